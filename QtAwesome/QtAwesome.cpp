@@ -9,14 +9,24 @@
 
 #include "QtAwesome.h"
 #include "QtAwesomeAnim.h"
+#include "QtAwesomeBadge.h"
+#include "QtAwesomeBundle.h"
 
 #include <QApplication>
 #include <QPalette>
 #include <QDebug>
+#include <QDir>
 #include <QFile>
 #include <QFontDatabase>
 #include <QFontMetrics>
+#include <QPixmapCache>
+#include <QRawFont>
+#include <QSaveFile>
 #include <QString>
+#include <QThread>
+
+#include <algorithm>
+#include <cstring>
 
 
 #if (QT_VERSION >= QT_VERSION_CHECK(6, 5, 0))
@@ -27,22 +37,120 @@
 // Initializing namespaces need to happen outside a namespace
 static void qtawesome_init_resources()
 {
+#ifndef QTAWESOME_NO_EMBEDDED_FONTS
 #ifdef FONT_AWESOME_PRO
     Q_INIT_RESOURCE(QtAwesomePro);
 #else
     Q_INIT_RESOURCE(QtAwesomeFree);
 #endif
+#endif
 }
 
 
-namespace fa {
-
+#ifdef QTAWESOME_ICON_SUBSET
+#include "QtAwesomeSubset/QtAwesomeStringGenerated.h"
+#else
 #include "QtAwesomeStringGenerated.h"
+#endif
+
+namespace fa {
 
 QtAwesomeIconPainter::~QtAwesomeIconPainter()
 {
 }
 
+/// The codepoint of a single glyph text (a character or a surrogate pair), -1 for other texts
+static int textCodePoint(const QString& text)
+{
+    if (text.size() == 1) return text.at(0).unicode();
+    if (text.size() == 2 && text.at(0).isHighSurrogate() && text.at(1).isLowSurrogate()) {
+        return static_cast<int>(QChar::surrogateToUcs4(text.at(0), text.at(1)));
+    }
+    return -1;
+}
+
+/// Memory-maps the given font file, so processes loading the same file share the pages via the page cache.
+/// QFontDatabase keeps on referring to the registered font data, so the mapping is kept for the lifetime
+/// of the process. When the file cannot be mapped, its content is read into memory instead.
+static QByteArray mapFontFile(const QString& path)
+{
+    static QHash<QString, QByteArray> mappedFonts;
+
+    QByteArray fontData = mappedFonts.value(path);
+    if (!fontData.isNull()) return fontData;
+
+    QFile* file = new QFile(path);
+    if (!file->open(QIODevice::ReadOnly)) {
+        delete file;
+        return QByteArray();
+    }
+
+    uchar* data = file->map(0, file->size());
+    if (data) {
+        // the file is intentionally never closed, closing it would unmap the data
+        fontData = QByteArray::fromRawData(reinterpret_cast<const char*>(data), static_cast<int>(file->size()));
+    } else {
+        fontData = file->readAll();
+        delete file;
+    }
+
+    mappedFonts.insert(path, fontData);
+    return fontData;
+}
+
+/// Returns the animation of the "anim" option, a QSharedPointer<QtAwesomeAnimation>, a QPointer<QtAwesomeAnimation>
+/// (see guardAnimationOption) or a QtAwesomeAnimation*
+/// @return the animation, nullptr when there is no animation or the animation has been deleted
+static QtAwesomeAnimation* animationOption(const QVariantMap& options)
+{
+    QVariant value = options.value("anim");
+    if (value.userType() == qMetaTypeId<QSharedPointer<QtAwesomeAnimation>>()) {
+        return value.value<QSharedPointer<QtAwesomeAnimation>>().data();
+    }
+    if (value.userType() == qMetaTypeId<QPointer<QtAwesomeAnimation>>()) {
+        return value.value<QPointer<QtAwesomeAnimation>>().data();
+    }
+    return value.value<QtAwesomeAnimation*>();
+}
+
+/// Replaces a QtAwesomeAnimation* in the "anim" option with a QPointer. Such an animation is owned by its widget,
+/// while the icon (e.g. on a QAction or in a model) may outlive the widget. The icon stops animating instead of
+/// using the deleted animation.
+static QVariantMap guardAnimationOption(const QVariantMap& options)
+{
+    QVariant value = options.value("anim");
+    if (value.userType() != qMetaTypeId<QtAwesomeAnimation*>()) return options;
+
+    QVariantMap result = options;
+    result.insert("anim", QVariant::fromValue(QPointer<QtAwesomeAnimation>(value.value<QtAwesomeAnimation*>())));
+    return result;
+}
+
+/// The QPixmapCache can only be used in the gui thread, animated icons change every frame
+static bool canUsePixmapCache(const QVariantMap& options)
+{
+    return qApp && QThread::currentThread() == qApp->thread() && !animationOption(options);
+}
+
+/// Returns the pixmap from the QPixmapCache, it's rendered with the paint function when it isn't cached
+/// @param paintFunction a function (QPainter* painter, const QRect& rect) painting the pixmap content
+template<typename PaintFunction>
+static QPixmap cachedPixmap(const QString& key, const QSize& size, qreal devicePixelRatio, PaintFunction paintFunction)
+{
+    QPixmap pixmap;
+    if (!QPixmapCache::find(key, &pixmap)) {
+        pixmap = QPixmap(size * devicePixelRatio);
+        pixmap.setDevicePixelRatio(devicePixelRatio);
+        pixmap.fill(Qt::transparent);
+        {
+            QPainter painter(&pixmap);
+            paintFunction(&painter, QRect(QPoint(0, 0), size));
+        }
+        QPixmapCache::insert(key, pixmap);
+    }
+    return pixmap;
+}
+
 /// The font-awesome icon painter
 class QtAwesomeCharIconPainter: public QtAwesomeIconPainter
 {
@@ -99,6 +207,31 @@ protected:
         return options.value(baseKey);
     }
 
+    /// Fills the outline of the icon from the bundle, centered in the rect like the text glyph
+    void paintOutline(const QtAwesomeBundle* bundle, QPainter* painter, const QRectF& rect, IconId id,
+                      const QColor& color, const QColor& duotoneColor, qreal scaleFactor)
+    {
+        qreal drawSize = qRound(rect.height() * scaleFactor);
+        qreal advance = bundle->advance(id, drawSize);
+        if (advance > rect.width()) {
+            drawSize *= rect.width() * 0.95 / advance;
+            advance = bundle->advance(id, drawSize);
+        }
+        QPointF origin(rect.center().x() - advance / 2, rect.center().y() - drawSize / 2);
+
+        painter->setPen(Qt::NoPen);
+        painter->fillPath(bundle->path(id, drawSize).translated(origin), color);
+
+#ifdef FONT_AWESOME_PRO
+        IconId secondaryId(id.style(), id.codePoint() | QtAwesome::DUOTONE_HEX_ICON_VALUE);
+        if (duotoneColor.isValid() && secondaryId != id && bundle->contains(secondaryId)) {
+            painter->fillPath(bundle->path(secondaryId, drawSize).translated(origin), duotoneColor);
+        }
+#else
+        Q_UNUSED(duotoneColor)
+#endif
+    }
+
 public:
 
     virtual void paint(QtAwesome* awesome, QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state,
@@ -111,8 +244,7 @@ public:
         painter->setRenderHint(QPainter::HighQualityAntialiasing);
 #endif
 
-        QVariant var =options.value("anim");
-        QtAwesomeAnimation* anim = var.value<QtAwesomeAnimation*>();
+        QtAwesomeAnimation* anim = animationOption(options);
         if (anim) {
             anim->setup(*painter, rect);
         }
@@ -127,6 +259,18 @@ public:
 
         painter->setPen(color);
         QRectF textRect(rect);
+
+        // icons in the loaded bundle are filled from their outline, the fonts aren't required
+        QSharedPointer<const QtAwesomeBundle> bundle = awesome->bundle();
+        int codePoint = textCodePoint(text);
+        if (bundle && codePoint >= 0 && bundle->contains(IconId(st, codePoint))) {
+            QColor dcolor = optionValueForModeAndState("duotone-color", mode, state, options).value<QColor>();
+            paintOutline(bundle.data(), painter, textRect, IconId(st, codePoint), color, dcolor,
+                         options.value("scale-factor").toDouble());
+            painter->restore();
+            return;
+        }
+
         int flags = Qt::AlignHCenter | Qt::AlignVCenter;
 
         // ajust font size depending on the rectangle
@@ -144,14 +288,12 @@ public:
         painter->drawText(textRect, flags, text);
 
 #ifdef FONT_AWESOME_PRO
-        if (st == fa::fa_duotone) {
+        if (st == fa::fa_duotone && codePoint >= 0) {
             QColor dcolor = optionValueForModeAndState("duotone-color", mode, state, options).value<QColor>();
-            int dcharacter = text.at(0).unicode() | QtAwesome::DUOTONE_HEX_ICON_VALUE;
+            int dcharacter = codePoint | QtAwesome::DUOTONE_HEX_ICON_VALUE;
 
             //Duotone is a 21-bits character, we need to use surrogate pairs
-            int high = ((dcharacter - 0x10000) >> 10) + 0xD800;
-            int low = (dcharacter & 0x3FF) + 0xDC00;
-            text = QString("%1%2").arg(QChar(high), QChar(low));
+            text = codePointToString(dcharacter);
 
             painter->setPen(dcolor);
             painter->drawText(textRect, Qt::AlignHCenter | Qt::AlignVCenter, text);
@@ -162,6 +304,369 @@ public:
     }
 };
 
+/// The stacked icon painter, paints the layers with the font-awesome icon painter
+/// The composite is rendered once per size, mode, state and options and kept in the QPixmapCache,
+/// so a stacked icon is as cheap to repaint as a single glyph.
+class QtAwesomeStackIconPainter : public QtAwesomeCharIconPainter
+{
+public:
+
+    virtual void paint(QtAwesome* awesome, QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state,
+                       const QVariantMap& options) override
+    {
+        QtAwesomeLayers layers = options.value("layers").value<QtAwesomeLayers>();
+        if (!canUsePixmapCache(options)) {
+            paintLayers(awesome, painter, rect, mode, state, options, layers);
+            return;
+        }
+
+        qreal devicePixelRatio = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+        QString key = cacheKey(rect.size(), devicePixelRatio, mode, state, options, layers);
+        painter->drawPixmap(rect.topLeft(), cachedPixmap(key, rect.size(), devicePixelRatio,
+                                                         [&](QPainter* pixmapPainter, const QRect& pixmapRect) {
+            paintLayers(awesome, pixmapPainter, pixmapRect, mode, state, options, layers);
+        }));
+    }
+
+private:
+
+    /// The cache key contains everything that changes the composite, including the resolved option colors
+    QString cacheKey(const QSize& size, qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state,
+                     const QVariantMap& options, const QtAwesomeLayers& layers)
+    {
+        QColor color = optionValueForModeAndState("color", mode, state, options).value<QColor>();
+        QColor duotoneColor = optionValueForModeAndState("duotone-color", mode, state, options).value<QColor>();
+
+        QString key = QString::asprintf("qtawesome-stack-%dx%d@%g-%d-%d-%08x-%08x-%g",
+                                        size.width(), size.height(), devicePixelRatio,
+                                        static_cast<int>(mode), static_cast<int>(state), color.rgba(),
+                                        duotoneColor.rgba(), options.value("scale-factor").toDouble());
+        for (const QtAwesomeLayer& layer : layers) {
+            key += QString::asprintf("|%08x-%d-%08x-%g-%g-%g-%g", layer.id.value(), layer.color.isValid() ? 1 : 0,
+                                     layer.color.rgba(), layer.scale, layer.offset.x(), layer.offset.y(), layer.rotation);
+        }
+        return key;
+    }
+
+    /// Paints the layers from bottom to top, each layer in its own (scaled, offset and rotated) rect
+    void paintLayers(QtAwesome* awesome, QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state,
+                     const QVariantMap& options, const QtAwesomeLayers& layers)
+    {
+        QVariantMap layerOptions = options;
+        for (const QtAwesomeLayer& layer : layers) {
+            if (!layer.id.isValid() || layer.scale <= 0) continue;
+
+            layerOptions.insert("text", codePointToString(layer.id.codePoint()));
+            layerOptions.insert("style", layer.id.style());
+            if (layer.color.isValid()) {
+                // disabled layers keep the color-disabled option
+                layerOptions.insert("color", layer.color);
+                layerOptions.insert("color-active", layer.color);
+                layerOptions.insert("color-selected", layer.color);
+            } else {
+                layerOptions.insert("color", options.value("color"));
+                layerOptions.insert("color-active", options.value("color-active"));
+                layerOptions.insert("color-selected", options.value("color-selected"));
+            }
+
+            QSizeF layerSize = QSizeF(rect.size()) * layer.scale;
+            QPointF center = QRectF(rect).center() + QPointF(layer.offset.x() * rect.width(), layer.offset.y() * rect.height());
+            QRectF layerRect(center - QPointF(layerSize.width() / 2, layerSize.height() / 2), layerSize);
+
+            painter->save();
+            if (!qFuzzyIsNull(layer.rotation)) {
+                painter->translate(center);
+                painter->rotate(layer.rotation);
+                painter->translate(-center);
+            }
+            QtAwesomeCharIconPainter::paint(awesome, painter, layerRect.toAlignedRect(), mode, state, layerOptions);
+            painter->restore();
+        }
+    }
+};
+
+/// The badged icon painter, paints the glyph from the QPixmapCache and the badge on top
+/// The glyph doesn't depend on the badge, so changing the badge only paints the badge again.
+class QtAwesomeBadgeIconPainter : public QtAwesomeCharIconPainter
+{
+public:
+
+    virtual void paint(QtAwesome* awesome, QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state,
+                       const QVariantMap& options) override
+    {
+        if (canUsePixmapCache(options)) {
+            qreal devicePixelRatio = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+            QColor color = optionValueForModeAndState("color", mode, state, options).value<QColor>();
+            QColor duotoneColor = optionValueForModeAndState("duotone-color", mode, state, options).value<QColor>();
+            QString text = optionValueForModeAndState("text", mode, state, options).toString();
+            int st = optionValueForModeAndState("style", mode, state, options).toInt();
+
+            QString key = QString::asprintf("qtawesome-glyph-%d-%dx%d@%g-%08x-%08x-%g-", st,
+                                            rect.width(), rect.height(), devicePixelRatio, color.rgba(), duotoneColor.rgba(),
+                                            options.value("scale-factor").toDouble()) + text;
+            painter->drawPixmap(rect.topLeft(), cachedPixmap(key, rect.size(), devicePixelRatio,
+                                                             [&](QPainter* pixmapPainter, const QRect& pixmapRect) {
+                QtAwesomeCharIconPainter::paint(awesome, pixmapPainter, pixmapRect, mode, state, options);
+            }));
+        } else {
+            QtAwesomeCharIconPainter::paint(awesome, painter, rect, mode, state, options);
+        }
+
+        QSharedPointer<QtAwesomeBadge> badge = options.value("badge").value<QSharedPointer<QtAwesomeBadge>>();
+        if (badge) {
+            badge->paint(painter, rect);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------------------
+// Allocation free name parsing, these helpers work on QChar (QString/QStringView) and char (latin1) data
+
+static inline ushort charCode(QChar c)
+{
+    return c.unicode();
+}
+
+static inline ushort charCode(char c)
+{
+    return static_cast<uchar>(c);
+}
+
+/// Compares the given characters to a \0 terminated latin1 name (like strcmp)
+template<typename Char>
+static int compareName(const Char* data, int size, const char* name)
+{
+    for (int i = 0; i < size; ++i) {
+        ushort c = charCode(data[i]);
+        ushort n = static_cast<uchar>(name[i]);
+        if (n == 0) return 1;
+        if (c != n) return c < n ? -1 : 1;
+    }
+    return name[size] == 0 ? 0 : -1;
+}
+
+/// Returns true if the characters start with the fa- prefix
+template<typename Char>
+static bool hasFaPrefix(const Char* data, int size)
+{
+    return size >= 3 && charCode(data[0]) == 'f' && charCode(data[1]) == 'a' && charCode(data[2]) == '-';
+}
+
+/// The FNV-1a hash of a style name, computed at compile time for the switch labels in styleFromName
+static constexpr quint32 styleNameHash(const char* str, quint32 hash = 2166136261u)
+{
+    return *str ? styleNameHash(str + 1, (hash ^ static_cast<uchar>(*str)) * 16777619u) : hash;
+}
+
+/// Resolves the style name (the fa- prefix is optional) via a switch on its hash
+/// @return the style, or fa_solid when the name isn't a known style
+template<typename Char>
+static int styleFromName(const Char* data, int size)
+{
+    if (hasFaPrefix(data, size)) {
+        data += 3;
+        size -= 3;
+    }
+
+    quint32 hash = 2166136261u;
+    for (int i = 0; i < size; ++i) {
+        hash = (hash ^ charCode(data[i])) * 16777619u;
+    }
+
+    const char* name = nullptr;
+    int style = fa::fa_solid;
+    switch (hash) {
+        case styleNameHash("solid"): name = "solid"; style = fa::fa_solid; break;
+        case styleNameHash("regular"): name = "regular"; style = fa::fa_regular; break;
+        case styleNameHash("brands"): name = "brands"; style = fa::fa_brands; break;
+#ifdef FONT_AWESOME_PRO
+        case styleNameHash("light"): name = "light"; style = fa::fa_light; break;
+        case styleNameHash("thin"): name = "thin"; style = fa::fa_thin; break;
+        case styleNameHash("duotone"): name = "duotone"; style = fa::fa_duotone; break; // DEPRECATED
+        case styleNameHash("duotone-solid"): name = "duotone-solid"; style = fa::fa_duotone_solid; break;
+        case styleNameHash("duotone-regular"): name = "duotone-regular"; style = fa::fa_duotone_regular; break;
+        case styleNameHash("duotone-light"): name = "duotone-light"; style = fa::fa_duotone_light; break;
+        case styleNameHash("duotone-thin"): name = "duotone-thin"; style = fa::fa_duotone_thin; break;
+        case styleNameHash("sharp-solid"): name = "sharp-solid"; style = fa::fa_sharp_solid; break;
+        case styleNameHash("sharp-regular"): name = "sharp-regular"; style = fa::fa_sharp_regular; break;
+        case styleNameHash("sharp-light"): name = "sharp-light"; style = fa::fa_sharp_light; break;
+        case styleNameHash("sharp-thin"): name = "sharp-thin"; style = fa::fa_sharp_thin; break;
+        case styleNameHash("sharp-duotone-solid"): name = "sharp-duotone-solid"; style = fa::fa_sharp_duotone_solid; break;
+        case styleNameHash("sharp-duotone-regular"): name = "sharp-duotone-regular"; style = fa::fa_sharp_duotone_regular; break;
+        case styleNameHash("sharp-duotone-light"): name = "sharp-duotone-light"; style = fa::fa_sharp_duotone_light; break;
+        case styleNameHash("sharp-duotone-thin"): name = "sharp-duotone-thin"; style = fa::fa_sharp_duotone_thin; break;
+#endif
+        default: break;
+    }
+
+    // guard against hash collisions
+    if (!name || compareName(data, size, name) != 0) return fa::fa_solid;
+    return style;
+}
+
+/// Splits an icon name like "fa-solid fa-house" in the style and the icon name (without the fa- prefix)
+/// The style is optional, and falls back to fa_solid
+/// @return the style
+template<typename Char>
+static int splitIconName(const Char* name, int size, const Char** iconName, int* iconNameSize)
+{
+    int spaceIndex = -1;
+    for (int i = 0; i < size && spaceIndex < 0; ++i) {
+        if (charCode(name[i]) == ' ') spaceIndex = i;
+    }
+
+    int style = fa::fa_solid;
+    *iconName = name;
+    *iconNameSize = size;
+
+    if (spaceIndex > 0) {
+        style = styleFromName(name, spaceIndex);
+        *iconName = name + spaceIndex + 1;
+        *iconNameSize = size - spaceIndex - 1;
+    }
+
+    if (hasFaPrefix(*iconName, *iconNameSize)) {
+        *iconName += 3;
+        *iconNameSize -= 3;
+    }
+    return style;
+}
+
+/// Looks up the codepoint of the given name with a binary search in the sorted name tables
+/// @return the codepoint, or -1 when the name isn't found
+template<typename Char>
+static int findCodePoint(const QVector<QtAwesomeNamedIconTable>& tables, const Char* data, int size)
+{
+    for (const QtAwesomeNamedIconTable& table : tables) {
+        int first = 0;
+        int last = table.size;
+        while (first < last) {
+            int middle = (first + last) / 2;
+            int cmp = compareName(data, size, table.names + table.icons[middle].nameOffset);
+            if (cmp == 0) return table.icons[middle].icon;
+            if (cmp < 0) {
+                last = middle;
+            } else {
+                first = middle + 1;
+            }
+        }
+    }
+    return -1;
+}
+
+static inline QString nameToString(const QChar* data, int size)
+{
+    return QString(data, size);
+}
+
+static inline QString nameToString(const char* data, int size)
+{
+    return QString::fromLatin1(data, size);
+}
+
+//---------------------------------------------------------------------------------------
+
+/// A trigram index over the names of a name table, used for searching icons
+class QtAwesomeSearchIndex
+{
+public:
+
+    /// A search result with its ranking
+    struct Match
+    {
+        int rank;         ///< 0 exact, 1 prefix, 2 word prefix, 3 substring
+        int length;       ///< the length of the name
+        const char* name;
+        int codePoint;
+    };
+
+    explicit QtAwesomeSearchIndex(const QtAwesomeNamedIconTable& table)
+        : table_(table)
+    {
+        // every entry is (trigram << 32 | name index), sorted so the names of a trigram can be found by a binary search
+        for (int i = 0; i < table_.size; ++i) {
+            const char* name = nameAt(i);
+            int length = static_cast<int>(qstrlen(name));
+            for (int j = 0; j + 3 <= length; ++j) {
+                entries_.append((static_cast<quint64>(trigram(name + j)) << 32) | static_cast<quint64>(i));
+            }
+        }
+        std::sort(entries_.begin(), entries_.end());
+        entries_.erase(std::unique(entries_.begin(), entries_.end()), entries_.end());
+    }
+
+    /// Appends the names containing the given (lowercase, latin1) query to the matches
+    void search(const QByteArray& query, QVector<Match>& matches) const
+    {
+        // short queries don't have a trigram, simply test all names
+        if (query.size() < 3) {
+            for (int i = 0; i < table_.size; ++i) {
+                match(i, query, matches);
+            }
+            return;
+        }
+
+        // the names containing the rarest trigram of the query are the candidates
+        const quint64* entriesEnd = entries_.constData() + entries_.size();
+        const quint64* first = nullptr;
+        const quint64* last = nullptr;
+        for (int j = 0; j + 3 <= query.size(); ++j) {
+            quint64 key = static_cast<quint64>(trigram(query.constData() + j)) << 32;
+            const quint64* lower = std::lower_bound(entries_.constData(), entriesEnd, key);
+            const quint64* upper = std::lower_bound(lower, entriesEnd, key + (Q_UINT64_C(1) << 32));
+            if (!first || upper - lower < last - first) {
+                first = lower;
+                last = upper;
+            }
+            if (first == last) return;
+        }
+
+        for (const quint64* itr = first; itr != last; ++itr) {
+            match(static_cast<int>(*itr & 0xffffffff), query, matches);
+        }
+    }
+
+private:
+
+    static quint32 trigram(const char* str)
+    {
+        return (static_cast<quint32>(static_cast<uchar>(str[0])) << 16)
+               | (static_cast<quint32>(static_cast<uchar>(str[1])) << 8)
+               | static_cast<quint32>(static_cast<uchar>(str[2]));
+    }
+
+    const char* nameAt(int index) const
+    {
+        return table_.names + table_.icons[index].nameOffset;
+    }
+
+    void match(int index, const QByteArray& query, QVector<Match>& matches) const
+    {
+        const char* name = nameAt(index);
+        const char* found = std::strstr(name, query.constData());
+        if (!found) return;
+
+        int length = static_cast<int>(qstrlen(name));
+        int rank = 3;
+        if (found == name) {
+            rank = length == query.size() ? 0 : 1;
+        } else {
+            for (const char* occurrence = found; occurrence; occurrence = std::strstr(occurrence + 1, query.constData())) {
+                if (occurrence[-1] == '-') {
+                    rank = 2;
+                    break;
+                }
+            }
+        }
+
+        Match result = { rank, length, name, table_.icons[index].icon };
+        matches.append(result);
+    }
+
+    QtAwesomeNamedIconTable table_;   ///< the indexed name table
+    QVector<quint64> entries_;        ///< the sorted (trigram, name index) entries
+};
+
 //---------------------------------------------------------------------------------------
 
 /// The painter icon engine.
@@ -241,13 +746,21 @@ const QString QtAwesome::FA_SOLID_FONT_FILENAME = "Font Awesome 6 Free-Solid-900
 /// The default icon colors
 QtAwesome::QtAwesome(QObject* parent)
     : QObject(parent)
-    , _namedCodepointsByStyle()
-    , _namedCodepointsList()
+    , _namedIconTablesByStyle()
+    , _namedCodePointsInitialized(false)
 {
 
     resetDefaultOptions();
 
+    qRegisterMetaType<IconId>();
+    qRegisterMetaType<QtAwesomeLayers>();
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    qRegisterMetaTypeStreamOperators<IconId>("fa::IconId");
+#endif
+
     _fontIconPainter = new QtAwesomeCharIconPainter();
+    _stackIconPainter = new QtAwesomeStackIconPainter();
+    _badgeIconPainter = new QtAwesomeBadgeIconPainter();
 
     _fontDetails.insert(fa::fa_brands, QtAwesomeFontData(FA_BRANDS_FONT_FILENAME, FA_BRANDS_FONT_WEIGHT));
     _fontDetails.insert(fa::fa_solid, QtAwesomeFontData(FA_SOLID_FONT_FILENAME, FA_SOLID_FONT_WEIGHT));
@@ -280,26 +793,32 @@ QtAwesome::QtAwesome(QObject* parent)
 }
 
 void QtAwesome::resetDefaultOptions(){
-    _defaultOptions.clear();
+    QVariantMap defaultOptions;
 
-    setDefaultOption("color", QApplication::palette().color(QPalette::Normal, QPalette::Text));
-    setDefaultOption("color-disabled", QApplication::palette().color(QPalette::Disabled, QPalette::Text));
-    setDefaultOption("color-active", QApplication::palette().color(QPalette::Active, QPalette::Text));
-    setDefaultOption("color-selected", QApplication::palette().color(QPalette::Active, QPalette::Text));  // TODO: check how to get the correct highlighted color
-    setDefaultOption("scale-factor", 1.0 );
+    defaultOptions.insert("color", QApplication::palette().color(QPalette::Normal, QPalette::Text));
+    defaultOptions.insert("color-disabled", QApplication::palette().color(QPalette::Disabled, QPalette::Text));
+    defaultOptions.insert("color-active", QApplication::palette().color(QPalette::Active, QPalette::Text));
+    defaultOptions.insert("color-selected", QApplication::palette().color(QPalette::Active, QPalette::Text));  // TODO: check how to get the correct highlighted color
+    defaultOptions.insert("scale-factor", 1.0 );
 
 
 #ifdef FONT_AWESOME_PRO
-    setDefaultOption("duotone-color", QApplication::palette().color(QPalette::Normal, QPalette::BrightText) );
-    setDefaultOption("duotone-color-disabled",
-                     QApplication::palette().color(QPalette::Disabled, QPalette::BrightText));
-    setDefaultOption("duotone-color-active", QApplication::palette().color(QPalette::Active, QPalette::BrightText));
-    setDefaultOption("duotone-color-selected", QApplication::palette().color(QPalette::Active, QPalette::BrightText));
+    defaultOptions.insert("duotone-color", QApplication::palette().color(QPalette::Normal, QPalette::BrightText) );
+    defaultOptions.insert("duotone-color-disabled",
+                          QApplication::palette().color(QPalette::Disabled, QPalette::BrightText));
+    defaultOptions.insert("duotone-color-active", QApplication::palette().color(QPalette::Active, QPalette::BrightText));
+    defaultOptions.insert("duotone-color-selected", QApplication::palette().color(QPalette::Active, QPalette::BrightText));
 #endif
-    setDefaultOption("text", QVariant());
-    setDefaultOption("text-disabled", QVariant());
-    setDefaultOption("text-active", QVariant());
-    setDefaultOption("text-selected", QVariant());
+    defaultOptions.insert("text", QVariant());
+    defaultOptions.insert("text-disabled", QVariant());
+    defaultOptions.insert("text-active", QVariant());
+    defaultOptions.insert("text-selected", QVariant());
+
+    // the options are replaced at once, image() may read them from another thread
+    {
+        QMutexLocker locker(&_defaultOptionsMutex);
+        _defaultOptions = defaultOptions;
+    }
 
     Q_EMIT defaultOptionsReset();
 }
@@ -307,8 +826,10 @@ void QtAwesome::resetDefaultOptions(){
 QtAwesome::~QtAwesome()
 {
     delete _fontIconPainter;
+    delete _stackIconPainter;
+    delete _badgeIconPainter;
     qDeleteAll(_painterMap);
-    qDeleteAll(_namedCodepointsList);
+    qDeleteAll(_searchIndexes);
 }
 
 /// a specialized init function so font-awesome is loaded and initialized
@@ -328,15 +849,22 @@ bool QtAwesome::initFontAwesome()
     for (QtAwesomeFontData &fd : _fontDetails) {
         // only load font-awesome once
         if (fd.fontId() < 0) {
-            // load the font file
-            QFile res(":/fonts/" + fd.fontFilename());
-            if (!res.open(QIODevice::ReadOnly)) {
+            // load the font file, from the font directory or from the resources
+            QByteArray fontData;
+            if (!fd.fontDirectory().isEmpty()) {
+                fontData = mapFontFile(QDir(fd.fontDirectory()).filePath(fd.fontFilename()));
+            } else {
+                QFile res(":/fonts/" + fd.fontFilename());
+                if (res.open(QIODevice::ReadOnly)) {
+                    fontData = res.readAll();
+                    res.close();
+                }
+            }
+            if (fontData.isEmpty()) {
                 qDebug() << "Font awesome font" << fd.fontFilename() << "could not be loaded!";
                 success = false;
                 continue;
             }
-            QByteArray fontData(res.readAll());
-            res.close();
 
             // fetch the given font
             fd.setFontId(QFontDatabase::addApplicationFontFromData(fontData));
@@ -352,61 +880,235 @@ bool QtAwesome::initFontAwesome()
         }
     }
 
+    initNamedCodePoints();
+
+    return success;
+}
+
+/// Registers the icon name tables of all styles
+/// The tables are built once: iconId() reads them from other threads (e.g. the QML image provider), so a later
+/// initFontAwesome or loadBundle must not modify them.
+void QtAwesome::initNamedCodePoints()
+{
+    if (_namedCodePointsInitialized) return;
+    _namedCodePointsInitialized = true;
+
     // intialize the brands icon map
-    addToNamedCodePoints(fa::fa_brands, faBrandsIconArray, sizeof(faBrandsIconArray)/sizeof(QtAwesomeNamedIcon));
-    addToNamedCodePoints(fa::fa_solid, faCommonIconArray, sizeof(faCommonIconArray)/sizeof(QtAwesomeNamedIcon));
+    addToNamedCodePoints(fa::fa_brands, faIconNames, faBrandsIconArray, faBrandsIconCount);
+    addToNamedCodePoints(fa::fa_solid, faIconNames, faCommonIconArray, faCommonIconCount);
 
     //initialize others code icons maps
 #ifdef FONT_AWESOME_PRO
-    addToNamedCodePoints(fa::fa_solid, faProIconArray, sizeof(faProIconArray)/sizeof(QtAwesomeNamedIcon));
-
-    _namedCodepointsByStyle.insert(fa::fa_regular, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_light, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_thin, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_duotone, _namedCodepointsByStyle.value(fa::fa_solid)); // DEPRECATED
-    _namedCodepointsByStyle.insert(fa::fa_duotone_solid, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_duotone_regular, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_duotone_light, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_duotone_thin, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_solid, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_regular, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_light, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_thin, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_duotone_solid, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_duotone_regular, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_duotone_light, _namedCodepointsByStyle.value(fa::fa_solid));
-    _namedCodepointsByStyle.insert(fa::fa_sharp_duotone_thin, _namedCodepointsByStyle.value(fa::fa_solid));
+    addToNamedCodePoints(fa::fa_solid, faIconNames, faProIconArray, faProIconCount);
+
+    _namedIconTablesByStyle.insert(fa::fa_regular, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_light, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_thin, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_duotone, _namedIconTablesByStyle.value(fa::fa_solid)); // DEPRECATED
+    _namedIconTablesByStyle.insert(fa::fa_duotone_solid, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_duotone_regular, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_duotone_light, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_duotone_thin, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_solid, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_regular, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_light, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_thin, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_duotone_solid, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_duotone_regular, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_duotone_light, _namedIconTablesByStyle.value(fa::fa_solid));
+    _namedIconTablesByStyle.insert(fa::fa_sharp_duotone_thin, _namedIconTablesByStyle.value(fa::fa_solid));
 #else
-    addToNamedCodePoints(fa::fa_regular, faRegularFreeIconArray, sizeof(faRegularFreeIconArray)/sizeof(QtAwesomeNamedIcon));
+    addToNamedCodePoints(fa::fa_regular, faIconNames, faRegularFreeIconArray, faRegularFreeIconCount);
 #endif
+}
 
-    return success;
+/// Initializes QtAwesome with a precompiled icon bundle instead of the fonts (see writeBundle)
+/// The bundle file is memory-mapped, no fonts are registered in the QFontDatabase. The icons in the bundle are
+/// painted from their outlines, other icons still require the fonts (initFontAwesome).
+///
+/// @return false when the file can't be read or isn't a valid bundle
+bool QtAwesome::loadBundle(const QString& fileName)
+{
+    QSharedPointer<QtAwesomeBundle> bundle(new QtAwesomeBundle());
+    if (!bundle->load(fileName)) {
+        qDebug() << "Icon bundle" << fileName << "could not be loaded!";
+        return false;
+    }
+
+    // a previous bundle is deleted when the last image() painting with it is done
+    {
+        QMutexLocker locker(&_bundleMutex);
+        _bundle = bundle;
+    }
+    initNamedCodePoints();
+    return true;
 }
 
-/// Add the given array as named codepoints
-void QtAwesome::addToNamedCodePoints(int style, const QtAwesomeNamedIcon *QtAwesomeNamedIcons, int size)
+/// The loaded icon bundle, a null pointer when no bundle is loaded
+/// The bundle stays valid while the returned pointer is held, even when another bundle is loaded.
+QSharedPointer<const QtAwesomeBundle> QtAwesome::bundle() const
 {
-    QHash<QString, int> *namedCodepoints = _namedCodepointsByStyle.value(style, nullptr);
-    if (namedCodepoints == nullptr) {
-        namedCodepoints = new QHash<QString, int>();
-        _namedCodepointsList.append(namedCodepoints);
-        _namedCodepointsByStyle.insert(style, namedCodepoints);
+    QMutexLocker locker(&_bundleMutex);
+    return _bundle;
+}
+
+/// Loads the font files of all styles from the given directory instead of from the embedded resources
+/// The directory layout should mirror the QtAwesome/fonts folder, e.g. pro fonts are located in a pro/ subfolder.
+/// The files are memory-mapped, this method must be called before initFontAwesome.
+///
+/// @param directory the filesystem directory containing the font files
+void QtAwesome::setFontDirectory(const QString& directory)
+{
+    for (QtAwesomeFontData &fd : _fontDetails) {
+        fd.setFontDirectory(directory);
     }
+}
 
-    for (int i = 0; i < size; ++i) {
-        namedCodepoints->insert(QtAwesomeNamedIcons[i].name, QtAwesomeNamedIcons[i].icon);
+/// Loads the font file of the given style from the given directory instead of from the embedded resources
+///
+/// @param style the style to load from the directory
+/// @param directory the filesystem directory containing the font file
+void QtAwesome::setFontDirectory(int style, const QString& directory)
+{
+    if (!_fontDetails.contains(style)) return;
+    _fontDetails[style].setFontDirectory(directory);
+}
+
+/// Add the given array as named codepoints
+/// The array must be sorted by name, the names are looked up with a binary search. The array isn't copied.
+/// The name offsets of the named icons refer to the given names string table
+void QtAwesome::addToNamedCodePoints(int style, const char* names, const QtAwesomeNamedIcon *QtAwesomeNamedIcons, int size)
+{
+    QVector<QtAwesomeNamedIconTable>& tables = _namedIconTablesByStyle[style];
+    for (const QtAwesomeNamedIconTable& table : tables) {
+        if (table.icons == QtAwesomeNamedIcons) return; // already added
     }
+
+    QtAwesomeNamedIconTable table = { names, QtAwesomeNamedIcons, size };
+    tables.append(table);
 }
 
+/// Returns all named codepoints of the given style
+/// This creates a new hash with all names, use namedCodePoint to lookup a single name.
 const QHash<QString, int> QtAwesome::namedCodePoints(int style) const
 {
-    if (!_namedCodepointsByStyle.contains(style)) return QHash<QString, int>();
-    return *_namedCodepointsByStyle[style];
+    QHash<QString, int> result;
+    for (const QtAwesomeNamedIconTable& table : _namedIconTablesByStyle.value(style)) {
+        for (int i = 0; i < table.size; ++i) {
+            result.insert(QLatin1String(table.names + table.icons[i].nameOffset), table.icons[i].icon);
+        }
+    }
+    return result;
+}
+
+/// Splits the name in a style and icon name and resolves the codepoint
+template<typename Char>
+IconId QtAwesome::iconIdFromName(const Char* name, int size) const
+{
+    const Char* iconName = name;
+    int iconNameSize = size;
+    int style = splitIconName(name, size, &iconName, &iconNameSize);
+
+    int codePoint = findNamedCodePoint(style, iconName, iconNameSize);
+    return codePoint >= 0 ? IconId(style, codePoint) : IconId();
+}
+
+/// Looks up the codepoint of a name (without the fa- prefix) in the name tables of the style
+/// @return the codepoint, or -1 when the name isn't found
+template<typename Char>
+int QtAwesome::findNamedCodePoint(int style, const Char* name, int size) const
+{
+    QHash<int, QVector<QtAwesomeNamedIconTable>>::const_iterator itr = _namedIconTablesByStyle.constFind(style);
+    if (itr == _namedIconTablesByStyle.constEnd()) return -1;
+
+    return findCodePoint(itr.value(), name, size);
+}
+
+/// Looks up the codepoint of the given icon name (without fa- prefix)
+/// The name is searched with a binary search in the sorted name tables of the style.
+///
+/// @param style the style of the icon
+/// @param name the name of the icon, e.g. "address-book"
+/// @return the codepoint, or -1 when the name isn't found
+int QtAwesome::namedCodePoint(int style, const QString& name) const
+{
+    return findNamedCodePoint(style, name.constData(), static_cast<int>(name.size()));
+}
+
+/// Resolves an icon name, like "fa-solid fa-house", to an IconId (see icon(const QString&, const QVariantMap&))
+/// This makes it possible to store the icon in a model or settings instead of the name
+/// @return the IconId, or an invalid IconId when the name isn't a named codepoint
+IconId QtAwesome::iconId(QStringView name) const
+{
+    return iconIdFromName(name.data(), static_cast<int>(name.size()));
+}
+
+/// Resolves a latin1 icon name to an IconId, see iconId(QStringView)
+IconId QtAwesome::iconId(QLatin1String name) const
+{
+    return iconIdFromName(name.data(), static_cast<int>(name.size()));
+}
+
+/// Returns a view on the named codepoints of the given style, without copying the names
+/// The view is valid as long as this QtAwesome object is
+///
+/// @param style the style of the icons
+/// @param sortedByName iterate the names in sorted order (the name tables are merged while iterating)
+QtAwesomeNamedCodePoints QtAwesome::namedCodePointsView(int style, bool sortedByName) const
+{
+    return QtAwesomeNamedCodePoints(_namedIconTablesByStyle.value(style), sortedByName);
+}
+
+/// Searches the named icons of the given style, e.g. "arr" or "arrow up"
+/// Exact matches are ranked first, followed by prefix, word prefix and substring matches. Shorter names rank higher.
+/// The search index of the name tables is built at the first search. search() is thread-safe, like iconId().
+///
+/// @param style the style of the icons to search
+/// @param query the (partial) name to search for, the fa- prefix is optional and spaces are matched as dashes
+/// @param limit the maximum number of results
+/// @return the matching named codepoints, best match first
+QVector<QtAwesomeNamedCodePoint> QtAwesome::search(int style, const QString& query, int limit) const
+{
+    QVector<QtAwesomeNamedCodePoint> result;
+
+    QByteArray term = query.simplified().toLower().toLatin1();
+    term.replace(' ', '-');
+    if (term.startsWith("fa-")) term = term.mid(3);
+    if (term.isEmpty() || limit <= 0) return result;
+
+    QVector<QtAwesomeSearchIndex::Match> matches;
+    for (const QtAwesomeNamedIconTable& table : _namedIconTablesByStyle.value(style)) {
+        QtAwesomeSearchIndex* index;
+        {
+            // an index isn't changed after it's built, only the lookup and creation are locked
+            QMutexLocker locker(&_searchIndexesMutex);
+            index = _searchIndexes.value(table.icons, nullptr);
+            if (!index) {
+                index = new QtAwesomeSearchIndex(table);
+                _searchIndexes.insert(table.icons, index);
+            }
+        }
+        index->search(term, matches);
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const QtAwesomeSearchIndex::Match& a, const QtAwesomeSearchIndex::Match& b) {
+        if (a.rank != b.rank) return a.rank < b.rank;
+        if (a.length != b.length) return a.length < b.length;
+        return qstrcmp(a.name, b.name) < 0;
+    });
+
+    result.reserve(qMin(limit, static_cast<int>(matches.size())));
+    for (int i = 0; i < matches.size() && i < limit; ++i) {
+        QtAwesomeNamedCodePoint namedCodePoint = { QLatin1String(matches.at(i).name), matches.at(i).codePoint };
+        result.append(namedCodePoint);
+    }
+    return result;
 }
 
 /// Sets a default option. These options are passed on to the icon painters
 void QtAwesome::setDefaultOption(const QString& name, const QVariant& value)
 {
+    QMutexLocker locker(&_defaultOptionsMutex);
     _defaultOptions.insert( name, value );
 }
 
@@ -414,6 +1116,7 @@ void QtAwesome::setDefaultOption(const QString& name, const QVariant& value)
 /// Returns the default option for the given name
 QVariant QtAwesome::defaultOption(const QString& name)
 {
+    QMutexLocker locker(&_defaultOptionsMutex);
     return _defaultOptions.value( name );
 }
 
@@ -439,12 +1142,50 @@ QIcon QtAwesome::icon(int style, int character, const QVariantMap &options)
 {
     // create a merged QVariantMap to have default options and icon-specific options
     QVariantMap optionMap = mergeOptions(_defaultOptions, options);
-    optionMap.insert("text", QString( QChar(character)) );
+    optionMap.insert("text", codePointToString(character));
     optionMap.insert("style", style);
 
     return icon( _fontIconPainter, optionMap );
 }
 
+/// Creates an icon for the given IconId, the same as icon(id.style(), id.codePoint(), options)
+QIcon QtAwesome::icon(IconId id, const QVariantMap& options)
+{
+    return icon(id.style(), id.codePoint(), options);
+}
+
+/// Renders the icon with the given code-point for given style to an image
+/// Unlike icon(), this method may be called from any thread (e.g. to render icons on a worker thread).
+/// Custom painters and animations are not supported, the "anim" option is ignored.
+///
+/// @param size the size of the image in pixels
+QImage QtAwesome::image(int style, int character, const QSize& size, const QVariantMap& options,
+                        QIcon::Mode mode, QIcon::State state)
+{
+    QVariantMap optionMap;
+    {
+        QMutexLocker locker(&_defaultOptionsMutex);
+        optionMap = mergeOptions(_defaultOptions, options);
+    }
+    optionMap.remove("anim");
+    optionMap.insert("text", codePointToString(character));
+    optionMap.insert("style", style);
+
+    QImage result(size, QImage::Format_ARGB32_Premultiplied);
+    result.fill(Qt::transparent);
+    if (!result.isNull()) {
+        QPainter painter(&result);
+        _fontIconPainter->paint(this, &painter, QRect(QPoint(0, 0), size), mode, state, optionMap);
+    }
+    return result;
+}
+
+/// Renders the icon to an image, see image(int, int, const QSize&, const QVariantMap&, QIcon::Mode, QIcon::State)
+QImage QtAwesome::image(IconId id, const QSize& size, const QVariantMap& options, QIcon::Mode mode, QIcon::State state)
+{
+    return image(id.style(), id.codePoint(), size, options, mode, state);
+}
+
 /// Creates an icon with the given name
 ///
 /// You can use the icon names as defined on https://fontawesome.com/cheatsheet/free and
@@ -455,36 +1196,52 @@ QIcon QtAwesome::icon(int style, int character, const QVariantMap &options)
 /// @param options extra option to pass to the icon renderer
 QIcon QtAwesome::icon(const QString& name, const QVariantMap& options)
 {
-    // split the string in a style and icon name (and skip the fa- prefix if given)
-    int spaceIndex = name.indexOf(' ');
-    int style = fa::fa_solid;
-    QString iconName;
+    return iconFromName(name.constData(), static_cast<int>(name.size()), options);
+}
 
-    if( spaceIndex > 0) {
-        QString styleName = name.left(spaceIndex);
-        style = stringToStyleEnum(styleName.startsWith("fa-") ? styleName : "fa-" + styleName);
-        iconName = name.mid(spaceIndex + 1);
-    } else {
-        iconName = name;
-    }
+/// Creates an icon with the given name, see icon(const QString&, const QVariantMap&)
+/// The name is parsed without allocating memory
+QIcon QtAwesome::icon(QStringView name, const QVariantMap& options)
+{
+    return iconFromName(name.data(), static_cast<int>(name.size()), options);
+}
 
-    if( iconName.startsWith("fa-")) {
-        iconName = iconName.mid(3);
-    }
+/// Creates an icon with the given latin1 name, see icon(const QString&, const QVariantMap&)
+QIcon QtAwesome::icon(QLatin1String name, const QVariantMap& options)
+{
+    return iconFromName(name.data(), static_cast<int>(name.size()), options);
+}
+
+/// Creates an icon with the given name, see icon(const QString&, const QVariantMap&)
+/// @param name a latin1 encoded, \0 terminated name, e.g. "fa-solid fa-address-book"
+QIcon QtAwesome::icon(const char* name, const QVariantMap& options)
+{
+    return icon(QLatin1String(name), options);
+}
+
+/// Splits the name in a style and icon name and creates the icon
+/// (The name tokens are compared in place, no strings are created for named icons)
+template<typename Char>
+QIcon QtAwesome::iconFromName(const Char* name, int size, const QVariantMap& options)
+{
+    const Char* iconName = name;
+    int iconNameSize = size;
+    int style = splitIconName(name, size, &iconName, &iconNameSize);
 
     // when it's a named codepoint
-    if (_namedCodepointsByStyle.contains(style) && _namedCodepointsByStyle[style]->contains(iconName)) {
-        return icon(style, _namedCodepointsByStyle[style]->value(iconName), options);
+    int codePoint = findNamedCodePoint(style, iconName, iconNameSize);
+    if (codePoint >= 0) {
+        return icon(style, codePoint, options);
     }
 
+    // this method first tries to retrieve the icon via the painter map
+    QtAwesomeIconPainter* painter = _painterMap.value(nameToString(name, size));
+    if (!painter) return QIcon();
+
     // create a merged QVariantMap to have default options and icon-specific options
     QVariantMap optionMap = mergeOptions(_defaultOptions, options);
     optionMap.insert("style", style);
 
-    // this method first tries to retrieve the icon via the painter map
-    QtAwesomeIconPainter* painter = _painterMap.value(name);
-    if (!painter) return QIcon();
-
     return icon(painter, optionMap);
 }
 
@@ -497,10 +1254,44 @@ QIcon QtAwesome::icon(QtAwesomeIconPainter* painter, const QVariantMap& optionMa
     // Warning, when you use memoryleak detection. You should turn it off for the next call
     // QIcon's placed in gui items are often cached and not deleted when my memory-leak detection checks for leaks.
     // I'm not sure if it's a Qt bug or something I do wrong
-    QtAwesomeIconPainterIconEngine* engine = new QtAwesomeIconPainterIconEngine(this, painter, optionMap);
+    QtAwesomeIconPainterIconEngine* engine = new QtAwesomeIconPainterIconEngine(this, painter, guardAnimationOption(optionMap));
     return QIcon(engine);
 }
 
+/// Creates a stacked icon, the layers are painted on top of each other (like fa-stack and fa-layers)
+/// The composite is rendered once per size and kept in the QPixmapCache.
+///
+///     fa::QtAwesomeLayers layers;
+///     layers << fa::QtAwesomeLayer(fa::IconId(fa::fa_solid, fa::fa_camera), QColor(), 0.6)
+///            << fa::QtAwesomeLayer(fa::IconId(fa::fa_solid, fa::fa_ban), Qt::red);
+///     QIcon icon = awesome->stackedIcon(layers);
+///
+/// @param layers the layers, from bottom to top
+/// @param options the icon options, the same as for icon(). A layer color replaces the color options of the layer,
+///                except color-disabled
+QIcon QtAwesome::stackedIcon(const QtAwesomeLayers& layers, const QVariantMap& options)
+{
+    QVariantMap optionMap = mergeOptions(_defaultOptions, options);
+    optionMap.insert("layers", QVariant::fromValue(layers));
+
+    return icon(_stackIconPainter, optionMap);
+}
+
+/// Creates an icon with a badge overlay, e.g. an unread count
+/// The badge is shared with the icon: after changing the badge, repaint the icon instead of creating a new one.
+/// The glyph is kept in the QPixmapCache, only the badge is painted again.
+///
+/// @param badge the badge, a null pointer paints the icon without badge
+QIcon QtAwesome::badgedIcon(IconId id, const QSharedPointer<QtAwesomeBadge>& badge, const QVariantMap& options)
+{
+    QVariantMap optionMap = mergeOptions(_defaultOptions, options);
+    optionMap.insert("text", codePointToString(id.codePoint()));
+    optionMap.insert("style", id.style());
+    optionMap.insert("badge", QVariant::fromValue(badge));
+
+    return icon(_badgeIconPainter, optionMap);
+}
+
 /// Adds a named icon-painter to the QtAwesome icon map
 /// As the name applies the ownership is passed over to QtAwesome
 ///
@@ -539,29 +1330,154 @@ QString QtAwesome::fontName(int style) const
     return _fontDetails[style].fontFamily();
 }
 
-int QtAwesome::stringToStyleEnum(const QString style) const
+/// Extracts the outline of a glyph from the raw font
+/// The path origin is the top-left of the em box (the baseline is at the ascent)
+/// @return false when the font doesn't contain the glyph
+static bool rawGlyphPath(const QRawFont& rawFont, int codePoint, QPainterPath* path, qreal* advance)
+{
+    QVector<quint32> glyphIndexes = rawFont.glyphIndexesForString(codePointToString(codePoint));
+    if (glyphIndexes.size() != 1 || glyphIndexes.first() == 0) return false;
+
+    *path = rawFont.pathForGlyph(glyphIndexes.first());
+    path->translate(0, rawFont.ascent());
+
+    QVector<QPointF> advances = rawFont.advancesForGlyphIndexes(glyphIndexes);
+    *advance = advances.isEmpty() ? rawFont.unitsPerEm() : advances.first().x();
+    return true;
+}
+
+/// Loads the raw font data of the style
+/// @param size the pixel size, 0 for the font units (the em size of font awesome is 512)
+static QRawFont rawFontForStyle(const QtAwesome* awesome, int style, qreal size)
+{
+    QRawFont rawFont = QRawFont::fromFont(awesome->font(style, 64));
+    if (rawFont.isValid()) {
+        rawFont.setPixelSize(size > 0 ? size : rawFont.unitsPerEm());
+    }
+    return rawFont;
+}
+
+/// Converts the path to SVG path data
+static QByteArray svgPathData(const QPainterPath& path)
+{
+    QByteArray result;
+    for (int i = 0; i < path.elementCount(); ++i) {
+        QPainterPath::Element element = path.elementAt(i);
+        switch (element.type) {
+            case QPainterPath::MoveToElement: result += i > 0 ? "ZM" : "M"; break;
+            case QPainterPath::LineToElement: result += 'L'; break;
+            case QPainterPath::CurveToElement: result += 'C'; break;
+            case QPainterPath::CurveToDataElement: result += ' '; break;
+        }
+        result += QByteArray::number(element.x, 'g', 6) + ' ' + QByteArray::number(element.y, 'g', 6);
+    }
+    if (!result.isEmpty()) result += 'Z';
+    return result;
+}
+
+/// Returns the outline of the glyph, extracted from the loaded font data
+/// The origin is the top-left of the em box, a glyph is size high and (at most) size wide.
+/// The path can be used to draw or print the icon as a vector (e.g. in a PDF) instead of rasterizing it.
+///
+/// @param size the em size of the path, 0 for the font units (512 for font awesome)
+/// @return the path, empty when the font doesn't contain the glyph
+QPainterPath QtAwesome::glyphPath(int style, int codePoint, qreal size) const
+{
+    QPainterPath path;
+    qreal advance = 0;
+    rawGlyphPath(rawFontForStyle(this, style, size), codePoint, &path, &advance);
+    return path;
+}
+
+/// Returns the glyph as SVG document, in font units (the viewBox is the advance width x em size)
+/// The secondary glyph of a duotone icon is added as a second path with 40% opacity.
+///
+/// @param color the fill color, when invalid no fill is given (the SVG default is black)
+/// @return the SVG document, empty when the font doesn't contain the glyph
+QByteArray QtAwesome::glyphSvg(int style, int codePoint, const QColor& color) const
 {
-    if (style == "fa-solid") return fa::fa_solid;
-    else if (style == "fa-regular") return fa::fa_regular;
-    else if (style == "fa-brands") return fa::fa_brands;
+    QRawFont rawFont = rawFontForStyle(this, style, 0);
+
+    QPainterPath path;
+    qreal advance = 0;
+    if (!rawGlyphPath(rawFont, codePoint, &path, &advance)) return QByteArray();
+
+    QByteArray fill;
+    if (color.isValid()) {
+        fill = " fill=\"" + color.name().toLatin1() + "\"";
+        if (color.alpha() != 255) fill += " fill-opacity=\"" + QByteArray::number(color.alphaF(), 'g', 3) + "\"";
+    }
+    QByteArray fillRule = path.fillRule() == Qt::WindingFill ? "nonzero" : "evenodd";
+
+    QByteArray result = "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"0 0 "
+                        + QByteArray::number(qRound(advance)) + ' ' + QByteArray::number(qRound(rawFont.unitsPerEm()))
+                        + "\">";
+
 #ifdef FONT_AWESOME_PRO
-    else if (style == "fa-light") return fa::fa_light;
-    else if (style == "fa-thin") return fa::fa_thin;
-    else if (style == "fa-duotone") return fa::fa_duotone; // DEPRECATED
-    else if (style == "fa-duotone-solid") return fa::fa_duotone_solid;
-    else if (style == "fa-duotone-regular") return fa::fa_duotone_regular;
-    else if (style == "fa-duotone-light") return fa::fa_duotone_light;
-    else if (style == "fa-duotone-thin") return fa::fa_duotone_thin;
-    else if (style == "fa-sharp-solid") return fa::fa_sharp_solid;
-    else if (style == "fa-sharp-regular") return fa::fa_sharp_regular;
-    else if (style == "fa-sharp-light") return fa::fa_sharp_light;
-    else if (style == "fa-sharp-thin") return fa::fa_sharp_thin;
-    else if (style == "fa-sharp-duotone-solid") return fa::fa_sharp_duotone_solid;
-    else if (style == "fa-sharp-duotone-regular") return fa::fa_sharp_duotone_regular;
-    else if (style == "fa-sharp-duotone-light") return fa::fa_sharp_duotone_light;
-    else if (style == "fa-sharp-duotone-thin") return fa::fa_sharp_duotone_thin;
+    QPainterPath secondaryPath;
+    qreal secondaryAdvance = 0;
+    if (!(codePoint & DUOTONE_HEX_ICON_VALUE)
+            && rawGlyphPath(rawFont, codePoint | DUOTONE_HEX_ICON_VALUE, &secondaryPath, &secondaryAdvance)) {
+        result += "<path" + fill + " opacity=\".4\" fill-rule=\"" + fillRule + "\" d=\"" + svgPathData(secondaryPath) + "\"/>";
+    }
 #endif
-    return fa::fa_solid;
+
+    result += "<path" + fill + " fill-rule=\"" + fillRule + "\" d=\"" + svgPathData(path) + "\"/></svg>\n";
+    return result;
+}
+
+/// Writes an SVG file for every named icon of the style to the directory, the files are named <name>.svg
+/// @return the number of files written, or -1 when a file can't be written
+int QtAwesome::exportSvgs(int style, const QString& directory, const QColor& color) const
+{
+    QDir dir(directory);
+    if (!dir.exists() && !dir.mkpath(".")) return -1;
+
+    int count = 0;
+    for (const QtAwesomeNamedCodePoint& namedCodePoint : namedCodePointsView(style)) {
+        QByteArray svg = glyphSvg(style, namedCodePoint.codePoint, color);
+        if (svg.isEmpty()) continue;
+
+        QSaveFile file(dir.filePath(QString(namedCodePoint.name) + ".svg"));
+        if (!file.open(QIODevice::WriteOnly) || file.write(svg) != svg.size() || !file.commit()) return -1;
+        ++count;
+    }
+    return count;
+}
+
+/// Writes a precompiled icon bundle with the outlines of the given icons (see loadBundle)
+/// The secondary glyphs of duotone icons are added as well. The fonts must be loaded (initFontAwesome).
+///
+/// @return false when an icon isn't found in the fonts or the file can't be written
+bool QtAwesome::writeBundle(const QString& fileName, const QVector<IconId>& icons) const
+{
+    QHash<int, QRawFont> rawFonts;
+    QtAwesomeBundleWriter writer;
+    for (IconId id : icons) {
+        if (!rawFonts.contains(id.style())) rawFonts.insert(id.style(), rawFontForStyle(this, id.style(), 0));
+        const QRawFont& rawFont = rawFonts[id.style()];
+
+        QPainterPath path;
+        qreal advance = 0;
+        if (!rawGlyphPath(rawFont, id.codePoint(), &path, &advance)
+                || !writer.addIcon(id, path, advance, qRound(rawFont.unitsPerEm()))) {
+            qDebug() << "Icon" << id.style() << id.codePoint() << "can't be added to the bundle";
+            return false;
+        }
+
+#ifdef FONT_AWESOME_PRO
+        int secondaryCodePoint = id.codePoint() | DUOTONE_HEX_ICON_VALUE;
+        if (secondaryCodePoint != id.codePoint() && rawGlyphPath(rawFont, secondaryCodePoint, &path, &advance)) {
+            writer.addIcon(IconId(id.style(), secondaryCodePoint), path, advance, qRound(rawFont.unitsPerEm()));
+        }
+#endif
+    }
+    return writer.save(fileName);
+}
+
+int QtAwesome::stringToStyleEnum(const QString style) const
+{
+    return styleFromName(style.constData(), static_cast<int>(style.size()));
 }
 
 const QString QtAwesome::styleEnumToString(int style) const
@@ -593,9 +1509,86 @@ const QString QtAwesome::styleEnumToString(int style) const
 
 //---------------------------------------------------------------------------------------
 
+QtAwesomeNamedCodePoint QtAwesomeNamedCodePoints::const_iterator::operator*() const
+{
+    const QtAwesomeNamedIcon& namedIcon = _view->_tables.at(_table).icons[_index];
+    QtAwesomeNamedCodePoint result = { QLatin1String(_view->nameAt(_table, _index)), namedIcon.icon };
+    return result;
+}
+
+QtAwesomeNamedCodePoints::const_iterator& QtAwesomeNamedCodePoints::const_iterator::operator++()
+{
+    if (_view->_sortedByName) {
+        *this = _view->firstAfter(_view->nameAt(_table, _index));
+        return *this;
+    }
+
+    // table order: next entry, skipping empty tables
+    ++_index;
+    while (_table < _view->_tables.size() && _index >= _view->_tables.at(_table).size) {
+        ++_table;
+        _index = 0;
+    }
+    return *this;
+}
+
+QtAwesomeNamedCodePoints::const_iterator QtAwesomeNamedCodePoints::begin() const
+{
+    if (_sortedByName) return firstAfter(nullptr);
+
+    int table = 0;
+    while (table < _tables.size() && _tables.at(table).size == 0) ++table;
+    return const_iterator(this, table, 0);
+}
+
+/// The number of named codepoints in the view
+int QtAwesomeNamedCodePoints::size() const
+{
+    int result = 0;
+    for (const QtAwesomeNamedIconTable& table : _tables) {
+        result += table.size;
+    }
+    return result;
+}
+
+const char* QtAwesomeNamedCodePoints::nameAt(int table, int index) const
+{
+    const QtAwesomeNamedIconTable& namedIconTable = _tables.at(table);
+    return namedIconTable.names + namedIconTable.icons[index].nameOffset;
+}
+
+/// Returns the first entry with a name after the given name over all tables (nullptr returns the first entry)
+/// Every table is sorted, so this is a binary search per table.
+QtAwesomeNamedCodePoints::const_iterator QtAwesomeNamedCodePoints::firstAfter(const char* name) const
+{
+    const_iterator result = end();
+    const char* resultName = nullptr;
+
+    for (int table = 0; table < _tables.size(); ++table) {
+        int first = 0;
+        int last = _tables.at(table).size;
+        while (name && first < last) {
+            int middle = (first + last) / 2;
+            if (qstrcmp(nameAt(table, middle), name) <= 0) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+        if (first < _tables.at(table).size && (!resultName || qstrcmp(nameAt(table, first), resultName) < 0)) {
+            result = const_iterator(this, table, first);
+            resultName = nameAt(table, first);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------------------
+
 QtAwesomeFontData::QtAwesomeFontData(const QString& fontFileName, QFont::Weight fontWeight)
     : _fontFamily(QString()),
     _fontFilename(fontFileName),
+    _fontDirectory(QString()),
     _fontId(-1),
     _fontWeight(fontWeight)
 {
@@ -617,6 +1610,17 @@ const QString& QtAwesomeFontData::fontFilename() const
     return _fontFilename;
 }
 
+/// Returns the directory the font file is loaded from. An empty directory means the embedded resources are used.
+const QString& QtAwesomeFontData::fontDirectory() const
+{
+    return _fontDirectory;
+}
+
+void QtAwesomeFontData::setFontDirectory(const QString &directory)
+{
+    _fontDirectory = directory;
+}
+
 int QtAwesomeFontData::fontId() const
 {
     return _fontId;
@@ -10,13 +10,24 @@
 #ifndef QTAWESOME_H
 #define QTAWESOME_H
 
+#include <QColor>
 #include <QIcon>
 #include <QIconEngine>
+#include <QImage>
+#include <QMutex>
 #include <QPainter>
+#include <QPainterPath>
+#include <QPointF>
 #include <QRect>
+#include <QSharedPointer>
+#include <QStringView>
 #include <QVariantMap>
+#include <QVector>
+
+#include <iterator>
 
 #include "QtAwesomeAnim.h"
+#include "QtAwesomeIconId.h"
 
 /// A list of all icon-names with the codepoint (unicode-value) on the right
 /// You can use the names on the page  http://fortawesome.github.io/Font-Awesome/design.html
@@ -52,12 +63,96 @@ enum fa_styles {
 };
 
 
+/// A named icon, the name is stored as offset in a string table with \0 terminated names
+/// (QtAwesomeStringGenerated.h contains a single string table, so no relocations are required for the names)
 struct QtAwesomeNamedIcon {
-    const char *name;
+    quint32 nameOffset;
     ushort icon;
 };
 
+/// A table of named icons sorted by name, with the string table containing the names
+struct QtAwesomeNamedIconTable {
+    const char* names;
+    const QtAwesomeNamedIcon* icons;
+    int size;
+};
+
+/// A named codepoint, the name refers to the static name tables (no copy is made)
+struct QtAwesomeNamedCodePoint {
+    QLatin1String name;
+    int codePoint;
+};
+
+/// A lightweight view on the named codepoints of a style. It doesn't copy or allocate anything.
+/// Iteration is in table order, or sorted by name when requested (the tables are merged while iterating)
+class QtAwesomeNamedCodePoints
+{
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef QtAwesomeNamedCodePoint value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const QtAwesomeNamedCodePoint* pointer;
+        typedef QtAwesomeNamedCodePoint reference;
+
+        const_iterator() : _view(nullptr), _table(0), _index(0) {}
+
+        QtAwesomeNamedCodePoint operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int) { const_iterator result = *this; ++*this; return result; }
+        bool operator==(const const_iterator& other) const { return _table == other._table && _index == other._index; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class QtAwesomeNamedCodePoints;
+        const_iterator(const QtAwesomeNamedCodePoints* view, int table, int index)
+            : _view(view), _table(table), _index(index) {}
+
+        const QtAwesomeNamedCodePoints* _view;
+        int _table;
+        int _index;
+    };
+
+    QtAwesomeNamedCodePoints() : _sortedByName(false) {}
+    QtAwesomeNamedCodePoints(const QVector<QtAwesomeNamedIconTable>& tables, bool sortedByName)
+        : _tables(tables), _sortedByName(sortedByName) {}
+
+    const_iterator begin() const;
+    const_iterator end() const { return const_iterator(this, _tables.size(), 0); }
+    int size() const;
+    bool isEmpty() const { return size() == 0; }
+
+private:
+    const char* nameAt(int table, int index) const;
+    const_iterator firstAfter(const char* name) const;
+
+    QVector<QtAwesomeNamedIconTable> _tables;   ///< the tables of the style (implicitly shared)
+    bool _sortedByName;                         ///< iterate sorted by name
+};
+
+/// A layer of a stacked icon (see QtAwesome::stackedIcon)
+struct QtAwesomeLayer
+{
+    IconId id;          ///< the glyph of the layer
+    QColor color;       ///< the color, when invalid the color option of the icon is used
+    qreal scale;        ///< the size of the layer relative to the icon size
+    QPointF offset;     ///< the offset relative to the icon size, e.g. (0.25, -0.25) moves the layer to the top-right
+    qreal rotation;     ///< the clockwise rotation in degrees
+
+    QtAwesomeLayer(IconId id = IconId(), const QColor& color = QColor(), qreal scale = 1.0,
+                   const QPointF& offset = QPointF(), qreal rotation = 0)
+        : id(id), color(color), scale(scale), offset(offset), rotation(rotation) {}
+};
+
+/// The layers of a stacked icon, from bottom to top
+typedef QVector<QtAwesomeLayer> QtAwesomeLayers;
+
+class QtAwesomeBadge;
+class QtAwesomeBundle;
 class QtAwesomeIconPainter;
+class QtAwesomeSearchIndex;
 
 
 class QtAwesomeFontData
@@ -68,6 +163,8 @@ public:
     const QString& fontFamily() const;
     void setFontFamily(const QString &family);
     const QString& fontFilename() const;
+    const QString& fontDirectory() const;
+    void setFontDirectory(const QString &directory);
     int fontId() const;
     void setFontId(int id);
     QFont::Weight fontWeight() const;
@@ -76,6 +173,7 @@ public:
 private:
     QString _fontFamily;
     QString _fontFilename;
+    QString _fontDirectory;
     int _fontId;
     QFont::Weight _fontWeight;
 };
@@ -144,14 +242,45 @@ public:
 
     virtual bool initFontAwesome();
 
+    void setFontDirectory(const QString& directory);
+    void setFontDirectory(int style, const QString& directory);
+
+    bool loadBundle(const QString& fileName);
+    QSharedPointer<const QtAwesomeBundle> bundle() const;
+
     virtual const QHash<QString, int> namedCodePoints(int style) const;
+    int namedCodePoint(int style, const QString& name) const;
+    IconId iconId(QStringView name) const;
+    IconId iconId(QLatin1String name) const;
+    QtAwesomeNamedCodePoints namedCodePointsView(int style, bool sortedByName = false) const;
+    QVector<QtAwesomeNamedCodePoint> search(int style, const QString& query, int limit = 50) const;
+
+    /// Calls the visitor with (QLatin1String name, int codePoint) for every named codepoint of the style
+    template<typename Visitor>
+    void forEachNamedCodePoint(int style, Visitor visitor, bool sortedByName = false) const
+    {
+        for (const QtAwesomeNamedCodePoint& namedCodePoint : namedCodePointsView(style, sortedByName)) {
+            visitor(namedCodePoint.name, namedCodePoint.codePoint);
+        }
+    }
 
     void setDefaultOption(const QString& name, const QVariant& value);
     QVariant defaultOption(const QString& name);
 
     QIcon icon(int style, int character, const QVariantMap& options = QVariantMap());
+    QIcon icon(IconId id, const QVariantMap& options = QVariantMap());
     QIcon icon(const QString& name, const QVariantMap& options = QVariantMap());
+    QIcon icon(QStringView name, const QVariantMap& options = QVariantMap());
+    QIcon icon(QLatin1String name, const QVariantMap& options = QVariantMap());
+    QIcon icon(const char* name, const QVariantMap& options = QVariantMap());
     QIcon icon(QtAwesomeIconPainter* painter, const QVariantMap& optionMap = QVariantMap());
+    QIcon stackedIcon(const QtAwesomeLayers& layers, const QVariantMap& options = QVariantMap());
+    QIcon badgedIcon(IconId id, const QSharedPointer<QtAwesomeBadge>& badge, const QVariantMap& options = QVariantMap());
+
+    QImage image(int style, int character, const QSize& size, const QVariantMap& options = QVariantMap(),
+                 QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::On);
+    QImage image(IconId id, const QSize& size, const QVariantMap& options = QVariantMap(),
+                 QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::On);
 
     void give(const QString& name, QtAwesomeIconPainter* painter);
 
@@ -160,10 +289,15 @@ public:
     /// Returns the font-name that is used as icon-map
     QString fontName(int style) const;
 
+    QPainterPath glyphPath(int style, int codePoint, qreal size = 0) const;
+    QByteArray glyphSvg(int style, int codePoint, const QColor& color = QColor()) const;
+    int exportSvgs(int style, const QString& directory, const QColor& color = QColor()) const;
+    bool writeBundle(const QString& fileName, const QVector<IconId>& icons) const;
+
 protected:
     int stringToStyleEnum(const QString style) const;
     const QString styleEnumToString(int style) const;
-    void addToNamedCodePoints(int style, const fa::QtAwesomeNamedIcon* faCommonIconArray, int size);
+    void addToNamedCodePoints(int style, const char* names, const fa::QtAwesomeNamedIcon* faCommonIconArray, int size);
 
 Q_SIGNALS:
     // signal about default options being reset
@@ -174,13 +308,28 @@ public Q_SLOTS:
     void resetDefaultOptions();
 
 private:
+    void initNamedCodePoints();
+    template<typename Char>
+    QIcon iconFromName(const Char* name, int size, const QVariantMap& options);
+    template<typename Char>
+    IconId iconIdFromName(const Char* name, int size) const;
+    template<typename Char>
+    int findNamedCodePoint(int style, const Char* name, int size) const;
+
     QHash<int, QtAwesomeFontData>     _fontDetails;           ///< The fonts name used for each style
-    QHash<int, QHash<QString, int>*> _namedCodepointsByStyle; ///< A map with names mapped to code-points for each style
-    QList<QHash<QString, int>*>      _namedCodepointsList;    ///< The list of all created named-codepoints
+    QHash<int, QVector<QtAwesomeNamedIconTable>> _namedIconTablesByStyle; ///< The sorted name tables for each style
+    bool _namedCodePointsInitialized;                     ///< The name tables are built, they aren't changed afterwards (read from other threads)
+    mutable QHash<const QtAwesomeNamedIcon*, QtAwesomeSearchIndex*> _searchIndexes; ///< The search index of each name table (built on demand)
+    mutable QMutex _searchIndexesMutex;                   ///< Guards the search indexes, search() may be called from other threads
 
     QHash<QString, QtAwesomeIconPainter*> _painterMap;     ///< A map of custom painters
     QVariantMap _defaultOptions;                           ///< The default icon options
+    QMutex _defaultOptionsMutex;                           ///< Guards the default options, they are read by image() from other threads
     QtAwesomeIconPainter* _fontIconPainter;                ///< A special painter fo painting codepoints
+    QtAwesomeIconPainter* _stackIconPainter;               ///< The painter of the stacked icons (shared by all stacked icons)
+    QtAwesomeIconPainter* _badgeIconPainter;               ///< The painter of the badged icons (shared by all badged icons)
+    QSharedPointer<const QtAwesomeBundle> _bundle;        ///< The loaded icon bundle (see loadBundle), painters hold a copy while painting
+    mutable QMutex _bundleMutex;                           ///< Guards the bundle pointer, image() paints with the bundle from other threads
 };
 
 //---------------------------------------------------------------------------------------
@@ -198,5 +347,6 @@ public:
 } // fa
 
 Q_DECLARE_METATYPE(fa::QtAwesomeAnimation*)
+Q_DECLARE_METATYPE(fa::QtAwesomeLayers)
 
 #endif // QTAWESOME_H
@@ -9,25 +9,50 @@ count(options, 2) { error("fontAwesomePro and fontAwesomeFree were defined, only
 INCLUDEPATH += $$PWD
 
 SOURCES += $$PWD/QtAwesome.cpp \
-    $$PWD/QtAwesomeAnim.cpp
+    $$PWD/QtAwesomeAnim.cpp \
+    $$PWD/QtAwesomeBadge.cpp \
+    $$PWD/QtAwesomeBundle.cpp \
+    $$PWD/QtAwesomeItemDelegate.cpp \
+    $$PWD/QtAwesomeTextObject.cpp
 
 
 HEADERS += $$PWD/QtAwesome.h \
     $$PWD/QtAwesomeAnim.h \
+    $$PWD/QtAwesomeBadge.h \
+    $$PWD/QtAwesomeBundle.h \
+    $$PWD/QtAwesomeIconId.h \
+    $$PWD/QtAwesomeItemDelegate.h \
+    $$PWD/QtAwesomeLiterals.h \
+    $$PWD/QtAwesomeTextObject.h \
     $$PWD/QtAwesomeEnumGenerated.h \
     $$PWD/QtAwesomeStringGenerated.h
 
 
+# fonts are loaded from a directory via QtAwesome::setFontDirectory
+CONFIG( fontAwesomeExternalFonts ){
+    DEFINES += QTAWESOME_NO_EMBEDDED_FONTS
+    !build_pass:message(using external font awesome font files)
+}
+
+# the QML image provider (QtAwesomeImageProvider) and icon item (QtAwesomeIconItem)
+CONFIG( fontAwesomeQuick ){
+    QT += quick
+    SOURCES += $$PWD/QtAwesomeImageProvider.cpp \
+        $$PWD/QtAwesomeIconItem.cpp
+    HEADERS += $$PWD/QtAwesomeImageProvider.h \
+        $$PWD/QtAwesomeIconItem.h
+}
+
 CONFIG( fontAwesomePro ){
     config = Pro
-    RESOURCES += $$resourcesForConfig(config)
+    !CONFIG(fontAwesomeExternalFonts): RESOURCES += $$resourcesForConfig(config)
     DEFINES += FONT_AWESOME_PRO=1
     !build_pass:message(using font awesome pro)
 }
 
 CONFIG( fontAwesomeFree ){
     config = Free
-    RESOURCES += $$resourcesForConfig(config)
+    !CONFIG(fontAwesomeExternalFonts): RESOURCES += $$resourcesForConfig(config)
     !build_pass:message(using font awesome free)
 }
 
@@ -1,49 +1,401 @@
 #include "QtAwesomeAnim.h"
 
 #include <cmath>
+#include <QGuiApplication>
 #include <QPainter>
+#include <QPointer>
 #include <QRect>
+#include <QScreen>
 #include <QTimer>
+#include <QtMath>
 #include <QWidget>
 
 namespace fa {
 
+/// The shared timeline, see QtAwesomeAnimationTimeline::instance
+static QPointer<QtAwesomeAnimationTimeline> sharedTimeline;
+
+/// A keyframe of an animation, the values are interpolated between the keyframes
+struct QtAwesomeKeyframe
+{
+    qreal at;            ///< the progress of the keyframe (0..1)
+    qreal rotation;      ///< the rotation in degrees
+    qreal scaleX;        ///< the horizontal scale
+    qreal scaleY;        ///< the vertical scale
+    qreal translateY;    ///< the vertical translation relative to the icon height
+    qreal opacity;       ///< the opacity
+    qreal flip;          ///< the rotation around the vertical axis in degrees
+};
+
+// the keyframes of the Font Awesome css animations
+static const QtAwesomeKeyframe spinKeyframes[] = {
+    { 0.0, 0, 1, 1, 0, 1, 0 }, { 1.0, 360, 1, 1, 0, 1, 0 }
+};
+static const QtAwesomeKeyframe beatKeyframes[] = {
+    { 0.0, 0, 1, 1, 0, 1, 0 }, { 0.45, 0, 1.25, 1.25, 0, 1, 0 }, { 0.9, 0, 1, 1, 0, 1, 0 }, { 1.0, 0, 1, 1, 0, 1, 0 }
+};
+static const QtAwesomeKeyframe fadeKeyframes[] = {
+    { 0.0, 0, 1, 1, 0, 1, 0 }, { 0.5, 0, 1, 1, 0, 0.4, 0 }, { 1.0, 0, 1, 1, 0, 1, 0 }
+};
+static const QtAwesomeKeyframe bounceKeyframes[] = {
+    { 0.0, 0, 1, 1, 0, 1, 0 }, { 0.1, 0, 1.1, 0.9, 0, 1, 0 }, { 0.3, 0, 0.9, 1.1, -0.5, 1, 0 },
+    { 0.5, 0, 1.05, 0.95, 0, 1, 0 }, { 0.57, 0, 1, 1, -0.125, 1, 0 }, { 0.64, 0, 1, 1, 0, 1, 0 },
+    { 1.0, 0, 1, 1, 0, 1, 0 }
+};
+static const QtAwesomeKeyframe shakeKeyframes[] = {
+    { 0.0, -15, 1, 1, 0, 1, 0 }, { 0.04, 15, 1, 1, 0, 1, 0 }, { 0.08, -18, 1, 1, 0, 1, 0 },
+    { 0.12, 18, 1, 1, 0, 1, 0 }, { 0.16, -22, 1, 1, 0, 1, 0 }, { 0.20, 22, 1, 1, 0, 1, 0 },
+    { 0.24, -18, 1, 1, 0, 1, 0 }, { 0.28, 18, 1, 1, 0, 1, 0 }, { 0.32, -12, 1, 1, 0, 1, 0 },
+    { 0.36, 12, 1, 1, 0, 1, 0 }, { 0.40, 0, 1, 1, 0, 1, 0 }, { 1.0, 0, 1, 1, 0, 1, 0 }
+};
+static const QtAwesomeKeyframe flipKeyframes[] = {
+    { 0.0, 0, 1, 1, 0, 1, 0 }, { 0.5, 0, 1, 1, 0, 1, -180 }, { 1.0, 0, 1, 1, 0, 1, 0 }
+};
+
+/// A css cubic-bezier() timing function
+static QEasingCurve cubicBezier(qreal x1, qreal y1, qreal x2, qreal y2)
+{
+    QEasingCurve curve(QEasingCurve::BezierSpline);
+    curve.addCubicBezierSegment(QPointF(x1, y1), QPointF(x2, y2), QPointF(1, 1));
+    return curve;
+}
+
+/// The css timing function of the animation type
+static QEasingCurve defaultEasingCurve(QtAwesomeAnimation::Type type)
+{
+    switch (type) {
+        case QtAwesomeAnimation::Beat:
+        case QtAwesomeAnimation::Flip:
+            return cubicBezier(0.42, 0, 0.58, 1);   // ease-in-out
+        case QtAwesomeAnimation::Fade:
+            return cubicBezier(0.4, 0, 0.6, 1);
+        case QtAwesomeAnimation::Bounce:
+            return cubicBezier(0.28, 0.84, 0.42, 1);
+        default:
+            return QEasingCurve(QEasingCurve::Linear);
+    }
+}
+
+/// Interpolates the keyframes at the progress, the easing curve is applied per keyframe segment (like css)
+template<int Count>
+static QtAwesomeKeyframe interpolate(const QtAwesomeKeyframe (&keyframes)[Count], qreal progress, const QEasingCurve& easingCurve)
+{
+    int index = 1;
+    while (index < Count - 1 && keyframes[index].at < progress) ++index;
+
+    const QtAwesomeKeyframe& from = keyframes[index - 1];
+    const QtAwesomeKeyframe& to = keyframes[index];
+    qreal t = easingCurve.valueForProgress(qBound(0.0, (progress - from.at) / (to.at - from.at), 1.0));
+
+    QtAwesomeKeyframe result = {
+        progress,
+        from.rotation + (to.rotation - from.rotation) * t,
+        from.scaleX + (to.scaleX - from.scaleX) * t,
+        from.scaleY + (to.scaleY - from.scaleY) * t,
+        from.translateY + (to.translateY - from.translateY) * t,
+        from.opacity + (to.opacity - from.opacity) * t,
+        from.flip + (to.flip - from.flip) * t
+    };
+    return result;
+}
+
+/// Creates a spin animation, rotating step degrees every interval milliseconds
+/// The speed and direction are kept (a negative step rotates counter-clockwise), the animation is updated
+/// by the timeline at the screen refresh rate.
 QtAwesomeAnimation::QtAwesomeAnimation(QWidget *parentWidget, int interval, int step)
-    : parentWidgetRef_(parentWidget)
-    , timer_(nullptr)
-    , interval_(interval)
-    , step_(step)
-    , angle_(0.0f)
+    : QObject(parentWidget)
+    , parentWidgetRef_(parentWidget)
+    , type_(Spin)
+    , duration_(step != 0 ? qAbs(interval * 360 / step) : 0)
+    , easingCurve_(QEasingCurve::Linear)
+    , direction_(step < 0 ? Reverse : Normal)
+    , registered_(false)
+    , paintedElsewhere_(false)
 {
 
 }
 
+/// Creates an animation of the given type, the animation is owned by the widget (its QObject parent)
+/// @param duration the duration of one cycle in milliseconds, by default the Font Awesome duration (2s for Spin, 1s for the others)
+QtAwesomeAnimation::QtAwesomeAnimation(QWidget* parentWidget, Type type, int duration)
+    : QObject(parentWidget)
+    , parentWidgetRef_(parentWidget)
+    , type_(type)
+    , duration_(duration >= 0 ? duration : (type == Spin ? 2000 : 1000))
+    , easingCurve_(defaultEasingCurve(type))
+    , direction_(Normal)
+    , registered_(false)
+    , paintedElsewhere_(false)
+{
+}
+
+QtAwesomeAnimation::~QtAwesomeAnimation()
+{
+    // the timeline is gone when the application is destroyed first
+    if (registered_ && sharedTimeline) {
+        sharedTimeline->unregisterAnimation(this);
+    }
+}
+
+/// Creates an animation that is owned by the icons using it, pass it as "anim" option:
+///
+///     options.insert("anim", QVariant::fromValue(fa::QtAwesomeAnimation::create(button, fa::QtAwesomeAnimation::Spin)));
+///
+/// The animation is deleted when the last icon (and QVariant) referring to it is gone.
+/// @param parentWidget the widget that is updated, it doesn't own the animation
+QSharedPointer<QtAwesomeAnimation> QtAwesomeAnimation::create(QWidget* parentWidget, Type type, int duration)
+{
+    QSharedPointer<QtAwesomeAnimation> animation(new QtAwesomeAnimation(parentWidget, type, duration));
+    animation->setParent(nullptr);
+    return animation;
+}
+
+QtAwesomeAnimation::Type QtAwesomeAnimation::type() const
+{
+    return type_;
+}
+
+int QtAwesomeAnimation::duration() const
+{
+    return duration_;
+}
+
+/// Sets the duration of one cycle in milliseconds
+void QtAwesomeAnimation::setDuration(int duration)
+{
+    duration_ = duration;
+}
+
+QEasingCurve QtAwesomeAnimation::easingCurve() const
+{
+    return easingCurve_;
+}
+
+/// Sets the timing function, it's applied to every keyframe segment (the Pulse steps aren't eased)
+void QtAwesomeAnimation::setEasingCurve(const QEasingCurve& easingCurve)
+{
+    easingCurve_ = easingCurve;
+}
+
+QtAwesomeAnimation::Direction QtAwesomeAnimation::direction() const
+{
+    return direction_;
+}
+
+/// Sets the direction, Reverse plays the keyframes backwards (e.g. a counter-clockwise spin)
+void QtAwesomeAnimation::setDirection(Direction direction)
+{
+    direction_ = direction;
+}
+
+/// Applies the current frame to the painter, the first call starts the animation
 void QtAwesomeAnimation::setup(QPainter &painter, const QRect &rect)
 {
-    // first time set the timer
-    if (!timer_)
-    {
-        timer_ = new QTimer();
-        connect(timer_,SIGNAL(timeout()), this, SLOT(update()) );
-        timer_->start(interval_);
+    QtAwesomeAnimationTimeline* timeline = QtAwesomeAnimationTimeline::instance();
+    if (!registered_) {
+        timeline->registerAnimation(this);
+        registered_ = true;
+    }
+
+    // remember the painted area, the next tick only updates this area of the parent widget
+    QPaintDevice* device = painter.device();
+    QWidget* widget = device && device->devType() == QInternal::Widget ? static_cast<QWidget*>(device) : nullptr;
+    if (widget && parentWidgetRef_ && (widget == parentWidgetRef_ || parentWidgetRef_->isAncestorOf(widget))) {
+        QRect deviceRect = painter.combinedTransform().mapRect(animatedBounds(QRectF(rect))).toAlignedRect().adjusted(-1, -1, 1, 1);
+        paintedRegion_ += deviceRect.translated(widget->mapTo(parentWidgetRef_, QPoint(0, 0)));
+    } else {
+        paintedElsewhere_ = true;
     }
-    else
-    {
-        //timer, angle, self.step = self.info[self.parent_widget]
-        float x_center = rect.width() * 0.5f;
-        float y_center = rect.height() * 0.5f;
-        painter.translate(static_cast<qreal>(x_center), static_cast<qreal>(y_center));
-        painter.rotate(static_cast<qreal>(angle_));
-        painter.translate(static_cast<qreal>(-x_center), -static_cast<qreal>(y_center));
+
+    apply(painter, QRectF(rect), timeline->elapsed());
+}
+
+/// The area the animation may paint in, the rect including the largest rotation, scale and translation
+QRectF QtAwesomeAnimation::animatedBounds(const QRectF& rect) const
+{
+    qreal width = rect.width();
+    qreal height = rect.height();
+    switch (type_) {
+        case Spin:
+        case Pulse:
+        case Shake: {
+            // the bounding rect of the rotated rect
+            qreal diagonal = std::sqrt(width * width + height * height);
+            return rect.adjusted((width - diagonal) / 2, (height - diagonal) / 2, (diagonal - width) / 2, (diagonal - height) / 2);
+        }
+        case Beat:
+            return rect.adjusted(-width * 0.125, -height * 0.125, width * 0.125, height * 0.125);
+        case Bounce:
+            return rect.adjusted(-width * 0.1, -height * 0.55, width * 0.1, height * 0.05);
+        default:
+            return rect;
     }
 }
 
+/// Applies the frame at the elapsed time to the painter (the transformation and opacity)
+/// This can be used to render frames without timer, e.g. to export an animation.
+///
+/// @param elapsed the time in milliseconds since the start of the animation
+void QtAwesomeAnimation::apply(QPainter& painter, const QRectF& rect, qint64 elapsed) const
+{
+    if (duration_ <= 0) return;
+
+    qreal progress = static_cast<qreal>(elapsed % duration_) / duration_;
+    if (direction_ == Reverse) progress = 1 - progress;
 
+    QtAwesomeKeyframe frame = spinKeyframes[0];
+    switch (type_) {
+        case Spin: frame = interpolate(spinKeyframes, progress, easingCurve_); break;
+        case Pulse: frame.rotation = 45 * std::floor(progress * 8); break;
+        case Beat: frame = interpolate(beatKeyframes, progress, easingCurve_); break;
+        case Fade: frame = interpolate(fadeKeyframes, progress, easingCurve_); break;
+        case Bounce: frame = interpolate(bounceKeyframes, progress, easingCurve_); break;
+        case Shake: frame = interpolate(shakeKeyframes, progress, easingCurve_); break;
+        case Flip: frame = interpolate(flipKeyframes, progress, easingCurve_); break;
+    }
+
+    // the transformations are relative to the center of the icon (the css transform-origin)
+    QPointF center = rect.center();
+    painter.translate(center.x(), center.y() + frame.translateY * rect.height());
+    painter.rotate(frame.rotation);
+    painter.scale(frame.scaleX * std::cos(qDegreesToRadians(frame.flip)), frame.scaleY);
+    painter.translate(-center);
+    painter.setOpacity(painter.opacity() * frame.opacity);
+}
+
+/// Called by the timeline every tick, updates the area painted since the previous tick
+/// Qt merges the update regions of all animations of a widget into one paint event.
+/// When the icon was painted on another device (e.g. a QIcon pixmap) the whole widget is updated.
+///
+/// When the icon wasn't painted (e.g. the icon is gone, hidden or scrolled out of view), the animation leaves
+/// the timeline, so idle animations don't keep the timer running. Painting it again continues the animation.
 void QtAwesomeAnimation::update()
 {
-    angle_ += step_;
-    angle_ = std::fmod( static_cast<float>(angle_), 360.0f);
-    parentWidgetRef_->update();
+    bool painted = paintedElsewhere_ || !paintedRegion_.isEmpty();
+    if (!parentWidgetRef_ || !painted) {
+        QtAwesomeAnimationTimeline::instance()->unregisterAnimation(this);
+        registered_ = false;
+    } else if (paintedElsewhere_) {
+        parentWidgetRef_->update();
+    } else {
+        parentWidgetRef_->update(paintedRegion_);
+    }
+    paintedRegion_ = QRegion();
+    paintedElsewhere_ = false;
+}
+
+//---------------------------------------------------------------------------------------
+
+/// Returns the shared timeline, it's created on first use (in the gui thread)
+QtAwesomeAnimationTimeline* QtAwesomeAnimationTimeline::instance()
+{
+    if (!sharedTimeline) {
+        sharedTimeline = new QtAwesomeAnimationTimeline();
+    }
+    return sharedTimeline;
+}
+
+QtAwesomeAnimationTimeline::QtAwesomeAnimationTimeline()
+    : QObject(QCoreApplication::instance())
+    , timer_(new QTimer(this))
+    , interval_(0)
+{
+    timer_->setTimerType(Qt::PreciseTimer);
+    connect(timer_, SIGNAL(timeout()), this, SLOT(tick()));
+    if (qGuiApp) {
+        // the screen is removed from the screens after the signal
+        connect(qGuiApp, SIGNAL(screenAdded(QScreen*)), this, SLOT(addScreen(QScreen*)));
+        connect(qGuiApp, SIGNAL(screenRemoved(QScreen*)), this, SLOT(updateInterval()), Qt::QueuedConnection);
+        for (QScreen* screen : QGuiApplication::screens()) {
+            connect(screen, SIGNAL(refreshRateChanged(qreal)), this, SLOT(updateInterval()));
+        }
+    }
+    updateInterval();
+    elapsedTimer_.start();
+}
+
+/// The time in milliseconds since the timeline started, all animations use the same time
+/// The frames only depend on this time, not on the number of ticks.
+qint64 QtAwesomeAnimationTimeline::elapsed() const
+{
+    return clock_ ? clock_() : elapsedTimer_.elapsed();
+}
+
+/// Replaces the clock of the timeline, e.g. with a manually advanced clock in tests
+/// @param clock the clock, an empty function restores the default (QElapsedTimer) clock
+void QtAwesomeAnimationTimeline::setClock(const Clock& clock)
+{
+    clock_ = clock;
+}
+
+/// The tick interval in milliseconds
+int QtAwesomeAnimationTimeline::interval() const
+{
+    return timer_->interval();
+}
+
+/// Sets the tick interval in milliseconds
+/// @param interval the interval, 0 (the default) for the refresh rate of the fastest screen
+void QtAwesomeAnimationTimeline::setInterval(int interval)
+{
+    interval_ = qMax(0, interval);
+    updateInterval();
+}
+
+/// Ticks once per frame of the fastest screen, more ticks would only paint frames that are never shown.
+/// A single timer drives the animations of all screens, so widgets on a slower screen get a few ticks
+/// more than they can show (their frames only depend on the elapsed time).
+void QtAwesomeAnimationTimeline::updateInterval()
+{
+    int interval = interval_;
+    if (interval == 0) {
+        qreal refreshRate = 0;
+        if (qGuiApp) {
+            for (QScreen* screen : QGuiApplication::screens()) {
+                refreshRate = qMax(refreshRate, screen->refreshRate());
+            }
+        }
+        interval = refreshRate > 0 ? qMax(1, qRound(1000 / refreshRate)) : 16;
+    }
+    timer_->setInterval(interval);
+}
+
+/// Follows the refresh rate of a new screen (e.g. a monitor that is plugged in)
+void QtAwesomeAnimationTimeline::addScreen(QScreen* screen)
+{
+    connect(screen, SIGNAL(refreshRateChanged(qreal)), this, SLOT(updateInterval()));
+    updateInterval();
+}
+
+/// Adds the animation, the animation is updated every tick. The timer is started for the first animation.
+void QtAwesomeAnimationTimeline::registerAnimation(QtAwesomeAnimation* animation)
+{
+    if (animations_.contains(animation)) return;
+
+    animations_.append(animation);
+    if (!timer_->isActive()) timer_->start();
+}
+
+/// Removes the animation, the timer is stopped after the last animation
+void QtAwesomeAnimationTimeline::unregisterAnimation(QtAwesomeAnimation* animation)
+{
+    animations_.removeAll(animation);
+    if (animations_.isEmpty()) timer_->stop();
+}
+
+/// The number of running animations, the animations that were painted since the last tick
+int QtAwesomeAnimationTimeline::animationCount() const
+{
+    return animations_.size();
+}
+
+void QtAwesomeAnimationTimeline::tick()
+{
+    // an update may remove animations
+    QVector<QtAwesomeAnimation*> animations = animations_;
+    for (QtAwesomeAnimation* animation : animations) {
+        animation->update();
+    }
 }
 
 } // namespace fa
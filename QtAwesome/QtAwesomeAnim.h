@@ -1,10 +1,20 @@
 #ifndef QTAWESOMEANIMATION_H
 #define QTAWESOMEANIMATION_H
 
+#include <QEasingCurve>
+#include <QElapsedTimer>
 #include <QObject>
+#include <QPointer>
+#include <QRegion>
+#include <QSharedPointer>
+#include <QVector>
+
+#include <functional>
 
 class QPainter;
 class QRect;
+class QRectF;
+class QScreen;
 class QTimer;
 class QWidget;
 
@@ -12,24 +22,113 @@ namespace fa {
     ///
     /// Basic Animation Support for QtAwesome (Inspired by https://github.com/spyder-ide/qtawesome)
     ///
+    /// The animation types match the Font Awesome css animations (fa-spin, fa-spin-pulse, fa-beat, fa-fade,
+    /// fa-bounce, fa-shake and fa-flip). The frames are computed from the elapsed time of the shared timeline,
+    /// so animations stay smooth when ticks are dropped, and icons with the same animation are synchronized.
+    ///
+    /// An animation created with the constructor is owned by its widget. An animation created with create() is owned
+    /// by the icons using it (the "anim" option holds a QSharedPointer), it's deleted with the last icon.
+    /// Icons only keep a QPointer to a widget-owned animation, they stop animating when the widget is deleted.
+    /// An animation only runs while it's painted, it leaves the timeline when its icon isn't painted anymore.
+    ///
     class QtAwesomeAnimation : public QObject
     {
     Q_OBJECT
 
     public:
+        /// The animation types
+        enum Type {
+            Spin,       ///< continuous rotation (fa-spin)
+            Pulse,      ///< rotation in 8 steps (fa-spin-pulse)
+            Beat,       ///< scales up and down (fa-beat)
+            Fade,       ///< fades out and in (fa-fade)
+            Bounce,     ///< bounces up with a squish (fa-bounce)
+            Shake,      ///< shakes by rotating back and forth (fa-shake)
+            Flip        ///< flips around the vertical axis (fa-flip)
+        };
+        Q_ENUM(Type)
+
+        /// The direction the keyframes are played (the css animation-direction)
+        enum Direction {
+            Normal,     ///< forwards, a spin rotates clockwise
+            Reverse     ///< backwards, a spin rotates counter-clockwise
+        };
+        Q_ENUM(Direction)
+
         QtAwesomeAnimation(QWidget* parentWidget, int interval = 10, int step = 1);
+        QtAwesomeAnimation(QWidget* parentWidget, Type type, int duration = -1);
+        virtual ~QtAwesomeAnimation();
+
+        static QSharedPointer<QtAwesomeAnimation> create(QWidget* parentWidget, Type type = Spin, int duration = -1);
+
+        Type type() const;
+
+        int duration() const;
+        void setDuration(int duration);
+
+        QEasingCurve easingCurve() const;
+        void setEasingCurve(const QEasingCurve& easingCurve);
+
+        Direction direction() const;
+        void setDirection(Direction direction);
+
         void setup(QPainter& painter, const QRect& rect);
+        void apply(QPainter& painter, const QRectF& rect, qint64 elapsed) const;
 
     public slots:
         void update();
 
     private:
-        QWidget* parentWidgetRef_;
-        QTimer* timer_;
-        int interval_;
-        int step_;
-        float angle_;
+        QRectF animatedBounds(const QRectF& rect) const;
+
+        QPointer<QWidget> parentWidgetRef_;   ///< the widget that is updated, not necessarily the owner
+        Type type_;                   ///< the animation type
+        int duration_;                ///< the duration of one cycle in milliseconds
+        QEasingCurve easingCurve_;    ///< the timing function, applied to every keyframe segment
+        Direction direction_;         ///< the direction the keyframes are played
+        bool registered_;             ///< the animation is registered in the timeline
+        QRegion paintedRegion_;       ///< the area painted since the last tick, in parent widget coordinates
+        bool paintedElsewhere_;       ///< painted on another device (e.g. a pixmap), the parent widget is updated completely
+    };
+
+    ///
+    /// The shared animation timeline, a single timer updates all running animations
+    /// The timer only runs while animations are registered. By default it ticks at the refresh rate of the fastest screen,
+    /// so animations on every screen get a frame per refresh.
+    ///
+    class QtAwesomeAnimationTimeline : public QObject
+    {
+    Q_OBJECT
+
+    public:
+        static QtAwesomeAnimationTimeline* instance();
+
+        /// A clock returning monotonic milliseconds
+        typedef std::function<qint64()> Clock;
+
+        qint64 elapsed() const;
+        void setClock(const Clock& clock);
+
+        int interval() const;
+        void setInterval(int interval);
+
+        void registerAnimation(QtAwesomeAnimation* animation);
+        void unregisterAnimation(QtAwesomeAnimation* animation);
+        int animationCount() const;
+
+    private slots:
+        void tick();
+        void updateInterval();
+        void addScreen(QScreen* screen);
+
+    private:
+        QtAwesomeAnimationTimeline();
 
+        QTimer* timer_;                              ///< the tick timer
+        int interval_;                               ///< the tick interval, 0 for the refresh rate of the fastest screen
+        QElapsedTimer elapsedTimer_;                 ///< the default clock
+        Clock clock_;                                ///< the injected clock, elapsedTimer_ is used when empty
+        QVector<QtAwesomeAnimation*> animations_;    ///< the running animations
     };
 } // namespace fa
 
@@ -0,0 +1,158 @@
+#include "QtAwesomeBadge.h"
+
+#include <QApplication>
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QPainterPath>
+
+namespace fa {
+
+QtAwesomeBadge::QtAwesomeBadge(QObject* parent)
+    : QObject(parent)
+    , color_(QColor(0xdc, 0x35, 0x45))
+    , textColor_(Qt::white)
+    , corner_(Qt::TopRightCorner)
+    , scale_(0.5)
+    , visible_(true)
+{
+}
+
+QString QtAwesomeBadge::text() const
+{
+    return text_;
+}
+
+/// Sets the badge text, a short text like a number. When empty a dot is painted (a status badge).
+void QtAwesomeBadge::setText(const QString& text)
+{
+    if (text_ == text) return;
+
+    text_ = text;
+    Q_EMIT changed();
+}
+
+/// Sets the text to the count, e.g. "3" or "99+". A count of 0 (or less) hides the badge.
+void QtAwesomeBadge::setCount(int count, int maximum)
+{
+    QString text = count > maximum ? QString::number(maximum) + "+" : QString::number(count);
+    bool visible = count > 0;
+    if (visible_ == visible && (!visible || text_ == text)) return;
+
+    visible_ = visible;
+    if (visible) text_ = text;
+    Q_EMIT changed();
+}
+
+QColor QtAwesomeBadge::color() const
+{
+    return color_;
+}
+
+/// Sets the background color of the badge
+void QtAwesomeBadge::setColor(const QColor& color)
+{
+    if (color_ == color) return;
+
+    color_ = color;
+    Q_EMIT changed();
+}
+
+QColor QtAwesomeBadge::textColor() const
+{
+    return textColor_;
+}
+
+void QtAwesomeBadge::setTextColor(const QColor& color)
+{
+    if (textColor_ == color) return;
+
+    textColor_ = color;
+    Q_EMIT changed();
+}
+
+Qt::Corner QtAwesomeBadge::corner() const
+{
+    return corner_;
+}
+
+/// Sets the corner of the icon the badge is placed in
+void QtAwesomeBadge::setCorner(Qt::Corner corner)
+{
+    if (corner_ == corner) return;
+
+    corner_ = corner;
+    Q_EMIT changed();
+}
+
+qreal QtAwesomeBadge::scale() const
+{
+    return scale_;
+}
+
+/// Sets the height of the badge relative to the icon height (default 0.5)
+void QtAwesomeBadge::setScale(qreal scale)
+{
+    if (qFuzzyCompare(scale_, scale)) return;
+
+    scale_ = scale;
+    Q_EMIT changed();
+}
+
+bool QtAwesomeBadge::isVisible() const
+{
+    return visible_;
+}
+
+void QtAwesomeBadge::setVisible(bool visible)
+{
+    if (visible_ == visible) return;
+
+    visible_ = visible;
+    Q_EMIT changed();
+}
+
+/// Paints the badge in the corner of the icon rect
+/// The badge is a pill with the text, at least as wide as high. It's kept inside the icon rect.
+void QtAwesomeBadge::paint(QPainter* painter, const QRectF& iconRect) const
+{
+    if (!visible_ || scale_ <= 0) return;
+
+    qreal height = iconRect.height() * qMin(scale_, 1.0);
+    if (text_.isEmpty()) height *= 0.6;
+
+    QFont font = QApplication::font();
+    font.setBold(true);
+    font.setPixelSize(qMax(1, qRound(height * 0.75)));
+    QFontMetricsF metrics(font);
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    qreal textWidth = metrics.horizontalAdvance(text_);
+#else
+    qreal textWidth = metrics.width(text_);
+#endif
+    qreal width = qMin(iconRect.width(), qMax(height, textWidth + height * 0.5));
+
+    QRectF badgeRect(0, 0, width, height);
+    switch (corner_) {
+        case Qt::TopLeftCorner: badgeRect.moveTopLeft(iconRect.topLeft()); break;
+        case Qt::TopRightCorner: badgeRect.moveTopRight(iconRect.topRight()); break;
+        case Qt::BottomLeftCorner: badgeRect.moveBottomLeft(iconRect.bottomLeft()); break;
+        case Qt::BottomRightCorner: badgeRect.moveBottomRight(iconRect.bottomRight()); break;
+    }
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+
+    QPainterPath path;
+    path.addRoundedRect(badgeRect, height / 2, height / 2);
+    painter->fillPath(path, color_);
+
+    if (!text_.isEmpty()) {
+        painter->setFont(font);
+        painter->setPen(textColor_);
+        painter->drawText(badgeRect, Qt::AlignCenter, text_);
+    }
+    painter->restore();
+}
+
+} // namespace fa
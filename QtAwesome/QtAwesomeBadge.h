@@ -0,0 +1,67 @@
+#ifndef QTAWESOMEBADGE_H
+#define QTAWESOMEBADGE_H
+
+#include <QColor>
+#include <QObject>
+#include <QString>
+
+class QPainter;
+class QRectF;
+
+namespace fa {
+
+///
+/// A badge overlay for an icon, e.g. an unread count or a status dot (see QtAwesome::badgedIcon)
+///
+/// The badge is shared by the icon, changing it changes the existing icon. The glyph of the icon stays cached,
+/// only the badge is painted again. Views that don't repaint by themselves (e.g. QSystemTrayIcon) can be
+/// refreshed via the changed signal.
+///
+///     QSharedPointer<fa::QtAwesomeBadge> badge(new fa::QtAwesomeBadge());
+///     trayIcon->setIcon(awesome->badgedIcon(fa::IconId(fa::fa_solid, fa::fa_envelope), badge));
+///     badge->setCount(3);
+///
+class QtAwesomeBadge : public QObject
+{
+Q_OBJECT
+
+public:
+    explicit QtAwesomeBadge(QObject* parent = nullptr);
+
+    QString text() const;
+    void setText(const QString& text);
+    void setCount(int count, int maximum = 99);
+
+    QColor color() const;
+    void setColor(const QColor& color);
+
+    QColor textColor() const;
+    void setTextColor(const QColor& color);
+
+    Qt::Corner corner() const;
+    void setCorner(Qt::Corner corner);
+
+    qreal scale() const;
+    void setScale(qreal scale);
+
+    bool isVisible() const;
+    void setVisible(bool visible);
+
+    void paint(QPainter* painter, const QRectF& iconRect) const;
+
+Q_SIGNALS:
+    /// Emitted when the badge changes, the icons with this badge need to be repainted
+    void changed();
+
+private:
+    QString text_;          ///< the badge text, a dot is painted when empty
+    QColor color_;          ///< the background color
+    QColor textColor_;      ///< the text color
+    Qt::Corner corner_;     ///< the corner of the icon
+    qreal scale_;           ///< the badge height relative to the icon height
+    bool visible_;          ///< the badge is painted
+};
+
+} // namespace fa
+
+#endif // QTAWESOMEBADGE_H
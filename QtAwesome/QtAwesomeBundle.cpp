@@ -0,0 +1,260 @@
+#include "QtAwesomeBundle.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <QtEndian>
+
+#include <cstring>
+
+namespace fa {
+
+static const char bundleMagic[4] = { 'Q', 'T', 'A', 'B' };
+static const quint32 bundleVersion = 1;
+static const int headerSize = 16;
+static const int entrySize = 16;
+static const int pointScale = 16;   ///< the points are stored in 1/16 font units
+
+static inline quint32 readUInt32(const uchar* data)
+{
+    return qFromLittleEndian<quint32>(data);
+}
+
+static inline quint16 readUInt16(const uchar* data)
+{
+    return qFromLittleEndian<quint16>(data);
+}
+
+static inline void appendUInt32(QByteArray& data, quint32 value)
+{
+    uchar buffer[4];
+    qToLittleEndian<quint32>(value, buffer);
+    data.append(reinterpret_cast<const char*>(buffer), 4);
+}
+
+static inline void appendUInt16(QByteArray& data, quint16 value)
+{
+    uchar buffer[2];
+    qToLittleEndian<quint16>(value, buffer);
+    data.append(reinterpret_cast<const char*>(buffer), 2);
+}
+
+QtAwesomeBundle::QtAwesomeBundle()
+    : file_(nullptr)
+    , data_(nullptr)
+    , size_(0)
+    , count_(0)
+{
+}
+
+QtAwesomeBundle::~QtAwesomeBundle()
+{
+    delete file_;   // unmaps the data
+}
+
+/// Loads the bundle file, the file is memory-mapped and kept open while the bundle exists.
+/// When the file cannot be mapped, its content is read into memory instead.
+/// @return false when the file can't be read or isn't a valid bundle
+bool QtAwesomeBundle::load(const QString& fileName)
+{
+    delete file_;
+    file_ = nullptr;
+    buffer_.clear();
+    data_ = nullptr;
+    size_ = 0;
+    count_ = 0;
+
+    QFile* file = new QFile(fileName);
+    if (!file->open(QIODevice::ReadOnly)) {
+        delete file;
+        return false;
+    }
+
+    const uchar* data = file->map(0, file->size());
+    qint64 size = file->size();
+    if (data) {
+        file_ = file;
+    } else {
+        buffer_ = file->readAll();
+        delete file;
+        data = reinterpret_cast<const uchar*>(buffer_.constData());
+        size = buffer_.size();
+    }
+
+    // validate the header and the index, so the icons can be read without checks
+    bool valid = size >= headerSize && std::memcmp(data, bundleMagic, 4) == 0 && readUInt32(data + 4) == bundleVersion;
+    quint32 count = valid ? readUInt32(data + 8) : 0;
+    valid = valid && count <= static_cast<quint64>(size - headerSize) / entrySize;
+    for (quint32 i = 0; valid && i < count; ++i) {
+        const uchar* entry = data + headerSize + i * entrySize;
+        quint64 offset = readUInt32(entry + 4);
+        quint64 elementCount = readUInt32(entry + 8);
+        quint64 end = offset + ((elementCount + 3) & ~3ull) + elementCount * 4;
+        valid = end <= static_cast<quint64>(size) && readUInt16(entry + 14) > 0
+                && (i == 0 || readUInt32(entry) > readUInt32(entry - entrySize));
+    }
+
+    if (!valid) {
+        delete file_;
+        file_ = nullptr;
+        buffer_.clear();
+        return false;
+    }
+
+    data_ = data;
+    size_ = size;
+    count_ = static_cast<int>(count);
+    return true;
+}
+
+bool QtAwesomeBundle::isLoaded() const
+{
+    return data_ != nullptr;
+}
+
+/// The number of icons in the bundle
+int QtAwesomeBundle::count() const
+{
+    return count_;
+}
+
+/// Returns the index entry of the icon, a binary search in the mapped index
+const uchar* QtAwesomeBundle::entry(IconId id) const
+{
+    int low = 0;
+    int high = count_ - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        const uchar* entry = data_ + headerSize + mid * entrySize;
+        quint32 value = readUInt32(entry);
+        if (value == id.value()) return entry;
+        if (value < id.value()) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return nullptr;
+}
+
+bool QtAwesomeBundle::contains(IconId id) const
+{
+    return entry(id) != nullptr;
+}
+
+/// Returns the outline of the icon, the origin is the top-left of the em box
+/// @param size the em size of the path, 0 for the font units
+/// @return the path, empty when the bundle doesn't contain the icon
+QPainterPath QtAwesomeBundle::path(IconId id, qreal size) const
+{
+    QPainterPath result;
+    const uchar* entry = this->entry(id);
+    if (!entry) return result;
+
+    quint32 elementCount = readUInt32(entry + 8);
+    qreal scale = (size > 0 ? size / readUInt16(entry + 14) : 1.0) / pointScale;
+
+    const uchar* types = data_ + readUInt32(entry + 4);
+    const uchar* points = types + ((elementCount + 3) & ~3u);
+    auto point = [points, scale](quint32 index) {
+        return QPointF(static_cast<qint16>(readUInt16(points + index * 4)) * scale,
+                       static_cast<qint16>(readUInt16(points + index * 4 + 2)) * scale);
+    };
+
+    // glyph outlines are defined with the non-zero winding rule
+    result.setFillRule(Qt::WindingFill);
+    for (quint32 i = 0; i < elementCount; ++i) {
+        switch (types[i]) {
+            case QPainterPath::MoveToElement:
+                result.moveTo(point(i));
+                break;
+            case QPainterPath::LineToElement:
+                result.lineTo(point(i));
+                break;
+            case QPainterPath::CurveToElement:
+                if (i + 2 < elementCount) {
+                    result.cubicTo(point(i), point(i + 1), point(i + 2));
+                    i += 2;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return result;
+}
+
+/// Returns the advance width of the icon
+/// @param size the em size, 0 for the font units
+qreal QtAwesomeBundle::advance(IconId id, qreal size) const
+{
+    const uchar* entry = this->entry(id);
+    if (!entry) return 0;
+
+    qreal advance = readUInt16(entry + 12);
+    return size > 0 ? advance * size / readUInt16(entry + 14) : advance;
+}
+
+//---------------------------------------------------------------------------------------
+
+/// Adds the outline of an icon to the bundle
+/// @param path the outline in font units, with the origin at the top-left of the em box
+/// @return false when the outline doesn't fit in the bundle format
+bool QtAwesomeBundleWriter::addIcon(IconId id, const QPainterPath& path, qreal advance, int unitsPerEm)
+{
+    const qreal limit = 32767.0 / pointScale;
+    QRectF bounds = path.controlPointRect();
+    if (bounds.left() < -limit || bounds.top() < -limit || bounds.right() > limit || bounds.bottom() > limit
+            || advance < 0 || advance > 65535 || unitsPerEm <= 0 || unitsPerEm > 65535) {
+        return false;
+    }
+
+    Icon icon = { path, advance, unitsPerEm };
+    icons_.insert(id.value(), icon);
+    return true;
+}
+
+/// Returns the bundle data
+QByteArray QtAwesomeBundleWriter::data() const
+{
+    QByteArray result;
+    result.append(bundleMagic, 4);
+    appendUInt32(result, bundleVersion);
+    appendUInt32(result, static_cast<quint32>(icons_.size()));
+    appendUInt32(result, 0);
+
+    QByteArray iconData;
+    quint32 dataOffset = headerSize + static_cast<quint32>(icons_.size()) * entrySize;
+    for (QMap<quint32, Icon>::const_iterator itr = icons_.constBegin(); itr != icons_.constEnd(); ++itr) {
+        const QPainterPath& path = itr.value().path;
+        int elementCount = path.elementCount();
+
+        appendUInt32(result, itr.key());
+        appendUInt32(result, dataOffset + static_cast<quint32>(iconData.size()));
+        appendUInt32(result, static_cast<quint32>(elementCount));
+        appendUInt16(result, static_cast<quint16>(qRound(itr.value().advance)));
+        appendUInt16(result, static_cast<quint16>(itr.value().unitsPerEm));
+
+        for (int i = 0; i < elementCount; ++i) {
+            iconData.append(static_cast<char>(path.elementAt(i).type));
+        }
+        while (iconData.size() % 4) iconData.append('\0');
+        for (int i = 0; i < elementCount; ++i) {
+            QPainterPath::Element element = path.elementAt(i);
+            appendUInt16(iconData, static_cast<quint16>(static_cast<qint16>(qRound(element.x * pointScale))));
+            appendUInt16(iconData, static_cast<quint16>(static_cast<qint16>(qRound(element.y * pointScale))));
+        }
+    }
+
+    result.append(iconData);
+    return result;
+}
+
+/// Writes the bundle file
+bool QtAwesomeBundleWriter::save(const QString& fileName) const
+{
+    QByteArray bundle = data();
+    QSaveFile file(fileName);
+    return file.open(QIODevice::WriteOnly) && file.write(bundle) == bundle.size() && file.commit();
+}
+
+} // namespace fa
@@ -0,0 +1,79 @@
+#ifndef QTAWESOMEBUNDLE_H
+#define QTAWESOMEBUNDLE_H
+
+#include <QByteArray>
+#include <QMap>
+#include <QPainterPath>
+#include <QString>
+
+#include "QtAwesomeIconId.h"
+
+class QFile;
+
+namespace fa {
+
+///
+/// A precompiled icon bundle, the glyph outlines of a set of icons indexed by IconId.
+/// A bundle is loaded via memory-mapping, so icons can be painted without registering the fonts (see QtAwesome::loadBundle).
+///
+/// The file layout (little endian):
+///
+///     header    "QTAB", quint32 version, quint32 icon count, quint32 reserved
+///     index     per icon, sorted by IconId:
+///               quint32 IconId, quint32 data offset, quint32 element count, quint16 advance, quint16 units per em
+///     data      per icon: the element types (quint8, QPainterPath::ElementType), padded to 4 bytes,
+///               followed by the element points (qint16 x, qint16 y in 1/16 font units)
+///
+/// The outlines are in font units with the origin at the top-left of the em box.
+///
+class QtAwesomeBundle
+{
+public:
+    QtAwesomeBundle();
+    ~QtAwesomeBundle();
+
+    bool load(const QString& fileName);
+    bool isLoaded() const;
+
+    int count() const;
+    bool contains(IconId id) const;
+    QPainterPath path(IconId id, qreal size = 0) const;
+    qreal advance(IconId id, qreal size = 0) const;
+
+private:
+    Q_DISABLE_COPY(QtAwesomeBundle)
+
+    const uchar* entry(IconId id) const;
+
+    QFile* file_;          ///< the mapped bundle file
+    QByteArray buffer_;    ///< the bundle data, when the file can't be mapped
+    const uchar* data_;    ///< the bundle data
+    qint64 size_;          ///< the size of the bundle data
+    int count_;            ///< the number of icons
+};
+
+///
+/// Writes an icon bundle, see QtAwesome::writeBundle
+///
+class QtAwesomeBundleWriter
+{
+public:
+    bool addIcon(IconId id, const QPainterPath& path, qreal advance, int unitsPerEm);
+    QByteArray data() const;
+    bool save(const QString& fileName) const;
+
+private:
+    /// An icon of the bundle
+    struct Icon
+    {
+        QPainterPath path;   ///< the outline in font units
+        qreal advance;       ///< the advance width in font units
+        int unitsPerEm;      ///< the em size in font units
+    };
+
+    QMap<quint32, Icon> icons_;   ///< the icons, sorted by IconId
+};
+
+} // namespace fa
+
+#endif // QTAWESOMEBUNDLE_H
@@ -0,0 +1,92 @@
+/**
+ * QtAwesome - use font-awesome (or other font icons) in your c++ / Qt Application
+ *
+ * MIT Licensed
+ *
+ * Copyright 2013-2024 - Reliable Bits Software by Blommers IT. All Rights Reserved.
+ * Author Rick Blommers
+ */
+
+#ifndef QTAWESOMEICONID_H
+#define QTAWESOMEICONID_H
+
+#include <QDataStream>
+#include <QHash>
+#include <QMetaType>
+#include <QString>
+
+namespace fa {
+
+/// A compact icon descriptor, the style and codepoint of an icon packed in 32 bits
+/// Bits 0-20 contain the codepoint (including the 21-bit duotone range), bits 24-31 the style.
+///
+/// An IconId can be used as hash key, stored in a QVariant (e.g. a model role) and streamed,
+/// and is accepted by QtAwesome::icon.
+class IconId
+{
+public:
+    constexpr IconId() : _value(0) {}
+    constexpr IconId(int style, int codePoint)
+        : _value((static_cast<quint32>(style) << 24) | (static_cast<quint32>(codePoint) & 0x1fffff)) {}
+
+    /// Creates the IconId from a packed value (see value())
+    static constexpr IconId fromValue(quint32 value) { return IconId(value); }
+
+    constexpr int style() const { return static_cast<int>(_value >> 24); }
+    constexpr int codePoint() const { return static_cast<int>(_value & 0x1fffff); }
+    constexpr bool isValid() const { return (_value & 0x1fffff) != 0; }
+
+    /// The packed value
+    constexpr quint32 value() const { return _value; }
+
+    friend constexpr bool operator==(IconId a, IconId b) { return a._value == b._value; }
+    friend constexpr bool operator!=(IconId a, IconId b) { return a._value != b._value; }
+
+    /// Orders by style, then codepoint
+    friend constexpr bool operator<(IconId a, IconId b) { return a._value < b._value; }
+
+private:
+    constexpr explicit IconId(quint32 value) : _value(value) {}
+
+    quint32 _value;
+};
+
+/// The (UTF-16) string of a codepoint, codepoints above U+FFFF (e.g. duotone) require a surrogate pair
+inline QString codePointToString(int codePoint)
+{
+    uint ucs4 = static_cast<uint>(codePoint);
+    if (QChar::requiresSurrogates(ucs4)) {
+        QChar pair[2] = { QChar(QChar::highSurrogate(ucs4)), QChar(QChar::lowSurrogate(ucs4)) };
+        return QString(pair, 2);
+    }
+    return QString(QChar(ucs4));
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+inline size_t qHash(IconId id, size_t seed = 0) noexcept
+#else
+inline uint qHash(IconId id, uint seed = 0) noexcept
+#endif
+{
+    return ::qHash(id.value(), seed);
+}
+
+inline QDataStream& operator<<(QDataStream& stream, IconId id)
+{
+    return stream << id.value();
+}
+
+inline QDataStream& operator>>(QDataStream& stream, IconId& id)
+{
+    quint32 value = 0;
+    stream >> value;
+    id = IconId::fromValue(value);
+    return stream;
+}
+
+} // namespace fa
+
+Q_DECLARE_TYPEINFO(fa::IconId, Q_PRIMITIVE_TYPE);
+Q_DECLARE_METATYPE(fa::IconId)
+
+#endif // QTAWESOMEICONID_H
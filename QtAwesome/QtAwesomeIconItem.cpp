@@ -0,0 +1,228 @@
+#include "QtAwesomeIconItem.h"
+#include "QtAwesome.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QQmlEngine>
+#include <QQuickWindow>
+#include <QSGSimpleTextureNode>
+#include <QSGTexture>
+
+namespace fa {
+
+/// The QtAwesome instance used by the FaIcon items (see QtAwesomeIconItem::registerType)
+static QtAwesome* iconItemAwesome = nullptr;
+
+/// A cached glyph texture, with the number of nodes using it
+struct QtAwesomeCachedTexture
+{
+    QSGTexture* texture;
+    int refs;
+};
+
+/// The glyph textures of a window. The textures are created and deleted on the render thread of the window.
+/// The textures in use by a node are kept, a few unused textures are kept for reuse (e.g. an item that is shown again).
+struct QtAwesomeTextureCache
+{
+    QHash<QString, QtAwesomeCachedTexture> textures;
+    QList<QString> unused;   ///< the unused textures, least recently used first
+};
+
+/// The maximum number of unused textures kept per window, animating the color or size of an item creates a texture per frame
+static const int maxUnusedTextures = 64;
+
+static QMutex textureCacheMutex;
+static QHash<QQuickWindow*, QtAwesomeTextureCache> textureCaches;
+
+static QString textureKey(IconId id, const QSize& size, const QColor& color)
+{
+    return QString::asprintf("%08x-%dx%d-%08x", id.value(), size.width(), size.height(), color.rgba());
+}
+
+/// Returns the texture with the rendered glyph and adds a reference, the glyph is only rendered the first time
+/// The texture may be placed in the texture atlas of the scene graph, so icons can be batched.
+static QSGTexture* acquireGlyphTexture(QQuickWindow* window, const QString& key, IconId id, const QSize& size,
+                                       const QColor& color)
+{
+    {
+        QMutexLocker locker(&textureCacheMutex);
+        QHash<QQuickWindow*, QtAwesomeTextureCache>::iterator itr = textureCaches.find(window);
+        if (itr != textureCaches.end()) {
+            QHash<QString, QtAwesomeCachedTexture>::iterator textureItr = itr.value().textures.find(key);
+            if (textureItr != itr.value().textures.end()) {
+                if (textureItr.value().refs++ == 0) itr.value().unused.removeOne(key);
+                return textureItr.value().texture;
+            }
+        } else {
+            textureCaches.insert(window, QtAwesomeTextureCache());
+
+            // the textures belong to the scene graph, they are deleted when it is invalidated
+            QObject::connect(window, &QQuickWindow::sceneGraphInvalidated, window, [window]() {
+                QMutexLocker locker(&textureCacheMutex);
+                QtAwesomeTextureCache& cache = textureCaches[window];
+                for (const QtAwesomeCachedTexture& cachedTexture : cache.textures) {
+                    delete cachedTexture.texture;
+                }
+                cache.textures.clear();
+                cache.unused.clear();
+            }, Qt::DirectConnection);
+            QObject::connect(window, &QObject::destroyed, [window]() {
+                QMutexLocker locker(&textureCacheMutex);
+                textureCaches.remove(window);
+            });
+        }
+    }
+
+    QVariantMap options;
+    options.insert("color", color);
+    QImage image = iconItemAwesome->image(id, size, options);
+    QSGTexture* texture = window->createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas | QQuickWindow::TextureHasAlphaChannel);
+
+    QtAwesomeCachedTexture cachedTexture = { texture, 1 };
+    QMutexLocker locker(&textureCacheMutex);
+    textureCaches[window].textures.insert(key, cachedTexture);
+    return texture;
+}
+
+/// Releases a reference to the texture. Unused textures are kept for reuse, the least recently used
+/// texture is deleted when there are more than maxUnusedTextures.
+static void releaseGlyphTexture(QQuickWindow* window, const QString& key)
+{
+    QMutexLocker locker(&textureCacheMutex);
+    QHash<QQuickWindow*, QtAwesomeTextureCache>::iterator itr = textureCaches.find(window);
+    if (itr == textureCaches.end()) return;   // the window is gone
+
+    QtAwesomeTextureCache& cache = itr.value();
+    QHash<QString, QtAwesomeCachedTexture>::iterator textureItr = cache.textures.find(key);
+    if (textureItr == cache.textures.end()) return;   // the scene graph was invalidated
+    if (--textureItr.value().refs > 0) return;
+
+    cache.unused.append(key);
+    while (cache.unused.size() > maxUnusedTextures) {
+        delete cache.textures.take(cache.unused.takeFirst()).texture;
+    }
+}
+
+/// The texture node of an icon item, it holds a reference to its glyph texture
+class QtAwesomeIconNode : public QSGSimpleTextureNode
+{
+public:
+    explicit QtAwesomeIconNode(QQuickWindow* window)
+        : windowRef_(window)
+    {
+        setFiltering(QSGTexture::Linear);
+    }
+
+    virtual ~QtAwesomeIconNode() override
+    {
+        if (!key_.isEmpty()) releaseGlyphTexture(windowRef_, key_);
+    }
+
+    /// Shows the glyph, the texture of the previous glyph is released
+    void setGlyph(IconId id, const QSize& size, const QColor& color)
+    {
+        QString key = textureKey(id, size, color);
+        if (key == key_) return;
+
+        setTexture(acquireGlyphTexture(windowRef_, key, id, size, color));
+        if (!key_.isEmpty()) releaseGlyphTexture(windowRef_, key_);
+        key_ = key;
+    }
+
+private:
+    QQuickWindow* windowRef_;   ///< the window of the texture cache
+    QString key_;               ///< the key of the texture in the cache
+};
+
+//---------------------------------------------------------------------------------------
+
+QtAwesomeIconItem::QtAwesomeIconItem(QQuickItem* parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents);
+    setImplicitWidth(24);
+    setImplicitHeight(24);
+
+    // the glyph is rendered for the pixel size of the item
+    connect(this, &QQuickItem::widthChanged, this, &QQuickItem::update);
+    connect(this, &QQuickItem::heightChanged, this, &QQuickItem::update);
+    if (iconItemAwesome) {
+        connect(iconItemAwesome, &QtAwesome::defaultOptionsReset, this, &QQuickItem::update);
+    }
+}
+
+/// Registers the FaIcon QML type (version 1.0) in the given module
+/// @param awesome the QtAwesome instance used to resolve and render the icons, initFontAwesome must be called
+void QtAwesomeIconItem::registerType(QtAwesome* awesome, const char* uri)
+{
+    iconItemAwesome = awesome;
+    qmlRegisterType<QtAwesomeIconItem>(uri, 1, 0, "FaIcon");
+}
+
+QString QtAwesomeIconItem::name() const
+{
+    return name_;
+}
+
+/// Sets the icon name, e.g. "fa-solid fa-house" (see QtAwesome::icon)
+void QtAwesomeIconItem::setName(const QString& name)
+{
+    if (name_ == name) return;
+
+    name_ = name;
+    iconId_ = iconItemAwesome ? iconItemAwesome->iconId(name) : IconId();
+    update();
+    Q_EMIT nameChanged();
+}
+
+QColor QtAwesomeIconItem::color() const
+{
+    return color_;
+}
+
+/// Sets the icon color. Every color is a separate texture, for fading use the opacity
+void QtAwesomeIconItem::setColor(const QColor& color)
+{
+    if (color_ == color) return;
+
+    color_ = color;
+    update();
+    Q_EMIT colorChanged();
+}
+
+/// The resolved icon name, invalid when the name isn't known
+IconId QtAwesomeIconItem::iconId() const
+{
+    return iconId_;
+}
+
+/// Called on the render thread, while the gui thread is blocked
+QSGNode* QtAwesomeIconItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+
+    QSize size = (boundingRect().size() * window()->effectiveDevicePixelRatio()).toSize();
+    if (!iconItemAwesome || !iconId_.isValid() || size.isEmpty()) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    QColor color = color_.isValid() ? color_ : iconItemAwesome->defaultOption("color").value<QColor>();
+
+    QtAwesomeIconNode* node = static_cast<QtAwesomeIconNode*>(oldNode);
+    if (!node) {
+        node = new QtAwesomeIconNode(window());
+    }
+    node->setGlyph(iconId_, size, color);
+    node->setRect(boundingRect());
+    return node;
+}
+
+/// The number of glyph textures cached for the window, the textures in use and at most 64 unused textures
+int QtAwesomeIconItem::cachedTextureCount(QQuickWindow* window)
+{
+    QMutexLocker locker(&textureCacheMutex);
+    return textureCaches.value(window).textures.size();
+}
+
+} // namespace fa
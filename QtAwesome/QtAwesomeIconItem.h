@@ -0,0 +1,63 @@
+#ifndef QTAWESOMEICONITEM_H
+#define QTAWESOMEICONITEM_H
+
+#include <QColor>
+#include <QQuickItem>
+
+#include "QtAwesomeIconId.h"
+
+namespace fa {
+
+class QtAwesome;
+
+///
+/// A QML item that draws an icon as a scene graph texture node.
+///
+///     fa::QtAwesomeIconItem::registerType(awesome);   // registers FaIcon in the QtAwesome 1.0 module
+///
+///     import QtAwesome 1.0
+///     FaIcon { name: "fa-solid fa-house"; color: "white"; width: 32; height: 32 }
+///
+/// The glyphs are rendered once per icon, size and color into textures that may be placed in the
+/// shared texture atlas, so the scene graph can batch the icons of a scene in a few draw calls.
+/// Rotation, scale and opacity (and their animations) are applied by the scene graph, without
+/// rendering the glyph again. The item works with the software scene graph backend as well.
+/// The textures are shared by the items and released with the last item using them, animating the color or size
+/// renders a texture per frame, only a few unused textures are kept.
+///
+class QtAwesomeIconItem : public QQuickItem
+{
+Q_OBJECT
+    Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+
+public:
+    explicit QtAwesomeIconItem(QQuickItem* parent = nullptr);
+
+    static void registerType(QtAwesome* awesome, const char* uri = "QtAwesome");
+    static int cachedTextureCount(QQuickWindow* window);
+
+    QString name() const;
+    void setName(const QString& name);
+
+    QColor color() const;
+    void setColor(const QColor& color);
+
+    IconId iconId() const;
+
+Q_SIGNALS:
+    void nameChanged();
+    void colorChanged();
+
+protected:
+    virtual QSGNode* updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    QString name_;     ///< the icon name
+    QColor color_;     ///< the icon color, the QtAwesome default color when invalid
+    IconId iconId_;    ///< the resolved icon name
+};
+
+} // namespace fa
+
+#endif // QTAWESOMEICONITEM_H
@@ -0,0 +1,159 @@
+#include "QtAwesomeImageProvider.h"
+#include "QtAwesome.h"
+
+#include <QCache>
+#include <QColor>
+#include <QImage>
+#include <QMutex>
+#include <QRunnable>
+#include <QStringList>
+#include <QUrl>
+
+namespace fa {
+
+/// The process-wide cache of rendered icons, shared by all providers and threads
+/// (the QPixmapCache can only be used from the gui thread)
+static QMutex imageCacheMutex;
+static QCache<QString, QImage> imageCache(10 * 1024); // the cost is the image size in KB
+
+/// Splits the image id, like "fa-solid/house?color=#fff", in the icon name and the icon options
+static void parseImageId(const QString& id, QString* name, QVariantMap* options)
+{
+    int queryIndex = id.indexOf('?');
+    *name = QUrl::fromPercentEncoding(id.left(queryIndex).toUtf8()).replace('/', ' ');
+    if (queryIndex < 0) return;
+
+    const QStringList items = id.mid(queryIndex + 1).split('&');
+    for (const QString& item : items) {
+        if (item.isEmpty()) continue;
+
+        int equalsIndex = item.indexOf('=');
+        QString key = QUrl::fromPercentEncoding(item.left(equalsIndex).toUtf8());
+        QString value = equalsIndex < 0 ? QString() : QUrl::fromPercentEncoding(item.mid(equalsIndex + 1).toUtf8());
+
+        if (key.startsWith("color") || key.startsWith("duotone-color")) {
+            options->insert(key, QColor(value));
+        } else if (key == "scale-factor") {
+            options->insert(key, value.toDouble());
+        } else {
+            options->insert(key, value);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------
+
+/// The response of an image request, the image is rendered when the thread pool runs it
+class QtAwesomeImageResponse : public QQuickImageResponse, public QRunnable
+{
+public:
+
+    QtAwesomeImageResponse(QtAwesome* awesome, const QString& id, const QSize& size)
+        : awesomeRef_(awesome)
+        , id_(id)
+        , size_(size)
+    {
+        // the response is deleted by the QML engine
+        setAutoDelete(false);
+    }
+
+    virtual QQuickTextureFactory* textureFactory() const override
+    {
+        return QQuickTextureFactory::textureFactoryForImage(image_);
+    }
+
+    virtual QString errorString() const override
+    {
+        return errorString_;
+    }
+
+    virtual void run() override
+    {
+        QString key = QString("%1:%2@%3x%4").arg(reinterpret_cast<quintptr>(awesomeRef_)).arg(id_)
+                                            .arg(size_.width()).arg(size_.height());
+        {
+            QMutexLocker locker(&imageCacheMutex);
+            if (QImage* image = imageCache.object(key)) {
+                image_ = *image;
+            }
+        }
+
+        if (image_.isNull()) {
+            QString name;
+            QVariantMap options;
+            parseImageId(id_, &name, &options);
+
+            IconId iconId = awesomeRef_->iconId(name);
+            if (!iconId.isValid()) {
+                errorString_ = QString("Unknown icon: %1").arg(name);
+                Q_EMIT finished();
+                return;
+            }
+
+            image_ = awesomeRef_->image(iconId, size_, options);
+
+            QMutexLocker locker(&imageCacheMutex);
+            imageCache.insert(key, new QImage(image_), qMax(1, static_cast<int>(image_.sizeInBytes() / 1024)));
+        }
+
+        Q_EMIT finished();
+    }
+
+private:
+
+    QtAwesome* awesomeRef_;   ///< a reference to the QtAwesome instance
+    QString id_;              ///< the requested image id
+    QSize size_;              ///< the size of the image
+    QImage image_;            ///< the rendered image
+    QString errorString_;     ///< the error when the icon can't be rendered
+};
+
+//---------------------------------------------------------------------------------------
+
+QtAwesomeImageProvider::QtAwesomeImageProvider(QtAwesome* awesome)
+    : awesomeRef_(awesome)
+    , defaultSize_(64, 64)
+{
+    // the default colors depend on the palette
+    QObject::connect(awesome, &QtAwesome::defaultOptionsReset, awesome, []() {
+        QMutexLocker locker(&imageCacheMutex);
+        imageCache.clear();
+    });
+}
+
+QtAwesomeImageProvider::~QtAwesomeImageProvider()
+{
+    pool_.waitForDone();
+}
+
+/// Sets the image size that is used when the image has no sourceSize
+/// (Set it before the provider is added to the QML engine)
+void QtAwesomeImageProvider::setDefaultSize(const QSize& size)
+{
+    defaultSize_ = size;
+}
+
+QSize QtAwesomeImageProvider::defaultSize() const
+{
+    return defaultSize_;
+}
+
+/// Starts rendering the image on a worker thread
+/// When only the width or height of the sourceSize is given, a square image is rendered.
+QQuickImageResponse* QtAwesomeImageProvider::requestImageResponse(const QString& id, const QSize& requestedSize)
+{
+    QSize size = requestedSize;
+    if (size.width() <= 0 && size.height() <= 0) {
+        size = defaultSize_;
+    } else if (size.width() <= 0) {
+        size.setWidth(size.height());
+    } else if (size.height() <= 0) {
+        size.setHeight(size.width());
+    }
+
+    QtAwesomeImageResponse* response = new QtAwesomeImageResponse(awesomeRef_, id, size);
+    pool_.start(response);
+    return response;
+}
+
+} // namespace fa
@@ -0,0 +1,42 @@
+#ifndef QTAWESOMEIMAGEPROVIDER_H
+#define QTAWESOMEIMAGEPROVIDER_H
+
+#include <QQuickAsyncImageProvider>
+#include <QSize>
+#include <QThreadPool>
+
+namespace fa {
+
+class QtAwesome;
+
+///
+/// A QML image provider for QtAwesome icons. The icons are rendered on a worker thread.
+///
+///     engine.addImageProvider("fa", new fa::QtAwesomeImageProvider(awesome));
+///
+///     Image { source: "image://fa/fa-solid/house?color=#fff"; sourceSize: Qt.size(32, 32) }
+///
+/// The image id is the style and icon name separated by a slash (the style is optional),
+/// the query contains the icon options. (e.g. color, color-disabled, scale-factor)
+/// The rendered images are shared via a process-wide cache.
+///
+class QtAwesomeImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    explicit QtAwesomeImageProvider(QtAwesome* awesome);
+    virtual ~QtAwesomeImageProvider();
+
+    void setDefaultSize(const QSize& size);
+    QSize defaultSize() const;
+
+    virtual QQuickImageResponse* requestImageResponse(const QString& id, const QSize& requestedSize) override;
+
+private:
+    QtAwesome* awesomeRef_;   ///< a reference to the QtAwesome instance
+    QSize defaultSize_;       ///< the image size when no sourceSize is given
+    QThreadPool pool_;        ///< the threads rendering the images
+};
+
+} // namespace fa
+
+#endif // QTAWESOMEIMAGEPROVIDER_H
@@ -0,0 +1,228 @@
+#include "QtAwesomeItemDelegate.h"
+#include "QtAwesome.h"
+
+#include <QAbstractItemView>
+#include <QApplication>
+#include <QAtomicInt>
+#include <QPainter>
+#include <QPixmapCache>
+#include <QStyle>
+
+namespace fa {
+
+/// Returns a new pixmap cache generation. The generations are unique in the process, the cached pixmaps outlive
+/// the delegate, so a delegate (e.g. at the address of a deleted one) never gets the pixmaps of another delegate.
+static int nextGeneration()
+{
+    static QAtomicInt generation;
+    return generation.fetchAndAddRelaxed(1) + 1;
+}
+
+/// Creates the delegate, by default the icons are read from the Qt::DecorationRole
+QtAwesomeItemDelegate::QtAwesomeItemDelegate(QtAwesome* awesome, QObject* parent)
+    : QStyledItemDelegate(parent)
+    , awesomeRef_(awesome)
+    , iconRole_(Qt::DecorationRole)
+    , generation_(nextGeneration())
+    , animationRole_(-1)
+{
+    // the default colors depend on the palette
+    connect(awesome, SIGNAL(defaultOptionsReset()), this, SLOT(invalidate()));
+}
+
+/// Sets the model role that contains the IconId or icon name (e.g. "fa-solid fa-house")
+void QtAwesomeItemDelegate::setIconRole(int role)
+{
+    iconRole_ = role;
+}
+
+int QtAwesomeItemDelegate::iconRole() const
+{
+    return iconRole_;
+}
+
+/// Sets the options that are passed to QtAwesome::icon
+void QtAwesomeItemDelegate::setOptions(const QVariantMap& options)
+{
+    options_ = options;
+    invalidate();
+}
+
+QVariantMap QtAwesomeItemDelegate::options() const
+{
+    return options_;
+}
+
+/// Sets the model role that contains the QtAwesomeAnimation::Type of an animated icon, -1 disables the animations
+void QtAwesomeItemDelegate::setAnimationRole(int role)
+{
+    animationRole_ = role;
+}
+
+int QtAwesomeItemDelegate::animationRole() const
+{
+    return animationRole_;
+}
+
+void QtAwesomeItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    // the icon role is read once per paint, it's passed to the helpers instead of reading it again
+    QVariant value = index.data(iconRole_);
+    IconId id = iconIdForValue(value);
+    QtAwesomeLayers layers = id.isValid() ? QtAwesomeLayers() : layersForValue(value);
+    if (!id.isValid() && layers.isEmpty()) {
+        QStyledItemDelegate::paint(painter, option, index);
+        return;
+    }
+
+    QStyleOptionViewItem opt = option;
+    initIconStyleOption(&opt, index, value);
+
+    const QWidget* widget = opt.widget;
+    QStyle* style = widget ? widget->style() : QApplication::style();
+
+    // the style paints the background, text and focus rect, the icon is empty
+    style->drawControl(QStyle::CE_ItemViewItem, &opt, painter, widget);
+
+    // the same mode and state as the style uses for icons
+    QIcon::Mode mode = QIcon::Normal;
+    if (!(opt.state & QStyle::State_Enabled)) {
+        mode = QIcon::Disabled;
+    } else if (opt.state & QStyle::State_Selected) {
+        mode = QIcon::Selected;
+    }
+    QIcon::State state = (opt.state & QStyle::State_Open) ? QIcon::On : QIcon::Off;
+
+    QRect iconRect = style->subElementRect(QStyle::SE_ItemViewItemDecoration, &opt, widget);
+
+    qreal devicePixelRatio = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+
+    // animated icons are painted on the viewport, so the animation only updates the painted rows
+    // the cached pixmap is transformed by the animation, the glyph isn't rendered again every frame
+    QtAwesomeAnimation* animation = id.isValid() ? animationForIndex(index, widget) : nullptr;
+    if (animation) {
+        painter->save();
+        painter->setRenderHint(QPainter::SmoothPixmapTransform);
+        animation->setup(*painter, iconRect);
+        painter->drawPixmap(iconRect.topLeft(), pixmap(id, iconRect.size(), devicePixelRatio, mode, state));
+        painter->restore();
+        return;
+    }
+
+    if (!layers.isEmpty()) {
+        // the stacked icon painter keeps the composite in the QPixmapCache
+        awesomeRef_->stackedIcon(layers, options_).paint(painter, iconRect, Qt::AlignCenter, mode, state);
+        return;
+    }
+    painter->drawPixmap(iconRect.topLeft(), pixmap(id, iconRect.size(), devicePixelRatio, mode, state));
+}
+
+/// Reserves the decoration space for rows with an icon, the icon itself is painted by paint
+void QtAwesomeItemDelegate::initStyleOption(QStyleOptionViewItem* option, const QModelIndex& index) const
+{
+    initIconStyleOption(option, index, index.data(iconRole_));
+}
+
+/// initStyleOption with the value of the icon role, when it has been read already
+void QtAwesomeItemDelegate::initIconStyleOption(QStyleOptionViewItem* option, const QModelIndex& index, const QVariant& value) const
+{
+    QStyledItemDelegate::initStyleOption(option, index);
+
+    if (iconIdForValue(value).isValid() || value.userType() == qMetaTypeId<QtAwesomeLayers>()) {
+        option->features |= QStyleOptionViewItem::HasDecoration;
+        option->icon = QIcon();
+    }
+}
+
+/// Returns the IconId of a value of the icon role, it may contain an IconId or an icon name
+/// @return the IconId, or an invalid IconId when the value isn't a (known) icon
+IconId QtAwesomeItemDelegate::iconIdForValue(const QVariant& value) const
+{
+    if (value.userType() == qMetaTypeId<IconId>()) {
+        return value.value<IconId>();
+    }
+    if (value.userType() == QMetaType::QString) {
+        return awesomeRef_->iconId(value.toString());
+    }
+    return IconId();
+}
+
+/// Returns the layers of a value of the icon role, when it contains QtAwesomeLayers (a stacked icon)
+QtAwesomeLayers QtAwesomeItemDelegate::layersForValue(const QVariant& value) const
+{
+    if (value.userType() == qMetaTypeId<QtAwesomeLayers>()) {
+        return value.value<QtAwesomeLayers>();
+    }
+    return QtAwesomeLayers();
+}
+
+/// Returns the animation of the index, the animations are shared by all rows with the same type in a viewport
+/// @return the animation, or nullptr when the animation role doesn't contain a QtAwesomeAnimation::Type
+QtAwesomeAnimation* QtAwesomeItemDelegate::animationForIndex(const QModelIndex& index, const QWidget* widget) const
+{
+    if (animationRole_ < 0 || !widget) return nullptr;
+
+    // only a real animation type animates, so a model returning false or 0 ("not animated") doesn't get a spinner
+    QVariant value = index.data(animationRole_);
+    if (value.userType() != qMetaTypeId<QtAwesomeAnimation::Type>()) return nullptr;
+
+    int type = value.value<QtAwesomeAnimation::Type>();
+    if (type < QtAwesomeAnimation::Spin || type > QtAwesomeAnimation::Flip) return nullptr;
+
+    const QAbstractItemView* view = qobject_cast<const QAbstractItemView*>(widget);
+    QWidget* viewport = view ? view->viewport() : const_cast<QWidget*>(widget);
+
+    QPair<const QObject*, int> key(viewport, type);
+    QPointer<QtAwesomeAnimation>& animation = animations_[key];
+    if (!animation) {
+        animation = new QtAwesomeAnimation(viewport, static_cast<QtAwesomeAnimation::Type>(type));
+        connect(viewport, SIGNAL(destroyed(QObject*)), this, SLOT(removeViewport(QObject*)), Qt::UniqueConnection);
+    }
+    return animation;
+}
+
+/// Removes the animations of a destroyed viewport (they are deleted with the viewport)
+void QtAwesomeItemDelegate::removeViewport(QObject* viewport)
+{
+    for (auto itr = animations_.begin(); itr != animations_.end();) {
+        if (itr.key().first == viewport) {
+            itr = animations_.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+}
+
+/// Returns the rendered icon, from the QPixmapCache when it has been rendered before
+QPixmap QtAwesomeItemDelegate::pixmap(IconId id, const QSize& size, qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state) const
+{
+    QString key = QString::asprintf("qtawesome-delegate-%d-%08x-%dx%d@%g-%d-%d",
+                                    generation_, id.value(),
+                                    size.width(), size.height(), devicePixelRatio,
+                                    static_cast<int>(mode), static_cast<int>(state));
+
+    QPixmap result;
+    if (QPixmapCache::find(key, &result)) {
+        return result;
+    }
+
+    result = QPixmap(size * devicePixelRatio);
+    result.setDevicePixelRatio(devicePixelRatio);
+    result.fill(Qt::transparent);
+    {
+        QPainter painter(&result);
+        awesomeRef_->icon(id, options_).paint(&painter, QRect(QPoint(0, 0), size), Qt::AlignCenter, mode, state);
+    }
+
+    QPixmapCache::insert(key, result);
+    return result;
+}
+
+/// Changes the pixmap cache keys, so the icons are rendered again
+/// The pixmaps with the old keys aren't used anymore, the QPixmapCache discards them when it's full
+void QtAwesomeItemDelegate::invalidate()
+{
+    generation_ = nextGeneration();
+}
+
+} // namespace fa
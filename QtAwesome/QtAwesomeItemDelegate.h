@@ -0,0 +1,79 @@
+#ifndef QTAWESOMEITEMDELEGATE_H
+#define QTAWESOMEITEMDELEGATE_H
+
+#include <QHash>
+#include <QPair>
+#include <QPointer>
+#include <QStyledItemDelegate>
+#include <QVariantMap>
+
+#include "QtAwesome.h"
+
+namespace fa {
+
+///
+/// An item delegate that paints icons from a model role containing an IconId, an icon name or QtAwesomeLayers
+///
+/// The model doesn't need to create a QIcon per row, the icons are resolved and painted when a row
+/// is painted, so only the visible rows are rendered. The rendered pixmaps are stored in the QPixmapCache.
+///
+///     model->setData(index, QVariant::fromValue(fa::IconId(fa::fa_solid, fa::fa_house)), Qt::DecorationRole);
+///     view->setItemDelegate(new fa::QtAwesomeItemDelegate(awesome, view));
+///
+/// Other role values (e.g. a QIcon) are painted like QStyledItemDelegate does.
+///
+/// Icons can be animated per row via the animation role, e.g. a spinner for running jobs. The role contains
+/// a QtAwesomeAnimation::Type stored with QVariant::fromValue. Rows with any other value (e.g. QVariant(), false or 0)
+/// aren't animated. Each tick only the animated rows that were painted (the visible ones) are updated, the rest of
+/// the viewport isn't repainted.
+///
+///     delegate->setAnimationRole(JobRunningRole);
+///     // data(JobRunningRole) returns QVariant::fromValue(fa::QtAwesomeAnimation::Spin) or QVariant()
+///
+class QtAwesomeItemDelegate : public QStyledItemDelegate
+{
+Q_OBJECT
+
+public:
+    explicit QtAwesomeItemDelegate(QtAwesome* awesome, QObject* parent = nullptr);
+
+    void setIconRole(int role);
+    int iconRole() const;
+
+    void setOptions(const QVariantMap& options);
+    QVariantMap options() const;
+
+    void setAnimationRole(int role);
+    int animationRole() const;
+
+    virtual void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+protected:
+    virtual void initStyleOption(QStyleOptionViewItem* option, const QModelIndex& index) const override;
+
+    IconId iconIdForValue(const QVariant& value) const;
+    QtAwesomeLayers layersForValue(const QVariant& value) const;
+    QtAwesomeAnimation* animationForIndex(const QModelIndex& index, const QWidget* widget) const;
+    QPixmap pixmap(IconId id, const QSize& size, qreal devicePixelRatio, QIcon::Mode mode, QIcon::State state) const;
+
+private Q_SLOTS:
+    void invalidate();
+    void removeViewport(QObject* viewport);
+
+private:
+    void initIconStyleOption(QStyleOptionViewItem* option, const QModelIndex& index, const QVariant& value) const;
+
+    QtAwesome* awesomeRef_;   ///< a reference to the QtAwesome instance
+    int iconRole_;            ///< the model role with the IconId or icon name
+    QVariantMap options_;     ///< the icon options
+    int generation_;          ///< the pixmap cache key prefix, unique in the process, changed when the options change
+    int animationRole_;       ///< the model role with the animation type, -1 when no icons are animated
+
+    /// the animations per viewport and animation type, an animation is owned by its viewport
+    /// (the entries of a viewport are removed when it's destroyed)
+    mutable QHash<QPair<const QObject*, int>, QPointer<QtAwesomeAnimation>> animations_;
+};
+
+} // namespace fa
+
+#endif // QTAWESOMEITEMDELEGATE_H
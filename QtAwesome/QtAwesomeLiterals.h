@@ -0,0 +1,199 @@
+/**
+ * QtAwesome - use font-awesome (or other font icons) in your c++ / Qt Application
+ *
+ * MIT Licensed
+ *
+ * Copyright 2013-2024 - Reliable Bits Software by Blommers IT. All Rights Reserved.
+ * Author Rick Blommers
+ */
+
+#ifndef QTAWESOMELITERALS_H
+#define QTAWESOMELITERALS_H
+
+/// Compile-time icon names. Resolves names like "fa-solid fa-house" to an IconId while compiling,
+/// so no runtime name lookup is required:
+///
+///     using namespace fa::literals;
+///     constexpr fa::IconId house = "fa-solid fa-house"_fa;
+///     awesome->icon(house);
+///
+/// An unknown style or name is a compile error. (Requires C++14, with C++20 the literal is consteval)
+/// Only use these functions in constant expressions, at runtime the name tables would be included in the object file.
+
+#include "QtAwesome.h"
+#include "QtAwesomeIconId.h"
+
+// with an icon subset the trimmed name tables are used, so an icon outside the subset is a compile error
+#ifdef QTAWESOME_ICON_SUBSET
+#include "QtAwesomeSubset/QtAwesomeStringGenerated.h"
+#else
+#include "QtAwesomeStringGenerated.h"
+#endif
+
+#include <cstddef>
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+
+#if defined(__cpp_consteval)
+#define QTAWESOME_CONSTEVAL consteval
+#else
+#define QTAWESOME_CONSTEVAL constexpr
+#endif
+
+namespace fa {
+namespace detail {
+
+/// Called for an unknown icon name. It isn't constexpr, so an unknown name results in a compile error
+inline void font_awesome_icon_name_not_found()
+{
+}
+
+constexpr bool literalHasFaPrefix(const char* name, std::size_t size)
+{
+    return size >= 3 && name[0] == 'f' && name[1] == 'a' && name[2] == '-';
+}
+
+/// Compares the characters to a \0 terminated name (like strcmp)
+constexpr int literalCompare(const char* data, std::size_t size, const char* name)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        if (name[i] == 0) return 1;
+        if (data[i] != name[i]) {
+            return static_cast<unsigned char>(data[i]) < static_cast<unsigned char>(name[i]) ? -1 : 1;
+        }
+    }
+    return name[size] == 0 ? 0 : -1;
+}
+
+/// Resolves the style name (without the fa- prefix), returns -1 for an unknown style
+constexpr int literalStyle(const char* data, std::size_t size)
+{
+    if (literalCompare(data, size, "solid") == 0) return fa_solid;
+    if (literalCompare(data, size, "regular") == 0) return fa_regular;
+    if (literalCompare(data, size, "brands") == 0) return fa_brands;
+#ifdef FONT_AWESOME_PRO
+    if (literalCompare(data, size, "light") == 0) return fa_light;
+    if (literalCompare(data, size, "thin") == 0) return fa_thin;
+    if (literalCompare(data, size, "duotone") == 0) return fa_duotone; // DEPRECATED
+    if (literalCompare(data, size, "duotone-solid") == 0) return fa_duotone_solid;
+    if (literalCompare(data, size, "duotone-regular") == 0) return fa_duotone_regular;
+    if (literalCompare(data, size, "duotone-light") == 0) return fa_duotone_light;
+    if (literalCompare(data, size, "duotone-thin") == 0) return fa_duotone_thin;
+    if (literalCompare(data, size, "sharp-solid") == 0) return fa_sharp_solid;
+    if (literalCompare(data, size, "sharp-regular") == 0) return fa_sharp_regular;
+    if (literalCompare(data, size, "sharp-light") == 0) return fa_sharp_light;
+    if (literalCompare(data, size, "sharp-thin") == 0) return fa_sharp_thin;
+    if (literalCompare(data, size, "sharp-duotone-solid") == 0) return fa_sharp_duotone_solid;
+    if (literalCompare(data, size, "sharp-duotone-regular") == 0) return fa_sharp_duotone_regular;
+    if (literalCompare(data, size, "sharp-duotone-light") == 0) return fa_sharp_duotone_light;
+    if (literalCompare(data, size, "sharp-duotone-thin") == 0) return fa_sharp_duotone_thin;
+#endif
+    return -1;
+}
+
+/// Binary search in a sorted name table, returns -1 when the name isn't found
+constexpr int literalFind(const QtAwesomeNamedIcon* icons, int count, const char* data, std::size_t size)
+{
+    int first = 0;
+    int last = count;
+    while (first < last) {
+        int middle = (first + last) / 2;
+        int cmp = literalCompare(data, size, faIconNames + icons[middle].nameOffset);
+        if (cmp == 0) return icons[middle].icon;
+        if (cmp < 0) {
+            last = middle;
+        } else {
+            first = middle + 1;
+        }
+    }
+    return -1;
+}
+
+/// Looks up the name in the name tables of the style (the same tables as QtAwesome::initFontAwesome uses)
+constexpr int literalCodePoint(int style, const char* data, std::size_t size)
+{
+    if (style == fa_brands) return literalFind(faBrandsIconArray, faBrandsIconCount, data, size);
+#ifdef FONT_AWESOME_PRO
+    int codePoint = literalFind(faCommonIconArray, faCommonIconCount, data, size);
+    return codePoint >= 0 ? codePoint : literalFind(faProIconArray, faProIconCount, data, size);
+#else
+    if (style == fa_regular) return literalFind(faRegularFreeIconArray, faRegularFreeIconCount, data, size);
+    return literalFind(faCommonIconArray, faCommonIconCount, data, size);
+#endif
+}
+
+} // namespace detail
+
+/// Resolves an icon name, like "fa-solid fa-house", to an IconId. (The same names as QtAwesome::icon accepts)
+/// In a constant expression an unknown style or name is a compile error, at runtime an invalid IconId is returned.
+constexpr IconId iconLiteral(const char* name, std::size_t size)
+{
+    std::size_t spaceIndex = 0;
+    while (spaceIndex < size && name[spaceIndex] != ' ') ++spaceIndex;
+
+    int style = fa_solid;
+    const char* iconName = name;
+    std::size_t iconNameSize = size;
+
+    if (spaceIndex > 0 && spaceIndex < size) {
+        const char* styleName = name;
+        std::size_t styleNameSize = spaceIndex;
+        if (detail::literalHasFaPrefix(styleName, styleNameSize)) {
+            styleName += 3;
+            styleNameSize -= 3;
+        }
+        style = detail::literalStyle(styleName, styleNameSize);
+        iconName = name + spaceIndex + 1;
+        iconNameSize = size - spaceIndex - 1;
+    }
+
+    if (detail::literalHasFaPrefix(iconName, iconNameSize)) {
+        iconName += 3;
+        iconNameSize -= 3;
+    }
+
+    int codePoint = style >= 0 ? detail::literalCodePoint(style, iconName, iconNameSize) : -1;
+    if (codePoint < 0) {
+        detail::font_awesome_icon_name_not_found();
+        return IconId();
+    }
+    return IconId(style, codePoint);
+}
+
+namespace literals {
+
+/// The icon literal: "fa-solid fa-house"_fa
+QTAWESOME_CONSTEVAL IconId operator""_fa(const char* name, std::size_t size)
+{
+    return iconLiteral(name, size);
+}
+
+} // namespace literals
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+/// A string literal as template argument, for fa::named<"fa-solid fa-house">()
+template<std::size_t N>
+struct IconName
+{
+    constexpr IconName(const char (&name)[N])
+    {
+        for (std::size_t i = 0; i < N; ++i) value[i] = name[i];
+    }
+
+    char value[N];
+};
+
+/// Resolves the icon name at compile time: fa::named<"fa-solid fa-house">()
+template<IconName name>
+constexpr IconId named()
+{
+    constexpr IconId id = iconLiteral(name.value, sizeof(name.value) - 1);
+    return id;
+}
+#endif
+
+} // namespace fa
+
+#endif // __cpp_constexpr
+
+#endif // QTAWESOMELITERALS_H
@@ -1,5109 +1,9964 @@
-static const fa::QtAwesomeNamedIcon faCommonIconArray[] = {
-    { "0", fa::fa_0 } ,
-    { "1", fa::fa_1 } ,
-    { "2", fa::fa_2 } ,
-    { "3", fa::fa_3 } ,
-    { "4", fa::fa_4 } ,
-    { "5", fa::fa_5 } ,
-    { "6", fa::fa_6 } ,
-    { "7", fa::fa_7 } ,
-    { "8", fa::fa_8 } ,
-    { "9", fa::fa_9 } ,
-    { "a", fa::fa_a } ,
-    { "address-book", fa::fa_address_book } ,
-    { "contact-book", fa::fa_contact_book } ,
-    { "address-card", fa::fa_address_card } ,
-    { "contact-card", fa::fa_contact_card } ,
-    { "vcard", fa::fa_vcard } ,
-    { "align-center", fa::fa_align_center } ,
-    { "align-justify", fa::fa_align_justify } ,
-    { "align-left", fa::fa_align_left } ,
-    { "align-right", fa::fa_align_right } ,
-    { "anchor", fa::fa_anchor } ,
-    { "anchor-circle-check", fa::fa_anchor_circle_check } ,
-    { "anchor-circle-exclamation", fa::fa_anchor_circle_exclamation } ,
-    { "anchor-circle-xmark", fa::fa_anchor_circle_xmark } ,
-    { "anchor-lock", fa::fa_anchor_lock } ,
-    { "angle-down", fa::fa_angle_down } ,
-    { "angle-left", fa::fa_angle_left } ,
-    { "angle-right", fa::fa_angle_right } ,
-    { "angle-up", fa::fa_angle_up } ,
-    { "angles-down", fa::fa_angles_down } ,
-    { "angle-double-down", fa::fa_angle_double_down } ,
-    { "angles-left", fa::fa_angles_left } ,
-    { "angle-double-left", fa::fa_angle_double_left } ,
-    { "angles-right", fa::fa_angles_right } ,
-    { "angle-double-right", fa::fa_angle_double_right } ,
-    { "angles-up", fa::fa_angles_up } ,
-    { "angle-double-up", fa::fa_angle_double_up } ,
-    { "ankh", fa::fa_ankh } ,
-    { "apple-whole", fa::fa_apple_whole } ,
-    { "apple-alt", fa::fa_apple_alt } ,
-    { "archway", fa::fa_archway } ,
-    { "arrow-down", fa::fa_arrow_down } ,
-    { "arrow-down-1-9", fa::fa_arrow_down_1_9 } ,
-    { "sort-numeric-asc", fa::fa_sort_numeric_asc } ,
-    { "sort-numeric-down", fa::fa_sort_numeric_down } ,
-    { "arrow-down-9-1", fa::fa_arrow_down_9_1 } ,
-    { "sort-numeric-desc", fa::fa_sort_numeric_desc } ,
-    { "sort-numeric-down-alt", fa::fa_sort_numeric_down_alt } ,
-    { "arrow-down-a-z", fa::fa_arrow_down_a_z } ,
-    { "sort-alpha-asc", fa::fa_sort_alpha_asc } ,
-    { "sort-alpha-down", fa::fa_sort_alpha_down } ,
-    { "arrow-down-long", fa::fa_arrow_down_long } ,
-    { "long-arrow-down", fa::fa_long_arrow_down } ,
-    { "arrow-down-short-wide", fa::fa_arrow_down_short_wide } ,
-    { "sort-amount-desc", fa::fa_sort_amount_desc } ,
-    { "sort-amount-down-alt", fa::fa_sort_amount_down_alt } ,
-    { "arrow-down-up-across-line", fa::fa_arrow_down_up_across_line } ,
-    { "arrow-down-up-lock", fa::fa_arrow_down_up_lock } ,
-    { "arrow-down-wide-short", fa::fa_arrow_down_wide_short } ,
-    { "sort-amount-asc", fa::fa_sort_amount_asc } ,
-    { "sort-amount-down", fa::fa_sort_amount_down } ,
-    { "arrow-down-z-a", fa::fa_arrow_down_z_a } ,
-    { "sort-alpha-desc", fa::fa_sort_alpha_desc } ,
-    { "sort-alpha-down-alt", fa::fa_sort_alpha_down_alt } ,
-    { "arrow-left", fa::fa_arrow_left } ,
-    { "arrow-left-long", fa::fa_arrow_left_long } ,
-    { "long-arrow-left", fa::fa_long_arrow_left } ,
-    { "arrow-pointer", fa::fa_arrow_pointer } ,
-    { "mouse-pointer", fa::fa_mouse_pointer } ,
-    { "arrow-right", fa::fa_arrow_right } ,
-    { "arrow-right-arrow-left", fa::fa_arrow_right_arrow_left } ,
-    { "exchange", fa::fa_exchange } ,
-    { "arrow-right-from-bracket", fa::fa_arrow_right_from_bracket } ,
-    { "sign-out", fa::fa_sign_out } ,
-    { "arrow-right-long", fa::fa_arrow_right_long } ,
-    { "long-arrow-right", fa::fa_long_arrow_right } ,
-    { "arrow-right-to-bracket", fa::fa_arrow_right_to_bracket } ,
-    { "sign-in", fa::fa_sign_in } ,
-    { "arrow-right-to-city", fa::fa_arrow_right_to_city } ,
-    { "arrow-rotate-left", fa::fa_arrow_rotate_left } ,
-    { "arrow-left-rotate", fa::fa_arrow_left_rotate } ,
-    { "arrow-rotate-back", fa::fa_arrow_rotate_back } ,
-    { "arrow-rotate-backward", fa::fa_arrow_rotate_backward } ,
-    { "undo", fa::fa_undo } ,
-    { "arrow-rotate-right", fa::fa_arrow_rotate_right } ,
-    { "arrow-right-rotate", fa::fa_arrow_right_rotate } ,
-    { "arrow-rotate-forward", fa::fa_arrow_rotate_forward } ,
-    { "redo", fa::fa_redo } ,
-    { "arrow-trend-down", fa::fa_arrow_trend_down } ,
-    { "arrow-trend-up", fa::fa_arrow_trend_up } ,
-    { "arrow-turn-down", fa::fa_arrow_turn_down } ,
-    { "level-down", fa::fa_level_down } ,
-    { "arrow-turn-up", fa::fa_arrow_turn_up } ,
-    { "level-up", fa::fa_level_up } ,
-    { "arrow-up", fa::fa_arrow_up } ,
-    { "arrow-up-1-9", fa::fa_arrow_up_1_9 } ,
-    { "sort-numeric-up", fa::fa_sort_numeric_up } ,
-    { "arrow-up-9-1", fa::fa_arrow_up_9_1 } ,
-    { "sort-numeric-up-alt", fa::fa_sort_numeric_up_alt } ,
-    { "arrow-up-a-z", fa::fa_arrow_up_a_z } ,
-    { "sort-alpha-up", fa::fa_sort_alpha_up } ,
-    { "arrow-up-from-bracket", fa::fa_arrow_up_from_bracket } ,
-    { "arrow-up-from-ground-water", fa::fa_arrow_up_from_ground_water } ,
-    { "arrow-up-from-water-pump", fa::fa_arrow_up_from_water_pump } ,
-    { "arrow-up-long", fa::fa_arrow_up_long } ,
-    { "long-arrow-up", fa::fa_long_arrow_up } ,
-    { "arrow-up-right-dots", fa::fa_arrow_up_right_dots } ,
-    { "arrow-up-right-from-square", fa::fa_arrow_up_right_from_square } ,
-    { "external-link", fa::fa_external_link } ,
-    { "arrow-up-short-wide", fa::fa_arrow_up_short_wide } ,
-    { "sort-amount-up-alt", fa::fa_sort_amount_up_alt } ,
-    { "arrow-up-wide-short", fa::fa_arrow_up_wide_short } ,
-    { "sort-amount-up", fa::fa_sort_amount_up } ,
-    { "arrow-up-z-a", fa::fa_arrow_up_z_a } ,
-    { "sort-alpha-up-alt", fa::fa_sort_alpha_up_alt } ,
-    { "arrows-down-to-line", fa::fa_arrows_down_to_line } ,
-    { "arrows-down-to-people", fa::fa_arrows_down_to_people } ,
-    { "arrows-left-right", fa::fa_arrows_left_right } ,
-    { "arrows-h", fa::fa_arrows_h } ,
-    { "arrows-left-right-to-line", fa::fa_arrows_left_right_to_line } ,
-    { "arrows-rotate", fa::fa_arrows_rotate } ,
-    { "refresh", fa::fa_refresh } ,
-    { "sync", fa::fa_sync } ,
-    { "arrows-spin", fa::fa_arrows_spin } ,
-    { "arrows-split-up-and-left", fa::fa_arrows_split_up_and_left } ,
-    { "arrows-to-circle", fa::fa_arrows_to_circle } ,
-    { "arrows-to-dot", fa::fa_arrows_to_dot } ,
-    { "arrows-to-eye", fa::fa_arrows_to_eye } ,
-    { "arrows-turn-right", fa::fa_arrows_turn_right } ,
-    { "arrows-turn-to-dots", fa::fa_arrows_turn_to_dots } ,
-    { "arrows-up-down", fa::fa_arrows_up_down } ,
-    { "arrows-v", fa::fa_arrows_v } ,
-    { "arrows-up-down-left-right", fa::fa_arrows_up_down_left_right } ,
-    { "arrows", fa::fa_arrows } ,
-    { "arrows-up-to-line", fa::fa_arrows_up_to_line } ,
-    { "asterisk", fa::fa_asterisk } ,
-    { "at", fa::fa_at } ,
-    { "atom", fa::fa_atom } ,
-    { "audio-description", fa::fa_audio_description } ,
-    { "austral-sign", fa::fa_austral_sign } ,
-    { "award", fa::fa_award } ,
-    { "b", fa::fa_b } ,
-    { "baby", fa::fa_baby } ,
-    { "baby-carriage", fa::fa_baby_carriage } ,
-    { "carriage-baby", fa::fa_carriage_baby } ,
-    { "backward", fa::fa_backward } ,
-    { "backward-fast", fa::fa_backward_fast } ,
-    { "fast-backward", fa::fa_fast_backward } ,
-    { "backward-step", fa::fa_backward_step } ,
-    { "step-backward", fa::fa_step_backward } ,
-    { "bacon", fa::fa_bacon } ,
-    { "bacteria", fa::fa_bacteria } ,
-    { "bacterium", fa::fa_bacterium } ,
-    { "bag-shopping", fa::fa_bag_shopping } ,
-    { "shopping-bag", fa::fa_shopping_bag } ,
-    { "bahai", fa::fa_bahai } ,
-    { "haykal", fa::fa_haykal } ,
-    { "baht-sign", fa::fa_baht_sign } ,
-    { "ban", fa::fa_ban } ,
-    { "cancel", fa::fa_cancel } ,
-    { "ban-smoking", fa::fa_ban_smoking } ,
-    { "smoking-ban", fa::fa_smoking_ban } ,
-    { "bandage", fa::fa_bandage } ,
-    { "band-aid", fa::fa_band_aid } ,
-    { "bangladeshi-taka-sign", fa::fa_bangladeshi_taka_sign } ,
-    { "barcode", fa::fa_barcode } ,
-    { "bars", fa::fa_bars } ,
-    { "navicon", fa::fa_navicon } ,
-    { "bars-progress", fa::fa_bars_progress } ,
-    { "tasks-alt", fa::fa_tasks_alt } ,
-    { "bars-staggered", fa::fa_bars_staggered } ,
-    { "reorder", fa::fa_reorder } ,
-    { "stream", fa::fa_stream } ,
-    { "baseball", fa::fa_baseball } ,
-    { "baseball-ball", fa::fa_baseball_ball } ,
-    { "baseball-bat-ball", fa::fa_baseball_bat_ball } ,
-    { "basket-shopping", fa::fa_basket_shopping } ,
-    { "shopping-basket", fa::fa_shopping_basket } ,
-    { "basketball", fa::fa_basketball } ,
-    { "basketball-ball", fa::fa_basketball_ball } ,
-    { "bath", fa::fa_bath } ,
-    { "bathtub", fa::fa_bathtub } ,
-    { "battery-empty", fa::fa_battery_empty } ,
-    { "battery-0", fa::fa_battery_0 } ,
-    { "battery-full", fa::fa_battery_full } ,
-    { "battery", fa::fa_battery } ,
-    { "battery-5", fa::fa_battery_5 } ,
-    { "battery-half", fa::fa_battery_half } ,
-    { "battery-3", fa::fa_battery_3 } ,
-    { "battery-quarter", fa::fa_battery_quarter } ,
-    { "battery-2", fa::fa_battery_2 } ,
-    { "battery-three-quarters", fa::fa_battery_three_quarters } ,
-    { "battery-4", fa::fa_battery_4 } ,
-    { "bed", fa::fa_bed } ,
-    { "bed-pulse", fa::fa_bed_pulse } ,
-    { "procedures", fa::fa_procedures } ,
-    { "beer-mug-empty", fa::fa_beer_mug_empty } ,
-    { "beer", fa::fa_beer } ,
-    { "bell", fa::fa_bell } ,
-    { "bell-concierge", fa::fa_bell_concierge } ,
-    { "concierge-bell", fa::fa_concierge_bell } ,
-    { "bell-slash", fa::fa_bell_slash } ,
-    { "bezier-curve", fa::fa_bezier_curve } ,
-    { "bicycle", fa::fa_bicycle } ,
-    { "binoculars", fa::fa_binoculars } ,
-    { "biohazard", fa::fa_biohazard } ,
-    { "bitcoin-sign", fa::fa_bitcoin_sign } ,
-    { "blender", fa::fa_blender } ,
-    { "blender-phone", fa::fa_blender_phone } ,
-    { "blog", fa::fa_blog } ,
-    { "bold", fa::fa_bold } ,
-    { "bolt", fa::fa_bolt } ,
-    { "zap", fa::fa_zap } ,
-    { "bolt-lightning", fa::fa_bolt_lightning } ,
-    { "bomb", fa::fa_bomb } ,
-    { "bone", fa::fa_bone } ,
-    { "bong", fa::fa_bong } ,
-    { "book", fa::fa_book } ,
-    { "book-atlas", fa::fa_book_atlas } ,
-    { "atlas", fa::fa_atlas } ,
-    { "book-bible", fa::fa_book_bible } ,
-    { "bible", fa::fa_bible } ,
-    { "book-bookmark", fa::fa_book_bookmark } ,
-    { "book-journal-whills", fa::fa_book_journal_whills } ,
-    { "journal-whills", fa::fa_journal_whills } ,
-    { "book-medical", fa::fa_book_medical } ,
-    { "book-open", fa::fa_book_open } ,
-    { "book-open-reader", fa::fa_book_open_reader } ,
-    { "book-reader", fa::fa_book_reader } ,
-    { "book-quran", fa::fa_book_quran } ,
-    { "quran", fa::fa_quran } ,
-    { "book-skull", fa::fa_book_skull } ,
-    { "book-dead", fa::fa_book_dead } ,
-    { "book-tanakh", fa::fa_book_tanakh } ,
-    { "tanakh", fa::fa_tanakh } ,
-    { "bookmark", fa::fa_bookmark } ,
-    { "border-all", fa::fa_border_all } ,
-    { "border-none", fa::fa_border_none } ,
-    { "border-top-left", fa::fa_border_top_left } ,
-    { "border-style", fa::fa_border_style } ,
-    { "bore-hole", fa::fa_bore_hole } ,
-    { "bottle-droplet", fa::fa_bottle_droplet } ,
-    { "bottle-water", fa::fa_bottle_water } ,
-    { "bowl-food", fa::fa_bowl_food } ,
-    { "bowl-rice", fa::fa_bowl_rice } ,
-    { "bowling-ball", fa::fa_bowling_ball } ,
-    { "box", fa::fa_box } ,
-    { "box-archive", fa::fa_box_archive } ,
-    { "archive", fa::fa_archive } ,
-    { "box-open", fa::fa_box_open } ,
-    { "box-tissue", fa::fa_box_tissue } ,
-    { "boxes-packing", fa::fa_boxes_packing } ,
-    { "boxes-stacked", fa::fa_boxes_stacked } ,
-    { "boxes", fa::fa_boxes } ,
-    { "boxes-alt", fa::fa_boxes_alt } ,
-    { "braille", fa::fa_braille } ,
-    { "brain", fa::fa_brain } ,
-    { "brazilian-real-sign", fa::fa_brazilian_real_sign } ,
-    { "bread-slice", fa::fa_bread_slice } ,
-    { "bridge", fa::fa_bridge } ,
-    { "bridge-circle-check", fa::fa_bridge_circle_check } ,
-    { "bridge-circle-exclamation", fa::fa_bridge_circle_exclamation } ,
-    { "bridge-circle-xmark", fa::fa_bridge_circle_xmark } ,
-    { "bridge-lock", fa::fa_bridge_lock } ,
-    { "bridge-water", fa::fa_bridge_water } ,
-    { "briefcase", fa::fa_briefcase } ,
-    { "briefcase-medical", fa::fa_briefcase_medical } ,
-    { "broom", fa::fa_broom } ,
-    { "broom-ball", fa::fa_broom_ball } ,
-    { "quidditch", fa::fa_quidditch } ,
-    { "quidditch-broom-ball", fa::fa_quidditch_broom_ball } ,
-    { "brush", fa::fa_brush } ,
-    { "bucket", fa::fa_bucket } ,
-    { "bug", fa::fa_bug } ,
-    { "bug-slash", fa::fa_bug_slash } ,
-    { "bugs", fa::fa_bugs } ,
-    { "building", fa::fa_building } ,
-    { "building-circle-arrow-right", fa::fa_building_circle_arrow_right } ,
-    { "building-circle-check", fa::fa_building_circle_check } ,
-    { "building-circle-exclamation", fa::fa_building_circle_exclamation } ,
-    { "building-circle-xmark", fa::fa_building_circle_xmark } ,
-    { "building-columns", fa::fa_building_columns } ,
-    { "bank", fa::fa_bank } ,
-    { "institution", fa::fa_institution } ,
-    { "museum", fa::fa_museum } ,
-    { "university", fa::fa_university } ,
-    { "building-flag", fa::fa_building_flag } ,
-    { "building-lock", fa::fa_building_lock } ,
-    { "building-ngo", fa::fa_building_ngo } ,
-    { "building-shield", fa::fa_building_shield } ,
-    { "building-un", fa::fa_building_un } ,
-    { "building-user", fa::fa_building_user } ,
-    { "building-wheat", fa::fa_building_wheat } ,
-    { "bullhorn", fa::fa_bullhorn } ,
-    { "bullseye", fa::fa_bullseye } ,
-    { "burger", fa::fa_burger } ,
-    { "hamburger", fa::fa_hamburger } ,
-    { "burst", fa::fa_burst } ,
-    { "bus", fa::fa_bus } ,
-    { "bus-simple", fa::fa_bus_simple } ,
-    { "bus-alt", fa::fa_bus_alt } ,
-    { "business-time", fa::fa_business_time } ,
-    { "briefcase-clock", fa::fa_briefcase_clock } ,
-    { "c", fa::fa_c } ,
-    { "cable-car", fa::fa_cable_car } ,
-    { "tram", fa::fa_tram } ,
-    { "cake-candles", fa::fa_cake_candles } ,
-    { "birthday-cake", fa::fa_birthday_cake } ,
-    { "cake", fa::fa_cake } ,
-    { "calculator", fa::fa_calculator } ,
-    { "calendar", fa::fa_calendar } ,
-    { "calendar-check", fa::fa_calendar_check } ,
-    { "calendar-day", fa::fa_calendar_day } ,
-    { "calendar-days", fa::fa_calendar_days } ,
-    { "calendar-alt", fa::fa_calendar_alt } ,
-    { "calendar-minus", fa::fa_calendar_minus } ,
-    { "calendar-plus", fa::fa_calendar_plus } ,
-    { "calendar-week", fa::fa_calendar_week } ,
-    { "calendar-xmark", fa::fa_calendar_xmark } ,
-    { "calendar-times", fa::fa_calendar_times } ,
-    { "camera", fa::fa_camera } ,
-    { "camera-alt", fa::fa_camera_alt } ,
-    { "camera-retro", fa::fa_camera_retro } ,
-    { "camera-rotate", fa::fa_camera_rotate } ,
-    { "campground", fa::fa_campground } ,
-    { "candy-cane", fa::fa_candy_cane } ,
-    { "cannabis", fa::fa_cannabis } ,
-    { "capsules", fa::fa_capsules } ,
-    { "car", fa::fa_car } ,
-    { "automobile", fa::fa_automobile } ,
-    { "car-battery", fa::fa_car_battery } ,
-    { "battery-car", fa::fa_battery_car } ,
-    { "car-burst", fa::fa_car_burst } ,
-    { "car-crash", fa::fa_car_crash } ,
-    { "car-on", fa::fa_car_on } ,
-    { "car-rear", fa::fa_car_rear } ,
-    { "car-alt", fa::fa_car_alt } ,
-    { "car-side", fa::fa_car_side } ,
-    { "car-tunnel", fa::fa_car_tunnel } ,
-    { "caravan", fa::fa_caravan } ,
-    { "caret-down", fa::fa_caret_down } ,
-    { "caret-left", fa::fa_caret_left } ,
-    { "caret-right", fa::fa_caret_right } ,
-    { "caret-up", fa::fa_caret_up } ,
-    { "carrot", fa::fa_carrot } ,
-    { "cart-arrow-down", fa::fa_cart_arrow_down } ,
-    { "cart-flatbed", fa::fa_cart_flatbed } ,
-    { "dolly-flatbed", fa::fa_dolly_flatbed } ,
-    { "cart-flatbed-suitcase", fa::fa_cart_flatbed_suitcase } ,
-    { "luggage-cart", fa::fa_luggage_cart } ,
-    { "cart-plus", fa::fa_cart_plus } ,
-    { "cart-shopping", fa::fa_cart_shopping } ,
-    { "shopping-cart", fa::fa_shopping_cart } ,
-    { "cash-register", fa::fa_cash_register } ,
-    { "cat", fa::fa_cat } ,
-    { "cedi-sign", fa::fa_cedi_sign } ,
-    { "cent-sign", fa::fa_cent_sign } ,
-    { "certificate", fa::fa_certificate } ,
-    { "chair", fa::fa_chair } ,
-    { "chalkboard", fa::fa_chalkboard } ,
-    { "blackboard", fa::fa_blackboard } ,
-    { "chalkboard-user", fa::fa_chalkboard_user } ,
-    { "chalkboard-teacher", fa::fa_chalkboard_teacher } ,
-    { "champagne-glasses", fa::fa_champagne_glasses } ,
-    { "glass-cheers", fa::fa_glass_cheers } ,
-    { "charging-station", fa::fa_charging_station } ,
-    { "chart-area", fa::fa_chart_area } ,
-    { "area-chart", fa::fa_area_chart } ,
-    { "chart-bar", fa::fa_chart_bar } ,
-    { "bar-chart", fa::fa_bar_chart } ,
-    { "chart-column", fa::fa_chart_column } ,
-    { "chart-diagram", fa::fa_chart_diagram } ,
-    { "chart-gantt", fa::fa_chart_gantt } ,
-    { "chart-line", fa::fa_chart_line } ,
-    { "line-chart", fa::fa_line_chart } ,
-    { "chart-pie", fa::fa_chart_pie } ,
-    { "pie-chart", fa::fa_pie_chart } ,
-    { "chart-simple", fa::fa_chart_simple } ,
-    { "check", fa::fa_check } ,
-    { "check-double", fa::fa_check_double } ,
-    { "check-to-slot", fa::fa_check_to_slot } ,
-    { "vote-yea", fa::fa_vote_yea } ,
-    { "cheese", fa::fa_cheese } ,
-    { "chess", fa::fa_chess } ,
-    { "chess-bishop", fa::fa_chess_bishop } ,
-    { "chess-board", fa::fa_chess_board } ,
-    { "chess-king", fa::fa_chess_king } ,
-    { "chess-knight", fa::fa_chess_knight } ,
-    { "chess-pawn", fa::fa_chess_pawn } ,
-    { "chess-queen", fa::fa_chess_queen } ,
-    { "chess-rook", fa::fa_chess_rook } ,
-    { "chevron-down", fa::fa_chevron_down } ,
-    { "chevron-left", fa::fa_chevron_left } ,
-    { "chevron-right", fa::fa_chevron_right } ,
-    { "chevron-up", fa::fa_chevron_up } ,
-    { "child", fa::fa_child } ,
-    { "child-combatant", fa::fa_child_combatant } ,
-    { "child-rifle", fa::fa_child_rifle } ,
-    { "child-dress", fa::fa_child_dress } ,
-    { "child-reaching", fa::fa_child_reaching } ,
-    { "children", fa::fa_children } ,
-    { "church", fa::fa_church } ,
-    { "circle", fa::fa_circle } ,
-    { "circle-arrow-down", fa::fa_circle_arrow_down } ,
-    { "arrow-circle-down", fa::fa_arrow_circle_down } ,
-    { "circle-arrow-left", fa::fa_circle_arrow_left } ,
-    { "arrow-circle-left", fa::fa_arrow_circle_left } ,
-    { "circle-arrow-right", fa::fa_circle_arrow_right } ,
-    { "arrow-circle-right", fa::fa_arrow_circle_right } ,
-    { "circle-arrow-up", fa::fa_circle_arrow_up } ,
-    { "arrow-circle-up", fa::fa_arrow_circle_up } ,
-    { "circle-check", fa::fa_circle_check } ,
-    { "check-circle", fa::fa_check_circle } ,
-    { "circle-chevron-down", fa::fa_circle_chevron_down } ,
-    { "chevron-circle-down", fa::fa_chevron_circle_down } ,
-    { "circle-chevron-left", fa::fa_circle_chevron_left } ,
-    { "chevron-circle-left", fa::fa_chevron_circle_left } ,
-    { "circle-chevron-right", fa::fa_circle_chevron_right } ,
-    { "chevron-circle-right", fa::fa_chevron_circle_right } ,
-    { "circle-chevron-up", fa::fa_circle_chevron_up } ,
-    { "chevron-circle-up", fa::fa_chevron_circle_up } ,
-    { "circle-dollar-to-slot", fa::fa_circle_dollar_to_slot } ,
-    { "donate", fa::fa_donate } ,
-    { "circle-dot", fa::fa_circle_dot } ,
-    { "dot-circle", fa::fa_dot_circle } ,
-    { "circle-down", fa::fa_circle_down } ,
-    { "arrow-alt-circle-down", fa::fa_arrow_alt_circle_down } ,
-    { "circle-exclamation", fa::fa_circle_exclamation } ,
-    { "exclamation-circle", fa::fa_exclamation_circle } ,
-    { "circle-h", fa::fa_circle_h } ,
-    { "hospital-symbol", fa::fa_hospital_symbol } ,
-    { "circle-half-stroke", fa::fa_circle_half_stroke } ,
-    { "adjust", fa::fa_adjust } ,
-    { "circle-info", fa::fa_circle_info } ,
-    { "info-circle", fa::fa_info_circle } ,
-    { "circle-left", fa::fa_circle_left } ,
-    { "arrow-alt-circle-left", fa::fa_arrow_alt_circle_left } ,
-    { "circle-minus", fa::fa_circle_minus } ,
-    { "minus-circle", fa::fa_minus_circle } ,
-    { "circle-nodes", fa::fa_circle_nodes } ,
-    { "circle-notch", fa::fa_circle_notch } ,
-    { "circle-pause", fa::fa_circle_pause } ,
-    { "pause-circle", fa::fa_pause_circle } ,
-    { "circle-play", fa::fa_circle_play } ,
-    { "play-circle", fa::fa_play_circle } ,
-    { "circle-plus", fa::fa_circle_plus } ,
-    { "plus-circle", fa::fa_plus_circle } ,
-    { "circle-question", fa::fa_circle_question } ,
-    { "question-circle", fa::fa_question_circle } ,
-    { "circle-radiation", fa::fa_circle_radiation } ,
-    { "radiation-alt", fa::fa_radiation_alt } ,
-    { "circle-right", fa::fa_circle_right } ,
-    { "arrow-alt-circle-right", fa::fa_arrow_alt_circle_right } ,
-    { "circle-stop", fa::fa_circle_stop } ,
-    { "stop-circle", fa::fa_stop_circle } ,
-    { "circle-up", fa::fa_circle_up } ,
-    { "arrow-alt-circle-up", fa::fa_arrow_alt_circle_up } ,
-    { "circle-user", fa::fa_circle_user } ,
-    { "user-circle", fa::fa_user_circle } ,
-    { "circle-xmark", fa::fa_circle_xmark } ,
-    { "times-circle", fa::fa_times_circle } ,
-    { "xmark-circle", fa::fa_xmark_circle } ,
-    { "city", fa::fa_city } ,
-    { "clapperboard", fa::fa_clapperboard } ,
-    { "clipboard", fa::fa_clipboard } ,
-    { "clipboard-check", fa::fa_clipboard_check } ,
-    { "clipboard-list", fa::fa_clipboard_list } ,
-    { "clipboard-question", fa::fa_clipboard_question } ,
-    { "clipboard-user", fa::fa_clipboard_user } ,
-    { "clock", fa::fa_clock } ,
-    { "clock-four", fa::fa_clock_four } ,
-    { "clock-rotate-left", fa::fa_clock_rotate_left } ,
-    { "history", fa::fa_history } ,
-    { "clone", fa::fa_clone } ,
-    { "closed-captioning", fa::fa_closed_captioning } ,
-    { "cloud", fa::fa_cloud } ,
-    { "cloud-arrow-down", fa::fa_cloud_arrow_down } ,
-    { "cloud-download", fa::fa_cloud_download } ,
-    { "cloud-download-alt", fa::fa_cloud_download_alt } ,
-    { "cloud-arrow-up", fa::fa_cloud_arrow_up } ,
-    { "cloud-upload", fa::fa_cloud_upload } ,
-    { "cloud-upload-alt", fa::fa_cloud_upload_alt } ,
-    { "cloud-bolt", fa::fa_cloud_bolt } ,
-    { "thunderstorm", fa::fa_thunderstorm } ,
-    { "cloud-meatball", fa::fa_cloud_meatball } ,
-    { "cloud-moon", fa::fa_cloud_moon } ,
-    { "cloud-moon-rain", fa::fa_cloud_moon_rain } ,
-    { "cloud-rain", fa::fa_cloud_rain } ,
-    { "cloud-showers-heavy", fa::fa_cloud_showers_heavy } ,
-    { "cloud-showers-water", fa::fa_cloud_showers_water } ,
-    { "cloud-sun", fa::fa_cloud_sun } ,
-    { "cloud-sun-rain", fa::fa_cloud_sun_rain } ,
-    { "clover", fa::fa_clover } ,
-    { "code", fa::fa_code } ,
-    { "code-branch", fa::fa_code_branch } ,
-    { "code-commit", fa::fa_code_commit } ,
-    { "code-compare", fa::fa_code_compare } ,
-    { "code-fork", fa::fa_code_fork } ,
-    { "code-merge", fa::fa_code_merge } ,
-    { "code-pull-request", fa::fa_code_pull_request } ,
-    { "coins", fa::fa_coins } ,
-    { "colon-sign", fa::fa_colon_sign } ,
-    { "comment", fa::fa_comment } ,
-    { "comment-dollar", fa::fa_comment_dollar } ,
-    { "comment-dots", fa::fa_comment_dots } ,
-    { "commenting", fa::fa_commenting } ,
-    { "comment-medical", fa::fa_comment_medical } ,
-    { "comment-nodes", fa::fa_comment_nodes } ,
-    { "comment-slash", fa::fa_comment_slash } ,
-    { "comment-sms", fa::fa_comment_sms } ,
-    { "sms", fa::fa_sms } ,
-    { "comments", fa::fa_comments } ,
-    { "comments-dollar", fa::fa_comments_dollar } ,
-    { "compact-disc", fa::fa_compact_disc } ,
-    { "compass", fa::fa_compass } ,
-    { "compass-drafting", fa::fa_compass_drafting } ,
-    { "drafting-compass", fa::fa_drafting_compass } ,
-    { "compress", fa::fa_compress } ,
-    { "computer", fa::fa_computer } ,
-    { "computer-mouse", fa::fa_computer_mouse } ,
-    { "mouse", fa::fa_mouse } ,
-    { "cookie", fa::fa_cookie } ,
-    { "cookie-bite", fa::fa_cookie_bite } ,
-    { "copy", fa::fa_copy } ,
-    { "copyright", fa::fa_copyright } ,
-    { "couch", fa::fa_couch } ,
-    { "cow", fa::fa_cow } ,
-    { "credit-card", fa::fa_credit_card } ,
-    { "credit-card-alt", fa::fa_credit_card_alt } ,
-    { "crop", fa::fa_crop } ,
-    { "crop-simple", fa::fa_crop_simple } ,
-    { "crop-alt", fa::fa_crop_alt } ,
-    { "cross", fa::fa_cross } ,
-    { "crosshairs", fa::fa_crosshairs } ,
-    { "crow", fa::fa_crow } ,
-    { "crown", fa::fa_crown } ,
-    { "crutch", fa::fa_crutch } ,
-    { "cruzeiro-sign", fa::fa_cruzeiro_sign } ,
-    { "cube", fa::fa_cube } ,
-    { "cubes", fa::fa_cubes } ,
-    { "cubes-stacked", fa::fa_cubes_stacked } ,
-    { "d", fa::fa_d } ,
-    { "database", fa::fa_database } ,
-    { "delete-left", fa::fa_delete_left } ,
-    { "backspace", fa::fa_backspace } ,
-    { "democrat", fa::fa_democrat } ,
-    { "desktop", fa::fa_desktop } ,
-    { "desktop-alt", fa::fa_desktop_alt } ,
-    { "dharmachakra", fa::fa_dharmachakra } ,
-    { "diagram-next", fa::fa_diagram_next } ,
-    { "diagram-predecessor", fa::fa_diagram_predecessor } ,
-    { "diagram-project", fa::fa_diagram_project } ,
-    { "project-diagram", fa::fa_project_diagram } ,
-    { "diagram-successor", fa::fa_diagram_successor } ,
-    { "diamond", fa::fa_diamond } ,
-    { "diamond-turn-right", fa::fa_diamond_turn_right } ,
-    { "directions", fa::fa_directions } ,
-    { "dice", fa::fa_dice } ,
-    { "dice-d20", fa::fa_dice_d20 } ,
-    { "dice-d6", fa::fa_dice_d6 } ,
-    { "dice-five", fa::fa_dice_five } ,
-    { "dice-four", fa::fa_dice_four } ,
-    { "dice-one", fa::fa_dice_one } ,
-    { "dice-six", fa::fa_dice_six } ,
-    { "dice-three", fa::fa_dice_three } ,
-    { "dice-two", fa::fa_dice_two } ,
-    { "disease", fa::fa_disease } ,
-    { "display", fa::fa_display } ,
-    { "divide", fa::fa_divide } ,
-    { "dna", fa::fa_dna } ,
-    { "dog", fa::fa_dog } ,
-    { "dollar-sign", fa::fa_dollar_sign } ,
-    { "dollar", fa::fa_dollar } ,
-    { "usd", fa::fa_usd } ,
-    { "dolly", fa::fa_dolly } ,
-    { "dolly-box", fa::fa_dolly_box } ,
-    { "dong-sign", fa::fa_dong_sign } ,
-    { "door-closed", fa::fa_door_closed } ,
-    { "door-open", fa::fa_door_open } ,
-    { "dove", fa::fa_dove } ,
-    { "down-left-and-up-right-to-center", fa::fa_down_left_and_up_right_to_center } ,
-    { "compress-alt", fa::fa_compress_alt } ,
-    { "down-long", fa::fa_down_long } ,
-    { "long-arrow-alt-down", fa::fa_long_arrow_alt_down } ,
-    { "download", fa::fa_download } ,
-    { "dragon", fa::fa_dragon } ,
-    { "draw-polygon", fa::fa_draw_polygon } ,
-    { "droplet", fa::fa_droplet } ,
-    { "tint", fa::fa_tint } ,
-    { "droplet-slash", fa::fa_droplet_slash } ,
-    { "tint-slash", fa::fa_tint_slash } ,
-    { "drum", fa::fa_drum } ,
-    { "drum-steelpan", fa::fa_drum_steelpan } ,
-    { "drumstick-bite", fa::fa_drumstick_bite } ,
-    { "dumbbell", fa::fa_dumbbell } ,
-    { "dumpster", fa::fa_dumpster } ,
-    { "dumpster-fire", fa::fa_dumpster_fire } ,
-    { "dungeon", fa::fa_dungeon } ,
-    { "e", fa::fa_e } ,
-    { "ear-deaf", fa::fa_ear_deaf } ,
-    { "deaf", fa::fa_deaf } ,
-    { "deafness", fa::fa_deafness } ,
-    { "hard-of-hearing", fa::fa_hard_of_hearing } ,
-    { "ear-listen", fa::fa_ear_listen } ,
-    { "assistive-listening-systems", fa::fa_assistive_listening_systems } ,
-    { "earth-africa", fa::fa_earth_africa } ,
-    { "globe-africa", fa::fa_globe_africa } ,
-    { "earth-americas", fa::fa_earth_americas } ,
-    { "earth", fa::fa_earth } ,
-    { "earth-america", fa::fa_earth_america } ,
-    { "globe-americas", fa::fa_globe_americas } ,
-    { "earth-asia", fa::fa_earth_asia } ,
-    { "globe-asia", fa::fa_globe_asia } ,
-    { "earth-europe", fa::fa_earth_europe } ,
-    { "globe-europe", fa::fa_globe_europe } ,
-    { "earth-oceania", fa::fa_earth_oceania } ,
-    { "globe-oceania", fa::fa_globe_oceania } ,
-    { "egg", fa::fa_egg } ,
-    { "eject", fa::fa_eject } ,
-    { "elevator", fa::fa_elevator } ,
-    { "ellipsis", fa::fa_ellipsis } ,
-    { "ellipsis-h", fa::fa_ellipsis_h } ,
-    { "ellipsis-vertical", fa::fa_ellipsis_vertical } ,
-    { "ellipsis-v", fa::fa_ellipsis_v } ,
-    { "envelope", fa::fa_envelope } ,
-    { "envelope-circle-check", fa::fa_envelope_circle_check } ,
-    { "envelope-open", fa::fa_envelope_open } ,
-    { "envelope-open-text", fa::fa_envelope_open_text } ,
-    { "envelopes-bulk", fa::fa_envelopes_bulk } ,
-    { "mail-bulk", fa::fa_mail_bulk } ,
-    { "equals", fa::fa_equals } ,
-    { "eraser", fa::fa_eraser } ,
-    { "ethernet", fa::fa_ethernet } ,
-    { "euro-sign", fa::fa_euro_sign } ,
-    { "eur", fa::fa_eur } ,
-    { "euro", fa::fa_euro } ,
-    { "exclamation", fa::fa_exclamation } ,
-    { "expand", fa::fa_expand } ,
-    { "explosion", fa::fa_explosion } ,
-    { "eye", fa::fa_eye } ,
-    { "eye-dropper", fa::fa_eye_dropper } ,
-    { "eye-dropper-empty", fa::fa_eye_dropper_empty } ,
-    { "eyedropper", fa::fa_eyedropper } ,
-    { "eye-low-vision", fa::fa_eye_low_vision } ,
-    { "low-vision", fa::fa_low_vision } ,
-    { "eye-slash", fa::fa_eye_slash } ,
-    { "f", fa::fa_f } ,
-    { "face-angry", fa::fa_face_angry } ,
-    { "angry", fa::fa_angry } ,
-    { "face-dizzy", fa::fa_face_dizzy } ,
-    { "dizzy", fa::fa_dizzy } ,
-    { "face-flushed", fa::fa_face_flushed } ,
-    { "flushed", fa::fa_flushed } ,
-    { "face-frown", fa::fa_face_frown } ,
-    { "frown", fa::fa_frown } ,
-    { "face-frown-open", fa::fa_face_frown_open } ,
-    { "frown-open", fa::fa_frown_open } ,
-    { "face-grimace", fa::fa_face_grimace } ,
-    { "grimace", fa::fa_grimace } ,
-    { "face-grin", fa::fa_face_grin } ,
-    { "grin", fa::fa_grin } ,
-    { "face-grin-beam", fa::fa_face_grin_beam } ,
-    { "grin-beam", fa::fa_grin_beam } ,
-    { "face-grin-beam-sweat", fa::fa_face_grin_beam_sweat } ,
-    { "grin-beam-sweat", fa::fa_grin_beam_sweat } ,
-    { "face-grin-hearts", fa::fa_face_grin_hearts } ,
-    { "grin-hearts", fa::fa_grin_hearts } ,
-    { "face-grin-squint", fa::fa_face_grin_squint } ,
-    { "grin-squint", fa::fa_grin_squint } ,
-    { "face-grin-squint-tears", fa::fa_face_grin_squint_tears } ,
-    { "grin-squint-tears", fa::fa_grin_squint_tears } ,
-    { "face-grin-stars", fa::fa_face_grin_stars } ,
-    { "grin-stars", fa::fa_grin_stars } ,
-    { "face-grin-tears", fa::fa_face_grin_tears } ,
-    { "grin-tears", fa::fa_grin_tears } ,
-    { "face-grin-tongue", fa::fa_face_grin_tongue } ,
-    { "grin-tongue", fa::fa_grin_tongue } ,
-    { "face-grin-tongue-squint", fa::fa_face_grin_tongue_squint } ,
-    { "grin-tongue-squint", fa::fa_grin_tongue_squint } ,
-    { "face-grin-tongue-wink", fa::fa_face_grin_tongue_wink } ,
-    { "grin-tongue-wink", fa::fa_grin_tongue_wink } ,
-    { "face-grin-wide", fa::fa_face_grin_wide } ,
-    { "grin-alt", fa::fa_grin_alt } ,
-    { "face-grin-wink", fa::fa_face_grin_wink } ,
-    { "grin-wink", fa::fa_grin_wink } ,
-    { "face-kiss", fa::fa_face_kiss } ,
-    { "kiss", fa::fa_kiss } ,
-    { "face-kiss-beam", fa::fa_face_kiss_beam } ,
-    { "kiss-beam", fa::fa_kiss_beam } ,
-    { "face-kiss-wink-heart", fa::fa_face_kiss_wink_heart } ,
-    { "kiss-wink-heart", fa::fa_kiss_wink_heart } ,
-    { "face-laugh", fa::fa_face_laugh } ,
-    { "laugh", fa::fa_laugh } ,
-    { "face-laugh-beam", fa::fa_face_laugh_beam } ,
-    { "laugh-beam", fa::fa_laugh_beam } ,
-    { "face-laugh-squint", fa::fa_face_laugh_squint } ,
-    { "laugh-squint", fa::fa_laugh_squint } ,
-    { "face-laugh-wink", fa::fa_face_laugh_wink } ,
-    { "laugh-wink", fa::fa_laugh_wink } ,
-    { "face-meh", fa::fa_face_meh } ,
-    { "meh", fa::fa_meh } ,
-    { "face-meh-blank", fa::fa_face_meh_blank } ,
-    { "meh-blank", fa::fa_meh_blank } ,
-    { "face-rolling-eyes", fa::fa_face_rolling_eyes } ,
-    { "meh-rolling-eyes", fa::fa_meh_rolling_eyes } ,
-    { "face-sad-cry", fa::fa_face_sad_cry } ,
-    { "sad-cry", fa::fa_sad_cry } ,
-    { "face-sad-tear", fa::fa_face_sad_tear } ,
-    { "sad-tear", fa::fa_sad_tear } ,
-    { "face-smile", fa::fa_face_smile } ,
-    { "smile", fa::fa_smile } ,
-    { "face-smile-beam", fa::fa_face_smile_beam } ,
-    { "smile-beam", fa::fa_smile_beam } ,
-    { "face-smile-wink", fa::fa_face_smile_wink } ,
-    { "smile-wink", fa::fa_smile_wink } ,
-    { "face-surprise", fa::fa_face_surprise } ,
-    { "surprise", fa::fa_surprise } ,
-    { "face-tired", fa::fa_face_tired } ,
-    { "tired", fa::fa_tired } ,
-    { "fan", fa::fa_fan } ,
-    { "faucet", fa::fa_faucet } ,
-    { "faucet-drip", fa::fa_faucet_drip } ,
-    { "fax", fa::fa_fax } ,
-    { "feather", fa::fa_feather } ,
-    { "feather-pointed", fa::fa_feather_pointed } ,
-    { "feather-alt", fa::fa_feather_alt } ,
-    { "ferry", fa::fa_ferry } ,
-    { "file", fa::fa_file } ,
-    { "file-arrow-down", fa::fa_file_arrow_down } ,
-    { "file-download", fa::fa_file_download } ,
-    { "file-arrow-up", fa::fa_file_arrow_up } ,
-    { "file-upload", fa::fa_file_upload } ,
-    { "file-audio", fa::fa_file_audio } ,
-    { "file-circle-check", fa::fa_file_circle_check } ,
-    { "file-circle-exclamation", fa::fa_file_circle_exclamation } ,
-    { "file-circle-minus", fa::fa_file_circle_minus } ,
-    { "file-circle-plus", fa::fa_file_circle_plus } ,
-    { "file-circle-question", fa::fa_file_circle_question } ,
-    { "file-circle-xmark", fa::fa_file_circle_xmark } ,
-    { "file-code", fa::fa_file_code } ,
-    { "file-contract", fa::fa_file_contract } ,
-    { "file-csv", fa::fa_file_csv } ,
-    { "file-excel", fa::fa_file_excel } ,
-    { "file-export", fa::fa_file_export } ,
-    { "arrow-right-from-file", fa::fa_arrow_right_from_file } ,
-    { "file-fragment", fa::fa_file_fragment } ,
-    { "file-half-dashed", fa::fa_file_half_dashed } ,
-    { "file-image", fa::fa_file_image } ,
-    { "file-import", fa::fa_file_import } ,
-    { "arrow-right-to-file", fa::fa_arrow_right_to_file } ,
-    { "file-invoice", fa::fa_file_invoice } ,
-    { "file-invoice-dollar", fa::fa_file_invoice_dollar } ,
-    { "file-lines", fa::fa_file_lines } ,
-    { "file-alt", fa::fa_file_alt } ,
-    { "file-text", fa::fa_file_text } ,
-    { "file-medical", fa::fa_file_medical } ,
-    { "file-pdf", fa::fa_file_pdf } ,
-    { "file-pen", fa::fa_file_pen } ,
-    { "file-edit", fa::fa_file_edit } ,
-    { "file-powerpoint", fa::fa_file_powerpoint } ,
-    { "file-prescription", fa::fa_file_prescription } ,
-    { "file-shield", fa::fa_file_shield } ,
-    { "file-signature", fa::fa_file_signature } ,
-    { "file-video", fa::fa_file_video } ,
-    { "file-waveform", fa::fa_file_waveform } ,
-    { "file-medical-alt", fa::fa_file_medical_alt } ,
-    { "file-word", fa::fa_file_word } ,
-    { "file-zipper", fa::fa_file_zipper } ,
-    { "file-archive", fa::fa_file_archive } ,
-    { "fill", fa::fa_fill } ,
-    { "fill-drip", fa::fa_fill_drip } ,
-    { "film", fa::fa_film } ,
-    { "filter", fa::fa_filter } ,
-    { "filter-circle-dollar", fa::fa_filter_circle_dollar } ,
-    { "funnel-dollar", fa::fa_funnel_dollar } ,
-    { "filter-circle-xmark", fa::fa_filter_circle_xmark } ,
-    { "fingerprint", fa::fa_fingerprint } ,
-    { "fire", fa::fa_fire } ,
-    { "fire-burner", fa::fa_fire_burner } ,
-    { "fire-extinguisher", fa::fa_fire_extinguisher } ,
-    { "fire-flame-curved", fa::fa_fire_flame_curved } ,
-    { "fire-alt", fa::fa_fire_alt } ,
-    { "fire-flame-simple", fa::fa_fire_flame_simple } ,
-    { "burn", fa::fa_burn } ,
-    { "fish", fa::fa_fish } ,
-    { "fish-fins", fa::fa_fish_fins } ,
-    { "flag", fa::fa_flag } ,
-    { "flag-checkered", fa::fa_flag_checkered } ,
-    { "flag-usa", fa::fa_flag_usa } ,
-    { "flask", fa::fa_flask } ,
-    { "flask-vial", fa::fa_flask_vial } ,
-    { "floppy-disk", fa::fa_floppy_disk } ,
-    { "save", fa::fa_save } ,
-    { "florin-sign", fa::fa_florin_sign } ,
-    { "folder", fa::fa_folder } ,
-    { "folder-blank", fa::fa_folder_blank } ,
-    { "folder-closed", fa::fa_folder_closed } ,
-    { "folder-minus", fa::fa_folder_minus } ,
-    { "folder-open", fa::fa_folder_open } ,
-    { "folder-plus", fa::fa_folder_plus } ,
-    { "folder-tree", fa::fa_folder_tree } ,
-    { "font", fa::fa_font } ,
-    { "football", fa::fa_football } ,
-    { "football-ball", fa::fa_football_ball } ,
-    { "forward", fa::fa_forward } ,
-    { "forward-fast", fa::fa_forward_fast } ,
-    { "fast-forward", fa::fa_fast_forward } ,
-    { "forward-step", fa::fa_forward_step } ,
-    { "step-forward", fa::fa_step_forward } ,
-    { "franc-sign", fa::fa_franc_sign } ,
-    { "frog", fa::fa_frog } ,
-    { "futbol", fa::fa_futbol } ,
-    { "futbol-ball", fa::fa_futbol_ball } ,
-    { "soccer-ball", fa::fa_soccer_ball } ,
-    { "g", fa::fa_g } ,
-    { "gamepad", fa::fa_gamepad } ,
-    { "gas-pump", fa::fa_gas_pump } ,
-    { "gauge", fa::fa_gauge } ,
-    { "dashboard", fa::fa_dashboard } ,
-    { "gauge-med", fa::fa_gauge_med } ,
-    { "tachometer-alt-average", fa::fa_tachometer_alt_average } ,
-    { "gauge-high", fa::fa_gauge_high } ,
-    { "tachometer-alt", fa::fa_tachometer_alt } ,
-    { "tachometer-alt-fast", fa::fa_tachometer_alt_fast } ,
-    { "gauge-simple", fa::fa_gauge_simple } ,
-    { "gauge-simple-med", fa::fa_gauge_simple_med } ,
-    { "tachometer-average", fa::fa_tachometer_average } ,
-    { "gauge-simple-high", fa::fa_gauge_simple_high } ,
-    { "tachometer", fa::fa_tachometer } ,
-    { "tachometer-fast", fa::fa_tachometer_fast } ,
-    { "gavel", fa::fa_gavel } ,
-    { "legal", fa::fa_legal } ,
-    { "gear", fa::fa_gear } ,
-    { "cog", fa::fa_cog } ,
-    { "gears", fa::fa_gears } ,
-    { "cogs", fa::fa_cogs } ,
-    { "gem", fa::fa_gem } ,
-    { "genderless", fa::fa_genderless } ,
-    { "ghost", fa::fa_ghost } ,
-    { "gift", fa::fa_gift } ,
-    { "gifts", fa::fa_gifts } ,
-    { "glass-water", fa::fa_glass_water } ,
-    { "glass-water-droplet", fa::fa_glass_water_droplet } ,
-    { "glasses", fa::fa_glasses } ,
-    { "globe", fa::fa_globe } ,
-    { "golf-ball-tee", fa::fa_golf_ball_tee } ,
-    { "golf-ball", fa::fa_golf_ball } ,
-    { "gopuram", fa::fa_gopuram } ,
-    { "graduation-cap", fa::fa_graduation_cap } ,
-    { "mortar-board", fa::fa_mortar_board } ,
-    { "greater-than", fa::fa_greater_than } ,
-    { "greater-than-equal", fa::fa_greater_than_equal } ,
-    { "grip", fa::fa_grip } ,
-    { "grip-horizontal", fa::fa_grip_horizontal } ,
-    { "grip-lines", fa::fa_grip_lines } ,
-    { "grip-lines-vertical", fa::fa_grip_lines_vertical } ,
-    { "grip-vertical", fa::fa_grip_vertical } ,
-    { "group-arrows-rotate", fa::fa_group_arrows_rotate } ,
-    { "guarani-sign", fa::fa_guarani_sign } ,
-    { "guitar", fa::fa_guitar } ,
-    { "gun", fa::fa_gun } ,
-    { "h", fa::fa_h } ,
-    { "hammer", fa::fa_hammer } ,
-    { "hamsa", fa::fa_hamsa } ,
-    { "hand", fa::fa_hand } ,
-    { "hand-paper", fa::fa_hand_paper } ,
-    { "hand-back-fist", fa::fa_hand_back_fist } ,
-    { "hand-rock", fa::fa_hand_rock } ,
-    { "hand-dots", fa::fa_hand_dots } ,
-    { "allergies", fa::fa_allergies } ,
-    { "hand-fist", fa::fa_hand_fist } ,
-    { "fist-raised", fa::fa_fist_raised } ,
-    { "hand-holding", fa::fa_hand_holding } ,
-    { "hand-holding-dollar", fa::fa_hand_holding_dollar } ,
-    { "hand-holding-usd", fa::fa_hand_holding_usd } ,
-    { "hand-holding-droplet", fa::fa_hand_holding_droplet } ,
-    { "hand-holding-water", fa::fa_hand_holding_water } ,
-    { "hand-holding-hand", fa::fa_hand_holding_hand } ,
-    { "hand-holding-heart", fa::fa_hand_holding_heart } ,
-    { "hand-holding-medical", fa::fa_hand_holding_medical } ,
-    { "hand-lizard", fa::fa_hand_lizard } ,
-    { "hand-middle-finger", fa::fa_hand_middle_finger } ,
-    { "hand-peace", fa::fa_hand_peace } ,
-    { "hand-point-down", fa::fa_hand_point_down } ,
-    { "hand-point-left", fa::fa_hand_point_left } ,
-    { "hand-point-right", fa::fa_hand_point_right } ,
-    { "hand-point-up", fa::fa_hand_point_up } ,
-    { "hand-pointer", fa::fa_hand_pointer } ,
-    { "hand-scissors", fa::fa_hand_scissors } ,
-    { "hand-sparkles", fa::fa_hand_sparkles } ,
-    { "hand-spock", fa::fa_hand_spock } ,
-    { "handcuffs", fa::fa_handcuffs } ,
-    { "hands", fa::fa_hands } ,
-    { "sign-language", fa::fa_sign_language } ,
-    { "signing", fa::fa_signing } ,
-    { "hands-asl-interpreting", fa::fa_hands_asl_interpreting } ,
-    { "american-sign-language-interpreting", fa::fa_american_sign_language_interpreting } ,
-    { "asl-interpreting", fa::fa_asl_interpreting } ,
-    { "hands-american-sign-language-interpreting", fa::fa_hands_american_sign_language_interpreting } ,
-    { "hands-bound", fa::fa_hands_bound } ,
-    { "hands-bubbles", fa::fa_hands_bubbles } ,
-    { "hands-wash", fa::fa_hands_wash } ,
-    { "hands-clapping", fa::fa_hands_clapping } ,
-    { "hands-holding", fa::fa_hands_holding } ,
-    { "hands-holding-child", fa::fa_hands_holding_child } ,
-    { "hands-holding-circle", fa::fa_hands_holding_circle } ,
-    { "hands-praying", fa::fa_hands_praying } ,
-    { "praying-hands", fa::fa_praying_hands } ,
-    { "handshake", fa::fa_handshake } ,
-    { "handshake-angle", fa::fa_handshake_angle } ,
-    { "hands-helping", fa::fa_hands_helping } ,
-    { "handshake-simple", fa::fa_handshake_simple } ,
-    { "handshake-alt", fa::fa_handshake_alt } ,
-    { "handshake-simple-slash", fa::fa_handshake_simple_slash } ,
-    { "handshake-alt-slash", fa::fa_handshake_alt_slash } ,
-    { "handshake-slash", fa::fa_handshake_slash } ,
-    { "hanukiah", fa::fa_hanukiah } ,
-    { "hard-drive", fa::fa_hard_drive } ,
-    { "hdd", fa::fa_hdd } ,
-    { "hashtag", fa::fa_hashtag } ,
-    { "hat-cowboy", fa::fa_hat_cowboy } ,
-    { "hat-cowboy-side", fa::fa_hat_cowboy_side } ,
-    { "hat-wizard", fa::fa_hat_wizard } ,
-    { "head-side-cough", fa::fa_head_side_cough } ,
-    { "head-side-cough-slash", fa::fa_head_side_cough_slash } ,
-    { "head-side-mask", fa::fa_head_side_mask } ,
-    { "head-side-virus", fa::fa_head_side_virus } ,
-    { "heading", fa::fa_heading } ,
-    { "header", fa::fa_header } ,
-    { "headphones", fa::fa_headphones } ,
-    { "headphones-simple", fa::fa_headphones_simple } ,
-    { "headphones-alt", fa::fa_headphones_alt } ,
-    { "headset", fa::fa_headset } ,
-    { "heart", fa::fa_heart } ,
-    { "heart-circle-bolt", fa::fa_heart_circle_bolt } ,
-    { "heart-circle-check", fa::fa_heart_circle_check } ,
-    { "heart-circle-exclamation", fa::fa_heart_circle_exclamation } ,
-    { "heart-circle-minus", fa::fa_heart_circle_minus } ,
-    { "heart-circle-plus", fa::fa_heart_circle_plus } ,
-    { "heart-circle-xmark", fa::fa_heart_circle_xmark } ,
-    { "heart-crack", fa::fa_heart_crack } ,
-    { "heart-broken", fa::fa_heart_broken } ,
-    { "heart-pulse", fa::fa_heart_pulse } ,
-    { "heartbeat", fa::fa_heartbeat } ,
-    { "helicopter", fa::fa_helicopter } ,
-    { "helicopter-symbol", fa::fa_helicopter_symbol } ,
-    { "helmet-safety", fa::fa_helmet_safety } ,
-    { "hard-hat", fa::fa_hard_hat } ,
-    { "hat-hard", fa::fa_hat_hard } ,
-    { "helmet-un", fa::fa_helmet_un } ,
-    { "hexagon-nodes", fa::fa_hexagon_nodes } ,
-    { "hexagon-nodes-bolt", fa::fa_hexagon_nodes_bolt } ,
-    { "highlighter", fa::fa_highlighter } ,
-    { "hill-avalanche", fa::fa_hill_avalanche } ,
-    { "hill-rockslide", fa::fa_hill_rockslide } ,
-    { "hippo", fa::fa_hippo } ,
-    { "hockey-puck", fa::fa_hockey_puck } ,
-    { "holly-berry", fa::fa_holly_berry } ,
-    { "horse", fa::fa_horse } ,
-    { "horse-head", fa::fa_horse_head } ,
-    { "hospital", fa::fa_hospital } ,
-    { "hospital-alt", fa::fa_hospital_alt } ,
-    { "hospital-wide", fa::fa_hospital_wide } ,
-    { "hospital-user", fa::fa_hospital_user } ,
-    { "hot-tub-person", fa::fa_hot_tub_person } ,
-    { "hot-tub", fa::fa_hot_tub } ,
-    { "hotdog", fa::fa_hotdog } ,
-    { "hotel", fa::fa_hotel } ,
-    { "hourglass", fa::fa_hourglass } ,
-    { "hourglass-empty", fa::fa_hourglass_empty } ,
-    { "hourglass-end", fa::fa_hourglass_end } ,
-    { "hourglass-3", fa::fa_hourglass_3 } ,
-    { "hourglass-half", fa::fa_hourglass_half } ,
-    { "hourglass-2", fa::fa_hourglass_2 } ,
-    { "hourglass-start", fa::fa_hourglass_start } ,
-    { "hourglass-1", fa::fa_hourglass_1 } ,
-    { "house", fa::fa_house } ,
-    { "home", fa::fa_home } ,
-    { "home-alt", fa::fa_home_alt } ,
-    { "home-lg-alt", fa::fa_home_lg_alt } ,
-    { "house-chimney", fa::fa_house_chimney } ,
-    { "home-lg", fa::fa_home_lg } ,
-    { "house-chimney-crack", fa::fa_house_chimney_crack } ,
-    { "house-damage", fa::fa_house_damage } ,
-    { "house-chimney-medical", fa::fa_house_chimney_medical } ,
-    { "clinic-medical", fa::fa_clinic_medical } ,
-    { "house-chimney-user", fa::fa_house_chimney_user } ,
-    { "house-chimney-window", fa::fa_house_chimney_window } ,
-    { "house-circle-check", fa::fa_house_circle_check } ,
-    { "house-circle-exclamation", fa::fa_house_circle_exclamation } ,
-    { "house-circle-xmark", fa::fa_house_circle_xmark } ,
-    { "house-crack", fa::fa_house_crack } ,
-    { "house-fire", fa::fa_house_fire } ,
-    { "house-flag", fa::fa_house_flag } ,
-    { "house-flood-water", fa::fa_house_flood_water } ,
-    { "house-flood-water-circle-arrow-right", fa::fa_house_flood_water_circle_arrow_right } ,
-    { "house-laptop", fa::fa_house_laptop } ,
-    { "laptop-house", fa::fa_laptop_house } ,
-    { "house-lock", fa::fa_house_lock } ,
-    { "house-medical", fa::fa_house_medical } ,
-    { "house-medical-circle-check", fa::fa_house_medical_circle_check } ,
-    { "house-medical-circle-exclamation", fa::fa_house_medical_circle_exclamation } ,
-    { "house-medical-circle-xmark", fa::fa_house_medical_circle_xmark } ,
-    { "house-medical-flag", fa::fa_house_medical_flag } ,
-    { "house-signal", fa::fa_house_signal } ,
-    { "house-tsunami", fa::fa_house_tsunami } ,
-    { "house-user", fa::fa_house_user } ,
-    { "home-user", fa::fa_home_user } ,
-    { "hryvnia-sign", fa::fa_hryvnia_sign } ,
-    { "hryvnia", fa::fa_hryvnia } ,
-    { "hurricane", fa::fa_hurricane } ,
-    { "i", fa::fa_i } ,
-    { "i-cursor", fa::fa_i_cursor } ,
-    { "ice-cream", fa::fa_ice_cream } ,
-    { "icicles", fa::fa_icicles } ,
-    { "icons", fa::fa_icons } ,
-    { "heart-music-camera-bolt", fa::fa_heart_music_camera_bolt } ,
-    { "id-badge", fa::fa_id_badge } ,
-    { "id-card", fa::fa_id_card } ,
-    { "drivers-license", fa::fa_drivers_license } ,
-    { "id-card-clip", fa::fa_id_card_clip } ,
-    { "id-card-alt", fa::fa_id_card_alt } ,
-    { "igloo", fa::fa_igloo } ,
-    { "image", fa::fa_image } ,
-    { "image-portrait", fa::fa_image_portrait } ,
-    { "portrait", fa::fa_portrait } ,
-    { "images", fa::fa_images } ,
-    { "inbox", fa::fa_inbox } ,
-    { "indent", fa::fa_indent } ,
-    { "indian-rupee-sign", fa::fa_indian_rupee_sign } ,
-    { "indian-rupee", fa::fa_indian_rupee } ,
-    { "inr", fa::fa_inr } ,
-    { "industry", fa::fa_industry } ,
-    { "infinity", fa::fa_infinity } ,
-    { "info", fa::fa_info } ,
-    { "italic", fa::fa_italic } ,
-    { "j", fa::fa_j } ,
-    { "jar", fa::fa_jar } ,
-    { "jar-wheat", fa::fa_jar_wheat } ,
-    { "jedi", fa::fa_jedi } ,
-    { "jet-fighter", fa::fa_jet_fighter } ,
-    { "fighter-jet", fa::fa_fighter_jet } ,
-    { "jet-fighter-up", fa::fa_jet_fighter_up } ,
-    { "joint", fa::fa_joint } ,
-    { "jug-detergent", fa::fa_jug_detergent } ,
-    { "k", fa::fa_k } ,
-    { "kaaba", fa::fa_kaaba } ,
-    { "key", fa::fa_key } ,
-    { "keyboard", fa::fa_keyboard } ,
-    { "khanda", fa::fa_khanda } ,
-    { "kip-sign", fa::fa_kip_sign } ,
-    { "kit-medical", fa::fa_kit_medical } ,
-    { "first-aid", fa::fa_first_aid } ,
-    { "kitchen-set", fa::fa_kitchen_set } ,
-    { "kiwi-bird", fa::fa_kiwi_bird } ,
-    { "l", fa::fa_l } ,
-    { "land-mine-on", fa::fa_land_mine_on } ,
-    { "landmark", fa::fa_landmark } ,
-    { "landmark-dome", fa::fa_landmark_dome } ,
-    { "landmark-alt", fa::fa_landmark_alt } ,
-    { "landmark-flag", fa::fa_landmark_flag } ,
-    { "language", fa::fa_language } ,
-    { "laptop", fa::fa_laptop } ,
-    { "laptop-code", fa::fa_laptop_code } ,
-    { "laptop-file", fa::fa_laptop_file } ,
-    { "laptop-medical", fa::fa_laptop_medical } ,
-    { "lari-sign", fa::fa_lari_sign } ,
-    { "layer-group", fa::fa_layer_group } ,
-    { "leaf", fa::fa_leaf } ,
-    { "left-long", fa::fa_left_long } ,
-    { "long-arrow-alt-left", fa::fa_long_arrow_alt_left } ,
-    { "left-right", fa::fa_left_right } ,
-    { "arrows-alt-h", fa::fa_arrows_alt_h } ,
-    { "lemon", fa::fa_lemon } ,
-    { "less-than", fa::fa_less_than } ,
-    { "less-than-equal", fa::fa_less_than_equal } ,
-    { "life-ring", fa::fa_life_ring } ,
-    { "lightbulb", fa::fa_lightbulb } ,
-    { "lines-leaning", fa::fa_lines_leaning } ,
-    { "link", fa::fa_link } ,
-    { "chain", fa::fa_chain } ,
-    { "link-slash", fa::fa_link_slash } ,
-    { "chain-broken", fa::fa_chain_broken } ,
-    { "chain-slash", fa::fa_chain_slash } ,
-    { "unlink", fa::fa_unlink } ,
-    { "lira-sign", fa::fa_lira_sign } ,
-    { "list", fa::fa_list } ,
-    { "list-squares", fa::fa_list_squares } ,
-    { "list-check", fa::fa_list_check } ,
-    { "tasks", fa::fa_tasks } ,
-    { "list-ol", fa::fa_list_ol } ,
-    { "list-1-2", fa::fa_list_1_2 } ,
-    { "list-numeric", fa::fa_list_numeric } ,
-    { "list-ul", fa::fa_list_ul } ,
-    { "list-dots", fa::fa_list_dots } ,
-    { "litecoin-sign", fa::fa_litecoin_sign } ,
-    { "location-arrow", fa::fa_location_arrow } ,
-    { "location-crosshairs", fa::fa_location_crosshairs } ,
-    { "location", fa::fa_location } ,
-    { "location-dot", fa::fa_location_dot } ,
-    { "map-marker-alt", fa::fa_map_marker_alt } ,
-    { "location-pin", fa::fa_location_pin } ,
-    { "map-marker", fa::fa_map_marker } ,
-    { "location-pin-lock", fa::fa_location_pin_lock } ,
-    { "lock", fa::fa_lock } ,
-    { "lock-open", fa::fa_lock_open } ,
-    { "locust", fa::fa_locust } ,
-    { "lungs", fa::fa_lungs } ,
-    { "lungs-virus", fa::fa_lungs_virus } ,
-    { "m", fa::fa_m } ,
-    { "magnet", fa::fa_magnet } ,
-    { "magnifying-glass", fa::fa_magnifying_glass } ,
-    { "search", fa::fa_search } ,
-    { "magnifying-glass-arrow-right", fa::fa_magnifying_glass_arrow_right } ,
-    { "magnifying-glass-chart", fa::fa_magnifying_glass_chart } ,
-    { "magnifying-glass-dollar", fa::fa_magnifying_glass_dollar } ,
-    { "search-dollar", fa::fa_search_dollar } ,
-    { "magnifying-glass-location", fa::fa_magnifying_glass_location } ,
-    { "search-location", fa::fa_search_location } ,
-    { "magnifying-glass-minus", fa::fa_magnifying_glass_minus } ,
-    { "search-minus", fa::fa_search_minus } ,
-    { "magnifying-glass-plus", fa::fa_magnifying_glass_plus } ,
-    { "search-plus", fa::fa_search_plus } ,
-    { "manat-sign", fa::fa_manat_sign } ,
-    { "map", fa::fa_map } ,
-    { "map-location", fa::fa_map_location } ,
-    { "map-marked", fa::fa_map_marked } ,
-    { "map-location-dot", fa::fa_map_location_dot } ,
-    { "map-marked-alt", fa::fa_map_marked_alt } ,
-    { "map-pin", fa::fa_map_pin } ,
-    { "marker", fa::fa_marker } ,
-    { "mars", fa::fa_mars } ,
-    { "mars-and-venus", fa::fa_mars_and_venus } ,
-    { "mars-and-venus-burst", fa::fa_mars_and_venus_burst } ,
-    { "mars-double", fa::fa_mars_double } ,
-    { "mars-stroke", fa::fa_mars_stroke } ,
-    { "mars-stroke-right", fa::fa_mars_stroke_right } ,
-    { "mars-stroke-h", fa::fa_mars_stroke_h } ,
-    { "mars-stroke-up", fa::fa_mars_stroke_up } ,
-    { "mars-stroke-v", fa::fa_mars_stroke_v } ,
-    { "martini-glass", fa::fa_martini_glass } ,
-    { "glass-martini-alt", fa::fa_glass_martini_alt } ,
-    { "martini-glass-citrus", fa::fa_martini_glass_citrus } ,
-    { "cocktail", fa::fa_cocktail } ,
-    { "martini-glass-empty", fa::fa_martini_glass_empty } ,
-    { "glass-martini", fa::fa_glass_martini } ,
-    { "mask", fa::fa_mask } ,
-    { "mask-face", fa::fa_mask_face } ,
-    { "mask-ventilator", fa::fa_mask_ventilator } ,
-    { "masks-theater", fa::fa_masks_theater } ,
-    { "theater-masks", fa::fa_theater_masks } ,
-    { "mattress-pillow", fa::fa_mattress_pillow } ,
-    { "maximize", fa::fa_maximize } ,
-    { "expand-arrows-alt", fa::fa_expand_arrows_alt } ,
-    { "medal", fa::fa_medal } ,
-    { "memory", fa::fa_memory } ,
-    { "menorah", fa::fa_menorah } ,
-    { "mercury", fa::fa_mercury } ,
-    { "message", fa::fa_message } ,
-    { "comment-alt", fa::fa_comment_alt } ,
-    { "meteor", fa::fa_meteor } ,
-    { "microchip", fa::fa_microchip } ,
-    { "microphone", fa::fa_microphone } ,
-    { "microphone-lines", fa::fa_microphone_lines } ,
-    { "microphone-alt", fa::fa_microphone_alt } ,
-    { "microphone-lines-slash", fa::fa_microphone_lines_slash } ,
-    { "microphone-alt-slash", fa::fa_microphone_alt_slash } ,
-    { "microphone-slash", fa::fa_microphone_slash } ,
-    { "microscope", fa::fa_microscope } ,
-    { "mill-sign", fa::fa_mill_sign } ,
-    { "minimize", fa::fa_minimize } ,
-    { "compress-arrows-alt", fa::fa_compress_arrows_alt } ,
-    { "minus", fa::fa_minus } ,
-    { "subtract", fa::fa_subtract } ,
-    { "mitten", fa::fa_mitten } ,
-    { "mobile", fa::fa_mobile } ,
-    { "mobile-android", fa::fa_mobile_android } ,
-    { "mobile-phone", fa::fa_mobile_phone } ,
-    { "mobile-button", fa::fa_mobile_button } ,
-    { "mobile-retro", fa::fa_mobile_retro } ,
-    { "mobile-screen", fa::fa_mobile_screen } ,
-    { "mobile-android-alt", fa::fa_mobile_android_alt } ,
-    { "mobile-screen-button", fa::fa_mobile_screen_button } ,
-    { "mobile-alt", fa::fa_mobile_alt } ,
-    { "money-bill", fa::fa_money_bill } ,
-    { "money-bill-1", fa::fa_money_bill_1 } ,
-    { "money-bill-alt", fa::fa_money_bill_alt } ,
-    { "money-bill-1-wave", fa::fa_money_bill_1_wave } ,
-    { "money-bill-wave-alt", fa::fa_money_bill_wave_alt } ,
-    { "money-bill-transfer", fa::fa_money_bill_transfer } ,
-    { "money-bill-trend-up", fa::fa_money_bill_trend_up } ,
-    { "money-bill-wave", fa::fa_money_bill_wave } ,
-    { "money-bill-wheat", fa::fa_money_bill_wheat } ,
-    { "money-bills", fa::fa_money_bills } ,
-    { "money-check", fa::fa_money_check } ,
-    { "money-check-dollar", fa::fa_money_check_dollar } ,
-    { "money-check-alt", fa::fa_money_check_alt } ,
-    { "monument", fa::fa_monument } ,
-    { "moon", fa::fa_moon } ,
-    { "mortar-pestle", fa::fa_mortar_pestle } ,
-    { "mosque", fa::fa_mosque } ,
-    { "mosquito", fa::fa_mosquito } ,
-    { "mosquito-net", fa::fa_mosquito_net } ,
-    { "motorcycle", fa::fa_motorcycle } ,
-    { "mound", fa::fa_mound } ,
-    { "mountain", fa::fa_mountain } ,
-    { "mountain-city", fa::fa_mountain_city } ,
-    { "mountain-sun", fa::fa_mountain_sun } ,
-    { "mug-hot", fa::fa_mug_hot } ,
-    { "mug-saucer", fa::fa_mug_saucer } ,
-    { "coffee", fa::fa_coffee } ,
-    { "music", fa::fa_music } ,
-    { "n", fa::fa_n } ,
-    { "naira-sign", fa::fa_naira_sign } ,
-    { "network-wired", fa::fa_network_wired } ,
-    { "neuter", fa::fa_neuter } ,
-    { "newspaper", fa::fa_newspaper } ,
-    { "not-equal", fa::fa_not_equal } ,
-    { "notdef", fa::fa_notdef } ,
-    { "note-sticky", fa::fa_note_sticky } ,
-    { "sticky-note", fa::fa_sticky_note } ,
-    { "notes-medical", fa::fa_notes_medical } ,
-    { "o", fa::fa_o } ,
-    { "object-group", fa::fa_object_group } ,
-    { "object-ungroup", fa::fa_object_ungroup } ,
-    { "oil-can", fa::fa_oil_can } ,
-    { "oil-well", fa::fa_oil_well } ,
-    { "om", fa::fa_om } ,
-    { "otter", fa::fa_otter } ,
-    { "outdent", fa::fa_outdent } ,
-    { "dedent", fa::fa_dedent } ,
-    { "p", fa::fa_p } ,
-    { "pager", fa::fa_pager } ,
-    { "paint-roller", fa::fa_paint_roller } ,
-    { "paintbrush", fa::fa_paintbrush } ,
-    { "paint-brush", fa::fa_paint_brush } ,
-    { "palette", fa::fa_palette } ,
-    { "pallet", fa::fa_pallet } ,
-    { "panorama", fa::fa_panorama } ,
-    { "paper-plane", fa::fa_paper_plane } ,
-    { "paperclip", fa::fa_paperclip } ,
-    { "parachute-box", fa::fa_parachute_box } ,
-    { "paragraph", fa::fa_paragraph } ,
-    { "passport", fa::fa_passport } ,
-    { "paste", fa::fa_paste } ,
-    { "file-clipboard", fa::fa_file_clipboard } ,
-    { "pause", fa::fa_pause } ,
-    { "paw", fa::fa_paw } ,
-    { "peace", fa::fa_peace } ,
-    { "pen", fa::fa_pen } ,
-    { "pen-clip", fa::fa_pen_clip } ,
-    { "pen-alt", fa::fa_pen_alt } ,
-    { "pen-fancy", fa::fa_pen_fancy } ,
-    { "pen-nib", fa::fa_pen_nib } ,
-    { "pen-ruler", fa::fa_pen_ruler } ,
-    { "pencil-ruler", fa::fa_pencil_ruler } ,
-    { "pen-to-square", fa::fa_pen_to_square } ,
-    { "edit", fa::fa_edit } ,
-    { "pencil", fa::fa_pencil } ,
-    { "pencil-alt", fa::fa_pencil_alt } ,
-    { "people-arrows", fa::fa_people_arrows } ,
-    { "people-arrows-left-right", fa::fa_people_arrows_left_right } ,
-    { "people-carry-box", fa::fa_people_carry_box } ,
-    { "people-carry", fa::fa_people_carry } ,
-    { "people-group", fa::fa_people_group } ,
-    { "people-line", fa::fa_people_line } ,
-    { "people-pulling", fa::fa_people_pulling } ,
-    { "people-robbery", fa::fa_people_robbery } ,
-    { "people-roof", fa::fa_people_roof } ,
-    { "pepper-hot", fa::fa_pepper_hot } ,
-    { "percent", fa::fa_percent } ,
-    { "percentage", fa::fa_percentage } ,
-    { "person", fa::fa_person } ,
-    { "male", fa::fa_male } ,
-    { "person-arrow-down-to-line", fa::fa_person_arrow_down_to_line } ,
-    { "person-arrow-up-from-line", fa::fa_person_arrow_up_from_line } ,
-    { "person-biking", fa::fa_person_biking } ,
-    { "biking", fa::fa_biking } ,
-    { "person-booth", fa::fa_person_booth } ,
-    { "person-breastfeeding", fa::fa_person_breastfeeding } ,
-    { "person-burst", fa::fa_person_burst } ,
-    { "person-cane", fa::fa_person_cane } ,
-    { "person-chalkboard", fa::fa_person_chalkboard } ,
-    { "person-circle-check", fa::fa_person_circle_check } ,
-    { "person-circle-exclamation", fa::fa_person_circle_exclamation } ,
-    { "person-circle-minus", fa::fa_person_circle_minus } ,
-    { "person-circle-plus", fa::fa_person_circle_plus } ,
-    { "person-circle-question", fa::fa_person_circle_question } ,
-    { "person-circle-xmark", fa::fa_person_circle_xmark } ,
-    { "person-digging", fa::fa_person_digging } ,
-    { "digging", fa::fa_digging } ,
-    { "person-dots-from-line", fa::fa_person_dots_from_line } ,
-    { "diagnoses", fa::fa_diagnoses } ,
-    { "person-dress", fa::fa_person_dress } ,
-    { "female", fa::fa_female } ,
-    { "person-dress-burst", fa::fa_person_dress_burst } ,
-    { "person-drowning", fa::fa_person_drowning } ,
-    { "person-falling", fa::fa_person_falling } ,
-    { "person-falling-burst", fa::fa_person_falling_burst } ,
-    { "person-half-dress", fa::fa_person_half_dress } ,
-    { "person-harassing", fa::fa_person_harassing } ,
-    { "person-hiking", fa::fa_person_hiking } ,
-    { "hiking", fa::fa_hiking } ,
-    { "person-military-pointing", fa::fa_person_military_pointing } ,
-    { "person-military-rifle", fa::fa_person_military_rifle } ,
-    { "person-military-to-person", fa::fa_person_military_to_person } ,
-    { "person-praying", fa::fa_person_praying } ,
-    { "pray", fa::fa_pray } ,
-    { "person-pregnant", fa::fa_person_pregnant } ,
-    { "person-rays", fa::fa_person_rays } ,
-    { "person-rifle", fa::fa_person_rifle } ,
-    { "person-running", fa::fa_person_running } ,
-    { "running", fa::fa_running } ,
-    { "person-shelter", fa::fa_person_shelter } ,
-    { "person-skating", fa::fa_person_skating } ,
-    { "skating", fa::fa_skating } ,
-    { "person-skiing", fa::fa_person_skiing } ,
-    { "skiing", fa::fa_skiing } ,
-    { "person-skiing-nordic", fa::fa_person_skiing_nordic } ,
-    { "skiing-nordic", fa::fa_skiing_nordic } ,
-    { "person-snowboarding", fa::fa_person_snowboarding } ,
-    { "snowboarding", fa::fa_snowboarding } ,
-    { "person-swimming", fa::fa_person_swimming } ,
-    { "swimmer", fa::fa_swimmer } ,
-    { "person-through-window", fa::fa_person_through_window } ,
-    { "person-walking", fa::fa_person_walking } ,
-    { "walking", fa::fa_walking } ,
-    { "person-walking-arrow-loop-left", fa::fa_person_walking_arrow_loop_left } ,
-    { "person-walking-arrow-right", fa::fa_person_walking_arrow_right } ,
-    { "person-walking-dashed-line-arrow-right", fa::fa_person_walking_dashed_line_arrow_right } ,
-    { "person-walking-luggage", fa::fa_person_walking_luggage } ,
-    { "person-walking-with-cane", fa::fa_person_walking_with_cane } ,
-    { "blind", fa::fa_blind } ,
-    { "peseta-sign", fa::fa_peseta_sign } ,
-    { "peso-sign", fa::fa_peso_sign } ,
-    { "phone", fa::fa_phone } ,
-    { "phone-flip", fa::fa_phone_flip } ,
-    { "phone-alt", fa::fa_phone_alt } ,
-    { "phone-slash", fa::fa_phone_slash } ,
-    { "phone-volume", fa::fa_phone_volume } ,
-    { "volume-control-phone", fa::fa_volume_control_phone } ,
-    { "photo-film", fa::fa_photo_film } ,
-    { "photo-video", fa::fa_photo_video } ,
-    { "piggy-bank", fa::fa_piggy_bank } ,
-    { "pills", fa::fa_pills } ,
-    { "pizza-slice", fa::fa_pizza_slice } ,
-    { "place-of-worship", fa::fa_place_of_worship } ,
-    { "plane", fa::fa_plane } ,
-    { "plane-arrival", fa::fa_plane_arrival } ,
-    { "plane-circle-check", fa::fa_plane_circle_check } ,
-    { "plane-circle-exclamation", fa::fa_plane_circle_exclamation } ,
-    { "plane-circle-xmark", fa::fa_plane_circle_xmark } ,
-    { "plane-departure", fa::fa_plane_departure } ,
-    { "plane-lock", fa::fa_plane_lock } ,
-    { "plane-slash", fa::fa_plane_slash } ,
-    { "plane-up", fa::fa_plane_up } ,
-    { "plant-wilt", fa::fa_plant_wilt } ,
-    { "plate-wheat", fa::fa_plate_wheat } ,
-    { "play", fa::fa_play } ,
-    { "plug", fa::fa_plug } ,
-    { "plug-circle-bolt", fa::fa_plug_circle_bolt } ,
-    { "plug-circle-check", fa::fa_plug_circle_check } ,
-    { "plug-circle-exclamation", fa::fa_plug_circle_exclamation } ,
-    { "plug-circle-minus", fa::fa_plug_circle_minus } ,
-    { "plug-circle-plus", fa::fa_plug_circle_plus } ,
-    { "plug-circle-xmark", fa::fa_plug_circle_xmark } ,
-    { "plus", fa::fa_plus } ,
-    { "add", fa::fa_add } ,
-    { "plus-minus", fa::fa_plus_minus } ,
-    { "podcast", fa::fa_podcast } ,
-    { "poo", fa::fa_poo } ,
-    { "poo-storm", fa::fa_poo_storm } ,
-    { "poo-bolt", fa::fa_poo_bolt } ,
-    { "poop", fa::fa_poop } ,
-    { "power-off", fa::fa_power_off } ,
-    { "prescription", fa::fa_prescription } ,
-    { "prescription-bottle", fa::fa_prescription_bottle } ,
-    { "prescription-bottle-medical", fa::fa_prescription_bottle_medical } ,
-    { "prescription-bottle-alt", fa::fa_prescription_bottle_alt } ,
-    { "print", fa::fa_print } ,
-    { "pump-medical", fa::fa_pump_medical } ,
-    { "pump-soap", fa::fa_pump_soap } ,
-    { "puzzle-piece", fa::fa_puzzle_piece } ,
-    { "q", fa::fa_q } ,
-    { "qrcode", fa::fa_qrcode } ,
-    { "question", fa::fa_question } ,
-    { "quote-left", fa::fa_quote_left } ,
-    { "quote-left-alt", fa::fa_quote_left_alt } ,
-    { "quote-right", fa::fa_quote_right } ,
-    { "quote-right-alt", fa::fa_quote_right_alt } ,
-    { "r", fa::fa_r } ,
-    { "radiation", fa::fa_radiation } ,
-    { "radio", fa::fa_radio } ,
-    { "rainbow", fa::fa_rainbow } ,
-    { "ranking-star", fa::fa_ranking_star } ,
-    { "receipt", fa::fa_receipt } ,
-    { "record-vinyl", fa::fa_record_vinyl } ,
-    { "rectangle-ad", fa::fa_rectangle_ad } ,
-    { "ad", fa::fa_ad } ,
-    { "rectangle-list", fa::fa_rectangle_list } ,
-    { "list-alt", fa::fa_list_alt } ,
-    { "rectangle-xmark", fa::fa_rectangle_xmark } ,
-    { "rectangle-times", fa::fa_rectangle_times } ,
-    { "times-rectangle", fa::fa_times_rectangle } ,
-    { "window-close", fa::fa_window_close } ,
-    { "recycle", fa::fa_recycle } ,
-    { "registered", fa::fa_registered } ,
-    { "repeat", fa::fa_repeat } ,
-    { "reply", fa::fa_reply } ,
-    { "mail-reply", fa::fa_mail_reply } ,
-    { "reply-all", fa::fa_reply_all } ,
-    { "mail-reply-all", fa::fa_mail_reply_all } ,
-    { "republican", fa::fa_republican } ,
-    { "restroom", fa::fa_restroom } ,
-    { "retweet", fa::fa_retweet } ,
-    { "ribbon", fa::fa_ribbon } ,
-    { "right-from-bracket", fa::fa_right_from_bracket } ,
-    { "sign-out-alt", fa::fa_sign_out_alt } ,
-    { "right-left", fa::fa_right_left } ,
-    { "exchange-alt", fa::fa_exchange_alt } ,
-    { "right-long", fa::fa_right_long } ,
-    { "long-arrow-alt-right", fa::fa_long_arrow_alt_right } ,
-    { "right-to-bracket", fa::fa_right_to_bracket } ,
-    { "sign-in-alt", fa::fa_sign_in_alt } ,
-    { "ring", fa::fa_ring } ,
-    { "road", fa::fa_road } ,
-    { "road-barrier", fa::fa_road_barrier } ,
-    { "road-bridge", fa::fa_road_bridge } ,
-    { "road-circle-check", fa::fa_road_circle_check } ,
-    { "road-circle-exclamation", fa::fa_road_circle_exclamation } ,
-    { "road-circle-xmark", fa::fa_road_circle_xmark } ,
-    { "road-lock", fa::fa_road_lock } ,
-    { "road-spikes", fa::fa_road_spikes } ,
-    { "robot", fa::fa_robot } ,
-    { "rocket", fa::fa_rocket } ,
-    { "rotate", fa::fa_rotate } ,
-    { "sync-alt", fa::fa_sync_alt } ,
-    { "rotate-left", fa::fa_rotate_left } ,
-    { "rotate-back", fa::fa_rotate_back } ,
-    { "rotate-backward", fa::fa_rotate_backward } ,
-    { "undo-alt", fa::fa_undo_alt } ,
-    { "rotate-right", fa::fa_rotate_right } ,
-    { "redo-alt", fa::fa_redo_alt } ,
-    { "rotate-forward", fa::fa_rotate_forward } ,
-    { "route", fa::fa_route } ,
-    { "rss", fa::fa_rss } ,
-    { "feed", fa::fa_feed } ,
-    { "ruble-sign", fa::fa_ruble_sign } ,
-    { "rouble", fa::fa_rouble } ,
-    { "rub", fa::fa_rub } ,
-    { "ruble", fa::fa_ruble } ,
-    { "rug", fa::fa_rug } ,
-    { "ruler", fa::fa_ruler } ,
-    { "ruler-combined", fa::fa_ruler_combined } ,
-    { "ruler-horizontal", fa::fa_ruler_horizontal } ,
-    { "ruler-vertical", fa::fa_ruler_vertical } ,
-    { "rupee-sign", fa::fa_rupee_sign } ,
-    { "rupee", fa::fa_rupee } ,
-    { "rupiah-sign", fa::fa_rupiah_sign } ,
-    { "s", fa::fa_s } ,
-    { "sack-dollar", fa::fa_sack_dollar } ,
-    { "sack-xmark", fa::fa_sack_xmark } ,
-    { "sailboat", fa::fa_sailboat } ,
-    { "satellite", fa::fa_satellite } ,
-    { "satellite-dish", fa::fa_satellite_dish } ,
-    { "scale-balanced", fa::fa_scale_balanced } ,
-    { "balance-scale", fa::fa_balance_scale } ,
-    { "scale-unbalanced", fa::fa_scale_unbalanced } ,
-    { "balance-scale-left", fa::fa_balance_scale_left } ,
-    { "scale-unbalanced-flip", fa::fa_scale_unbalanced_flip } ,
-    { "balance-scale-right", fa::fa_balance_scale_right } ,
-    { "school", fa::fa_school } ,
-    { "school-circle-check", fa::fa_school_circle_check } ,
-    { "school-circle-exclamation", fa::fa_school_circle_exclamation } ,
-    { "school-circle-xmark", fa::fa_school_circle_xmark } ,
-    { "school-flag", fa::fa_school_flag } ,
-    { "school-lock", fa::fa_school_lock } ,
-    { "scissors", fa::fa_scissors } ,
-    { "cut", fa::fa_cut } ,
-    { "screwdriver", fa::fa_screwdriver } ,
-    { "screwdriver-wrench", fa::fa_screwdriver_wrench } ,
-    { "tools", fa::fa_tools } ,
-    { "scroll", fa::fa_scroll } ,
-    { "scroll-torah", fa::fa_scroll_torah } ,
-    { "torah", fa::fa_torah } ,
-    { "sd-card", fa::fa_sd_card } ,
-    { "section", fa::fa_section } ,
-    { "seedling", fa::fa_seedling } ,
-    { "sprout", fa::fa_sprout } ,
-    { "server", fa::fa_server } ,
-    { "shapes", fa::fa_shapes } ,
-    { "triangle-circle-square", fa::fa_triangle_circle_square } ,
-    { "share", fa::fa_share } ,
-    { "mail-forward", fa::fa_mail_forward } ,
-    { "share-from-square", fa::fa_share_from_square } ,
-    { "share-square", fa::fa_share_square } ,
-    { "share-nodes", fa::fa_share_nodes } ,
-    { "share-alt", fa::fa_share_alt } ,
-    { "sheet-plastic", fa::fa_sheet_plastic } ,
-    { "shekel-sign", fa::fa_shekel_sign } ,
-    { "ils", fa::fa_ils } ,
-    { "shekel", fa::fa_shekel } ,
-    { "sheqel", fa::fa_sheqel } ,
-    { "sheqel-sign", fa::fa_sheqel_sign } ,
-    { "shield", fa::fa_shield } ,
-    { "shield-blank", fa::fa_shield_blank } ,
-    { "shield-cat", fa::fa_shield_cat } ,
-    { "shield-dog", fa::fa_shield_dog } ,
-    { "shield-halved", fa::fa_shield_halved } ,
-    { "shield-alt", fa::fa_shield_alt } ,
-    { "shield-heart", fa::fa_shield_heart } ,
-    { "shield-virus", fa::fa_shield_virus } ,
-    { "ship", fa::fa_ship } ,
-    { "shirt", fa::fa_shirt } ,
-    { "t-shirt", fa::fa_t_shirt } ,
-    { "tshirt", fa::fa_tshirt } ,
-    { "shoe-prints", fa::fa_shoe_prints } ,
-    { "shop", fa::fa_shop } ,
-    { "store-alt", fa::fa_store_alt } ,
-    { "shop-lock", fa::fa_shop_lock } ,
-    { "shop-slash", fa::fa_shop_slash } ,
-    { "store-alt-slash", fa::fa_store_alt_slash } ,
-    { "shower", fa::fa_shower } ,
-    { "shrimp", fa::fa_shrimp } ,
-    { "shuffle", fa::fa_shuffle } ,
-    { "random", fa::fa_random } ,
-    { "shuttle-space", fa::fa_shuttle_space } ,
-    { "space-shuttle", fa::fa_space_shuttle } ,
-    { "sign-hanging", fa::fa_sign_hanging } ,
-    { "sign", fa::fa_sign } ,
-    { "signal", fa::fa_signal } ,
-    { "signal-5", fa::fa_signal_5 } ,
-    { "signal-perfect", fa::fa_signal_perfect } ,
-    { "signature", fa::fa_signature } ,
-    { "signs-post", fa::fa_signs_post } ,
-    { "map-signs", fa::fa_map_signs } ,
-    { "sim-card", fa::fa_sim_card } ,
-    { "sink", fa::fa_sink } ,
-    { "sitemap", fa::fa_sitemap } ,
-    { "skull", fa::fa_skull } ,
-    { "skull-crossbones", fa::fa_skull_crossbones } ,
-    { "slash", fa::fa_slash } ,
-    { "sleigh", fa::fa_sleigh } ,
-    { "sliders", fa::fa_sliders } ,
-    { "sliders-h", fa::fa_sliders_h } ,
-    { "smog", fa::fa_smog } ,
-    { "smoking", fa::fa_smoking } ,
-    { "snowflake", fa::fa_snowflake } ,
-    { "snowman", fa::fa_snowman } ,
-    { "snowplow", fa::fa_snowplow } ,
-    { "soap", fa::fa_soap } ,
-    { "socks", fa::fa_socks } ,
-    { "solar-panel", fa::fa_solar_panel } ,
-    { "sort", fa::fa_sort } ,
-    { "unsorted", fa::fa_unsorted } ,
-    { "sort-down", fa::fa_sort_down } ,
-    { "sort-desc", fa::fa_sort_desc } ,
-    { "sort-up", fa::fa_sort_up } ,
-    { "sort-asc", fa::fa_sort_asc } ,
-    { "spa", fa::fa_spa } ,
-    { "spaghetti-monster-flying", fa::fa_spaghetti_monster_flying } ,
-    { "pastafarianism", fa::fa_pastafarianism } ,
-    { "spell-check", fa::fa_spell_check } ,
-    { "spider", fa::fa_spider } ,
-    { "spinner", fa::fa_spinner } ,
-    { "splotch", fa::fa_splotch } ,
-    { "spoon", fa::fa_spoon } ,
-    { "utensil-spoon", fa::fa_utensil_spoon } ,
-    { "spray-can", fa::fa_spray_can } ,
-    { "spray-can-sparkles", fa::fa_spray_can_sparkles } ,
-    { "air-freshener", fa::fa_air_freshener } ,
-    { "square", fa::fa_square } ,
-    { "square-arrow-up-right", fa::fa_square_arrow_up_right } ,
-    { "external-link-square", fa::fa_external_link_square } ,
-    { "square-binary", fa::fa_square_binary } ,
-    { "square-caret-down", fa::fa_square_caret_down } ,
-    { "caret-square-down", fa::fa_caret_square_down } ,
-    { "square-caret-left", fa::fa_square_caret_left } ,
-    { "caret-square-left", fa::fa_caret_square_left } ,
-    { "square-caret-right", fa::fa_square_caret_right } ,
-    { "caret-square-right", fa::fa_caret_square_right } ,
-    { "square-caret-up", fa::fa_square_caret_up } ,
-    { "caret-square-up", fa::fa_caret_square_up } ,
-    { "square-check", fa::fa_square_check } ,
-    { "check-square", fa::fa_check_square } ,
-    { "square-envelope", fa::fa_square_envelope } ,
-    { "envelope-square", fa::fa_envelope_square } ,
-    { "square-full", fa::fa_square_full } ,
-    { "square-h", fa::fa_square_h } ,
-    { "h-square", fa::fa_h_square } ,
-    { "square-minus", fa::fa_square_minus } ,
-    { "minus-square", fa::fa_minus_square } ,
-    { "square-nfi", fa::fa_square_nfi } ,
-    { "square-parking", fa::fa_square_parking } ,
-    { "parking", fa::fa_parking } ,
-    { "square-pen", fa::fa_square_pen } ,
-    { "pen-square", fa::fa_pen_square } ,
-    { "pencil-square", fa::fa_pencil_square } ,
-    { "square-person-confined", fa::fa_square_person_confined } ,
-    { "square-phone", fa::fa_square_phone } ,
-    { "phone-square", fa::fa_phone_square } ,
-    { "square-phone-flip", fa::fa_square_phone_flip } ,
-    { "phone-square-alt", fa::fa_phone_square_alt } ,
-    { "square-plus", fa::fa_square_plus } ,
-    { "plus-square", fa::fa_plus_square } ,
-    { "square-poll-horizontal", fa::fa_square_poll_horizontal } ,
-    { "poll-h", fa::fa_poll_h } ,
-    { "square-poll-vertical", fa::fa_square_poll_vertical } ,
-    { "poll", fa::fa_poll } ,
-    { "square-root-variable", fa::fa_square_root_variable } ,
-    { "square-root-alt", fa::fa_square_root_alt } ,
-    { "square-rss", fa::fa_square_rss } ,
-    { "rss-square", fa::fa_rss_square } ,
-    { "square-share-nodes", fa::fa_square_share_nodes } ,
-    { "share-alt-square", fa::fa_share_alt_square } ,
-    { "square-up-right", fa::fa_square_up_right } ,
-    { "external-link-square-alt", fa::fa_external_link_square_alt } ,
-    { "square-virus", fa::fa_square_virus } ,
-    { "square-xmark", fa::fa_square_xmark } ,
-    { "times-square", fa::fa_times_square } ,
-    { "xmark-square", fa::fa_xmark_square } ,
-    { "staff-snake", fa::fa_staff_snake } ,
-    { "rod-asclepius", fa::fa_rod_asclepius } ,
-    { "rod-snake", fa::fa_rod_snake } ,
-    { "staff-aesculapius", fa::fa_staff_aesculapius } ,
-    { "stairs", fa::fa_stairs } ,
-    { "stamp", fa::fa_stamp } ,
-    { "stapler", fa::fa_stapler } ,
-    { "star", fa::fa_star } ,
-    { "star-and-crescent", fa::fa_star_and_crescent } ,
-    { "star-half", fa::fa_star_half } ,
-    { "star-half-stroke", fa::fa_star_half_stroke } ,
-    { "star-half-alt", fa::fa_star_half_alt } ,
-    { "star-of-david", fa::fa_star_of_david } ,
-    { "star-of-life", fa::fa_star_of_life } ,
-    { "sterling-sign", fa::fa_sterling_sign } ,
-    { "gbp", fa::fa_gbp } ,
-    { "pound-sign", fa::fa_pound_sign } ,
-    { "stethoscope", fa::fa_stethoscope } ,
-    { "stop", fa::fa_stop } ,
-    { "stopwatch", fa::fa_stopwatch } ,
-    { "stopwatch-20", fa::fa_stopwatch_20 } ,
-    { "store", fa::fa_store } ,
-    { "store-slash", fa::fa_store_slash } ,
-    { "street-view", fa::fa_street_view } ,
-    { "strikethrough", fa::fa_strikethrough } ,
-    { "stroopwafel", fa::fa_stroopwafel } ,
-    { "subscript", fa::fa_subscript } ,
-    { "suitcase", fa::fa_suitcase } ,
-    { "suitcase-medical", fa::fa_suitcase_medical } ,
-    { "medkit", fa::fa_medkit } ,
-    { "suitcase-rolling", fa::fa_suitcase_rolling } ,
-    { "sun", fa::fa_sun } ,
-    { "sun-plant-wilt", fa::fa_sun_plant_wilt } ,
-    { "superscript", fa::fa_superscript } ,
-    { "swatchbook", fa::fa_swatchbook } ,
-    { "synagogue", fa::fa_synagogue } ,
-    { "syringe", fa::fa_syringe } ,
-    { "t", fa::fa_t } ,
-    { "table", fa::fa_table } ,
-    { "table-cells", fa::fa_table_cells } ,
-    { "th", fa::fa_th } ,
-    { "table-cells-column-lock", fa::fa_table_cells_column_lock } ,
-    { "table-cells-large", fa::fa_table_cells_large } ,
-    { "th-large", fa::fa_th_large } ,
-    { "table-cells-row-lock", fa::fa_table_cells_row_lock } ,
-    { "table-cells-row-unlock", fa::fa_table_cells_row_unlock } ,
-    { "table-columns", fa::fa_table_columns } ,
-    { "columns", fa::fa_columns } ,
-    { "table-list", fa::fa_table_list } ,
-    { "th-list", fa::fa_th_list } ,
-    { "table-tennis-paddle-ball", fa::fa_table_tennis_paddle_ball } ,
-    { "ping-pong-paddle-ball", fa::fa_ping_pong_paddle_ball } ,
-    { "table-tennis", fa::fa_table_tennis } ,
-    { "tablet", fa::fa_tablet } ,
-    { "tablet-android", fa::fa_tablet_android } ,
-    { "tablet-button", fa::fa_tablet_button } ,
-    { "tablet-screen-button", fa::fa_tablet_screen_button } ,
-    { "tablet-alt", fa::fa_tablet_alt } ,
-    { "tablets", fa::fa_tablets } ,
-    { "tachograph-digital", fa::fa_tachograph_digital } ,
-    { "digital-tachograph", fa::fa_digital_tachograph } ,
-    { "tag", fa::fa_tag } ,
-    { "tags", fa::fa_tags } ,
-    { "tape", fa::fa_tape } ,
-    { "tarp", fa::fa_tarp } ,
-    { "tarp-droplet", fa::fa_tarp_droplet } ,
-    { "taxi", fa::fa_taxi } ,
-    { "cab", fa::fa_cab } ,
-    { "teeth", fa::fa_teeth } ,
-    { "teeth-open", fa::fa_teeth_open } ,
-    { "temperature-arrow-down", fa::fa_temperature_arrow_down } ,
-    { "temperature-down", fa::fa_temperature_down } ,
-    { "temperature-arrow-up", fa::fa_temperature_arrow_up } ,
-    { "temperature-up", fa::fa_temperature_up } ,
-    { "temperature-empty", fa::fa_temperature_empty } ,
-    { "temperature-0", fa::fa_temperature_0 } ,
-    { "thermometer-0", fa::fa_thermometer_0 } ,
-    { "thermometer-empty", fa::fa_thermometer_empty } ,
-    { "temperature-full", fa::fa_temperature_full } ,
-    { "temperature-4", fa::fa_temperature_4 } ,
-    { "thermometer-4", fa::fa_thermometer_4 } ,
-    { "thermometer-full", fa::fa_thermometer_full } ,
-    { "temperature-half", fa::fa_temperature_half } ,
-    { "temperature-2", fa::fa_temperature_2 } ,
-    { "thermometer-2", fa::fa_thermometer_2 } ,
-    { "thermometer-half", fa::fa_thermometer_half } ,
-    { "temperature-high", fa::fa_temperature_high } ,
-    { "temperature-low", fa::fa_temperature_low } ,
-    { "temperature-quarter", fa::fa_temperature_quarter } ,
-    { "temperature-1", fa::fa_temperature_1 } ,
-    { "thermometer-1", fa::fa_thermometer_1 } ,
-    { "thermometer-quarter", fa::fa_thermometer_quarter } ,
-    { "temperature-three-quarters", fa::fa_temperature_three_quarters } ,
-    { "temperature-3", fa::fa_temperature_3 } ,
-    { "thermometer-3", fa::fa_thermometer_3 } ,
-    { "thermometer-three-quarters", fa::fa_thermometer_three_quarters } ,
-    { "tenge-sign", fa::fa_tenge_sign } ,
-    { "tenge", fa::fa_tenge } ,
-    { "tent", fa::fa_tent } ,
-    { "tent-arrow-down-to-line", fa::fa_tent_arrow_down_to_line } ,
-    { "tent-arrow-left-right", fa::fa_tent_arrow_left_right } ,
-    { "tent-arrow-turn-left", fa::fa_tent_arrow_turn_left } ,
-    { "tent-arrows-down", fa::fa_tent_arrows_down } ,
-    { "tents", fa::fa_tents } ,
-    { "terminal", fa::fa_terminal } ,
-    { "text-height", fa::fa_text_height } ,
-    { "text-slash", fa::fa_text_slash } ,
-    { "remove-format", fa::fa_remove_format } ,
-    { "text-width", fa::fa_text_width } ,
-    { "thermometer", fa::fa_thermometer } ,
-    { "thumbs-down", fa::fa_thumbs_down } ,
-    { "thumbs-up", fa::fa_thumbs_up } ,
-    { "thumbtack", fa::fa_thumbtack } ,
-    { "thumb-tack", fa::fa_thumb_tack } ,
-    { "thumbtack-slash", fa::fa_thumbtack_slash } ,
-    { "thumb-tack-slash", fa::fa_thumb_tack_slash } ,
-    { "ticket", fa::fa_ticket } ,
-    { "ticket-simple", fa::fa_ticket_simple } ,
-    { "ticket-alt", fa::fa_ticket_alt } ,
-    { "timeline", fa::fa_timeline } ,
-    { "toggle-off", fa::fa_toggle_off } ,
-    { "toggle-on", fa::fa_toggle_on } ,
-    { "toilet", fa::fa_toilet } ,
-    { "toilet-paper", fa::fa_toilet_paper } ,
-    { "toilet-paper-slash", fa::fa_toilet_paper_slash } ,
-    { "toilet-portable", fa::fa_toilet_portable } ,
-    { "toilets-portable", fa::fa_toilets_portable } ,
-    { "toolbox", fa::fa_toolbox } ,
-    { "tooth", fa::fa_tooth } ,
-    { "torii-gate", fa::fa_torii_gate } ,
-    { "tornado", fa::fa_tornado } ,
-    { "tower-broadcast", fa::fa_tower_broadcast } ,
-    { "broadcast-tower", fa::fa_broadcast_tower } ,
-    { "tower-cell", fa::fa_tower_cell } ,
-    { "tower-observation", fa::fa_tower_observation } ,
-    { "tractor", fa::fa_tractor } ,
-    { "trademark", fa::fa_trademark } ,
-    { "traffic-light", fa::fa_traffic_light } ,
-    { "trailer", fa::fa_trailer } ,
-    { "train", fa::fa_train } ,
-    { "train-subway", fa::fa_train_subway } ,
-    { "subway", fa::fa_subway } ,
-    { "train-tram", fa::fa_train_tram } ,
-    { "transgender", fa::fa_transgender } ,
-    { "transgender-alt", fa::fa_transgender_alt } ,
-    { "trash", fa::fa_trash } ,
-    { "trash-arrow-up", fa::fa_trash_arrow_up } ,
-    { "trash-restore", fa::fa_trash_restore } ,
-    { "trash-can", fa::fa_trash_can } ,
-    { "trash-alt", fa::fa_trash_alt } ,
-    { "trash-can-arrow-up", fa::fa_trash_can_arrow_up } ,
-    { "trash-restore-alt", fa::fa_trash_restore_alt } ,
-    { "tree", fa::fa_tree } ,
-    { "tree-city", fa::fa_tree_city } ,
-    { "triangle-exclamation", fa::fa_triangle_exclamation } ,
-    { "exclamation-triangle", fa::fa_exclamation_triangle } ,
-    { "warning", fa::fa_warning } ,
-    { "trophy", fa::fa_trophy } ,
-    { "trowel", fa::fa_trowel } ,
-    { "trowel-bricks", fa::fa_trowel_bricks } ,
-    { "truck", fa::fa_truck } ,
-    { "truck-arrow-right", fa::fa_truck_arrow_right } ,
-    { "truck-droplet", fa::fa_truck_droplet } ,
-    { "truck-fast", fa::fa_truck_fast } ,
-    { "shipping-fast", fa::fa_shipping_fast } ,
-    { "truck-field", fa::fa_truck_field } ,
-    { "truck-field-un", fa::fa_truck_field_un } ,
-    { "truck-front", fa::fa_truck_front } ,
-    { "truck-medical", fa::fa_truck_medical } ,
-    { "ambulance", fa::fa_ambulance } ,
-    { "truck-monster", fa::fa_truck_monster } ,
-    { "truck-moving", fa::fa_truck_moving } ,
-    { "truck-pickup", fa::fa_truck_pickup } ,
-    { "truck-plane", fa::fa_truck_plane } ,
-    { "truck-ramp-box", fa::fa_truck_ramp_box } ,
-    { "truck-loading", fa::fa_truck_loading } ,
-    { "tty", fa::fa_tty } ,
-    { "teletype", fa::fa_teletype } ,
-    { "turkish-lira-sign", fa::fa_turkish_lira_sign } ,
-    { "try", fa::fa_try } ,
-    { "turkish-lira", fa::fa_turkish_lira } ,
-    { "turn-down", fa::fa_turn_down } ,
-    { "level-down-alt", fa::fa_level_down_alt } ,
-    { "turn-up", fa::fa_turn_up } ,
-    { "level-up-alt", fa::fa_level_up_alt } ,
-    { "tv", fa::fa_tv } ,
-    { "television", fa::fa_television } ,
-    { "tv-alt", fa::fa_tv_alt } ,
-    { "u", fa::fa_u } ,
-    { "umbrella", fa::fa_umbrella } ,
-    { "umbrella-beach", fa::fa_umbrella_beach } ,
-    { "underline", fa::fa_underline } ,
-    { "universal-access", fa::fa_universal_access } ,
-    { "unlock", fa::fa_unlock } ,
-    { "unlock-keyhole", fa::fa_unlock_keyhole } ,
-    { "unlock-alt", fa::fa_unlock_alt } ,
-    { "up-down", fa::fa_up_down } ,
-    { "arrows-alt-v", fa::fa_arrows_alt_v } ,
-    { "up-down-left-right", fa::fa_up_down_left_right } ,
-    { "arrows-alt", fa::fa_arrows_alt } ,
-    { "up-long", fa::fa_up_long } ,
-    { "long-arrow-alt-up", fa::fa_long_arrow_alt_up } ,
-    { "up-right-and-down-left-from-center", fa::fa_up_right_and_down_left_from_center } ,
-    { "expand-alt", fa::fa_expand_alt } ,
-    { "up-right-from-square", fa::fa_up_right_from_square } ,
-    { "external-link-alt", fa::fa_external_link_alt } ,
-    { "upload", fa::fa_upload } ,
-    { "user", fa::fa_user } ,
-    { "user-astronaut", fa::fa_user_astronaut } ,
-    { "user-check", fa::fa_user_check } ,
-    { "user-clock", fa::fa_user_clock } ,
-    { "user-doctor", fa::fa_user_doctor } ,
-    { "user-md", fa::fa_user_md } ,
-    { "user-gear", fa::fa_user_gear } ,
-    { "user-cog", fa::fa_user_cog } ,
-    { "user-graduate", fa::fa_user_graduate } ,
-    { "user-group", fa::fa_user_group } ,
-    { "user-friends", fa::fa_user_friends } ,
-    { "user-injured", fa::fa_user_injured } ,
-    { "user-large", fa::fa_user_large } ,
-    { "user-alt", fa::fa_user_alt } ,
-    { "user-large-slash", fa::fa_user_large_slash } ,
-    { "user-alt-slash", fa::fa_user_alt_slash } ,
-    { "user-lock", fa::fa_user_lock } ,
-    { "user-minus", fa::fa_user_minus } ,
-    { "user-ninja", fa::fa_user_ninja } ,
-    { "user-nurse", fa::fa_user_nurse } ,
-    { "user-pen", fa::fa_user_pen } ,
-    { "user-edit", fa::fa_user_edit } ,
-    { "user-plus", fa::fa_user_plus } ,
-    { "user-secret", fa::fa_user_secret } ,
-    { "user-shield", fa::fa_user_shield } ,
-    { "user-slash", fa::fa_user_slash } ,
-    { "user-tag", fa::fa_user_tag } ,
-    { "user-tie", fa::fa_user_tie } ,
-    { "user-xmark", fa::fa_user_xmark } ,
-    { "user-times", fa::fa_user_times } ,
-    { "users", fa::fa_users } ,
-    { "users-between-lines", fa::fa_users_between_lines } ,
-    { "users-gear", fa::fa_users_gear } ,
-    { "users-cog", fa::fa_users_cog } ,
-    { "users-line", fa::fa_users_line } ,
-    { "users-rays", fa::fa_users_rays } ,
-    { "users-rectangle", fa::fa_users_rectangle } ,
-    { "users-slash", fa::fa_users_slash } ,
-    { "users-viewfinder", fa::fa_users_viewfinder } ,
-    { "utensils", fa::fa_utensils } ,
-    { "cutlery", fa::fa_cutlery } ,
-    { "v", fa::fa_v } ,
-    { "van-shuttle", fa::fa_van_shuttle } ,
-    { "shuttle-van", fa::fa_shuttle_van } ,
-    { "vault", fa::fa_vault } ,
-    { "vector-square", fa::fa_vector_square } ,
-    { "venus", fa::fa_venus } ,
-    { "venus-double", fa::fa_venus_double } ,
-    { "venus-mars", fa::fa_venus_mars } ,
-    { "vest", fa::fa_vest } ,
-    { "vest-patches", fa::fa_vest_patches } ,
-    { "vial", fa::fa_vial } ,
-    { "vial-circle-check", fa::fa_vial_circle_check } ,
-    { "vial-virus", fa::fa_vial_virus } ,
-    { "vials", fa::fa_vials } ,
-    { "video", fa::fa_video } ,
-    { "video-camera", fa::fa_video_camera } ,
-    { "video-slash", fa::fa_video_slash } ,
-    { "vihara", fa::fa_vihara } ,
-    { "virus", fa::fa_virus } ,
-    { "virus-covid", fa::fa_virus_covid } ,
-    { "virus-covid-slash", fa::fa_virus_covid_slash } ,
-    { "virus-slash", fa::fa_virus_slash } ,
-    { "viruses", fa::fa_viruses } ,
-    { "voicemail", fa::fa_voicemail } ,
-    { "volcano", fa::fa_volcano } ,
-    { "volleyball", fa::fa_volleyball } ,
-    { "volleyball-ball", fa::fa_volleyball_ball } ,
-    { "volume-high", fa::fa_volume_high } ,
-    { "volume-up", fa::fa_volume_up } ,
-    { "volume-low", fa::fa_volume_low } ,
-    { "volume-down", fa::fa_volume_down } ,
-    { "volume-off", fa::fa_volume_off } ,
-    { "volume-xmark", fa::fa_volume_xmark } ,
-    { "volume-mute", fa::fa_volume_mute } ,
-    { "volume-times", fa::fa_volume_times } ,
-    { "vr-cardboard", fa::fa_vr_cardboard } ,
-    { "w", fa::fa_w } ,
-    { "walkie-talkie", fa::fa_walkie_talkie } ,
-    { "wallet", fa::fa_wallet } ,
-    { "wand-magic", fa::fa_wand_magic } ,
-    { "magic", fa::fa_magic } ,
-    { "wand-magic-sparkles", fa::fa_wand_magic_sparkles } ,
-    { "magic-wand-sparkles", fa::fa_magic_wand_sparkles } ,
-    { "wand-sparkles", fa::fa_wand_sparkles } ,
-    { "warehouse", fa::fa_warehouse } ,
-    { "water", fa::fa_water } ,
-    { "water-ladder", fa::fa_water_ladder } ,
-    { "ladder-water", fa::fa_ladder_water } ,
-    { "swimming-pool", fa::fa_swimming_pool } ,
-    { "wave-square", fa::fa_wave_square } ,
-    { "weight-hanging", fa::fa_weight_hanging } ,
-    { "weight-scale", fa::fa_weight_scale } ,
-    { "weight", fa::fa_weight } ,
-    { "wheat-awn", fa::fa_wheat_awn } ,
-    { "wheat-alt", fa::fa_wheat_alt } ,
-    { "wheat-awn-circle-exclamation", fa::fa_wheat_awn_circle_exclamation } ,
-    { "wheelchair", fa::fa_wheelchair } ,
-    { "wheelchair-move", fa::fa_wheelchair_move } ,
-    { "wheelchair-alt", fa::fa_wheelchair_alt } ,
-    { "whiskey-glass", fa::fa_whiskey_glass } ,
-    { "glass-whiskey", fa::fa_glass_whiskey } ,
-    { "wifi", fa::fa_wifi } ,
-    { "wifi-3", fa::fa_wifi_3 } ,
-    { "wifi-strong", fa::fa_wifi_strong } ,
-    { "wind", fa::fa_wind } ,
-    { "window-maximize", fa::fa_window_maximize } ,
-    { "window-minimize", fa::fa_window_minimize } ,
-    { "window-restore", fa::fa_window_restore } ,
-    { "wine-bottle", fa::fa_wine_bottle } ,
-    { "wine-glass", fa::fa_wine_glass } ,
-    { "wine-glass-empty", fa::fa_wine_glass_empty } ,
-    { "wine-glass-alt", fa::fa_wine_glass_alt } ,
-    { "won-sign", fa::fa_won_sign } ,
-    { "krw", fa::fa_krw } ,
-    { "won", fa::fa_won } ,
-    { "worm", fa::fa_worm } ,
-    { "wrench", fa::fa_wrench } ,
-    { "x", fa::fa_x } ,
-    { "x-ray", fa::fa_x_ray } ,
-    { "xmark", fa::fa_xmark } ,
-    { "close", fa::fa_close } ,
-    { "multiply", fa::fa_multiply } ,
-    { "remove", fa::fa_remove } ,
-    { "times", fa::fa_times } ,
-    { "xmarks-lines", fa::fa_xmarks_lines } ,
-    { "y", fa::fa_y } ,
-    { "yen-sign", fa::fa_yen_sign } ,
-    { "cny", fa::fa_cny } ,
-    { "jpy", fa::fa_jpy } ,
-    { "rmb", fa::fa_rmb } ,
-    { "yen", fa::fa_yen } ,
-    { "yin-yang", fa::fa_yin_yang } ,
-    { "z", fa::fa_z } 
+#ifndef QTAWESOMESTRINGGENERATED_H
+#define QTAWESOMESTRINGGENERATED_H
 
-};
+namespace fa {
 
-static const fa::QtAwesomeNamedIcon faBrandsIconArray[] = {
-    { "42-group", fa::fa_42_group } ,
-    { "innosoft", fa::fa_innosoft } ,
-    { "500px", fa::fa_500px } ,
-    { "accessible-icon", fa::fa_accessible_icon } ,
-    { "accusoft", fa::fa_accusoft } ,
-    { "adn", fa::fa_adn } ,
-    { "adversal", fa::fa_adversal } ,
-    { "affiliatetheme", fa::fa_affiliatetheme } ,
-    { "airbnb", fa::fa_airbnb } ,
-    { "algolia", fa::fa_algolia } ,
-    { "alipay", fa::fa_alipay } ,
-    { "amazon", fa::fa_amazon } ,
-    { "amazon-pay", fa::fa_amazon_pay } ,
-    { "amilia", fa::fa_amilia } ,
-    { "android", fa::fa_android } ,
-    { "angellist", fa::fa_angellist } ,
-    { "angrycreative", fa::fa_angrycreative } ,
-    { "angular", fa::fa_angular } ,
-    { "app-store", fa::fa_app_store } ,
-    { "app-store-ios", fa::fa_app_store_ios } ,
-    { "apper", fa::fa_apper } ,
-    { "apple", fa::fa_apple } ,
-    { "apple-pay", fa::fa_apple_pay } ,
-    { "artstation", fa::fa_artstation } ,
-    { "asymmetrik", fa::fa_asymmetrik } ,
-    { "atlassian", fa::fa_atlassian } ,
-    { "audible", fa::fa_audible } ,
-    { "autoprefixer", fa::fa_autoprefixer } ,
-    { "avianex", fa::fa_avianex } ,
-    { "aviato", fa::fa_aviato } ,
-    { "aws", fa::fa_aws } ,
-    { "bandcamp", fa::fa_bandcamp } ,
-    { "battle-net", fa::fa_battle_net } ,
-    { "behance", fa::fa_behance } ,
-    { "bilibili", fa::fa_bilibili } ,
-    { "bimobject", fa::fa_bimobject } ,
-    { "bitbucket", fa::fa_bitbucket } ,
-    { "bitcoin", fa::fa_bitcoin } ,
-    { "bity", fa::fa_bity } ,
-    { "black-tie", fa::fa_black_tie } ,
-    { "blackberry", fa::fa_blackberry } ,
-    { "blogger", fa::fa_blogger } ,
-    { "blogger-b", fa::fa_blogger_b } ,
-    { "bluesky", fa::fa_bluesky } ,
-    { "bluetooth", fa::fa_bluetooth } ,
-    { "bluetooth-b", fa::fa_bluetooth_b } ,
-    { "bootstrap", fa::fa_bootstrap } ,
-    { "bots", fa::fa_bots } ,
-    { "brave", fa::fa_brave } ,
-    { "brave-reverse", fa::fa_brave_reverse } ,
-    { "btc", fa::fa_btc } ,
-    { "buffer", fa::fa_buffer } ,
-    { "buromobelexperte", fa::fa_buromobelexperte } ,
-    { "buy-n-large", fa::fa_buy_n_large } ,
-    { "buysellads", fa::fa_buysellads } ,
-    { "canadian-maple-leaf", fa::fa_canadian_maple_leaf } ,
-    { "cc-amazon-pay", fa::fa_cc_amazon_pay } ,
-    { "cc-amex", fa::fa_cc_amex } ,
-    { "cc-apple-pay", fa::fa_cc_apple_pay } ,
-    { "cc-diners-club", fa::fa_cc_diners_club } ,
-    { "cc-discover", fa::fa_cc_discover } ,
-    { "cc-jcb", fa::fa_cc_jcb } ,
-    { "cc-mastercard", fa::fa_cc_mastercard } ,
-    { "cc-paypal", fa::fa_cc_paypal } ,
-    { "cc-stripe", fa::fa_cc_stripe } ,
-    { "cc-visa", fa::fa_cc_visa } ,
-    { "centercode", fa::fa_centercode } ,
-    { "centos", fa::fa_centos } ,
-    { "chrome", fa::fa_chrome } ,
-    { "chromecast", fa::fa_chromecast } ,
-    { "cloudflare", fa::fa_cloudflare } ,
-    { "cloudscale", fa::fa_cloudscale } ,
-    { "cloudsmith", fa::fa_cloudsmith } ,
-    { "cloudversify", fa::fa_cloudversify } ,
-    { "cmplid", fa::fa_cmplid } ,
-    { "codepen", fa::fa_codepen } ,
-    { "codiepie", fa::fa_codiepie } ,
-    { "confluence", fa::fa_confluence } ,
-    { "connectdevelop", fa::fa_connectdevelop } ,
-    { "contao", fa::fa_contao } ,
-    { "cotton-bureau", fa::fa_cotton_bureau } ,
-    { "cpanel", fa::fa_cpanel } ,
-    { "creative-commons", fa::fa_creative_commons } ,
-    { "creative-commons-by", fa::fa_creative_commons_by } ,
-    { "creative-commons-nc", fa::fa_creative_commons_nc } ,
-    { "creative-commons-nc-eu", fa::fa_creative_commons_nc_eu } ,
-    { "creative-commons-nc-jp", fa::fa_creative_commons_nc_jp } ,
-    { "creative-commons-nd", fa::fa_creative_commons_nd } ,
-    { "creative-commons-pd", fa::fa_creative_commons_pd } ,
-    { "creative-commons-pd-alt", fa::fa_creative_commons_pd_alt } ,
-    { "creative-commons-remix", fa::fa_creative_commons_remix } ,
-    { "creative-commons-sa", fa::fa_creative_commons_sa } ,
-    { "creative-commons-sampling", fa::fa_creative_commons_sampling } ,
-    { "creative-commons-sampling-plus", fa::fa_creative_commons_sampling_plus } ,
-    { "creative-commons-share", fa::fa_creative_commons_share } ,
-    { "creative-commons-zero", fa::fa_creative_commons_zero } ,
-    { "critical-role", fa::fa_critical_role } ,
-    { "css", fa::fa_css } ,
-    { "css3", fa::fa_css3 } ,
-    { "css3-alt", fa::fa_css3_alt } ,
-    { "cuttlefish", fa::fa_cuttlefish } ,
-    { "d-and-d", fa::fa_d_and_d } ,
-    { "d-and-d-beyond", fa::fa_d_and_d_beyond } ,
-    { "dailymotion", fa::fa_dailymotion } ,
-    { "dart-lang", fa::fa_dart_lang } ,
-    { "dashcube", fa::fa_dashcube } ,
-    { "debian", fa::fa_debian } ,
-    { "deezer", fa::fa_deezer } ,
-    { "delicious", fa::fa_delicious } ,
-    { "deploydog", fa::fa_deploydog } ,
-    { "deskpro", fa::fa_deskpro } ,
-    { "dev", fa::fa_dev } ,
-    { "deviantart", fa::fa_deviantart } ,
-    { "dhl", fa::fa_dhl } ,
-    { "diaspora", fa::fa_diaspora } ,
-    { "digg", fa::fa_digg } ,
-    { "digital-ocean", fa::fa_digital_ocean } ,
-    { "discord", fa::fa_discord } ,
-    { "discourse", fa::fa_discourse } ,
-    { "dochub", fa::fa_dochub } ,
-    { "docker", fa::fa_docker } ,
-    { "draft2digital", fa::fa_draft2digital } ,
-    { "dribbble", fa::fa_dribbble } ,
-    { "dropbox", fa::fa_dropbox } ,
-    { "drupal", fa::fa_drupal } ,
-    { "dyalog", fa::fa_dyalog } ,
-    { "earlybirds", fa::fa_earlybirds } ,
-    { "ebay", fa::fa_ebay } ,
-    { "edge", fa::fa_edge } ,
-    { "edge-legacy", fa::fa_edge_legacy } ,
-    { "elementor", fa::fa_elementor } ,
-    { "ello", fa::fa_ello } ,
-    { "ember", fa::fa_ember } ,
-    { "empire", fa::fa_empire } ,
-    { "envira", fa::fa_envira } ,
-    { "erlang", fa::fa_erlang } ,
-    { "ethereum", fa::fa_ethereum } ,
-    { "etsy", fa::fa_etsy } ,
-    { "evernote", fa::fa_evernote } ,
-    { "expeditedssl", fa::fa_expeditedssl } ,
-    { "facebook", fa::fa_facebook } ,
-    { "facebook-f", fa::fa_facebook_f } ,
-    { "facebook-messenger", fa::fa_facebook_messenger } ,
-    { "fantasy-flight-games", fa::fa_fantasy_flight_games } ,
-    { "fedex", fa::fa_fedex } ,
-    { "fedora", fa::fa_fedora } ,
-    { "figma", fa::fa_figma } ,
-    { "files-pinwheel", fa::fa_files_pinwheel } ,
-    { "firefox", fa::fa_firefox } ,
-    { "firefox-browser", fa::fa_firefox_browser } ,
-    { "first-order", fa::fa_first_order } ,
-    { "first-order-alt", fa::fa_first_order_alt } ,
-    { "firstdraft", fa::fa_firstdraft } ,
-    { "flickr", fa::fa_flickr } ,
-    { "flipboard", fa::fa_flipboard } ,
-    { "flutter", fa::fa_flutter } ,
-    { "fly", fa::fa_fly } ,
-    { "font-awesome", fa::fa_font_awesome } ,
-    { "font-awesome-flag", fa::fa_font_awesome_flag } ,
-    { "font-awesome-logo-full", fa::fa_font_awesome_logo_full } ,
-    { "fonticons", fa::fa_fonticons } ,
-    { "fonticons-fi", fa::fa_fonticons_fi } ,
-    { "fort-awesome", fa::fa_fort_awesome } ,
-    { "fort-awesome-alt", fa::fa_fort_awesome_alt } ,
-    { "forumbee", fa::fa_forumbee } ,
-    { "foursquare", fa::fa_foursquare } ,
-    { "free-code-camp", fa::fa_free_code_camp } ,
-    { "freebsd", fa::fa_freebsd } ,
-    { "fulcrum", fa::fa_fulcrum } ,
-    { "galactic-republic", fa::fa_galactic_republic } ,
-    { "galactic-senate", fa::fa_galactic_senate } ,
-    { "get-pocket", fa::fa_get_pocket } ,
-    { "gg", fa::fa_gg } ,
-    { "gg-circle", fa::fa_gg_circle } ,
-    { "git", fa::fa_git } ,
-    { "git-alt", fa::fa_git_alt } ,
-    { "github", fa::fa_github } ,
-    { "github-alt", fa::fa_github_alt } ,
-    { "gitkraken", fa::fa_gitkraken } ,
-    { "gitlab", fa::fa_gitlab } ,
-    { "gitter", fa::fa_gitter } ,
-    { "glide", fa::fa_glide } ,
-    { "glide-g", fa::fa_glide_g } ,
-    { "gofore", fa::fa_gofore } ,
-    { "golang", fa::fa_golang } ,
-    { "goodreads", fa::fa_goodreads } ,
-    { "goodreads-g", fa::fa_goodreads_g } ,
-    { "google", fa::fa_google } ,
-    { "google-drive", fa::fa_google_drive } ,
-    { "google-pay", fa::fa_google_pay } ,
-    { "google-play", fa::fa_google_play } ,
-    { "google-plus", fa::fa_google_plus } ,
-    { "google-plus-g", fa::fa_google_plus_g } ,
-    { "google-scholar", fa::fa_google_scholar } ,
-    { "google-wallet", fa::fa_google_wallet } ,
-    { "gratipay", fa::fa_gratipay } ,
-    { "grav", fa::fa_grav } ,
-    { "gripfire", fa::fa_gripfire } ,
-    { "grunt", fa::fa_grunt } ,
-    { "guilded", fa::fa_guilded } ,
-    { "gulp", fa::fa_gulp } ,
-    { "hacker-news", fa::fa_hacker_news } ,
-    { "hackerrank", fa::fa_hackerrank } ,
-    { "hashnode", fa::fa_hashnode } ,
-    { "hips", fa::fa_hips } ,
-    { "hire-a-helper", fa::fa_hire_a_helper } ,
-    { "hive", fa::fa_hive } ,
-    { "hooli", fa::fa_hooli } ,
-    { "hornbill", fa::fa_hornbill } ,
-    { "hotjar", fa::fa_hotjar } ,
-    { "houzz", fa::fa_houzz } ,
-    { "html5", fa::fa_html5 } ,
-    { "hubspot", fa::fa_hubspot } ,
-    { "ideal", fa::fa_ideal } ,
-    { "imdb", fa::fa_imdb } ,
-    { "instagram", fa::fa_instagram } ,
-    { "instalod", fa::fa_instalod } ,
-    { "intercom", fa::fa_intercom } ,
-    { "internet-explorer", fa::fa_internet_explorer } ,
-    { "invision", fa::fa_invision } ,
-    { "ioxhost", fa::fa_ioxhost } ,
-    { "itch-io", fa::fa_itch_io } ,
-    { "itunes", fa::fa_itunes } ,
-    { "itunes-note", fa::fa_itunes_note } ,
-    { "java", fa::fa_java } ,
-    { "jedi-order", fa::fa_jedi_order } ,
-    { "jenkins", fa::fa_jenkins } ,
-    { "jira", fa::fa_jira } ,
-    { "joget", fa::fa_joget } ,
-    { "joomla", fa::fa_joomla } ,
-    { "js", fa::fa_js } ,
-    { "jsfiddle", fa::fa_jsfiddle } ,
-    { "jxl", fa::fa_jxl } ,
-    { "kaggle", fa::fa_kaggle } ,
-    { "keybase", fa::fa_keybase } ,
-    { "keycdn", fa::fa_keycdn } ,
-    { "kickstarter", fa::fa_kickstarter } ,
-    { "square-kickstarter", fa::fa_square_kickstarter } ,
-    { "kickstarter-k", fa::fa_kickstarter_k } ,
-    { "korvue", fa::fa_korvue } ,
-    { "laravel", fa::fa_laravel } ,
-    { "lastfm", fa::fa_lastfm } ,
-    { "leanpub", fa::fa_leanpub } ,
-    { "less", fa::fa_less } ,
-    { "letterboxd", fa::fa_letterboxd } ,
-    { "line", fa::fa_line } ,
-    { "linkedin", fa::fa_linkedin } ,
-    { "linkedin-in", fa::fa_linkedin_in } ,
-    { "linode", fa::fa_linode } ,
-    { "linux", fa::fa_linux } ,
-    { "lyft", fa::fa_lyft } ,
-    { "magento", fa::fa_magento } ,
-    { "mailchimp", fa::fa_mailchimp } ,
-    { "mandalorian", fa::fa_mandalorian } ,
-    { "markdown", fa::fa_markdown } ,
-    { "mastodon", fa::fa_mastodon } ,
-    { "maxcdn", fa::fa_maxcdn } ,
-    { "mdb", fa::fa_mdb } ,
-    { "medapps", fa::fa_medapps } ,
-    { "medium", fa::fa_medium } ,
-    { "medium-m", fa::fa_medium_m } ,
-    { "medrt", fa::fa_medrt } ,
-    { "meetup", fa::fa_meetup } ,
-    { "megaport", fa::fa_megaport } ,
-    { "mendeley", fa::fa_mendeley } ,
-    { "meta", fa::fa_meta } ,
-    { "microblog", fa::fa_microblog } ,
-    { "microsoft", fa::fa_microsoft } ,
-    { "mintbit", fa::fa_mintbit } ,
-    { "mix", fa::fa_mix } ,
-    { "mixcloud", fa::fa_mixcloud } ,
-    { "mixer", fa::fa_mixer } ,
-    { "mizuni", fa::fa_mizuni } ,
-    { "modx", fa::fa_modx } ,
-    { "monero", fa::fa_monero } ,
-    { "napster", fa::fa_napster } ,
-    { "neos", fa::fa_neos } ,
-    { "nfc-directional", fa::fa_nfc_directional } ,
-    { "nfc-symbol", fa::fa_nfc_symbol } ,
-    { "nimblr", fa::fa_nimblr } ,
-    { "node", fa::fa_node } ,
-    { "node-js", fa::fa_node_js } ,
-    { "npm", fa::fa_npm } ,
-    { "ns8", fa::fa_ns8 } ,
-    { "nutritionix", fa::fa_nutritionix } ,
-    { "octopus-deploy", fa::fa_octopus_deploy } ,
-    { "odnoklassniki", fa::fa_odnoklassniki } ,
-    { "odysee", fa::fa_odysee } ,
-    { "old-republic", fa::fa_old_republic } ,
-    { "opencart", fa::fa_opencart } ,
-    { "openid", fa::fa_openid } ,
-    { "opensuse", fa::fa_opensuse } ,
-    { "opera", fa::fa_opera } ,
-    { "optin-monster", fa::fa_optin_monster } ,
-    { "orcid", fa::fa_orcid } ,
-    { "osi", fa::fa_osi } ,
-    { "padlet", fa::fa_padlet } ,
-    { "page4", fa::fa_page4 } ,
-    { "pagelines", fa::fa_pagelines } ,
-    { "palfed", fa::fa_palfed } ,
-    { "patreon", fa::fa_patreon } ,
-    { "paypal", fa::fa_paypal } ,
-    { "perbyte", fa::fa_perbyte } ,
-    { "periscope", fa::fa_periscope } ,
-    { "phabricator", fa::fa_phabricator } ,
-    { "phoenix-framework", fa::fa_phoenix_framework } ,
-    { "phoenix-squadron", fa::fa_phoenix_squadron } ,
-    { "php", fa::fa_php } ,
-    { "pied-piper", fa::fa_pied_piper } ,
-    { "pied-piper-alt", fa::fa_pied_piper_alt } ,
-    { "pied-piper-hat", fa::fa_pied_piper_hat } ,
-    { "pied-piper-pp", fa::fa_pied_piper_pp } ,
-    { "pinterest", fa::fa_pinterest } ,
-    { "pinterest-p", fa::fa_pinterest_p } ,
-    { "pix", fa::fa_pix } ,
-    { "pixiv", fa::fa_pixiv } ,
-    { "playstation", fa::fa_playstation } ,
-    { "product-hunt", fa::fa_product_hunt } ,
-    { "pushed", fa::fa_pushed } ,
-    { "python", fa::fa_python } ,
-    { "qq", fa::fa_qq } ,
-    { "quinscape", fa::fa_quinscape } ,
-    { "quora", fa::fa_quora } ,
-    { "r-project", fa::fa_r_project } ,
-    { "raspberry-pi", fa::fa_raspberry_pi } ,
-    { "ravelry", fa::fa_ravelry } ,
-    { "react", fa::fa_react } ,
-    { "reacteurope", fa::fa_reacteurope } ,
-    { "readme", fa::fa_readme } ,
-    { "rebel", fa::fa_rebel } ,
-    { "red-river", fa::fa_red_river } ,
-    { "reddit", fa::fa_reddit } ,
-    { "reddit-alien", fa::fa_reddit_alien } ,
-    { "redhat", fa::fa_redhat } ,
-    { "renren", fa::fa_renren } ,
-    { "replyd", fa::fa_replyd } ,
-    { "researchgate", fa::fa_researchgate } ,
-    { "resolving", fa::fa_resolving } ,
-    { "rev", fa::fa_rev } ,
-    { "rocketchat", fa::fa_rocketchat } ,
-    { "rockrms", fa::fa_rockrms } ,
-    { "rust", fa::fa_rust } ,
-    { "safari", fa::fa_safari } ,
-    { "salesforce", fa::fa_salesforce } ,
-    { "sass", fa::fa_sass } ,
-    { "schlix", fa::fa_schlix } ,
-    { "screenpal", fa::fa_screenpal } ,
-    { "scribd", fa::fa_scribd } ,
-    { "searchengin", fa::fa_searchengin } ,
-    { "sellcast", fa::fa_sellcast } ,
-    { "sellsy", fa::fa_sellsy } ,
-    { "servicestack", fa::fa_servicestack } ,
-    { "shirtsinbulk", fa::fa_shirtsinbulk } ,
-    { "shoelace", fa::fa_shoelace } ,
-    { "shopify", fa::fa_shopify } ,
-    { "shopware", fa::fa_shopware } ,
-    { "signal-messenger", fa::fa_signal_messenger } ,
-    { "simplybuilt", fa::fa_simplybuilt } ,
-    { "sistrix", fa::fa_sistrix } ,
-    { "sith", fa::fa_sith } ,
-    { "sitrox", fa::fa_sitrox } ,
-    { "sketch", fa::fa_sketch } ,
-    { "skyatlas", fa::fa_skyatlas } ,
-    { "skype", fa::fa_skype } ,
-    { "slack", fa::fa_slack } ,
-    { "slack-hash", fa::fa_slack_hash } ,
-    { "slideshare", fa::fa_slideshare } ,
-    { "snapchat", fa::fa_snapchat } ,
-    { "snapchat-ghost", fa::fa_snapchat_ghost } ,
-    { "soundcloud", fa::fa_soundcloud } ,
-    { "sourcetree", fa::fa_sourcetree } ,
-    { "space-awesome", fa::fa_space_awesome } ,
-    { "speakap", fa::fa_speakap } ,
-    { "speaker-deck", fa::fa_speaker_deck } ,
-    { "spotify", fa::fa_spotify } ,
-    { "square-behance", fa::fa_square_behance } ,
-    { "behance-square", fa::fa_behance_square } ,
-    { "square-bluesky", fa::fa_square_bluesky } ,
-    { "square-dribbble", fa::fa_square_dribbble } ,
-    { "dribbble-square", fa::fa_dribbble_square } ,
-    { "square-facebook", fa::fa_square_facebook } ,
-    { "facebook-square", fa::fa_facebook_square } ,
-    { "square-font-awesome", fa::fa_square_font_awesome } ,
-    { "square-font-awesome-stroke", fa::fa_square_font_awesome_stroke } ,
-    { "font-awesome-alt", fa::fa_font_awesome_alt } ,
-    { "square-git", fa::fa_square_git } ,
-    { "git-square", fa::fa_git_square } ,
-    { "square-github", fa::fa_square_github } ,
-    { "github-square", fa::fa_github_square } ,
-    { "square-gitlab", fa::fa_square_gitlab } ,
-    { "gitlab-square", fa::fa_gitlab_square } ,
-    { "square-google-plus", fa::fa_square_google_plus } ,
-    { "google-plus-square", fa::fa_google_plus_square } ,
-    { "square-hacker-news", fa::fa_square_hacker_news } ,
-    { "hacker-news-square", fa::fa_hacker_news_square } ,
-    { "square-instagram", fa::fa_square_instagram } ,
-    { "instagram-square", fa::fa_instagram_square } ,
-    { "square-js", fa::fa_square_js } ,
-    { "js-square", fa::fa_js_square } ,
-    { "square-lastfm", fa::fa_square_lastfm } ,
-    { "lastfm-square", fa::fa_lastfm_square } ,
-    { "square-letterboxd", fa::fa_square_letterboxd } ,
-    { "square-odnoklassniki", fa::fa_square_odnoklassniki } ,
-    { "odnoklassniki-square", fa::fa_odnoklassniki_square } ,
-    { "square-pied-piper", fa::fa_square_pied_piper } ,
-    { "pied-piper-square", fa::fa_pied_piper_square } ,
-    { "square-pinterest", fa::fa_square_pinterest } ,
-    { "pinterest-square", fa::fa_pinterest_square } ,
-    { "square-reddit", fa::fa_square_reddit } ,
-    { "reddit-square", fa::fa_reddit_square } ,
-    { "square-snapchat", fa::fa_square_snapchat } ,
-    { "snapchat-square", fa::fa_snapchat_square } ,
-    { "square-steam", fa::fa_square_steam } ,
-    { "steam-square", fa::fa_steam_square } ,
-    { "square-threads", fa::fa_square_threads } ,
-    { "square-tumblr", fa::fa_square_tumblr } ,
-    { "tumblr-square", fa::fa_tumblr_square } ,
-    { "square-twitter", fa::fa_square_twitter } ,
-    { "twitter-square", fa::fa_twitter_square } ,
-    { "square-upwork", fa::fa_square_upwork } ,
-    { "square-viadeo", fa::fa_square_viadeo } ,
-    { "viadeo-square", fa::fa_viadeo_square } ,
-    { "square-vimeo", fa::fa_square_vimeo } ,
-    { "vimeo-square", fa::fa_vimeo_square } ,
-    { "square-web-awesome", fa::fa_square_web_awesome } ,
-    { "square-web-awesome-stroke", fa::fa_square_web_awesome_stroke } ,
-    { "square-whatsapp", fa::fa_square_whatsapp } ,
-    { "whatsapp-square", fa::fa_whatsapp_square } ,
-    { "square-x-twitter", fa::fa_square_x_twitter } ,
-    { "square-xing", fa::fa_square_xing } ,
-    { "xing-square", fa::fa_xing_square } ,
-    { "square-youtube", fa::fa_square_youtube } ,
-    { "youtube-square", fa::fa_youtube_square } ,
-    { "squarespace", fa::fa_squarespace } ,
-    { "stack-exchange", fa::fa_stack_exchange } ,
-    { "stack-overflow", fa::fa_stack_overflow } ,
-    { "stackpath", fa::fa_stackpath } ,
-    { "staylinked", fa::fa_staylinked } ,
-    { "steam", fa::fa_steam } ,
-    { "steam-symbol", fa::fa_steam_symbol } ,
-    { "sticker-mule", fa::fa_sticker_mule } ,
-    { "strava", fa::fa_strava } ,
-    { "stripe", fa::fa_stripe } ,
-    { "stripe-s", fa::fa_stripe_s } ,
-    { "stubber", fa::fa_stubber } ,
-    { "studiovinari", fa::fa_studiovinari } ,
-    { "stumbleupon", fa::fa_stumbleupon } ,
-    { "stumbleupon-circle", fa::fa_stumbleupon_circle } ,
-    { "superpowers", fa::fa_superpowers } ,
-    { "supple", fa::fa_supple } ,
-    { "suse", fa::fa_suse } ,
-    { "swift", fa::fa_swift } ,
-    { "symfony", fa::fa_symfony } ,
-    { "teamspeak", fa::fa_teamspeak } ,
-    { "telegram", fa::fa_telegram } ,
-    { "telegram-plane", fa::fa_telegram_plane } ,
-    { "tencent-weibo", fa::fa_tencent_weibo } ,
-    { "the-red-yeti", fa::fa_the_red_yeti } ,
-    { "themeco", fa::fa_themeco } ,
-    { "themeisle", fa::fa_themeisle } ,
-    { "think-peaks", fa::fa_think_peaks } ,
-    { "threads", fa::fa_threads } ,
-    { "tiktok", fa::fa_tiktok } ,
-    { "trade-federation", fa::fa_trade_federation } ,
-    { "trello", fa::fa_trello } ,
-    { "tumblr", fa::fa_tumblr } ,
-    { "twitch", fa::fa_twitch } ,
-    { "twitter", fa::fa_twitter } ,
-    { "typo3", fa::fa_typo3 } ,
-    { "uber", fa::fa_uber } ,
-    { "ubuntu", fa::fa_ubuntu } ,
-    { "uikit", fa::fa_uikit } ,
-    { "umbraco", fa::fa_umbraco } ,
-    { "uncharted", fa::fa_uncharted } ,
-    { "uniregistry", fa::fa_uniregistry } ,
-    { "unity", fa::fa_unity } ,
-    { "unsplash", fa::fa_unsplash } ,
-    { "untappd", fa::fa_untappd } ,
-    { "ups", fa::fa_ups } ,
-    { "upwork", fa::fa_upwork } ,
-    { "usb", fa::fa_usb } ,
-    { "usps", fa::fa_usps } ,
-    { "ussunnah", fa::fa_ussunnah } ,
-    { "vaadin", fa::fa_vaadin } ,
-    { "viacoin", fa::fa_viacoin } ,
-    { "viadeo", fa::fa_viadeo } ,
-    { "viber", fa::fa_viber } ,
-    { "vimeo", fa::fa_vimeo } ,
-    { "vimeo-v", fa::fa_vimeo_v } ,
-    { "vine", fa::fa_vine } ,
-    { "vk", fa::fa_vk } ,
-    { "vnv", fa::fa_vnv } ,
-    { "vuejs", fa::fa_vuejs } ,
-    { "watchman-monitoring", fa::fa_watchman_monitoring } ,
-    { "waze", fa::fa_waze } ,
-    { "web-awesome", fa::fa_web_awesome } ,
-    { "webflow", fa::fa_webflow } ,
-    { "weebly", fa::fa_weebly } ,
-    { "weibo", fa::fa_weibo } ,
-    { "weixin", fa::fa_weixin } ,
-    { "whatsapp", fa::fa_whatsapp } ,
-    { "whmcs", fa::fa_whmcs } ,
-    { "wikipedia-w", fa::fa_wikipedia_w } ,
-    { "windows", fa::fa_windows } ,
-    { "wirsindhandwerk", fa::fa_wirsindhandwerk } ,
-    { "wsh", fa::fa_wsh } ,
-    { "wix", fa::fa_wix } ,
-    { "wizards-of-the-coast", fa::fa_wizards_of_the_coast } ,
-    { "wodu", fa::fa_wodu } ,
-    { "wolf-pack-battalion", fa::fa_wolf_pack_battalion } ,
-    { "wordpress", fa::fa_wordpress } ,
-    { "wordpress-simple", fa::fa_wordpress_simple } ,
-    { "wpbeginner", fa::fa_wpbeginner } ,
-    { "wpexplorer", fa::fa_wpexplorer } ,
-    { "wpforms", fa::fa_wpforms } ,
-    { "wpressr", fa::fa_wpressr } ,
-    { "rendact", fa::fa_rendact } ,
-    { "x-twitter", fa::fa_x_twitter } ,
-    { "xbox", fa::fa_xbox } ,
-    { "xing", fa::fa_xing } ,
-    { "y-combinator", fa::fa_y_combinator } ,
-    { "yahoo", fa::fa_yahoo } ,
-    { "yammer", fa::fa_yammer } ,
-    { "yandex", fa::fa_yandex } ,
-    { "yandex-international", fa::fa_yandex_international } ,
-    { "yarn", fa::fa_yarn } ,
-    { "yelp", fa::fa_yelp } ,
-    { "yoast", fa::fa_yoast } ,
-    { "youtube", fa::fa_youtube } ,
-    { "zhihu", fa::fa_zhihu } 
+// All icon names in a single string table, the name tables refer to the names by offset.
+// (This prevents a relocation per name when QtAwesome is built as a shared library)
+// The name tables are sorted by name, so names can be looked up with a binary search.
+// The tables are constexpr, so QtAwesomeLiterals.h can resolve names at compile time.
+static constexpr char faIconNames[] =
+    "0\0"
+    "1\0"
+    "2\0"
+    "3\0"
+    "4\0"
+    "5\0"
+    "6\0"
+    "7\0"
+    "8\0"
+    "9\0"
+    "a\0"
+    "address-book\0"
+    "contact-book\0"
+    "address-card\0"
+    "contact-card\0"
+    "vcard\0"
+    "align-center\0"
+    "align-justify\0"
+    "align-left\0"
+    "align-right\0"
+    "anchor\0"
+    "anchor-circle-check\0"
+    "anchor-circle-exclamation\0"
+    "anchor-circle-xmark\0"
+    "anchor-lock\0"
+    "angle-down\0"
+    "angle-left\0"
+    "angle-right\0"
+    "angle-up\0"
+    "angles-down\0"
+    "angle-double-down\0"
+    "angles-left\0"
+    "angle-double-left\0"
+    "angles-right\0"
+    "angle-double-right\0"
+    "angles-up\0"
+    "angle-double-up\0"
+    "ankh\0"
+    "apple-whole\0"
+    "apple-alt\0"
+    "archway\0"
+    "arrow-down\0"
+    "arrow-down-1-9\0"
+    "sort-numeric-asc\0"
+    "sort-numeric-down\0"
+    "arrow-down-9-1\0"
+    "sort-numeric-desc\0"
+    "sort-numeric-down-alt\0"
+    "arrow-down-a-z\0"
+    "sort-alpha-asc\0"
+    "sort-alpha-down\0"
+    "arrow-down-long\0"
+    "long-arrow-down\0"
+    "arrow-down-short-wide\0"
+    "sort-amount-desc\0"
+    "sort-amount-down-alt\0"
+    "arrow-down-up-across-line\0"
+    "arrow-down-up-lock\0"
+    "arrow-down-wide-short\0"
+    "sort-amount-asc\0"
+    "sort-amount-down\0"
+    "arrow-down-z-a\0"
+    "sort-alpha-desc\0"
+    "sort-alpha-down-alt\0"
+    "arrow-left\0"
+    "arrow-left-long\0"
+    "long-arrow-left\0"
+    "arrow-pointer\0"
+    "mouse-pointer\0"
+    "arrow-right\0"
+    "arrow-right-arrow-left\0"
+    "exchange\0"
+    "arrow-right-from-bracket\0"
+    "sign-out\0"
+    "arrow-right-long\0"
+    "long-arrow-right\0"
+    "arrow-right-to-bracket\0"
+    "sign-in\0"
+    "arrow-right-to-city\0"
+    "arrow-rotate-left\0"
+    "arrow-left-rotate\0"
+    "arrow-rotate-back\0"
+    "arrow-rotate-backward\0"
+    "undo\0"
+    "arrow-rotate-right\0"
+    "arrow-right-rotate\0"
+    "arrow-rotate-forward\0"
+    "redo\0"
+    "arrow-trend-down\0"
+    "arrow-trend-up\0"
+    "arrow-turn-down\0"
+    "level-down\0"
+    "arrow-turn-up\0"
+    "level-up\0"
+    "arrow-up\0"
+    "arrow-up-1-9\0"
+    "sort-numeric-up\0"
+    "arrow-up-9-1\0"
+    "sort-numeric-up-alt\0"
+    "arrow-up-a-z\0"
+    "sort-alpha-up\0"
+    "arrow-up-from-bracket\0"
+    "arrow-up-from-ground-water\0"
+    "arrow-up-from-water-pump\0"
+    "arrow-up-long\0"
+    "long-arrow-up\0"
+    "arrow-up-right-dots\0"
+    "arrow-up-right-from-square\0"
+    "external-link\0"
+    "arrow-up-short-wide\0"
+    "sort-amount-up-alt\0"
+    "arrow-up-wide-short\0"
+    "sort-amount-up\0"
+    "arrow-up-z-a\0"
+    "sort-alpha-up-alt\0"
+    "arrows-down-to-line\0"
+    "arrows-down-to-people\0"
+    "arrows-left-right\0"
+    "arrows-h\0"
+    "arrows-left-right-to-line\0"
+    "arrows-rotate\0"
+    "refresh\0"
+    "sync\0"
+    "arrows-spin\0"
+    "arrows-split-up-and-left\0"
+    "arrows-to-circle\0"
+    "arrows-to-dot\0"
+    "arrows-to-eye\0"
+    "arrows-turn-right\0"
+    "arrows-turn-to-dots\0"
+    "arrows-up-down\0"
+    "arrows-v\0"
+    "arrows-up-down-left-right\0"
+    "arrows\0"
+    "arrows-up-to-line\0"
+    "asterisk\0"
+    "at\0"
+    "atom\0"
+    "audio-description\0"
+    "austral-sign\0"
+    "award\0"
+    "b\0"
+    "baby\0"
+    "baby-carriage\0"
+    "carriage-baby\0"
+    "backward\0"
+    "backward-fast\0"
+    "fast-backward\0"
+    "backward-step\0"
+    "step-backward\0"
+    "bacon\0"
+    "bacteria\0"
+    "bacterium\0"
+    "bag-shopping\0"
+    "shopping-bag\0"
+    "bahai\0"
+    "haykal\0"
+    "baht-sign\0"
+    "ban\0"
+    "cancel\0"
+    "ban-smoking\0"
+    "smoking-ban\0"
+    "bandage\0"
+    "band-aid\0"
+    "bangladeshi-taka-sign\0"
+    "barcode\0"
+    "bars\0"
+    "navicon\0"
+    "bars-progress\0"
+    "tasks-alt\0"
+    "bars-staggered\0"
+    "reorder\0"
+    "stream\0"
+    "baseball\0"
+    "baseball-ball\0"
+    "baseball-bat-ball\0"
+    "basket-shopping\0"
+    "shopping-basket\0"
+    "basketball\0"
+    "basketball-ball\0"
+    "bath\0"
+    "bathtub\0"
+    "battery-empty\0"
+    "battery-0\0"
+    "battery-full\0"
+    "battery\0"
+    "battery-5\0"
+    "battery-half\0"
+    "battery-3\0"
+    "battery-quarter\0"
+    "battery-2\0"
+    "battery-three-quarters\0"
+    "battery-4\0"
+    "bed\0"
+    "bed-pulse\0"
+    "procedures\0"
+    "beer-mug-empty\0"
+    "beer\0"
+    "bell\0"
+    "bell-concierge\0"
+    "concierge-bell\0"
+    "bell-slash\0"
+    "bezier-curve\0"
+    "bicycle\0"
+    "binoculars\0"
+    "biohazard\0"
+    "bitcoin-sign\0"
+    "blender\0"
+    "blender-phone\0"
+    "blog\0"
+    "bold\0"
+    "bolt\0"
+    "zap\0"
+    "bolt-lightning\0"
+    "bomb\0"
+    "bone\0"
+    "bong\0"
+    "book\0"
+    "book-atlas\0"
+    "atlas\0"
+    "book-bible\0"
+    "bible\0"
+    "book-bookmark\0"
+    "book-journal-whills\0"
+    "journal-whills\0"
+    "book-medical\0"
+    "book-open\0"
+    "book-open-reader\0"
+    "book-reader\0"
+    "book-quran\0"
+    "quran\0"
+    "book-skull\0"
+    "book-dead\0"
+    "book-tanakh\0"
+    "tanakh\0"
+    "bookmark\0"
+    "border-all\0"
+    "border-none\0"
+    "border-top-left\0"
+    "border-style\0"
+    "bore-hole\0"
+    "bottle-droplet\0"
+    "bottle-water\0"
+    "bowl-food\0"
+    "bowl-rice\0"
+    "bowling-ball\0"
+    "box\0"
+    "box-archive\0"
+    "archive\0"
+    "box-open\0"
+    "box-tissue\0"
+    "boxes-packing\0"
+    "boxes-stacked\0"
+    "boxes\0"
+    "boxes-alt\0"
+    "braille\0"
+    "brain\0"
+    "brazilian-real-sign\0"
+    "bread-slice\0"
+    "bridge\0"
+    "bridge-circle-check\0"
+    "bridge-circle-exclamation\0"
+    "bridge-circle-xmark\0"
+    "bridge-lock\0"
+    "bridge-water\0"
+    "briefcase\0"
+    "briefcase-medical\0"
+    "broom\0"
+    "broom-ball\0"
+    "quidditch\0"
+    "quidditch-broom-ball\0"
+    "brush\0"
+    "bucket\0"
+    "bug\0"
+    "bug-slash\0"
+    "bugs\0"
+    "building\0"
+    "building-circle-arrow-right\0"
+    "building-circle-check\0"
+    "building-circle-exclamation\0"
+    "building-circle-xmark\0"
+    "building-columns\0"
+    "bank\0"
+    "institution\0"
+    "museum\0"
+    "university\0"
+    "building-flag\0"
+    "building-lock\0"
+    "building-ngo\0"
+    "building-shield\0"
+    "building-un\0"
+    "building-user\0"
+    "building-wheat\0"
+    "bullhorn\0"
+    "bullseye\0"
+    "burger\0"
+    "hamburger\0"
+    "burst\0"
+    "bus\0"
+    "bus-simple\0"
+    "bus-alt\0"
+    "business-time\0"
+    "briefcase-clock\0"
+    "c\0"
+    "cable-car\0"
+    "tram\0"
+    "cake-candles\0"
+    "birthday-cake\0"
+    "cake\0"
+    "calculator\0"
+    "calendar\0"
+    "calendar-check\0"
+    "calendar-day\0"
+    "calendar-days\0"
+    "calendar-alt\0"
+    "calendar-minus\0"
+    "calendar-plus\0"
+    "calendar-week\0"
+    "calendar-xmark\0"
+    "calendar-times\0"
+    "camera\0"
+    "camera-alt\0"
+    "camera-retro\0"
+    "camera-rotate\0"
+    "campground\0"
+    "candy-cane\0"
+    "cannabis\0"
+    "capsules\0"
+    "car\0"
+    "automobile\0"
+    "car-battery\0"
+    "battery-car\0"
+    "car-burst\0"
+    "car-crash\0"
+    "car-on\0"
+    "car-rear\0"
+    "car-alt\0"
+    "car-side\0"
+    "car-tunnel\0"
+    "caravan\0"
+    "caret-down\0"
+    "caret-left\0"
+    "caret-right\0"
+    "caret-up\0"
+    "carrot\0"
+    "cart-arrow-down\0"
+    "cart-flatbed\0"
+    "dolly-flatbed\0"
+    "cart-flatbed-suitcase\0"
+    "luggage-cart\0"
+    "cart-plus\0"
+    "cart-shopping\0"
+    "shopping-cart\0"
+    "cash-register\0"
+    "cat\0"
+    "cedi-sign\0"
+    "cent-sign\0"
+    "certificate\0"
+    "chair\0"
+    "chalkboard\0"
+    "blackboard\0"
+    "chalkboard-user\0"
+    "chalkboard-teacher\0"
+    "champagne-glasses\0"
+    "glass-cheers\0"
+    "charging-station\0"
+    "chart-area\0"
+    "area-chart\0"
+    "chart-bar\0"
+    "bar-chart\0"
+    "chart-column\0"
+    "chart-diagram\0"
+    "chart-gantt\0"
+    "chart-line\0"
+    "line-chart\0"
+    "chart-pie\0"
+    "pie-chart\0"
+    "chart-simple\0"
+    "check\0"
+    "check-double\0"
+    "check-to-slot\0"
+    "vote-yea\0"
+    "cheese\0"
+    "chess\0"
+    "chess-bishop\0"
+    "chess-board\0"
+    "chess-king\0"
+    "chess-knight\0"
+    "chess-pawn\0"
+    "chess-queen\0"
+    "chess-rook\0"
+    "chevron-down\0"
+    "chevron-left\0"
+    "chevron-right\0"
+    "chevron-up\0"
+    "child\0"
+    "child-combatant\0"
+    "child-rifle\0"
+    "child-dress\0"
+    "child-reaching\0"
+    "children\0"
+    "church\0"
+    "circle\0"
+    "circle-arrow-down\0"
+    "arrow-circle-down\0"
+    "circle-arrow-left\0"
+    "arrow-circle-left\0"
+    "circle-arrow-right\0"
+    "arrow-circle-right\0"
+    "circle-arrow-up\0"
+    "arrow-circle-up\0"
+    "circle-check\0"
+    "check-circle\0"
+    "circle-chevron-down\0"
+    "chevron-circle-down\0"
+    "circle-chevron-left\0"
+    "chevron-circle-left\0"
+    "circle-chevron-right\0"
+    "chevron-circle-right\0"
+    "circle-chevron-up\0"
+    "chevron-circle-up\0"
+    "circle-dollar-to-slot\0"
+    "donate\0"
+    "circle-dot\0"
+    "dot-circle\0"
+    "circle-down\0"
+    "arrow-alt-circle-down\0"
+    "circle-exclamation\0"
+    "exclamation-circle\0"
+    "circle-h\0"
+    "hospital-symbol\0"
+    "circle-half-stroke\0"
+    "adjust\0"
+    "circle-info\0"
+    "info-circle\0"
+    "circle-left\0"
+    "arrow-alt-circle-left\0"
+    "circle-minus\0"
+    "minus-circle\0"
+    "circle-nodes\0"
+    "circle-notch\0"
+    "circle-pause\0"
+    "pause-circle\0"
+    "circle-play\0"
+    "play-circle\0"
+    "circle-plus\0"
+    "plus-circle\0"
+    "circle-question\0"
+    "question-circle\0"
+    "circle-radiation\0"
+    "radiation-alt\0"
+    "circle-right\0"
+    "arrow-alt-circle-right\0"
+    "circle-stop\0"
+    "stop-circle\0"
+    "circle-up\0"
+    "arrow-alt-circle-up\0"
+    "circle-user\0"
+    "user-circle\0"
+    "circle-xmark\0"
+    "times-circle\0"
+    "xmark-circle\0"
+    "city\0"
+    "clapperboard\0"
+    "clipboard\0"
+    "clipboard-check\0"
+    "clipboard-list\0"
+    "clipboard-question\0"
+    "clipboard-user\0"
+    "clock\0"
+    "clock-four\0"
+    "clock-rotate-left\0"
+    "history\0"
+    "clone\0"
+    "closed-captioning\0"
+    "cloud\0"
+    "cloud-arrow-down\0"
+    "cloud-download\0"
+    "cloud-download-alt\0"
+    "cloud-arrow-up\0"
+    "cloud-upload\0"
+    "cloud-upload-alt\0"
+    "cloud-bolt\0"
+    "thunderstorm\0"
+    "cloud-meatball\0"
+    "cloud-moon\0"
+    "cloud-moon-rain\0"
+    "cloud-rain\0"
+    "cloud-showers-heavy\0"
+    "cloud-showers-water\0"
+    "cloud-sun\0"
+    "cloud-sun-rain\0"
+    "clover\0"
+    "code\0"
+    "code-branch\0"
+    "code-commit\0"
+    "code-compare\0"
+    "code-fork\0"
+    "code-merge\0"
+    "code-pull-request\0"
+    "coins\0"
+    "colon-sign\0"
+    "comment\0"
+    "comment-dollar\0"
+    "comment-dots\0"
+    "commenting\0"
+    "comment-medical\0"
+    "comment-nodes\0"
+    "comment-slash\0"
+    "comment-sms\0"
+    "sms\0"
+    "comments\0"
+    "comments-dollar\0"
+    "compact-disc\0"
+    "compass\0"
+    "compass-drafting\0"
+    "drafting-compass\0"
+    "compress\0"
+    "computer\0"
+    "computer-mouse\0"
+    "mouse\0"
+    "cookie\0"
+    "cookie-bite\0"
+    "copy\0"
+    "copyright\0"
+    "couch\0"
+    "cow\0"
+    "credit-card\0"
+    "credit-card-alt\0"
+    "crop\0"
+    "crop-simple\0"
+    "crop-alt\0"
+    "cross\0"
+    "crosshairs\0"
+    "crow\0"
+    "crown\0"
+    "crutch\0"
+    "cruzeiro-sign\0"
+    "cube\0"
+    "cubes\0"
+    "cubes-stacked\0"
+    "d\0"
+    "database\0"
+    "delete-left\0"
+    "backspace\0"
+    "democrat\0"
+    "desktop\0"
+    "desktop-alt\0"
+    "dharmachakra\0"
+    "diagram-next\0"
+    "diagram-predecessor\0"
+    "diagram-project\0"
+    "project-diagram\0"
+    "diagram-successor\0"
+    "diamond\0"
+    "diamond-turn-right\0"
+    "directions\0"
+    "dice\0"
+    "dice-d20\0"
+    "dice-d6\0"
+    "dice-five\0"
+    "dice-four\0"
+    "dice-one\0"
+    "dice-six\0"
+    "dice-three\0"
+    "dice-two\0"
+    "disease\0"
+    "display\0"
+    "divide\0"
+    "dna\0"
+    "dog\0"
+    "dollar-sign\0"
+    "dollar\0"
+    "usd\0"
+    "dolly\0"
+    "dolly-box\0"
+    "dong-sign\0"
+    "door-closed\0"
+    "door-open\0"
+    "dove\0"
+    "down-left-and-up-right-to-center\0"
+    "compress-alt\0"
+    "down-long\0"
+    "long-arrow-alt-down\0"
+    "download\0"
+    "dragon\0"
+    "draw-polygon\0"
+    "droplet\0"
+    "tint\0"
+    "droplet-slash\0"
+    "tint-slash\0"
+    "drum\0"
+    "drum-steelpan\0"
+    "drumstick-bite\0"
+    "dumbbell\0"
+    "dumpster\0"
+    "dumpster-fire\0"
+    "dungeon\0"
+    "e\0"
+    "ear-deaf\0"
+    "deaf\0"
+    "deafness\0"
+    "hard-of-hearing\0"
+    "ear-listen\0"
+    "assistive-listening-systems\0"
+    "earth-africa\0"
+    "globe-africa\0"
+    "earth-americas\0"
+    "earth\0"
+    "earth-america\0"
+    "globe-americas\0"
+    "earth-asia\0"
+    "globe-asia\0"
+    "earth-europe\0"
+    "globe-europe\0"
+    "earth-oceania\0"
+    "globe-oceania\0"
+    "egg\0"
+    "eject\0"
+    "elevator\0"
+    "ellipsis\0"
+    "ellipsis-h\0"
+    "ellipsis-vertical\0"
+    "ellipsis-v\0"
+    "envelope\0"
+    "envelope-circle-check\0"
+    "envelope-open\0"
+    "envelope-open-text\0"
+    "envelopes-bulk\0"
+    "mail-bulk\0"
+    "equals\0"
+    "eraser\0"
+    "ethernet\0"
+    "euro-sign\0"
+    "eur\0"
+    "euro\0"
+    "exclamation\0"
+    "expand\0"
+    "explosion\0"
+    "eye\0"
+    "eye-dropper\0"
+    "eye-dropper-empty\0"
+    "eyedropper\0"
+    "eye-low-vision\0"
+    "low-vision\0"
+    "eye-slash\0"
+    "f\0"
+    "face-angry\0"
+    "angry\0"
+    "face-dizzy\0"
+    "dizzy\0"
+    "face-flushed\0"
+    "flushed\0"
+    "face-frown\0"
+    "frown\0"
+    "face-frown-open\0"
+    "frown-open\0"
+    "face-grimace\0"
+    "grimace\0"
+    "face-grin\0"
+    "grin\0"
+    "face-grin-beam\0"
+    "grin-beam\0"
+    "face-grin-beam-sweat\0"
+    "grin-beam-sweat\0"
+    "face-grin-hearts\0"
+    "grin-hearts\0"
+    "face-grin-squint\0"
+    "grin-squint\0"
+    "face-grin-squint-tears\0"
+    "grin-squint-tears\0"
+    "face-grin-stars\0"
+    "grin-stars\0"
+    "face-grin-tears\0"
+    "grin-tears\0"
+    "face-grin-tongue\0"
+    "grin-tongue\0"
+    "face-grin-tongue-squint\0"
+    "grin-tongue-squint\0"
+    "face-grin-tongue-wink\0"
+    "grin-tongue-wink\0"
+    "face-grin-wide\0"
+    "grin-alt\0"
+    "face-grin-wink\0"
+    "grin-wink\0"
+    "face-kiss\0"
+    "kiss\0"
+    "face-kiss-beam\0"
+    "kiss-beam\0"
+    "face-kiss-wink-heart\0"
+    "kiss-wink-heart\0"
+    "face-laugh\0"
+    "laugh\0"
+    "face-laugh-beam\0"
+    "laugh-beam\0"
+    "face-laugh-squint\0"
+    "laugh-squint\0"
+    "face-laugh-wink\0"
+    "laugh-wink\0"
+    "face-meh\0"
+    "meh\0"
+    "face-meh-blank\0"
+    "meh-blank\0"
+    "face-rolling-eyes\0"
+    "meh-rolling-eyes\0"
+    "face-sad-cry\0"
+    "sad-cry\0"
+    "face-sad-tear\0"
+    "sad-tear\0"
+    "face-smile\0"
+    "smile\0"
+    "face-smile-beam\0"
+    "smile-beam\0"
+    "face-smile-wink\0"
+    "smile-wink\0"
+    "face-surprise\0"
+    "surprise\0"
+    "face-tired\0"
+    "tired\0"
+    "fan\0"
+    "faucet\0"
+    "faucet-drip\0"
+    "fax\0"
+    "feather\0"
+    "feather-pointed\0"
+    "feather-alt\0"
+    "ferry\0"
+    "file\0"
+    "file-arrow-down\0"
+    "file-download\0"
+    "file-arrow-up\0"
+    "file-upload\0"
+    "file-audio\0"
+    "file-circle-check\0"
+    "file-circle-exclamation\0"
+    "file-circle-minus\0"
+    "file-circle-plus\0"
+    "file-circle-question\0"
+    "file-circle-xmark\0"
+    "file-code\0"
+    "file-contract\0"
+    "file-csv\0"
+    "file-excel\0"
+    "file-export\0"
+    "arrow-right-from-file\0"
+    "file-fragment\0"
+    "file-half-dashed\0"
+    "file-image\0"
+    "file-import\0"
+    "arrow-right-to-file\0"
+    "file-invoice\0"
+    "file-invoice-dollar\0"
+    "file-lines\0"
+    "file-alt\0"
+    "file-text\0"
+    "file-medical\0"
+    "file-pdf\0"
+    "file-pen\0"
+    "file-edit\0"
+    "file-powerpoint\0"
+    "file-prescription\0"
+    "file-shield\0"
+    "file-signature\0"
+    "file-video\0"
+    "file-waveform\0"
+    "file-medical-alt\0"
+    "file-word\0"
+    "file-zipper\0"
+    "file-archive\0"
+    "fill\0"
+    "fill-drip\0"
+    "film\0"
+    "filter\0"
+    "filter-circle-dollar\0"
+    "funnel-dollar\0"
+    "filter-circle-xmark\0"
+    "fingerprint\0"
+    "fire\0"
+    "fire-burner\0"
+    "fire-extinguisher\0"
+    "fire-flame-curved\0"
+    "fire-alt\0"
+    "fire-flame-simple\0"
+    "burn\0"
+    "fish\0"
+    "fish-fins\0"
+    "flag\0"
+    "flag-checkered\0"
+    "flag-usa\0"
+    "flask\0"
+    "flask-vial\0"
+    "floppy-disk\0"
+    "save\0"
+    "florin-sign\0"
+    "folder\0"
+    "folder-blank\0"
+    "folder-closed\0"
+    "folder-minus\0"
+    "folder-open\0"
+    "folder-plus\0"
+    "folder-tree\0"
+    "font\0"
+    "football\0"
+    "football-ball\0"
+    "forward\0"
+    "forward-fast\0"
+    "fast-forward\0"
+    "forward-step\0"
+    "step-forward\0"
+    "franc-sign\0"
+    "frog\0"
+    "futbol\0"
+    "futbol-ball\0"
+    "soccer-ball\0"
+    "g\0"
+    "gamepad\0"
+    "gas-pump\0"
+    "gauge\0"
+    "dashboard\0"
+    "gauge-med\0"
+    "tachometer-alt-average\0"
+    "gauge-high\0"
+    "tachometer-alt\0"
+    "tachometer-alt-fast\0"
+    "gauge-simple\0"
+    "gauge-simple-med\0"
+    "tachometer-average\0"
+    "gauge-simple-high\0"
+    "tachometer\0"
+    "tachometer-fast\0"
+    "gavel\0"
+    "legal\0"
+    "gear\0"
+    "cog\0"
+    "gears\0"
+    "cogs\0"
+    "gem\0"
+    "genderless\0"
+    "ghost\0"
+    "gift\0"
+    "gifts\0"
+    "glass-water\0"
+    "glass-water-droplet\0"
+    "glasses\0"
+    "globe\0"
+    "golf-ball-tee\0"
+    "golf-ball\0"
+    "gopuram\0"
+    "graduation-cap\0"
+    "mortar-board\0"
+    "greater-than\0"
+    "greater-than-equal\0"
+    "grip\0"
+    "grip-horizontal\0"
+    "grip-lines\0"
+    "grip-lines-vertical\0"
+    "grip-vertical\0"
+    "group-arrows-rotate\0"
+    "guarani-sign\0"
+    "guitar\0"
+    "gun\0"
+    "h\0"
+    "hammer\0"
+    "hamsa\0"
+    "hand\0"
+    "hand-paper\0"
+    "hand-back-fist\0"
+    "hand-rock\0"
+    "hand-dots\0"
+    "allergies\0"
+    "hand-fist\0"
+    "fist-raised\0"
+    "hand-holding\0"
+    "hand-holding-dollar\0"
+    "hand-holding-usd\0"
+    "hand-holding-droplet\0"
+    "hand-holding-water\0"
+    "hand-holding-hand\0"
+    "hand-holding-heart\0"
+    "hand-holding-medical\0"
+    "hand-lizard\0"
+    "hand-middle-finger\0"
+    "hand-peace\0"
+    "hand-point-down\0"
+    "hand-point-left\0"
+    "hand-point-right\0"
+    "hand-point-up\0"
+    "hand-pointer\0"
+    "hand-scissors\0"
+    "hand-sparkles\0"
+    "hand-spock\0"
+    "handcuffs\0"
+    "hands\0"
+    "sign-language\0"
+    "signing\0"
+    "hands-asl-interpreting\0"
+    "american-sign-language-interpreting\0"
+    "asl-interpreting\0"
+    "hands-american-sign-language-interpreting\0"
+    "hands-bound\0"
+    "hands-bubbles\0"
+    "hands-wash\0"
+    "hands-clapping\0"
+    "hands-holding\0"
+    "hands-holding-child\0"
+    "hands-holding-circle\0"
+    "hands-praying\0"
+    "praying-hands\0"
+    "handshake\0"
+    "handshake-angle\0"
+    "hands-helping\0"
+    "handshake-simple\0"
+    "handshake-alt\0"
+    "handshake-simple-slash\0"
+    "handshake-alt-slash\0"
+    "handshake-slash\0"
+    "hanukiah\0"
+    "hard-drive\0"
+    "hdd\0"
+    "hashtag\0"
+    "hat-cowboy\0"
+    "hat-cowboy-side\0"
+    "hat-wizard\0"
+    "head-side-cough\0"
+    "head-side-cough-slash\0"
+    "head-side-mask\0"
+    "head-side-virus\0"
+    "heading\0"
+    "header\0"
+    "headphones\0"
+    "headphones-simple\0"
+    "headphones-alt\0"
+    "headset\0"
+    "heart\0"
+    "heart-circle-bolt\0"
+    "heart-circle-check\0"
+    "heart-circle-exclamation\0"
+    "heart-circle-minus\0"
+    "heart-circle-plus\0"
+    "heart-circle-xmark\0"
+    "heart-crack\0"
+    "heart-broken\0"
+    "heart-pulse\0"
+    "heartbeat\0"
+    "helicopter\0"
+    "helicopter-symbol\0"
+    "helmet-safety\0"
+    "hard-hat\0"
+    "hat-hard\0"
+    "helmet-un\0"
+    "hexagon-nodes\0"
+    "hexagon-nodes-bolt\0"
+    "highlighter\0"
+    "hill-avalanche\0"
+    "hill-rockslide\0"
+    "hippo\0"
+    "hockey-puck\0"
+    "holly-berry\0"
+    "horse\0"
+    "horse-head\0"
+    "hospital\0"
+    "hospital-alt\0"
+    "hospital-wide\0"
+    "hospital-user\0"
+    "hot-tub-person\0"
+    "hot-tub\0"
+    "hotdog\0"
+    "hotel\0"
+    "hourglass\0"
+    "hourglass-empty\0"
+    "hourglass-end\0"
+    "hourglass-3\0"
+    "hourglass-half\0"
+    "hourglass-2\0"
+    "hourglass-start\0"
+    "hourglass-1\0"
+    "house\0"
+    "home\0"
+    "home-alt\0"
+    "home-lg-alt\0"
+    "house-chimney\0"
+    "home-lg\0"
+    "house-chimney-crack\0"
+    "house-damage\0"
+    "house-chimney-medical\0"
+    "clinic-medical\0"
+    "house-chimney-user\0"
+    "house-chimney-window\0"
+    "house-circle-check\0"
+    "house-circle-exclamation\0"
+    "house-circle-xmark\0"
+    "house-crack\0"
+    "house-fire\0"
+    "house-flag\0"
+    "house-flood-water\0"
+    "house-flood-water-circle-arrow-right\0"
+    "house-laptop\0"
+    "laptop-house\0"
+    "house-lock\0"
+    "house-medical\0"
+    "house-medical-circle-check\0"
+    "house-medical-circle-exclamation\0"
+    "house-medical-circle-xmark\0"
+    "house-medical-flag\0"
+    "house-signal\0"
+    "house-tsunami\0"
+    "house-user\0"
+    "home-user\0"
+    "hryvnia-sign\0"
+    "hryvnia\0"
+    "hurricane\0"
+    "i\0"
+    "i-cursor\0"
+    "ice-cream\0"
+    "icicles\0"
+    "icons\0"
+    "heart-music-camera-bolt\0"
+    "id-badge\0"
+    "id-card\0"
+    "drivers-license\0"
+    "id-card-clip\0"
+    "id-card-alt\0"
+    "igloo\0"
+    "image\0"
+    "image-portrait\0"
+    "portrait\0"
+    "images\0"
+    "inbox\0"
+    "indent\0"
+    "indian-rupee-sign\0"
+    "indian-rupee\0"
+    "inr\0"
+    "industry\0"
+    "infinity\0"
+    "info\0"
+    "italic\0"
+    "j\0"
+    "jar\0"
+    "jar-wheat\0"
+    "jedi\0"
+    "jet-fighter\0"
+    "fighter-jet\0"
+    "jet-fighter-up\0"
+    "joint\0"
+    "jug-detergent\0"
+    "k\0"
+    "kaaba\0"
+    "key\0"
+    "keyboard\0"
+    "khanda\0"
+    "kip-sign\0"
+    "kit-medical\0"
+    "first-aid\0"
+    "kitchen-set\0"
+    "kiwi-bird\0"
+    "l\0"
+    "land-mine-on\0"
+    "landmark\0"
+    "landmark-dome\0"
+    "landmark-alt\0"
+    "landmark-flag\0"
+    "language\0"
+    "laptop\0"
+    "laptop-code\0"
+    "laptop-file\0"
+    "laptop-medical\0"
+    "lari-sign\0"
+    "layer-group\0"
+    "leaf\0"
+    "left-long\0"
+    "long-arrow-alt-left\0"
+    "left-right\0"
+    "arrows-alt-h\0"
+    "lemon\0"
+    "less-than\0"
+    "less-than-equal\0"
+    "life-ring\0"
+    "lightbulb\0"
+    "lines-leaning\0"
+    "link\0"
+    "chain\0"
+    "link-slash\0"
+    "chain-broken\0"
+    "chain-slash\0"
+    "unlink\0"
+    "lira-sign\0"
+    "list\0"
+    "list-squares\0"
+    "list-check\0"
+    "tasks\0"
+    "list-ol\0"
+    "list-1-2\0"
+    "list-numeric\0"
+    "list-ul\0"
+    "list-dots\0"
+    "litecoin-sign\0"
+    "location-arrow\0"
+    "location-crosshairs\0"
+    "location\0"
+    "location-dot\0"
+    "map-marker-alt\0"
+    "location-pin\0"
+    "map-marker\0"
+    "location-pin-lock\0"
+    "lock\0"
+    "lock-open\0"
+    "locust\0"
+    "lungs\0"
+    "lungs-virus\0"
+    "m\0"
+    "magnet\0"
+    "magnifying-glass\0"
+    "search\0"
+    "magnifying-glass-arrow-right\0"
+    "magnifying-glass-chart\0"
+    "magnifying-glass-dollar\0"
+    "search-dollar\0"
+    "magnifying-glass-location\0"
+    "search-location\0"
+    "magnifying-glass-minus\0"
+    "search-minus\0"
+    "magnifying-glass-plus\0"
+    "search-plus\0"
+    "manat-sign\0"
+    "map\0"
+    "map-location\0"
+    "map-marked\0"
+    "map-location-dot\0"
+    "map-marked-alt\0"
+    "map-pin\0"
+    "marker\0"
+    "mars\0"
+    "mars-and-venus\0"
+    "mars-and-venus-burst\0"
+    "mars-double\0"
+    "mars-stroke\0"
+    "mars-stroke-right\0"
+    "mars-stroke-h\0"
+    "mars-stroke-up\0"
+    "mars-stroke-v\0"
+    "martini-glass\0"
+    "glass-martini-alt\0"
+    "martini-glass-citrus\0"
+    "cocktail\0"
+    "martini-glass-empty\0"
+    "glass-martini\0"
+    "mask\0"
+    "mask-face\0"
+    "mask-ventilator\0"
+    "masks-theater\0"
+    "theater-masks\0"
+    "mattress-pillow\0"
+    "maximize\0"
+    "expand-arrows-alt\0"
+    "medal\0"
+    "memory\0"
+    "menorah\0"
+    "mercury\0"
+    "message\0"
+    "comment-alt\0"
+    "meteor\0"
+    "microchip\0"
+    "microphone\0"
+    "microphone-lines\0"
+    "microphone-alt\0"
+    "microphone-lines-slash\0"
+    "microphone-alt-slash\0"
+    "microphone-slash\0"
+    "microscope\0"
+    "mill-sign\0"
+    "minimize\0"
+    "compress-arrows-alt\0"
+    "minus\0"
+    "subtract\0"
+    "mitten\0"
+    "mobile\0"
+    "mobile-android\0"
+    "mobile-phone\0"
+    "mobile-button\0"
+    "mobile-retro\0"
+    "mobile-screen\0"
+    "mobile-android-alt\0"
+    "mobile-screen-button\0"
+    "mobile-alt\0"
+    "money-bill\0"
+    "money-bill-1\0"
+    "money-bill-alt\0"
+    "money-bill-1-wave\0"
+    "money-bill-wave-alt\0"
+    "money-bill-transfer\0"
+    "money-bill-trend-up\0"
+    "money-bill-wave\0"
+    "money-bill-wheat\0"
+    "money-bills\0"
+    "money-check\0"
+    "money-check-dollar\0"
+    "money-check-alt\0"
+    "monument\0"
+    "moon\0"
+    "mortar-pestle\0"
+    "mosque\0"
+    "mosquito\0"
+    "mosquito-net\0"
+    "motorcycle\0"
+    "mound\0"
+    "mountain\0"
+    "mountain-city\0"
+    "mountain-sun\0"
+    "mug-hot\0"
+    "mug-saucer\0"
+    "coffee\0"
+    "music\0"
+    "n\0"
+    "naira-sign\0"
+    "network-wired\0"
+    "neuter\0"
+    "newspaper\0"
+    "not-equal\0"
+    "notdef\0"
+    "note-sticky\0"
+    "sticky-note\0"
+    "notes-medical\0"
+    "o\0"
+    "object-group\0"
+    "object-ungroup\0"
+    "oil-can\0"
+    "oil-well\0"
+    "om\0"
+    "otter\0"
+    "outdent\0"
+    "dedent\0"
+    "p\0"
+    "pager\0"
+    "paint-roller\0"
+    "paintbrush\0"
+    "paint-brush\0"
+    "palette\0"
+    "pallet\0"
+    "panorama\0"
+    "paper-plane\0"
+    "paperclip\0"
+    "parachute-box\0"
+    "paragraph\0"
+    "passport\0"
+    "paste\0"
+    "file-clipboard\0"
+    "pause\0"
+    "paw\0"
+    "peace\0"
+    "pen\0"
+    "pen-clip\0"
+    "pen-alt\0"
+    "pen-fancy\0"
+    "pen-nib\0"
+    "pen-ruler\0"
+    "pencil-ruler\0"
+    "pen-to-square\0"
+    "edit\0"
+    "pencil\0"
+    "pencil-alt\0"
+    "people-arrows\0"
+    "people-arrows-left-right\0"
+    "people-carry-box\0"
+    "people-carry\0"
+    "people-group\0"
+    "people-line\0"
+    "people-pulling\0"
+    "people-robbery\0"
+    "people-roof\0"
+    "pepper-hot\0"
+    "percent\0"
+    "percentage\0"
+    "person\0"
+    "male\0"
+    "person-arrow-down-to-line\0"
+    "person-arrow-up-from-line\0"
+    "person-biking\0"
+    "biking\0"
+    "person-booth\0"
+    "person-breastfeeding\0"
+    "person-burst\0"
+    "person-cane\0"
+    "person-chalkboard\0"
+    "person-circle-check\0"
+    "person-circle-exclamation\0"
+    "person-circle-minus\0"
+    "person-circle-plus\0"
+    "person-circle-question\0"
+    "person-circle-xmark\0"
+    "person-digging\0"
+    "digging\0"
+    "person-dots-from-line\0"
+    "diagnoses\0"
+    "person-dress\0"
+    "female\0"
+    "person-dress-burst\0"
+    "person-drowning\0"
+    "person-falling\0"
+    "person-falling-burst\0"
+    "person-half-dress\0"
+    "person-harassing\0"
+    "person-hiking\0"
+    "hiking\0"
+    "person-military-pointing\0"
+    "person-military-rifle\0"
+    "person-military-to-person\0"
+    "person-praying\0"
+    "pray\0"
+    "person-pregnant\0"
+    "person-rays\0"
+    "person-rifle\0"
+    "person-running\0"
+    "running\0"
+    "person-shelter\0"
+    "person-skating\0"
+    "skating\0"
+    "person-skiing\0"
+    "skiing\0"
+    "person-skiing-nordic\0"
+    "skiing-nordic\0"
+    "person-snowboarding\0"
+    "snowboarding\0"
+    "person-swimming\0"
+    "swimmer\0"
+    "person-through-window\0"
+    "person-walking\0"
+    "walking\0"
+    "person-walking-arrow-loop-left\0"
+    "person-walking-arrow-right\0"
+    "person-walking-dashed-line-arrow-right\0"
+    "person-walking-luggage\0"
+    "person-walking-with-cane\0"
+    "blind\0"
+    "peseta-sign\0"
+    "peso-sign\0"
+    "phone\0"
+    "phone-flip\0"
+    "phone-alt\0"
+    "phone-slash\0"
+    "phone-volume\0"
+    "volume-control-phone\0"
+    "photo-film\0"
+    "photo-video\0"
+    "piggy-bank\0"
+    "pills\0"
+    "pizza-slice\0"
+    "place-of-worship\0"
+    "plane\0"
+    "plane-arrival\0"
+    "plane-circle-check\0"
+    "plane-circle-exclamation\0"
+    "plane-circle-xmark\0"
+    "plane-departure\0"
+    "plane-lock\0"
+    "plane-slash\0"
+    "plane-up\0"
+    "plant-wilt\0"
+    "plate-wheat\0"
+    "play\0"
+    "plug\0"
+    "plug-circle-bolt\0"
+    "plug-circle-check\0"
+    "plug-circle-exclamation\0"
+    "plug-circle-minus\0"
+    "plug-circle-plus\0"
+    "plug-circle-xmark\0"
+    "plus\0"
+    "add\0"
+    "plus-minus\0"
+    "podcast\0"
+    "poo\0"
+    "poo-storm\0"
+    "poo-bolt\0"
+    "poop\0"
+    "power-off\0"
+    "prescription\0"
+    "prescription-bottle\0"
+    "prescription-bottle-medical\0"
+    "prescription-bottle-alt\0"
+    "print\0"
+    "pump-medical\0"
+    "pump-soap\0"
+    "puzzle-piece\0"
+    "q\0"
+    "qrcode\0"
+    "question\0"
+    "quote-left\0"
+    "quote-left-alt\0"
+    "quote-right\0"
+    "quote-right-alt\0"
+    "r\0"
+    "radiation\0"
+    "radio\0"
+    "rainbow\0"
+    "ranking-star\0"
+    "receipt\0"
+    "record-vinyl\0"
+    "rectangle-ad\0"
+    "ad\0"
+    "rectangle-list\0"
+    "list-alt\0"
+    "rectangle-xmark\0"
+    "rectangle-times\0"
+    "times-rectangle\0"
+    "window-close\0"
+    "recycle\0"
+    "registered\0"
+    "repeat\0"
+    "reply\0"
+    "mail-reply\0"
+    "reply-all\0"
+    "mail-reply-all\0"
+    "republican\0"
+    "restroom\0"
+    "retweet\0"
+    "ribbon\0"
+    "right-from-bracket\0"
+    "sign-out-alt\0"
+    "right-left\0"
+    "exchange-alt\0"
+    "right-long\0"
+    "long-arrow-alt-right\0"
+    "right-to-bracket\0"
+    "sign-in-alt\0"
+    "ring\0"
+    "road\0"
+    "road-barrier\0"
+    "road-bridge\0"
+    "road-circle-check\0"
+    "road-circle-exclamation\0"
+    "road-circle-xmark\0"
+    "road-lock\0"
+    "road-spikes\0"
+    "robot\0"
+    "rocket\0"
+    "rotate\0"
+    "sync-alt\0"
+    "rotate-left\0"
+    "rotate-back\0"
+    "rotate-backward\0"
+    "undo-alt\0"
+    "rotate-right\0"
+    "redo-alt\0"
+    "rotate-forward\0"
+    "route\0"
+    "rss\0"
+    "feed\0"
+    "ruble-sign\0"
+    "rouble\0"
+    "rub\0"
+    "ruble\0"
+    "rug\0"
+    "ruler\0"
+    "ruler-combined\0"
+    "ruler-horizontal\0"
+    "ruler-vertical\0"
+    "rupee-sign\0"
+    "rupee\0"
+    "rupiah-sign\0"
+    "s\0"
+    "sack-dollar\0"
+    "sack-xmark\0"
+    "sailboat\0"
+    "satellite\0"
+    "satellite-dish\0"
+    "scale-balanced\0"
+    "balance-scale\0"
+    "scale-unbalanced\0"
+    "balance-scale-left\0"
+    "scale-unbalanced-flip\0"
+    "balance-scale-right\0"
+    "school\0"
+    "school-circle-check\0"
+    "school-circle-exclamation\0"
+    "school-circle-xmark\0"
+    "school-flag\0"
+    "school-lock\0"
+    "scissors\0"
+    "cut\0"
+    "screwdriver\0"
+    "screwdriver-wrench\0"
+    "tools\0"
+    "scroll\0"
+    "scroll-torah\0"
+    "torah\0"
+    "sd-card\0"
+    "section\0"
+    "seedling\0"
+    "sprout\0"
+    "server\0"
+    "shapes\0"
+    "triangle-circle-square\0"
+    "share\0"
+    "mail-forward\0"
+    "share-from-square\0"
+    "share-square\0"
+    "share-nodes\0"
+    "share-alt\0"
+    "sheet-plastic\0"
+    "shekel-sign\0"
+    "ils\0"
+    "shekel\0"
+    "sheqel\0"
+    "sheqel-sign\0"
+    "shield\0"
+    "shield-blank\0"
+    "shield-cat\0"
+    "shield-dog\0"
+    "shield-halved\0"
+    "shield-alt\0"
+    "shield-heart\0"
+    "shield-virus\0"
+    "ship\0"
+    "shirt\0"
+    "t-shirt\0"
+    "tshirt\0"
+    "shoe-prints\0"
+    "shop\0"
+    "store-alt\0"
+    "shop-lock\0"
+    "shop-slash\0"
+    "store-alt-slash\0"
+    "shower\0"
+    "shrimp\0"
+    "shuffle\0"
+    "random\0"
+    "shuttle-space\0"
+    "space-shuttle\0"
+    "sign-hanging\0"
+    "sign\0"
+    "signal\0"
+    "signal-5\0"
+    "signal-perfect\0"
+    "signature\0"
+    "signs-post\0"
+    "map-signs\0"
+    "sim-card\0"
+    "sink\0"
+    "sitemap\0"
+    "skull\0"
+    "skull-crossbones\0"
+    "slash\0"
+    "sleigh\0"
+    "sliders\0"
+    "sliders-h\0"
+    "smog\0"
+    "smoking\0"
+    "snowflake\0"
+    "snowman\0"
+    "snowplow\0"
+    "soap\0"
+    "socks\0"
+    "solar-panel\0"
+    "sort\0"
+    "unsorted\0"
+    "sort-down\0"
+    "sort-desc\0"
+    "sort-up\0"
+    "sort-asc\0"
+    "spa\0"
+    "spaghetti-monster-flying\0"
+    "pastafarianism\0"
+    "spell-check\0"
+    "spider\0"
+    "spinner\0"
+    "splotch\0"
+    "spoon\0"
+    "utensil-spoon\0"
+    "spray-can\0"
+    "spray-can-sparkles\0"
+    "air-freshener\0"
+    "square\0"
+    "square-arrow-up-right\0"
+    "external-link-square\0"
+    "square-binary\0"
+    "square-caret-down\0"
+    "caret-square-down\0"
+    "square-caret-left\0"
+    "caret-square-left\0"
+    "square-caret-right\0"
+    "caret-square-right\0"
+    "square-caret-up\0"
+    "caret-square-up\0"
+    "square-check\0"
+    "check-square\0"
+    "square-envelope\0"
+    "envelope-square\0"
+    "square-full\0"
+    "square-h\0"
+    "h-square\0"
+    "square-minus\0"
+    "minus-square\0"
+    "square-nfi\0"
+    "square-parking\0"
+    "parking\0"
+    "square-pen\0"
+    "pen-square\0"
+    "pencil-square\0"
+    "square-person-confined\0"
+    "square-phone\0"
+    "phone-square\0"
+    "square-phone-flip\0"
+    "phone-square-alt\0"
+    "square-plus\0"
+    "plus-square\0"
+    "square-poll-horizontal\0"
+    "poll-h\0"
+    "square-poll-vertical\0"
+    "poll\0"
+    "square-root-variable\0"
+    "square-root-alt\0"
+    "square-rss\0"
+    "rss-square\0"
+    "square-share-nodes\0"
+    "share-alt-square\0"
+    "square-up-right\0"
+    "external-link-square-alt\0"
+    "square-virus\0"
+    "square-xmark\0"
+    "times-square\0"
+    "xmark-square\0"
+    "staff-snake\0"
+    "rod-asclepius\0"
+    "rod-snake\0"
+    "staff-aesculapius\0"
+    "stairs\0"
+    "stamp\0"
+    "stapler\0"
+    "star\0"
+    "star-and-crescent\0"
+    "star-half\0"
+    "star-half-stroke\0"
+    "star-half-alt\0"
+    "star-of-david\0"
+    "star-of-life\0"
+    "sterling-sign\0"
+    "gbp\0"
+    "pound-sign\0"
+    "stethoscope\0"
+    "stop\0"
+    "stopwatch\0"
+    "stopwatch-20\0"
+    "store\0"
+    "store-slash\0"
+    "street-view\0"
+    "strikethrough\0"
+    "stroopwafel\0"
+    "subscript\0"
+    "suitcase\0"
+    "suitcase-medical\0"
+    "medkit\0"
+    "suitcase-rolling\0"
+    "sun\0"
+    "sun-plant-wilt\0"
+    "superscript\0"
+    "swatchbook\0"
+    "synagogue\0"
+    "syringe\0"
+    "t\0"
+    "table\0"
+    "table-cells\0"
+    "th\0"
+    "table-cells-column-lock\0"
+    "table-cells-large\0"
+    "th-large\0"
+    "table-cells-row-lock\0"
+    "table-cells-row-unlock\0"
+    "table-columns\0"
+    "columns\0"
+    "table-list\0"
+    "th-list\0"
+    "table-tennis-paddle-ball\0"
+    "ping-pong-paddle-ball\0"
+    "table-tennis\0"
+    "tablet\0"
+    "tablet-android\0"
+    "tablet-button\0"
+    "tablet-screen-button\0"
+    "tablet-alt\0"
+    "tablets\0"
+    "tachograph-digital\0"
+    "digital-tachograph\0"
+    "tag\0"
+    "tags\0"
+    "tape\0"
+    "tarp\0"
+    "tarp-droplet\0"
+    "taxi\0"
+    "cab\0"
+    "teeth\0"
+    "teeth-open\0"
+    "temperature-arrow-down\0"
+    "temperature-down\0"
+    "temperature-arrow-up\0"
+    "temperature-up\0"
+    "temperature-empty\0"
+    "temperature-0\0"
+    "thermometer-0\0"
+    "thermometer-empty\0"
+    "temperature-full\0"
+    "temperature-4\0"
+    "thermometer-4\0"
+    "thermometer-full\0"
+    "temperature-half\0"
+    "temperature-2\0"
+    "thermometer-2\0"
+    "thermometer-half\0"
+    "temperature-high\0"
+    "temperature-low\0"
+    "temperature-quarter\0"
+    "temperature-1\0"
+    "thermometer-1\0"
+    "thermometer-quarter\0"
+    "temperature-three-quarters\0"
+    "temperature-3\0"
+    "thermometer-3\0"
+    "thermometer-three-quarters\0"
+    "tenge-sign\0"
+    "tenge\0"
+    "tent\0"
+    "tent-arrow-down-to-line\0"
+    "tent-arrow-left-right\0"
+    "tent-arrow-turn-left\0"
+    "tent-arrows-down\0"
+    "tents\0"
+    "terminal\0"
+    "text-height\0"
+    "text-slash\0"
+    "remove-format\0"
+    "text-width\0"
+    "thermometer\0"
+    "thumbs-down\0"
+    "thumbs-up\0"
+    "thumbtack\0"
+    "thumb-tack\0"
+    "thumbtack-slash\0"
+    "thumb-tack-slash\0"
+    "ticket\0"
+    "ticket-simple\0"
+    "ticket-alt\0"
+    "timeline\0"
+    "toggle-off\0"
+    "toggle-on\0"
+    "toilet\0"
+    "toilet-paper\0"
+    "toilet-paper-slash\0"
+    "toilet-portable\0"
+    "toilets-portable\0"
+    "toolbox\0"
+    "tooth\0"
+    "torii-gate\0"
+    "tornado\0"
+    "tower-broadcast\0"
+    "broadcast-tower\0"
+    "tower-cell\0"
+    "tower-observation\0"
+    "tractor\0"
+    "trademark\0"
+    "traffic-light\0"
+    "trailer\0"
+    "train\0"
+    "train-subway\0"
+    "subway\0"
+    "train-tram\0"
+    "transgender\0"
+    "transgender-alt\0"
+    "trash\0"
+    "trash-arrow-up\0"
+    "trash-restore\0"
+    "trash-can\0"
+    "trash-alt\0"
+    "trash-can-arrow-up\0"
+    "trash-restore-alt\0"
+    "tree\0"
+    "tree-city\0"
+    "triangle-exclamation\0"
+    "exclamation-triangle\0"
+    "warning\0"
+    "trophy\0"
+    "trowel\0"
+    "trowel-bricks\0"
+    "truck\0"
+    "truck-arrow-right\0"
+    "truck-droplet\0"
+    "truck-fast\0"
+    "shipping-fast\0"
+    "truck-field\0"
+    "truck-field-un\0"
+    "truck-front\0"
+    "truck-medical\0"
+    "ambulance\0"
+    "truck-monster\0"
+    "truck-moving\0"
+    "truck-pickup\0"
+    "truck-plane\0"
+    "truck-ramp-box\0"
+    "truck-loading\0"
+    "tty\0"
+    "teletype\0"
+    "turkish-lira-sign\0"
+    "try\0"
+    "turkish-lira\0"
+    "turn-down\0"
+    "level-down-alt\0"
+    "turn-up\0"
+    "level-up-alt\0"
+    "tv\0"
+    "television\0"
+    "tv-alt\0"
+    "u\0"
+    "umbrella\0"
+    "umbrella-beach\0"
+    "underline\0"
+    "universal-access\0"
+    "unlock\0"
+    "unlock-keyhole\0"
+    "unlock-alt\0"
+    "up-down\0"
+    "arrows-alt-v\0"
+    "up-down-left-right\0"
+    "arrows-alt\0"
+    "up-long\0"
+    "long-arrow-alt-up\0"
+    "up-right-and-down-left-from-center\0"
+    "expand-alt\0"
+    "up-right-from-square\0"
+    "external-link-alt\0"
+    "upload\0"
+    "user\0"
+    "user-astronaut\0"
+    "user-check\0"
+    "user-clock\0"
+    "user-doctor\0"
+    "user-md\0"
+    "user-gear\0"
+    "user-cog\0"
+    "user-graduate\0"
+    "user-group\0"
+    "user-friends\0"
+    "user-injured\0"
+    "user-large\0"
+    "user-alt\0"
+    "user-large-slash\0"
+    "user-alt-slash\0"
+    "user-lock\0"
+    "user-minus\0"
+    "user-ninja\0"
+    "user-nurse\0"
+    "user-pen\0"
+    "user-edit\0"
+    "user-plus\0"
+    "user-secret\0"
+    "user-shield\0"
+    "user-slash\0"
+    "user-tag\0"
+    "user-tie\0"
+    "user-xmark\0"
+    "user-times\0"
+    "users\0"
+    "users-between-lines\0"
+    "users-gear\0"
+    "users-cog\0"
+    "users-line\0"
+    "users-rays\0"
+    "users-rectangle\0"
+    "users-slash\0"
+    "users-viewfinder\0"
+    "utensils\0"
+    "cutlery\0"
+    "v\0"
+    "van-shuttle\0"
+    "shuttle-van\0"
+    "vault\0"
+    "vector-square\0"
+    "venus\0"
+    "venus-double\0"
+    "venus-mars\0"
+    "vest\0"
+    "vest-patches\0"
+    "vial\0"
+    "vial-circle-check\0"
+    "vial-virus\0"
+    "vials\0"
+    "video\0"
+    "video-camera\0"
+    "video-slash\0"
+    "vihara\0"
+    "virus\0"
+    "virus-covid\0"
+    "virus-covid-slash\0"
+    "virus-slash\0"
+    "viruses\0"
+    "voicemail\0"
+    "volcano\0"
+    "volleyball\0"
+    "volleyball-ball\0"
+    "volume-high\0"
+    "volume-up\0"
+    "volume-low\0"
+    "volume-down\0"
+    "volume-off\0"
+    "volume-xmark\0"
+    "volume-mute\0"
+    "volume-times\0"
+    "vr-cardboard\0"
+    "w\0"
+    "walkie-talkie\0"
+    "wallet\0"
+    "wand-magic\0"
+    "magic\0"
+    "wand-magic-sparkles\0"
+    "magic-wand-sparkles\0"
+    "wand-sparkles\0"
+    "warehouse\0"
+    "water\0"
+    "water-ladder\0"
+    "ladder-water\0"
+    "swimming-pool\0"
+    "wave-square\0"
+    "weight-hanging\0"
+    "weight-scale\0"
+    "weight\0"
+    "wheat-awn\0"
+    "wheat-alt\0"
+    "wheat-awn-circle-exclamation\0"
+    "wheelchair\0"
+    "wheelchair-move\0"
+    "wheelchair-alt\0"
+    "whiskey-glass\0"
+    "glass-whiskey\0"
+    "wifi\0"
+    "wifi-3\0"
+    "wifi-strong\0"
+    "wind\0"
+    "window-maximize\0"
+    "window-minimize\0"
+    "window-restore\0"
+    "wine-bottle\0"
+    "wine-glass\0"
+    "wine-glass-empty\0"
+    "wine-glass-alt\0"
+    "won-sign\0"
+    "krw\0"
+    "won\0"
+    "worm\0"
+    "wrench\0"
+    "x\0"
+    "x-ray\0"
+    "xmark\0"
+    "close\0"
+    "multiply\0"
+    "remove\0"
+    "times\0"
+    "xmarks-lines\0"
+    "y\0"
+    "yen-sign\0"
+    "cny\0"
+    "jpy\0"
+    "rmb\0"
+    "yen\0"
+    "yin-yang\0"
+    "z\0"
+    "42-group\0"
+    "innosoft\0"
+    "500px\0"
+    "accessible-icon\0"
+    "accusoft\0"
+    "adn\0"
+    "adversal\0"
+    "affiliatetheme\0"
+    "airbnb\0"
+    "algolia\0"
+    "alipay\0"
+    "amazon\0"
+    "amazon-pay\0"
+    "amilia\0"
+    "android\0"
+    "angellist\0"
+    "angrycreative\0"
+    "angular\0"
+    "app-store\0"
+    "app-store-ios\0"
+    "apper\0"
+    "apple\0"
+    "apple-pay\0"
+    "artstation\0"
+    "asymmetrik\0"
+    "atlassian\0"
+    "audible\0"
+    "autoprefixer\0"
+    "avianex\0"
+    "aviato\0"
+    "aws\0"
+    "bandcamp\0"
+    "battle-net\0"
+    "behance\0"
+    "bilibili\0"
+    "bimobject\0"
+    "bitbucket\0"
+    "bitcoin\0"
+    "bity\0"
+    "black-tie\0"
+    "blackberry\0"
+    "blogger\0"
+    "blogger-b\0"
+    "bluesky\0"
+    "bluetooth\0"
+    "bluetooth-b\0"
+    "bootstrap\0"
+    "bots\0"
+    "brave\0"
+    "brave-reverse\0"
+    "btc\0"
+    "buffer\0"
+    "buromobelexperte\0"
+    "buy-n-large\0"
+    "buysellads\0"
+    "canadian-maple-leaf\0"
+    "cc-amazon-pay\0"
+    "cc-amex\0"
+    "cc-apple-pay\0"
+    "cc-diners-club\0"
+    "cc-discover\0"
+    "cc-jcb\0"
+    "cc-mastercard\0"
+    "cc-paypal\0"
+    "cc-stripe\0"
+    "cc-visa\0"
+    "centercode\0"
+    "centos\0"
+    "chrome\0"
+    "chromecast\0"
+    "cloudflare\0"
+    "cloudscale\0"
+    "cloudsmith\0"
+    "cloudversify\0"
+    "cmplid\0"
+    "codepen\0"
+    "codiepie\0"
+    "confluence\0"
+    "connectdevelop\0"
+    "contao\0"
+    "cotton-bureau\0"
+    "cpanel\0"
+    "creative-commons\0"
+    "creative-commons-by\0"
+    "creative-commons-nc\0"
+    "creative-commons-nc-eu\0"
+    "creative-commons-nc-jp\0"
+    "creative-commons-nd\0"
+    "creative-commons-pd\0"
+    "creative-commons-pd-alt\0"
+    "creative-commons-remix\0"
+    "creative-commons-sa\0"
+    "creative-commons-sampling\0"
+    "creative-commons-sampling-plus\0"
+    "creative-commons-share\0"
+    "creative-commons-zero\0"
+    "critical-role\0"
+    "css\0"
+    "css3\0"
+    "css3-alt\0"
+    "cuttlefish\0"
+    "d-and-d\0"
+    "d-and-d-beyond\0"
+    "dailymotion\0"
+    "dart-lang\0"
+    "dashcube\0"
+    "debian\0"
+    "deezer\0"
+    "delicious\0"
+    "deploydog\0"
+    "deskpro\0"
+    "dev\0"
+    "deviantart\0"
+    "dhl\0"
+    "diaspora\0"
+    "digg\0"
+    "digital-ocean\0"
+    "discord\0"
+    "discourse\0"
+    "dochub\0"
+    "docker\0"
+    "draft2digital\0"
+    "dribbble\0"
+    "dropbox\0"
+    "drupal\0"
+    "dyalog\0"
+    "earlybirds\0"
+    "ebay\0"
+    "edge\0"
+    "edge-legacy\0"
+    "elementor\0"
+    "ello\0"
+    "ember\0"
+    "empire\0"
+    "envira\0"
+    "erlang\0"
+    "ethereum\0"
+    "etsy\0"
+    "evernote\0"
+    "expeditedssl\0"
+    "facebook\0"
+    "facebook-f\0"
+    "facebook-messenger\0"
+    "fantasy-flight-games\0"
+    "fedex\0"
+    "fedora\0"
+    "figma\0"
+    "files-pinwheel\0"
+    "firefox\0"
+    "firefox-browser\0"
+    "first-order\0"
+    "first-order-alt\0"
+    "firstdraft\0"
+    "flickr\0"
+    "flipboard\0"
+    "flutter\0"
+    "fly\0"
+    "font-awesome\0"
+    "font-awesome-flag\0"
+    "font-awesome-logo-full\0"
+    "fonticons\0"
+    "fonticons-fi\0"
+    "fort-awesome\0"
+    "fort-awesome-alt\0"
+    "forumbee\0"
+    "foursquare\0"
+    "free-code-camp\0"
+    "freebsd\0"
+    "fulcrum\0"
+    "galactic-republic\0"
+    "galactic-senate\0"
+    "get-pocket\0"
+    "gg\0"
+    "gg-circle\0"
+    "git\0"
+    "git-alt\0"
+    "github\0"
+    "github-alt\0"
+    "gitkraken\0"
+    "gitlab\0"
+    "gitter\0"
+    "glide\0"
+    "glide-g\0"
+    "gofore\0"
+    "golang\0"
+    "goodreads\0"
+    "goodreads-g\0"
+    "google\0"
+    "google-drive\0"
+    "google-pay\0"
+    "google-play\0"
+    "google-plus\0"
+    "google-plus-g\0"
+    "google-scholar\0"
+    "google-wallet\0"
+    "gratipay\0"
+    "grav\0"
+    "gripfire\0"
+    "grunt\0"
+    "guilded\0"
+    "gulp\0"
+    "hacker-news\0"
+    "hackerrank\0"
+    "hashnode\0"
+    "hips\0"
+    "hire-a-helper\0"
+    "hive\0"
+    "hooli\0"
+    "hornbill\0"
+    "hotjar\0"
+    "houzz\0"
+    "html5\0"
+    "hubspot\0"
+    "ideal\0"
+    "imdb\0"
+    "instagram\0"
+    "instalod\0"
+    "intercom\0"
+    "internet-explorer\0"
+    "invision\0"
+    "ioxhost\0"
+    "itch-io\0"
+    "itunes\0"
+    "itunes-note\0"
+    "java\0"
+    "jedi-order\0"
+    "jenkins\0"
+    "jira\0"
+    "joget\0"
+    "joomla\0"
+    "js\0"
+    "jsfiddle\0"
+    "jxl\0"
+    "kaggle\0"
+    "keybase\0"
+    "keycdn\0"
+    "kickstarter\0"
+    "square-kickstarter\0"
+    "kickstarter-k\0"
+    "korvue\0"
+    "laravel\0"
+    "lastfm\0"
+    "leanpub\0"
+    "less\0"
+    "letterboxd\0"
+    "line\0"
+    "linkedin\0"
+    "linkedin-in\0"
+    "linode\0"
+    "linux\0"
+    "lyft\0"
+    "magento\0"
+    "mailchimp\0"
+    "mandalorian\0"
+    "markdown\0"
+    "mastodon\0"
+    "maxcdn\0"
+    "mdb\0"
+    "medapps\0"
+    "medium\0"
+    "medium-m\0"
+    "medrt\0"
+    "meetup\0"
+    "megaport\0"
+    "mendeley\0"
+    "meta\0"
+    "microblog\0"
+    "microsoft\0"
+    "mintbit\0"
+    "mix\0"
+    "mixcloud\0"
+    "mixer\0"
+    "mizuni\0"
+    "modx\0"
+    "monero\0"
+    "napster\0"
+    "neos\0"
+    "nfc-directional\0"
+    "nfc-symbol\0"
+    "nimblr\0"
+    "node\0"
+    "node-js\0"
+    "npm\0"
+    "ns8\0"
+    "nutritionix\0"
+    "octopus-deploy\0"
+    "odnoklassniki\0"
+    "odysee\0"
+    "old-republic\0"
+    "opencart\0"
+    "openid\0"
+    "opensuse\0"
+    "opera\0"
+    "optin-monster\0"
+    "orcid\0"
+    "osi\0"
+    "padlet\0"
+    "page4\0"
+    "pagelines\0"
+    "palfed\0"
+    "patreon\0"
+    "paypal\0"
+    "perbyte\0"
+    "periscope\0"
+    "phabricator\0"
+    "phoenix-framework\0"
+    "phoenix-squadron\0"
+    "php\0"
+    "pied-piper\0"
+    "pied-piper-alt\0"
+    "pied-piper-hat\0"
+    "pied-piper-pp\0"
+    "pinterest\0"
+    "pinterest-p\0"
+    "pix\0"
+    "pixiv\0"
+    "playstation\0"
+    "product-hunt\0"
+    "pushed\0"
+    "python\0"
+    "qq\0"
+    "quinscape\0"
+    "quora\0"
+    "r-project\0"
+    "raspberry-pi\0"
+    "ravelry\0"
+    "react\0"
+    "reacteurope\0"
+    "readme\0"
+    "rebel\0"
+    "red-river\0"
+    "reddit\0"
+    "reddit-alien\0"
+    "redhat\0"
+    "renren\0"
+    "replyd\0"
+    "researchgate\0"
+    "resolving\0"
+    "rev\0"
+    "rocketchat\0"
+    "rockrms\0"
+    "rust\0"
+    "safari\0"
+    "salesforce\0"
+    "sass\0"
+    "schlix\0"
+    "screenpal\0"
+    "scribd\0"
+    "searchengin\0"
+    "sellcast\0"
+    "sellsy\0"
+    "servicestack\0"
+    "shirtsinbulk\0"
+    "shoelace\0"
+    "shopify\0"
+    "shopware\0"
+    "signal-messenger\0"
+    "simplybuilt\0"
+    "sistrix\0"
+    "sith\0"
+    "sitrox\0"
+    "sketch\0"
+    "skyatlas\0"
+    "skype\0"
+    "slack\0"
+    "slack-hash\0"
+    "slideshare\0"
+    "snapchat\0"
+    "snapchat-ghost\0"
+    "soundcloud\0"
+    "sourcetree\0"
+    "space-awesome\0"
+    "speakap\0"
+    "speaker-deck\0"
+    "spotify\0"
+    "square-behance\0"
+    "behance-square\0"
+    "square-bluesky\0"
+    "square-dribbble\0"
+    "dribbble-square\0"
+    "square-facebook\0"
+    "facebook-square\0"
+    "square-font-awesome\0"
+    "square-font-awesome-stroke\0"
+    "font-awesome-alt\0"
+    "square-git\0"
+    "git-square\0"
+    "square-github\0"
+    "github-square\0"
+    "square-gitlab\0"
+    "gitlab-square\0"
+    "square-google-plus\0"
+    "google-plus-square\0"
+    "square-hacker-news\0"
+    "hacker-news-square\0"
+    "square-instagram\0"
+    "instagram-square\0"
+    "square-js\0"
+    "js-square\0"
+    "square-lastfm\0"
+    "lastfm-square\0"
+    "square-letterboxd\0"
+    "square-odnoklassniki\0"
+    "odnoklassniki-square\0"
+    "square-pied-piper\0"
+    "pied-piper-square\0"
+    "square-pinterest\0"
+    "pinterest-square\0"
+    "square-reddit\0"
+    "reddit-square\0"
+    "square-snapchat\0"
+    "snapchat-square\0"
+    "square-steam\0"
+    "steam-square\0"
+    "square-threads\0"
+    "square-tumblr\0"
+    "tumblr-square\0"
+    "square-twitter\0"
+    "twitter-square\0"
+    "square-upwork\0"
+    "square-viadeo\0"
+    "viadeo-square\0"
+    "square-vimeo\0"
+    "vimeo-square\0"
+    "square-web-awesome\0"
+    "square-web-awesome-stroke\0"
+    "square-whatsapp\0"
+    "whatsapp-square\0"
+    "square-x-twitter\0"
+    "square-xing\0"
+    "xing-square\0"
+    "square-youtube\0"
+    "youtube-square\0"
+    "squarespace\0"
+    "stack-exchange\0"
+    "stack-overflow\0"
+    "stackpath\0"
+    "staylinked\0"
+    "steam\0"
+    "steam-symbol\0"
+    "sticker-mule\0"
+    "strava\0"
+    "stripe\0"
+    "stripe-s\0"
+    "stubber\0"
+    "studiovinari\0"
+    "stumbleupon\0"
+    "stumbleupon-circle\0"
+    "superpowers\0"
+    "supple\0"
+    "suse\0"
+    "swift\0"
+    "symfony\0"
+    "teamspeak\0"
+    "telegram\0"
+    "telegram-plane\0"
+    "tencent-weibo\0"
+    "the-red-yeti\0"
+    "themeco\0"
+    "themeisle\0"
+    "think-peaks\0"
+    "threads\0"
+    "tiktok\0"
+    "trade-federation\0"
+    "trello\0"
+    "tumblr\0"
+    "twitch\0"
+    "twitter\0"
+    "typo3\0"
+    "uber\0"
+    "ubuntu\0"
+    "uikit\0"
+    "umbraco\0"
+    "uncharted\0"
+    "uniregistry\0"
+    "unity\0"
+    "unsplash\0"
+    "untappd\0"
+    "ups\0"
+    "upwork\0"
+    "usb\0"
+    "usps\0"
+    "ussunnah\0"
+    "vaadin\0"
+    "viacoin\0"
+    "viadeo\0"
+    "viber\0"
+    "vimeo\0"
+    "vimeo-v\0"
+    "vine\0"
+    "vk\0"
+    "vnv\0"
+    "vuejs\0"
+    "watchman-monitoring\0"
+    "waze\0"
+    "web-awesome\0"
+    "webflow\0"
+    "weebly\0"
+    "weibo\0"
+    "weixin\0"
+    "whatsapp\0"
+    "whmcs\0"
+    "wikipedia-w\0"
+    "windows\0"
+    "wirsindhandwerk\0"
+    "wsh\0"
+    "wix\0"
+    "wizards-of-the-coast\0"
+    "wodu\0"
+    "wolf-pack-battalion\0"
+    "wordpress\0"
+    "wordpress-simple\0"
+    "wpbeginner\0"
+    "wpexplorer\0"
+    "wpforms\0"
+    "wpressr\0"
+    "rendact\0"
+    "x-twitter\0"
+    "xbox\0"
+    "xing\0"
+    "y-combinator\0"
+    "yahoo\0"
+    "yammer\0"
+    "yandex\0"
+    "yandex-international\0"
+    "yarn\0"
+    "yelp\0"
+    "yoast\0"
+    "youtube\0"
+    "zhihu\0"
+#ifdef FONT_AWESOME_PRO
+    "00\0"
+    "360-degrees\0"
+    "abacus\0"
+    "accent-grave\0"
+    "acorn\0"
+    "air-conditioner\0"
+    "airplay\0"
+    "alarm-clock\0"
+    "alarm-exclamation\0"
+    "alarm-plus\0"
+    "alarm-snooze\0"
+    "album\0"
+    "album-circle-plus\0"
+    "album-circle-user\0"
+    "album-collection\0"
+    "album-collection-circle-plus\0"
+    "album-collection-circle-user\0"
+    "alicorn\0"
+    "alien\0"
+    "alien-8bit\0"
+    "alien-monster\0"
+    "align-slash\0"
+    "alt\0"
+    "amp-guitar\0"
+    "ampersand\0"
+    "angel\0"
+    "angle\0"
+    "angle-90\0"
+    "angles-up-down\0"
+    "ant\0"
+    "apartment\0"
+    "aperture\0"
+    "apostrophe\0"
+    "apple-core\0"
+    "arrow-down-arrow-up\0"
+    "sort-alt\0"
+    "arrow-down-big-small\0"
+    "sort-size-down\0"
+    "arrow-down-from-arc\0"
+    "arrow-down-from-bracket\0"
+    "arrow-down-from-dotted-line\0"
+    "arrow-down-from-line\0"
+    "arrow-from-top\0"
+    "arrow-down-left\0"
+    "arrow-down-left-and-arrow-up-right-to-center\0"
+    "arrow-down-right\0"
+    "arrow-down-small-big\0"
+    "sort-size-down-alt\0"
+    "arrow-down-square-triangle\0"
+    "sort-shapes-down-alt\0"
+    "arrow-down-to-arc\0"
+    "arrow-down-to-bracket\0"
+    "arrow-down-to-dotted-line\0"
+    "arrow-down-to-line\0"
+    "arrow-to-bottom\0"
+    "arrow-down-to-square\0"
+    "arrow-down-triangle-square\0"
+    "sort-shapes-down\0"
+    "arrow-left-from-arc\0"
+    "arrow-left-from-bracket\0"
+    "arrow-left-from-line\0"
+    "arrow-from-right\0"
+    "arrow-left-long-to-line\0"
+    "arrow-left-to-arc\0"
+    "arrow-left-to-bracket\0"
+    "arrow-left-to-line\0"
+    "arrow-to-left\0"
+    "arrow-progress\0"
+    "arrow-right-from-arc\0"
+    "arrow-right-from-line\0"
+    "arrow-from-left\0"
+    "arrow-right-long-to-line\0"
+    "arrow-right-to-arc\0"
+    "arrow-right-to-line\0"
+    "arrow-to-right\0"
+    "arrow-turn-down-left\0"
+    "arrow-turn-down-right\0"
+    "arrow-turn-left\0"
+    "arrow-turn-left-down\0"
+    "arrow-turn-left-up\0"
+    "arrow-turn-right\0"
+    "arrow-up-arrow-down\0"
+    "sort-up-down\0"
+    "arrow-up-big-small\0"
+    "sort-size-up\0"
+    "arrow-up-from-arc\0"
+    "arrow-up-from-dotted-line\0"
+    "arrow-up-from-line\0"
+    "arrow-from-bottom\0"
+    "arrow-up-from-square\0"
+    "arrow-up-left\0"
+    "arrow-up-left-from-circle\0"
+    "arrow-up-right\0"
+    "arrow-up-right-and-arrow-down-left-from-center\0"
+    "arrow-up-small-big\0"
+    "sort-size-up-alt\0"
+    "arrow-up-square-triangle\0"
+    "sort-shapes-up-alt\0"
+    "arrow-up-to-arc\0"
+    "arrow-up-to-bracket\0"
+    "arrow-up-to-dotted-line\0"
+    "arrow-up-to-line\0"
+    "arrow-to-top\0"
+    "arrow-up-triangle-square\0"
+    "sort-shapes-up\0"
+    "arrows-cross\0"
+    "arrows-from-dotted-line\0"
+    "arrows-from-line\0"
+    "arrows-maximize\0"
+    "expand-arrows\0"
+    "arrows-minimize\0"
+    "compress-arrows\0"
+    "arrows-repeat\0"
+    "repeat-alt\0"
+    "arrows-repeat-1\0"
+    "repeat-1-alt\0"
+    "arrows-retweet\0"
+    "retweet-alt\0"
+    "arrows-rotate-reverse\0"
+    "arrows-to-dotted-line\0"
+    "arrows-to-line\0"
+    "atom-simple\0"
+    "atom-alt\0"
+    "audio-description-slash\0"
+    "avocado\0"
+    "award-simple\0"
+    "axe\0"
+    "axe-battle\0"
+    "backpack\0"
+    "badge\0"
+    "badge-check\0"
+    "badge-dollar\0"
+    "badge-percent\0"
+    "badge-sheriff\0"
+    "badger-honey\0"
+    "badminton\0"
+    "bag-seedling\0"
+    "bag-shopping-minus\0"
+    "bag-shopping-plus\0"
+    "bagel\0"
+    "bags-shopping\0"
+    "baguette\0"
+    "ball-pile\0"
+    "balloon\0"
+    "balloons\0"
+    "ballot\0"
+    "ballot-check\0"
+    "ban-bug\0"
+    "debug\0"
+    "ban-parking\0"
+    "parking-circle-slash\0"
+    "banana\0"
+    "banjo\0"
+    "barcode-read\0"
+    "barcode-scan\0"
+    "bars-filter\0"
+    "bars-sort\0"
+    "basket-shopping-minus\0"
+    "basket-shopping-plus\0"
+    "basket-shopping-simple\0"
+    "shopping-basket-alt\0"
+    "basketball-hoop\0"
+    "bat\0"
+    "battery-bolt\0"
+    "battery-exclamation\0"
+    "battery-low\0"
+    "battery-1\0"
+    "battery-slash\0"
+    "bed-bunk\0"
+    "bed-empty\0"
+    "bed-front\0"
+    "bed-alt\0"
+    "bee\0"
+    "beer-mug\0"
+    "beer-foam\0"
+    "bell-exclamation\0"
+    "bell-on\0"
+    "bell-plus\0"
+    "bell-ring\0"
+    "bell-school\0"
+    "bell-school-slash\0"
+    "bells\0"
+    "bench-tree\0"
+    "billboard\0"
+    "bin-bottles\0"
+    "bin-bottles-recycle\0"
+    "bin-recycle\0"
+    "binary\0"
+    "binary-circle-check\0"
+    "binary-lock\0"
+    "binary-slash\0"
+    "bird\0"
+    "blanket\0"
+    "blanket-fire\0"
+    "blinds\0"
+    "blinds-open\0"
+    "blinds-raised\0"
+    "block\0"
+    "block-brick\0"
+    "wall-brick\0"
+    "block-brick-fire\0"
+    "firewall\0"
+    "block-question\0"
+    "block-quote\0"
+    "blueberries\0"
+    "bolt-auto\0"
+    "bolt-slash\0"
+    "bone-break\0"
+    "book-arrow-right\0"
+    "book-arrow-up\0"
+    "book-blank\0"
+    "book-alt\0"
+    "book-circle-arrow-right\0"
+    "book-circle-arrow-up\0"
+    "book-copy\0"
+    "book-font\0"
+    "book-heart\0"
+    "book-open-cover\0"
+    "book-open-alt\0"
+    "book-section\0"
+    "book-law\0"
+    "book-sparkles\0"
+    "book-spells\0"
+    "book-user\0"
+    "bookmark-slash\0"
+    "books\0"
+    "books-medical\0"
+    "boombox\0"
+    "boot\0"
+    "boot-heeled\0"
+    "booth-curtain\0"
+    "border-bottom\0"
+    "border-bottom-right\0"
+    "border-style-alt\0"
+    "border-center-h\0"
+    "border-center-v\0"
+    "border-inner\0"
+    "border-left\0"
+    "border-outer\0"
+    "border-right\0"
+    "border-top\0"
+    "bottle-baby\0"
+    "bow-arrow\0"
+    "bowl-chopsticks\0"
+    "bowl-chopsticks-noodles\0"
+    "bowl-hot\0"
+    "soup\0"
+    "bowl-scoop\0"
+    "bowl-shaved-ice\0"
+    "bowl-scoops\0"
+    "bowl-soft-serve\0"
+    "bowl-spoon\0"
+    "bowling-ball-pin\0"
+    "bowling-pins\0"
+    "box-ballot\0"
+    "box-check\0"
+    "box-circle-check\0"
+    "box-dollar\0"
+    "box-usd\0"
+    "box-heart\0"
+    "box-open-full\0"
+    "box-full\0"
+    "box-taped\0"
+    "box-alt\0"
+    "boxing-glove\0"
+    "glove-boxing\0"
+    "bracket-curly\0"
+    "bracket-curly-left\0"
+    "bracket-curly-right\0"
+    "bracket-round\0"
+    "parenthesis\0"
+    "bracket-round-right\0"
+    "bracket-square\0"
+    "bracket\0"
+    "bracket-left\0"
+    "bracket-square-right\0"
+    "brackets-curly\0"
+    "brackets-round\0"
+    "parentheses\0"
+    "brackets-square\0"
+    "brackets\0"
+    "brain-arrow-curved-right\0"
+    "mind-share\0"
+    "brain-circuit\0"
+    "brake-warning\0"
+    "bread-loaf\0"
+    "bread-slice-butter\0"
+    "bridge-suspension\0"
+    "briefcase-arrow-right\0"
+    "briefcase-blank\0"
+    "brightness\0"
+    "brightness-low\0"
+    "bring-forward\0"
+    "bring-front\0"
+    "broccoli\0"
+    "broom-wide\0"
+    "browser\0"
+    "browsers\0"
+    "building-magnifying-glass\0"
+    "building-memo\0"
+    "buildings\0"
+    "bulldozer\0"
+    "bullseye-arrow\0"
+    "bullseye-pointer\0"
+    "buoy\0"
+    "buoy-mooring\0"
+    "burger-cheese\0"
+    "cheeseburger\0"
+    "burger-fries\0"
+    "burger-glass\0"
+    "burger-lettuce\0"
+    "burger-soda\0"
+    "burrito\0"
+    "bus-school\0"
+    "butter\0"
+    "cabin\0"
+    "cabinet-filing\0"
+    "cactus\0"
+    "caduceus\0"
+    "cake-slice\0"
+    "shortcake\0"
+    "calculator-simple\0"
+    "calculator-alt\0"
+    "calendar-arrow-down\0"
+    "calendar-download\0"
+    "calendar-arrow-up\0"
+    "calendar-upload\0"
+    "calendar-circle-exclamation\0"
+    "calendar-circle-minus\0"
+    "calendar-circle-plus\0"
+    "calendar-circle-user\0"
+    "calendar-clock\0"
+    "calendar-time\0"
+    "calendar-exclamation\0"
+    "calendar-heart\0"
+    "calendar-image\0"
+    "calendar-lines\0"
+    "calendar-note\0"
+    "calendar-lines-pen\0"
+    "calendar-pen\0"
+    "calendar-edit\0"
+    "calendar-range\0"
+    "calendar-star\0"
+    "calendar-users\0"
+    "calendars\0"
+    "camcorder\0"
+    "video-handheld\0"
+    "camera-cctv\0"
+    "cctv\0"
+    "camera-movie\0"
+    "camera-polaroid\0"
+    "camera-security\0"
+    "camera-home\0"
+    "camera-slash\0"
+    "camera-viewfinder\0"
+    "screenshot\0"
+    "camera-web\0"
+    "webcam\0"
+    "camera-web-slash\0"
+    "webcam-slash\0"
+    "campfire\0"
+    "can-food\0"
+    "candle-holder\0"
+    "candy\0"
+    "candy-bar\0"
+    "chocolate-bar\0"
+    "candy-corn\0"
+    "cannon\0"
+    "car-bolt\0"
+    "car-building\0"
+    "car-bump\0"
+    "car-bus\0"
+    "car-circle-bolt\0"
+    "car-garage\0"
+    "car-mirrors\0"
+    "car-side-bolt\0"
+    "car-tilt\0"
+    "car-wash\0"
+    "car-wrench\0"
+    "car-mechanic\0"
+    "caravan-simple\0"
+    "caravan-alt\0"
+    "card-club\0"
+    "card-diamond\0"
+    "card-heart\0"
+    "card-spade\0"
+    "cards\0"
+    "cards-blank\0"
+    "carpool\0"
+    "car-people\0"
+    "cars\0"
+    "cart-arrow-up\0"
+    "cart-circle-arrow-down\0"
+    "cart-circle-arrow-up\0"
+    "cart-circle-check\0"
+    "cart-circle-exclamation\0"
+    "cart-circle-plus\0"
+    "cart-circle-xmark\0"
+    "cart-flatbed-boxes\0"
+    "dolly-flatbed-alt\0"
+    "cart-flatbed-empty\0"
+    "dolly-flatbed-empty\0"
+    "cart-minus\0"
+    "cart-shopping-fast\0"
+    "cart-xmark\0"
+    "cassette-betamax\0"
+    "betamax\0"
+    "cassette-tape\0"
+    "cassette-vhs\0"
+    "vhs\0"
+    "castle\0"
+    "cat-space\0"
+    "cauldron\0"
+    "chair-office\0"
+    "champagne-glass\0"
+    "glass-champagne\0"
+    "chart-bullet\0"
+    "chart-candlestick\0"
+    "chart-fft\0"
+    "chart-kanban\0"
+    "chart-line-down\0"
+    "chart-line-up\0"
+    "chart-line-up-down\0"
+    "chart-mixed\0"
+    "analytics\0"
+    "chart-mixed-up-circle-currency\0"
+    "chart-mixed-up-circle-dollar\0"
+    "chart-network\0"
+    "chart-pie-simple\0"
+    "chart-pie-alt\0"
+    "chart-pie-simple-circle-currency\0"
+    "chart-pie-simple-circle-dollar\0"
+    "chart-pyramid\0"
+    "chart-radar\0"
+    "chart-scatter\0"
+    "chart-scatter-3d\0"
+    "chart-scatter-bubble\0"
+    "chart-simple-horizontal\0"
+    "chart-sine\0"
+    "chart-tree-map\0"
+    "chart-user\0"
+    "user-chart\0"
+    "chart-waterfall\0"
+    "cheese-swiss\0"
+    "cherries\0"
+    "chess-bishop-piece\0"
+    "chess-bishop-alt\0"
+    "chess-clock\0"
+    "chess-clock-flip\0"
+    "chess-clock-alt\0"
+    "chess-king-piece\0"
+    "chess-king-alt\0"
+    "chess-knight-piece\0"
+    "chess-knight-alt\0"
+    "chess-pawn-piece\0"
+    "chess-pawn-alt\0"
+    "chess-queen-piece\0"
+    "chess-queen-alt\0"
+    "chess-rook-piece\0"
+    "chess-rook-alt\0"
+    "chestnut\0"
+    "chevrons-down\0"
+    "chevron-double-down\0"
+    "chevrons-left\0"
+    "chevron-double-left\0"
+    "chevrons-right\0"
+    "chevron-double-right\0"
+    "chevrons-up\0"
+    "chevron-double-up\0"
+    "chf-sign\0"
+    "chimney\0"
+    "chopsticks\0"
+    "circle-0\0"
+    "circle-1\0"
+    "circle-2\0"
+    "circle-3\0"
+    "circle-4\0"
+    "circle-5\0"
+    "circle-6\0"
+    "circle-7\0"
+    "circle-8\0"
+    "circle-9\0"
+    "circle-a\0"
+    "circle-ampersand\0"
+    "circle-arrow-down-left\0"
+    "circle-arrow-down-right\0"
+    "circle-arrow-up-left\0"
+    "circle-arrow-up-right\0"
+    "circle-b\0"
+    "circle-bolt\0"
+    "circle-book-open\0"
+    "book-circle\0"
+    "circle-bookmark\0"
+    "bookmark-circle\0"
+    "circle-c\0"
+    "circle-calendar\0"
+    "calendar-circle\0"
+    "circle-camera\0"
+    "camera-circle\0"
+    "circle-caret-down\0"
+    "caret-circle-down\0"
+    "circle-caret-left\0"
+    "caret-circle-left\0"
+    "circle-caret-right\0"
+    "caret-circle-right\0"
+    "circle-caret-up\0"
+    "caret-circle-up\0"
+    "circle-d\0"
+    "circle-dashed\0"
+    "circle-divide\0"
+    "circle-dollar\0"
+    "dollar-circle\0"
+    "usd-circle\0"
+    "circle-down-left\0"
+    "circle-down-right\0"
+    "circle-e\0"
+    "circle-ellipsis\0"
+    "circle-ellipsis-vertical\0"
+    "circle-envelope\0"
+    "envelope-circle\0"
+    "circle-euro\0"
+    "circle-exclamation-check\0"
+    "circle-f\0"
+    "circle-g\0"
+    "circle-gf\0"
+    "circle-half\0"
+    "circle-heart\0"
+    "heart-circle\0"
+    "circle-i\0"
+    "circle-j\0"
+    "circle-k\0"
+    "circle-l\0"
+    "circle-location-arrow\0"
+    "location-circle\0"
+    "circle-m\0"
+    "circle-microphone\0"
+    "microphone-circle\0"
+    "circle-microphone-lines\0"
+    "microphone-circle-alt\0"
+    "circle-n\0"
+    "circle-o\0"
+    "circle-p\0"
+    "circle-parking\0"
+    "parking-circle\0"
+    "circle-phone\0"
+    "phone-circle\0"
+    "circle-phone-flip\0"
+    "phone-circle-alt\0"
+    "circle-phone-hangup\0"
+    "phone-circle-down\0"
+    "circle-q\0"
+    "circle-quarter\0"
+    "circle-quarter-stroke\0"
+    "circle-quarters\0"
+    "circle-r\0"
+    "circle-s\0"
+    "circle-small\0"
+    "circle-sort\0"
+    "sort-circle\0"
+    "circle-sort-down\0"
+    "sort-circle-down\0"
+    "circle-sort-up\0"
+    "sort-circle-up\0"
+    "circle-star\0"
+    "star-circle\0"
+    "circle-sterling\0"
+    "circle-t\0"
+    "circle-three-quarters\0"
+    "circle-three-quarters-stroke\0"
+    "circle-trash\0"
+    "trash-circle\0"
+    "circle-u\0"
+    "circle-up-left\0"
+    "circle-up-right\0"
+    "circle-v\0"
+    "circle-video\0"
+    "video-circle\0"
+    "circle-w\0"
+    "circle-waveform-lines\0"
+    "waveform-circle\0"
+    "circle-wifi\0"
+    "circle-wifi-circle-wifi\0"
+    "circle-wifi-group\0"
+    "circle-x\0"
+    "circle-y\0"
+    "circle-yen\0"
+    "circle-z\0"
+    "circles-overlap\0"
+    "circles-overlap-3\0"
+    "pronoun\0"
+    "citrus\0"
+    "citrus-slice\0"
+    "clapperboard-play\0"
+    "clarinet\0"
+    "claw-marks\0"
+    "clipboard-list-check\0"
+    "clipboard-medical\0"
+    "clipboard-prescription\0"
+    "clock-desk\0"
+    "clock-eight\0"
+    "clock-eight-thirty\0"
+    "clock-eleven\0"
+    "clock-eleven-thirty\0"
+    "clock-five\0"
+    "clock-five-thirty\0"
+    "clock-four-thirty\0"
+    "clock-nine\0"
+    "clock-nine-thirty\0"
+    "clock-one\0"
+    "clock-one-thirty\0"
+    "clock-seven\0"
+    "clock-seven-thirty\0"
+    "clock-six\0"
+    "clock-six-thirty\0"
+    "clock-ten\0"
+    "clock-ten-thirty\0"
+    "clock-three\0"
+    "clock-three-thirty\0"
+    "clock-twelve\0"
+    "clock-twelve-thirty\0"
+    "clock-two\0"
+    "clock-two-thirty\0"
+    "closed-captioning-slash\0"
+    "clothes-hanger\0"
+    "cloud-binary\0"
+    "cloud-bolt-moon\0"
+    "thunderstorm-moon\0"
+    "cloud-bolt-sun\0"
+    "thunderstorm-sun\0"
+    "cloud-check\0"
+    "cloud-drizzle\0"
+    "cloud-exclamation\0"
+    "cloud-fog\0"
+    "fog\0"
+    "cloud-hail\0"
+    "cloud-hail-mixed\0"
+    "cloud-minus\0"
+    "cloud-music\0"
+    "cloud-plus\0"
+    "cloud-question\0"
+    "cloud-rainbow\0"
+    "cloud-showers\0"
+    "cloud-slash\0"
+    "cloud-sleet\0"
+    "cloud-snow\0"
+    "cloud-word\0"
+    "cloud-xmark\0"
+    "clouds\0"
+    "clouds-moon\0"
+    "clouds-sun\0"
+    "club\0"
+    "coconut\0"
+    "code-pull-request-closed\0"
+    "code-pull-request-draft\0"
+    "code-simple\0"
+    "coffee-bean\0"
+    "coffee-beans\0"
+    "coffee-pot\0"
+    "coffin\0"
+    "coffin-cross\0"
+    "coin\0"
+    "coin-blank\0"
+    "coin-front\0"
+    "coin-vertical\0"
+    "colon\0"
+    "columns-3\0"
+    "comet\0"
+    "comma\0"
+    "command\0"
+    "comment-arrow-down\0"
+    "comment-arrow-up\0"
+    "comment-arrow-up-right\0"
+    "comment-captions\0"
+    "comment-check\0"
+    "comment-code\0"
+    "comment-exclamation\0"
+    "comment-heart\0"
+    "comment-image\0"
+    "comment-lines\0"
+    "comment-middle\0"
+    "comment-middle-top\0"
+    "comment-minus\0"
+    "comment-music\0"
+    "comment-pen\0"
+    "comment-edit\0"
+    "comment-plus\0"
+    "comment-question\0"
+    "comment-quote\0"
+    "comment-smile\0"
+    "comment-text\0"
+    "comment-xmark\0"
+    "comment-times\0"
+    "comments-question\0"
+    "comments-question-check\0"
+    "compass-slash\0"
+    "compress-wide\0"
+    "computer-classic\0"
+    "computer-mouse-scrollwheel\0"
+    "mouse-alt\0"
+    "computer-speaker\0"
+    "container-storage\0"
+    "conveyor-belt\0"
+    "conveyor-belt-arm\0"
+    "conveyor-belt-boxes\0"
+    "conveyor-belt-alt\0"
+    "conveyor-belt-empty\0"
+    "corn\0"
+    "corner\0"
+    "court-sport\0"
+    "cowbell\0"
+    "cowbell-circle-plus\0"
+    "cowbell-more\0"
+    "crab\0"
+    "crate-apple\0"
+    "apple-crate\0"
+    "crate-empty\0"
+    "credit-card-blank\0"
+    "credit-card-front\0"
+    "cricket-bat-ball\0"
+    "cricket\0"
+    "croissant\0"
+    "crosshairs-simple\0"
+    "crutches\0"
+    "crystal-ball\0"
+    "cucumber\0"
+    "cup-straw\0"
+    "cup-straw-swoosh\0"
+    "cup-togo\0"
+    "coffee-togo\0"
+    "cupcake\0"
+    "curling-stone\0"
+    "curling\0"
+    "custard\0"
+    "dagger\0"
+    "dash\0"
+    "minus-large\0"
+    "deer\0"
+    "deer-rudolph\0"
+    "delete-right\0"
+    "desktop-arrow-down\0"
+    "diagram-cells\0"
+    "diagram-lean-canvas\0"
+    "diagram-nested\0"
+    "diagram-previous\0"
+    "diagram-sankey\0"
+    "diagram-subtask\0"
+    "diagram-venn\0"
+    "dial\0"
+    "dial-med-high\0"
+    "dial-high\0"
+    "dial-low\0"
+    "dial-max\0"
+    "dial-med\0"
+    "dial-med-low\0"
+    "dial-min\0"
+    "dial-off\0"
+    "diamond-exclamation\0"
+    "diamond-half\0"
+    "diamond-half-stroke\0"
+    "diamonds-4\0"
+    "dice-d10\0"
+    "dice-d12\0"
+    "dice-d4\0"
+    "dice-d8\0"
+    "dinosaur\0"
+    "diploma\0"
+    "scroll-ribbon\0"
+    "disc-drive\0"
+    "display-arrow-down\0"
+    "display-chart-up\0"
+    "display-chart-up-circle-currency\0"
+    "display-chart-up-circle-dollar\0"
+    "display-code\0"
+    "desktop-code\0"
+    "display-medical\0"
+    "desktop-medical\0"
+    "display-slash\0"
+    "desktop-slash\0"
+    "distribute-spacing-horizontal\0"
+    "distribute-spacing-vertical\0"
+    "ditto\0"
+    "do-not-enter\0"
+    "dog-leashed\0"
+    "dolly-empty\0"
+    "dolphin\0"
+    "donut\0"
+    "doughnut\0"
+    "down\0"
+    "arrow-alt-down\0"
+    "down-from-bracket\0"
+    "down-from-dotted-line\0"
+    "down-from-line\0"
+    "arrow-alt-from-top\0"
+    "down-left\0"
+    "down-right\0"
+    "down-to-bracket\0"
+    "down-to-dotted-line\0"
+    "down-to-line\0"
+    "arrow-alt-to-bottom\0"
+    "draw-circle\0"
+    "draw-square\0"
+    "dreidel\0"
+    "drone\0"
+    "drone-front\0"
+    "drone-alt\0"
+    "droplet-degree\0"
+    "dewpoint\0"
+    "droplet-percent\0"
+    "humidity\0"
+    "drumstick\0"
+    "dryer\0"
+    "dryer-heat\0"
+    "dryer-alt\0"
+    "duck\0"
+    "ear\0"
+    "ear-muffs\0"
+    "eclipse\0"
+    "egg-fried\0"
+    "eggplant\0"
+    "elephant\0"
+    "ellipsis-stroke\0"
+    "ellipsis-h-alt\0"
+    "ellipsis-stroke-vertical\0"
+    "ellipsis-v-alt\0"
+    "empty-set\0"
+    "engine\0"
+    "engine-warning\0"
+    "engine-exclamation\0"
+    "envelope-dot\0"
+    "envelope-badge\0"
+    "envelope-open-dollar\0"
+    "envelopes\0"
+    "escalator\0"
+    "excavator\0"
+    "expand-wide\0"
+    "eye-dropper-full\0"
+    "eye-dropper-half\0"
+    "eye-evil\0"
+    "eyes\0"
+    "face-angry-horns\0"
+    "face-anguished\0"
+    "face-anxious-sweat\0"
+    "face-astonished\0"
+    "face-awesome\0"
+    "gave-dandy\0"
+    "face-beam-hand-over-mouth\0"
+    "face-clouds\0"
+    "face-confounded\0"
+    "face-confused\0"
+    "face-cowboy-hat\0"
+    "face-diagonal-mouth\0"
+    "face-disappointed\0"
+    "face-disguise\0"
+    "face-dotted\0"
+    "face-downcast-sweat\0"
+    "face-drooling\0"
+    "face-exhaling\0"
+    "face-explode\0"
+    "exploding-head\0"
+    "face-expressionless\0"
+    "face-eyes-xmarks\0"
+    "face-fearful\0"
+    "face-frown-slight\0"
+    "face-glasses\0"
+    "face-hand-over-mouth\0"
+    "face-hand-peeking\0"
+    "face-hand-yawn\0"
+    "face-head-bandage\0"
+    "face-holding-back-tears\0"
+    "face-hushed\0"
+    "face-icicles\0"
+    "face-kiss-closed-eyes\0"
+    "face-lying\0"
+    "face-mask\0"
+    "face-melting\0"
+    "face-monocle\0"
+    "face-nauseated\0"
+    "face-nose-steam\0"
+    "face-party\0"
+    "face-pensive\0"
+    "face-persevering\0"
+    "face-pleading\0"
+    "face-pouting\0"
+    "face-raised-eyebrow\0"
+    "face-relieved\0"
+    "face-sad-sweat\0"
+    "face-saluting\0"
+    "face-scream\0"
+    "face-shush\0"
+    "face-sleeping\0"
+    "face-sleepy\0"
+    "face-smile-halo\0"
+    "face-smile-hearts\0"
+    "face-smile-horns\0"
+    "face-smile-plus\0"
+    "smile-plus\0"
+    "face-smile-relaxed\0"
+    "face-smile-tear\0"
+    "face-smile-tongue\0"
+    "face-smile-upside-down\0"
+    "face-smiling-hands\0"
+    "face-smirking\0"
+    "face-spiral-eyes\0"
+    "face-sunglasses\0"
+    "face-swear\0"
+    "face-thermometer\0"
+    "face-thinking\0"
+    "face-tissue\0"
+    "face-tongue-money\0"
+    "face-tongue-sweat\0"
+    "face-unamused\0"
+    "face-viewfinder\0"
+    "face-vomit\0"
+    "face-weary\0"
+    "face-woozy\0"
+    "face-worried\0"
+    "face-zany\0"
+    "face-zipper\0"
+    "falafel\0"
+    "family\0"
+    "family-dress\0"
+    "family-pants\0"
+    "fan-table\0"
+    "farm\0"
+    "barn-silo\0"
+    "fence\0"
+    "ferris-wheel\0"
+    "field-hockey-stick-ball\0"
+    "field-hockey\0"
+    "file-binary\0"
+    "file-cad\0"
+    "file-certificate\0"
+    "file-award\0"
+    "file-chart-column\0"
+    "file-chart-line\0"
+    "file-chart-pie\0"
+    "file-check\0"
+    "file-circle-info\0"
+    "file-dashed-line\0"
+    "page-break\0"
+    "file-doc\0"
+    "file-eps\0"
+    "file-exclamation\0"
+    "file-gif\0"
+    "file-heart\0"
+    "file-jpg\0"
+    "file-lock\0"
+    "file-magnifying-glass\0"
+    "file-search\0"
+    "file-minus\0"
+    "file-mov\0"
+    "file-mp3\0"
+    "file-mp4\0"
+    "file-music\0"
+    "file-plus\0"
+    "file-plus-minus\0"
+    "file-png\0"
+    "file-ppt\0"
+    "file-slash\0"
+    "file-spreadsheet\0"
+    "file-svg\0"
+    "file-user\0"
+    "file-vector\0"
+    "file-xls\0"
+    "file-xmark\0"
+    "file-times\0"
+    "file-xml\0"
+    "file-zip\0"
+    "files\0"
+    "files-medical\0"
+    "film-canister\0"
+    "film-cannister\0"
+    "film-simple\0"
+    "film-alt\0"
+    "film-slash\0"
+    "films\0"
+    "filter-list\0"
+    "filter-slash\0"
+    "filters\0"
+    "fire-flame\0"
+    "flame\0"
+    "fire-hydrant\0"
+    "fire-smoke\0"
+    "fireplace\0"
+    "fish-bones\0"
+    "fish-cooked\0"
+    "fishing-rod\0"
+    "flag-pennant\0"
+    "pennant\0"
+    "flag-swallowtail\0"
+    "flag-alt\0"
+    "flashlight\0"
+    "flask-gear\0"
+    "flask-round-poison\0"
+    "flask-poison\0"
+    "flask-round-potion\0"
+    "flask-potion\0"
+    "flatbread\0"
+    "flatbread-stuffed\0"
+    "floppy-disk-circle-arrow-right\0"
+    "save-circle-arrow-right\0"
+    "floppy-disk-circle-xmark\0"
+    "floppy-disk-times\0"
+    "save-circle-xmark\0"
+    "save-times\0"
+    "floppy-disk-pen\0"
+    "floppy-disks\0"
+    "flower\0"
+    "flower-daffodil\0"
+    "flower-tulip\0"
+    "flute\0"
+    "flux-capacitor\0"
+    "flying-disc\0"
+    "folder-arrow-down\0"
+    "folder-download\0"
+    "folder-arrow-up\0"
+    "folder-upload\0"
+    "folder-bookmark\0"
+    "folder-check\0"
+    "folder-gear\0"
+    "folder-cog\0"
+    "folder-grid\0"
+    "folder-heart\0"
+    "folder-image\0"
+    "folder-magnifying-glass\0"
+    "folder-search\0"
+    "folder-medical\0"
+    "folder-music\0"
+    "folder-user\0"
+    "folder-xmark\0"
+    "folder-times\0"
+    "folders\0"
+    "fondue-pot\0"
+    "font-case\0"
+    "football-helmet\0"
+    "fork\0"
+    "utensil-fork\0"
+    "fork-knife\0"
+    "utensils-alt\0"
+    "forklift\0"
+    "fort\0"
+    "frame\0"
+    "french-fries\0"
+    "function\0"
+    "galaxy\0"
+    "gallery-thumbnails\0"
+    "game-board\0"
+    "game-board-simple\0"
+    "game-board-alt\0"
+    "game-console-handheld\0"
+    "game-console-handheld-crank\0"
+    "gamepad-modern\0"
+    "gamepad-alt\0"
+    "garage\0"
+    "garage-car\0"
+    "garage-open\0"
+    "garlic\0"
+    "gas-pump-slash\0"
+    "gauge-circle-bolt\0"
+    "gauge-circle-minus\0"
+    "gauge-circle-plus\0"
+    "gauge-low\0"
+    "tachometer-alt-slow\0"
+    "gauge-max\0"
+    "tachometer-alt-fastest\0"
+    "gauge-min\0"
+    "tachometer-alt-slowest\0"
+    "gauge-simple-low\0"
+    "tachometer-slow\0"
+    "gauge-simple-max\0"
+    "tachometer-fastest\0"
+    "gauge-simple-min\0"
+    "tachometer-slowest\0"
+    "gear-code\0"
+    "gear-complex\0"
+    "gear-complex-code\0"
+    "gif\0"
+    "gift-card\0"
+    "gingerbread-man\0"
+    "glass\0"
+    "glass-citrus\0"
+    "glass-empty\0"
+    "glass-half\0"
+    "glass-half-empty\0"
+    "glass-half-full\0"
+    "glasses-round\0"
+    "glasses-alt\0"
+    "globe-pointer\0"
+    "globe-snow\0"
+    "globe-stand\0"
+    "globe-wifi\0"
+    "goal-net\0"
+    "golf-club\0"
+    "golf-flag-hole\0"
+    "gramophone\0"
+    "grapes\0"
+    "grate\0"
+    "grate-droplet\0"
+    "grid\0"
+    "grid-3\0"
+    "grid-2\0"
+    "grid-2-plus\0"
+    "grid-4\0"
+    "grid-5\0"
+    "grid-dividers\0"
+    "grid-horizontal\0"
+    "grid-round\0"
+    "grid-round-2\0"
+    "grid-round-2-plus\0"
+    "grid-round-4\0"
+    "grid-round-5\0"
+    "grill\0"
+    "grill-fire\0"
+    "grill-hot\0"
+    "grip-dots\0"
+    "grip-dots-vertical\0"
+    "guitar-electric\0"
+    "guitars\0"
+    "gun-slash\0"
+    "gun-squirt\0"
+    "h1\0"
+    "h2\0"
+    "h3\0"
+    "h4\0"
+    "h5\0"
+    "h6\0"
+    "hammer-brush\0"
+    "hammer-crash\0"
+    "hammer-war\0"
+    "hand-back-point-down\0"
+    "hand-back-point-left\0"
+    "hand-back-point-ribbon\0"
+    "hand-back-point-right\0"
+    "hand-back-point-up\0"
+    "hand-fingers-crossed\0"
+    "hand-heart\0"
+    "hand-holding-box\0"
+    "hand-holding-circle-dollar\0"
+    "hand-holding-magic\0"
+    "hand-holding-seedling\0"
+    "hand-holding-skull\0"
+    "hand-horns\0"
+    "hand-love\0"
+    "hand-point-ribbon\0"
+    "hand-wave\0"
+    "hands-holding-diamond\0"
+    "hand-receiving\0"
+    "hands-holding-dollar\0"
+    "hands-usd\0"
+    "hands-holding-heart\0"
+    "hands-heart\0"
+    "hashtag-lock\0"
+    "hat-beach\0"
+    "hat-chef\0"
+    "hat-santa\0"
+    "hat-winter\0"
+    "hat-witch\0"
+    "head-side\0"
+    "head-side-brain\0"
+    "head-side-gear\0"
+    "head-side-goggles\0"
+    "head-vr\0"
+    "head-side-headphones\0"
+    "head-side-heart\0"
+    "head-side-medical\0"
+    "heart-half\0"
+    "heart-half-stroke\0"
+    "heart-half-alt\0"
+    "heat\0"
+    "helmet-battle\0"
+    "hexagon\0"
+    "hexagon-check\0"
+    "hexagon-divide\0"
+    "hexagon-exclamation\0"
+    "hexagon-image\0"
+    "hexagon-minus\0"
+    "minus-hexagon\0"
+    "hexagon-plus\0"
+    "plus-hexagon\0"
+    "hexagon-vertical-nft\0"
+    "hexagon-vertical-nft-slanted\0"
+    "hexagon-xmark\0"
+    "times-hexagon\0"
+    "xmark-hexagon\0"
+    "high-definition\0"
+    "rectangle-hd\0"
+    "highlighter-line\0"
+    "hockey-mask\0"
+    "hockey-stick-puck\0"
+    "hockey-sticks\0"
+    "honey-pot\0"
+    "hood-cloak\0"
+    "horizontal-rule\0"
+    "horse-saddle\0"
+    "hose\0"
+    "hose-reel\0"
+    "hospitals\0"
+    "hourglass-clock\0"
+    "house-blank\0"
+    "home-blank\0"
+    "house-building\0"
+    "house-chimney-blank\0"
+    "house-chimney-heart\0"
+    "house-day\0"
+    "house-heart\0"
+    "home-heart\0"
+    "house-night\0"
+    "house-person-leave\0"
+    "house-leave\0"
+    "house-person-depart\0"
+    "house-person-return\0"
+    "house-person-arrive\0"
+    "house-return\0"
+    "house-tree\0"
+    "house-turret\0"
+    "house-water\0"
+    "house-flood\0"
+    "house-window\0"
+    "hundred-points\0"
+    "100\0"
+    "hydra\0"
+    "hyphen\0"
+    "ice-skate\0"
+    "image-landscape\0"
+    "landscape\0"
+    "image-polaroid\0"
+    "image-polaroid-user\0"
+    "image-slash\0"
+    "image-user\0"
+    "images-user\0"
+    "inbox-full\0"
+    "inbox-in\0"
+    "inbox-arrow-down\0"
+    "inbox-out\0"
+    "inbox-arrow-up\0"
+    "inboxes\0"
+    "industry-windows\0"
+    "industry-alt\0"
+    "inhaler\0"
+    "input-numeric\0"
+    "input-pipe\0"
+    "input-text\0"
+    "integral\0"
+    "interrobang\0"
+    "intersection\0"
+    "island-tropical\0"
+    "island-tree-palm\0"
+    "jack-o-lantern\0"
+    "joystick\0"
+    "jug\0"
+    "jug-bottle\0"
+    "kazoo\0"
+    "kerning\0"
+    "key-skeleton\0"
+    "key-skeleton-left-right\0"
+    "keyboard-brightness\0"
+    "keyboard-brightness-low\0"
+    "keyboard-down\0"
+    "keyboard-left\0"
+    "keynote\0"
+    "kidneys\0"
+    "kite\0"
+    "kiwi-fruit\0"
+    "knife\0"
+    "utensil-knife\0"
+    "knife-kitchen\0"
+    "lacrosse-stick\0"
+    "lacrosse-stick-ball\0"
+    "lambda\0"
+    "lamp\0"
+    "lamp-desk\0"
+    "lamp-floor\0"
+    "lamp-street\0"
+    "landmark-magnifying-glass\0"
+    "laptop-arrow-down\0"
+    "laptop-binary\0"
+    "laptop-mobile\0"
+    "phone-laptop\0"
+    "laptop-slash\0"
+    "lasso\0"
+    "lasso-sparkles\0"
+    "layer-minus\0"
+    "layer-group-minus\0"
+    "layer-plus\0"
+    "layer-group-plus\0"
+    "leaf-heart\0"
+    "leaf-maple\0"
+    "leaf-oak\0"
+    "leafy-green\0"
+    "left\0"
+    "arrow-alt-left\0"
+    "left-from-bracket\0"
+    "left-from-line\0"
+    "arrow-alt-from-right\0"
+    "left-long-to-line\0"
+    "left-to-bracket\0"
+    "left-to-line\0"
+    "arrow-alt-to-left\0"
+    "light-ceiling\0"
+    "light-emergency\0"
+    "light-emergency-on\0"
+    "light-switch\0"
+    "light-switch-off\0"
+    "light-switch-on\0"
+    "lightbulb-cfl\0"
+    "lightbulb-cfl-on\0"
+    "lightbulb-dollar\0"
+    "lightbulb-exclamation\0"
+    "lightbulb-exclamation-on\0"
+    "lightbulb-gear\0"
+    "lightbulb-message\0"
+    "lightbulb-on\0"
+    "lightbulb-slash\0"
+    "lighthouse\0"
+    "lights-holiday\0"
+    "line-columns\0"
+    "line-height\0"
+    "link-horizontal\0"
+    "chain-horizontal\0"
+    "link-horizontal-slash\0"
+    "chain-horizontal-slash\0"
+    "link-simple\0"
+    "link-simple-slash\0"
+    "lips\0"
+    "list-dropdown\0"
+    "list-music\0"
+    "list-radio\0"
+    "list-timeline\0"
+    "list-tree\0"
+    "loader\0"
+    "lobster\0"
+    "location-arrow-up\0"
+    "location-check\0"
+    "map-marker-check\0"
+    "location-crosshairs-slash\0"
+    "location-slash\0"
+    "location-dot-slash\0"
+    "map-marker-alt-slash\0"
+    "location-exclamation\0"
+    "map-marker-exclamation\0"
+    "location-minus\0"
+    "map-marker-minus\0"
+    "location-pen\0"
+    "map-marker-edit\0"
+    "location-pin-slash\0"
+    "map-marker-slash\0"
+    "location-plus\0"
+    "map-marker-plus\0"
+    "location-question\0"
+    "map-marker-question\0"
+    "location-smile\0"
+    "map-marker-smile\0"
+    "location-xmark\0"
+    "map-marker-times\0"
+    "map-marker-xmark\0"
+    "lock-a\0"
+    "lock-hashtag\0"
+    "lock-keyhole\0"
+    "lock-alt\0"
+    "lock-keyhole-open\0"
+    "lock-open-alt\0"
+    "lollipop\0"
+    "lollypop\0"
+    "loveseat\0"
+    "couch-small\0"
+    "luchador-mask\0"
+    "luchador\0"
+    "mask-luchador\0"
+    "mace\0"
+    "magnifying-glass-arrows-rotate\0"
+    "magnifying-glass-music\0"
+    "magnifying-glass-play\0"
+    "magnifying-glass-waveform\0"
+    "mailbox\0"
+    "mailbox-flag-up\0"
+    "mandolin\0"
+    "mango\0"
+    "manhole\0"
+    "mask-snorkel\0"
+    "meat\0"
+    "megaphone\0"
+    "melon\0"
+    "melon-slice\0"
+    "memo\0"
+    "memo-circle-check\0"
+    "memo-circle-info\0"
+    "memo-pad\0"
+    "merge\0"
+    "message-arrow-down\0"
+    "comment-alt-arrow-down\0"
+    "message-arrow-up\0"
+    "comment-alt-arrow-up\0"
+    "message-arrow-up-right\0"
+    "message-bot\0"
+    "message-captions\0"
+    "comment-alt-captions\0"
+    "message-check\0"
+    "comment-alt-check\0"
+    "message-code\0"
+    "message-dollar\0"
+    "comment-alt-dollar\0"
+    "message-dots\0"
+    "comment-alt-dots\0"
+    "messaging\0"
+    "message-exclamation\0"
+    "comment-alt-exclamation\0"
+    "message-heart\0"
+    "message-image\0"
+    "comment-alt-image\0"
+    "message-lines\0"
+    "comment-alt-lines\0"
+    "message-medical\0"
+    "comment-alt-medical\0"
+    "message-middle\0"
+    "comment-middle-alt\0"
+    "message-middle-top\0"
+    "comment-middle-top-alt\0"
+    "message-minus\0"
+    "comment-alt-minus\0"
+    "message-music\0"
+    "comment-alt-music\0"
+    "message-pen\0"
+    "comment-alt-edit\0"
+    "message-edit\0"
+    "message-plus\0"
+    "comment-alt-plus\0"
+    "message-question\0"
+    "message-quote\0"
+    "comment-alt-quote\0"
+    "message-slash\0"
+    "comment-alt-slash\0"
+    "message-smile\0"
+    "comment-alt-smile\0"
+    "message-sms\0"
+    "message-text\0"
+    "comment-alt-text\0"
+    "message-xmark\0"
+    "comment-alt-times\0"
+    "message-times\0"
+    "messages\0"
+    "comments-alt\0"
+    "messages-dollar\0"
+    "comments-alt-dollar\0"
+    "messages-question\0"
+    "meter\0"
+    "meter-bolt\0"
+    "meter-droplet\0"
+    "meter-fire\0"
+    "microchip-ai\0"
+    "microphone-stand\0"
+    "microwave\0"
+    "mistletoe\0"
+    "mobile-notch\0"
+    "mobile-iphone\0"
+    "mobile-signal\0"
+    "mobile-signal-out\0"
+    "money-bill-simple\0"
+    "money-bill-simple-wave\0"
+    "money-bills-simple\0"
+    "money-bills-alt\0"
+    "money-check-dollar-pen\0"
+    "money-check-edit-alt\0"
+    "money-check-pen\0"
+    "money-check-edit\0"
+    "money-from-bracket\0"
+    "money-simple-from-bracket\0"
+    "monitor-waveform\0"
+    "monitor-heart-rate\0"
+    "monkey\0"
+    "moon-cloud\0"
+    "moon-over-sun\0"
+    "eclipse-alt\0"
+    "moon-stars\0"
+    "moped\0"
+    "mountains\0"
+    "mouse-field\0"
+    "mp3-player\0"
+    "mug\0"
+    "mug-marshmallows\0"
+    "mug-tea\0"
+    "mug-tea-saucer\0"
+    "mushroom\0"
+    "music-magnifying-glass\0"
+    "music-note\0"
+    "music-alt\0"
+    "music-note-slash\0"
+    "music-alt-slash\0"
+    "music-slash\0"
+    "mustache\0"
+    "narwhal\0"
+    "nesting-dolls\0"
+    "nfc\0"
+    "nfc-lock\0"
+    "nfc-magnifying-glass\0"
+    "nfc-pen\0"
+    "nfc-signal\0"
+    "nfc-slash\0"
+    "nfc-trash\0"
+    "nose\0"
+    "note\0"
+    "note-medical\0"
+    "notebook\0"
+    "notes\0"
+    "object-exclude\0"
+    "object-intersect\0"
+    "object-subtract\0"
+    "object-union\0"
+    "objects-align-bottom\0"
+    "objects-align-center-horizontal\0"
+    "objects-align-center-vertical\0"
+    "objects-align-left\0"
+    "objects-align-right\0"
+    "objects-align-top\0"
+    "objects-column\0"
+    "octagon\0"
+    "octagon-check\0"
+    "octagon-divide\0"
+    "octagon-exclamation\0"
+    "octagon-minus\0"
+    "minus-octagon\0"
+    "octagon-plus\0"
+    "plus-octagon\0"
+    "octagon-xmark\0"
+    "times-octagon\0"
+    "xmark-octagon\0"
+    "octopus\0"
+    "oil-can-drip\0"
+    "oil-temperature\0"
+    "oil-temp\0"
+    "olive\0"
+    "olive-branch\0"
+    "omega\0"
+    "onion\0"
+    "option\0"
+    "ornament\0"
+    "outlet\0"
+    "oven\0"
+    "overline\0"
+    "page\0"
+    "page-caret-down\0"
+    "file-caret-down\0"
+    "page-caret-up\0"
+    "file-caret-up\0"
+    "paintbrush-fine\0"
+    "paint-brush-alt\0"
+    "paint-brush-fine\0"
+    "paintbrush-alt\0"
+    "paintbrush-pencil\0"
+    "pallet-box\0"
+    "pallet-boxes\0"
+    "palette-boxes\0"
+    "pallet-alt\0"
+    "pan-food\0"
+    "pan-frying\0"
+    "pancakes\0"
+    "panel-ews\0"
+    "panel-fire\0"
+    "paper-plane-top\0"
+    "paper-plane-alt\0"
+    "send\0"
+    "paperclip-vertical\0"
+    "paragraph-left\0"
+    "paragraph-rtl\0"
+    "party-bell\0"
+    "party-horn\0"
+    "paw-claws\0"
+    "paw-simple\0"
+    "paw-alt\0"
+    "peach\0"
+    "peanut\0"
+    "peanuts\0"
+    "peapod\0"
+    "pear\0"
+    "pedestal\0"
+    "pegasus\0"
+    "pen-circle\0"
+    "pen-clip-slash\0"
+    "pen-alt-slash\0"
+    "pen-fancy-slash\0"
+    "pen-field\0"
+    "pen-line\0"
+    "pen-nib-slash\0"
+    "pen-paintbrush\0"
+    "pencil-paintbrush\0"
+    "pen-slash\0"
+    "pen-swirl\0"
+    "pencil-mechanical\0"
+    "pencil-slash\0"
+    "people\0"
+    "people-dress\0"
+    "people-dress-simple\0"
+    "people-pants\0"
+    "people-pants-simple\0"
+    "people-simple\0"
+    "pepper\0"
+    "period\0"
+    "person-biking-mountain\0"
+    "biking-mountain\0"
+    "person-carry-box\0"
+    "person-carry\0"
+    "person-dolly\0"
+    "person-dolly-empty\0"
+    "person-dress-fairy\0"
+    "person-dress-simple\0"
+    "person-fairy\0"
+    "person-from-portal\0"
+    "portal-exit\0"
+    "person-pinball\0"
+    "person-running-fast\0"
+    "person-seat\0"
+    "person-seat-reclined\0"
+    "person-sign\0"
+    "person-simple\0"
+    "person-ski-jumping\0"
+    "ski-jump\0"
+    "person-ski-lift\0"
+    "ski-lift\0"
+    "person-sledding\0"
+    "sledding\0"
+    "person-snowmobiling\0"
+    "snowmobile\0"
+    "person-to-door\0"
+    "person-to-portal\0"
+    "portal-enter\0"
+    "phone-arrow-down-left\0"
+    "phone-arrow-down\0"
+    "phone-incoming\0"
+    "phone-arrow-right\0"
+    "phone-arrow-up-right\0"
+    "phone-arrow-up\0"
+    "phone-outgoing\0"
+    "phone-hangup\0"
+    "phone-intercom\0"
+    "phone-missed\0"
+    "phone-office\0"
+    "phone-plus\0"
+    "phone-rotary\0"
+    "phone-xmark\0"
+    "photo-film-music\0"
+    "pi\0"
+    "piano\0"
+    "piano-keyboard\0"
+    "pickaxe\0"
+    "pickleball\0"
+    "pie\0"
+    "pig\0"
+    "pinata\0"
+    "pinball\0"
+    "pineapple\0"
+    "pipe\0"
+    "pipe-circle-check\0"
+    "pipe-collar\0"
+    "pipe-section\0"
+    "pipe-smoking\0"
+    "pipe-valve\0"
+    "pizza\0"
+    "plane-engines\0"
+    "plane-alt\0"
+    "plane-prop\0"
+    "plane-tail\0"
+    "plane-up-slash\0"
+    "planet-moon\0"
+    "planet-ringed\0"
+    "plate-utensils\0"
+    "play-pause\0"
+    "plus-large\0"
+    "podium\0"
+    "podium-star\0"
+    "police-box\0"
+    "poll-people\0"
+    "pompebled\0"
+    "pool-8-ball\0"
+    "popcorn\0"
+    "popsicle\0"
+    "pot-food\0"
+    "potato\0"
+    "prescription-bottle-pill\0"
+    "presentation-screen\0"
+    "presentation\0"
+    "pretzel\0"
+    "print-magnifying-glass\0"
+    "print-search\0"
+    "print-slash\0"
+    "projector\0"
+    "pump\0"
+    "pumpkin\0"
+    "puzzle\0"
+    "puzzle-piece-simple\0"
+    "puzzle-piece-alt\0"
+    "quotes\0"
+    "rabbit\0"
+    "rabbit-running\0"
+    "rabbit-fast\0"
+    "raccoon\0"
+    "racquet\0"
+    "radar\0"
+    "radio-tuner\0"
+    "radio-alt\0"
+    "raindrops\0"
+    "ram\0"
+    "ramp-loading\0"
+    "raygun\0"
+    "rectangle\0"
+    "rectangle-landscape\0"
+    "rectangle-barcode\0"
+    "barcode-alt\0"
+    "rectangle-code\0"
+    "rectangle-history\0"
+    "rectangle-history-circle-plus\0"
+    "rectangle-history-circle-user\0"
+    "rectangle-pro\0"
+    "pro\0"
+    "rectangle-terminal\0"
+    "rectangle-vertical\0"
+    "rectangle-portrait\0"
+    "rectangle-vertical-history\0"
+    "rectangle-wide\0"
+    "rectangles-mixed\0"
+    "reel\0"
+    "reflect-both\0"
+    "reflect-horizontal\0"
+    "reflect-vertical\0"
+    "refrigerator\0"
+    "repeat-1\0"
+    "reply-clock\0"
+    "reply-time\0"
+    "restroom-simple\0"
+    "rhombus\0"
+    "right\0"
+    "arrow-alt-right\0"
+    "right-from-line\0"
+    "arrow-alt-from-left\0"
+    "right-left-large\0"
+    "right-long-to-line\0"
+    "right-to-line\0"
+    "arrow-alt-to-right\0"
+    "ring-diamond\0"
+    "rings-wedding\0"
+    "robot-astromech\0"
+    "rocket-launch\0"
+    "roller-coaster\0"
+    "rotate-exclamation\0"
+    "rotate-reverse\0"
+    "route-highway\0"
+    "route-interstate\0"
+    "router\0"
+    "rugby-ball\0"
+    "ruler-triangle\0"
+    "rv\0"
+    "sack\0"
+    "salad\0"
+    "bowl-salad\0"
+    "salt-shaker\0"
+    "sandwich\0"
+    "sausage\0"
+    "saxophone\0"
+    "saxophone-fire\0"
+    "sax-hot\0"
+    "scalpel\0"
+    "scalpel-line-dashed\0"
+    "scalpel-path\0"
+    "scanner-gun\0"
+    "scanner\0"
+    "scanner-image\0"
+    "scanner-keyboard\0"
+    "scanner-touchscreen\0"
+    "scarecrow\0"
+    "scarf\0"
+    "screen-users\0"
+    "users-class\0"
+    "screencast\0"
+    "scribble\0"
+    "scroll-old\0"
+    "scrubber\0"
+    "scythe\0"
+    "sd-cards\0"
+    "seal\0"
+    "seal-exclamation\0"
+    "seal-question\0"
+    "seat-airline\0"
+    "semicolon\0"
+    "send-back\0"
+    "send-backward\0"
+    "sensor\0"
+    "sensor-cloud\0"
+    "sensor-smoke\0"
+    "sensor-fire\0"
+    "sensor-on\0"
+    "sensor-triangle-exclamation\0"
+    "sensor-alert\0"
+    "share-all\0"
+    "sheep\0"
+    "shelves\0"
+    "inventory\0"
+    "shelves-empty\0"
+    "shield-check\0"
+    "shield-cross\0"
+    "shield-exclamation\0"
+    "shield-keyhole\0"
+    "shield-minus\0"
+    "shield-plus\0"
+    "shield-quartered\0"
+    "shield-slash\0"
+    "shield-xmark\0"
+    "shield-times\0"
+    "shirt-long-sleeve\0"
+    "shirt-running\0"
+    "shirt-tank-top\0"
+    "shish-kebab\0"
+    "shovel\0"
+    "shovel-snow\0"
+    "shower-down\0"
+    "shower-alt\0"
+    "shredder\0"
+    "shutters\0"
+    "shuttlecock\0"
+    "sickle\0"
+    "sidebar\0"
+    "sidebar-flip\0"
+    "sigma\0"
+    "sign-post\0"
+    "sign-posts\0"
+    "sign-posts-wrench\0"
+    "signal-bars\0"
+    "signal-alt\0"
+    "signal-alt-4\0"
+    "signal-bars-strong\0"
+    "signal-bars-fair\0"
+    "signal-alt-2\0"
+    "signal-bars-good\0"
+    "signal-alt-3\0"
+    "signal-bars-slash\0"
+    "signal-alt-slash\0"
+    "signal-bars-weak\0"
+    "signal-alt-1\0"
+    "signal-fair\0"
+    "signal-2\0"
+    "signal-good\0"
+    "signal-3\0"
+    "signal-slash\0"
+    "signal-stream\0"
+    "signal-stream-slash\0"
+    "signal-strong\0"
+    "signal-4\0"
+    "signal-weak\0"
+    "signal-1\0"
+    "signature-lock\0"
+    "signature-slash\0"
+    "sim-cards\0"
+    "siren\0"
+    "siren-on\0"
+    "skeleton\0"
+    "skeleton-ribs\0"
+    "ski-boot\0"
+    "ski-boot-ski\0"
+    "skull-cow\0"
+    "slash-back\0"
+    "slash-forward\0"
+    "slider\0"
+    "sliders-simple\0"
+    "sliders-up\0"
+    "sliders-v\0"
+    "slot-machine\0"
+    "smoke\0"
+    "snake\0"
+    "snooze\0"
+    "zzz\0"
+    "snow-blowing\0"
+    "snowflake-droplets\0"
+    "snowflakes\0"
+    "snowman-head\0"
+    "frosty-head\0"
+    "soft-serve\0"
+    "creemee\0"
+    "solar-system\0"
+    "space-station-moon\0"
+    "space-station-moon-construction\0"
+    "space-station-moon-alt\0"
+    "spade\0"
+    "sparkle\0"
+    "sparkles\0"
+    "speaker\0"
+    "speakers\0"
+    "spider-black-widow\0"
+    "spider-web\0"
+    "spinner-scale\0"
+    "spinner-third\0"
+    "split\0"
+    "sportsball\0"
+    "sprinkler\0"
+    "sprinkler-ceiling\0"
+    "square-0\0"
+    "square-1\0"
+    "square-2\0"
+    "square-3\0"
+    "square-4\0"
+    "square-5\0"
+    "square-6\0"
+    "square-7\0"
+    "square-8\0"
+    "square-9\0"
+    "square-a\0"
+    "square-a-lock\0"
+    "square-ampersand\0"
+    "square-arrow-down\0"
+    "arrow-square-down\0"
+    "square-arrow-down-left\0"
+    "square-arrow-down-right\0"
+    "square-arrow-left\0"
+    "arrow-square-left\0"
+    "square-arrow-right\0"
+    "arrow-square-right\0"
+    "square-arrow-up\0"
+    "arrow-square-up\0"
+    "square-arrow-up-left\0"
+    "square-b\0"
+    "square-bolt\0"
+    "square-c\0"
+    "square-chevron-down\0"
+    "chevron-square-down\0"
+    "square-chevron-left\0"
+    "chevron-square-left\0"
+    "square-chevron-right\0"
+    "chevron-square-right\0"
+    "square-chevron-up\0"
+    "chevron-square-up\0"
+    "square-code\0"
+    "square-d\0"
+    "square-dashed\0"
+    "square-dashed-circle-plus\0"
+    "square-divide\0"
+    "square-dollar\0"
+    "dollar-square\0"
+    "usd-square\0"
+    "square-down\0"
+    "arrow-alt-square-down\0"
+    "square-down-left\0"
+    "square-down-right\0"
+    "square-e\0"
+    "square-ellipsis\0"
+    "square-ellipsis-vertical\0"
+    "square-exclamation\0"
+    "exclamation-square\0"
+    "square-f\0"
+    "square-fragile\0"
+    "box-fragile\0"
+    "square-wine-glass-crack\0"
+    "square-g\0"
+    "square-heart\0"
+    "heart-square\0"
+    "square-i\0"
+    "square-info\0"
+    "info-square\0"
+    "square-j\0"
+    "square-k\0"
+    "square-kanban\0"
+    "square-l\0"
+    "square-left\0"
+    "arrow-alt-square-left\0"
+    "square-list\0"
+    "square-m\0"
+    "square-n\0"
+    "square-o\0"
+    "square-p\0"
+    "square-parking-slash\0"
+    "parking-slash\0"
+    "square-phone-hangup\0"
+    "phone-square-down\0"
+    "square-q\0"
+    "square-quarters\0"
+    "square-question\0"
+    "question-square\0"
+    "square-quote\0"
+    "square-r\0"
+    "square-right\0"
+    "arrow-alt-square-right\0"
+    "square-ring\0"
+    "square-root\0"
+    "square-s\0"
+    "square-sliders\0"
+    "sliders-h-square\0"
+    "square-sliders-vertical\0"
+    "sliders-v-square\0"
+    "square-small\0"
+    "square-star\0"
+    "square-t\0"
+    "square-terminal\0"
+    "square-this-way-up\0"
+    "box-up\0"
+    "square-u\0"
+    "square-up\0"
+    "arrow-alt-square-up\0"
+    "square-up-left\0"
+    "square-user\0"
+    "square-v\0"
+    "square-w\0"
+    "square-x\0"
+    "square-y\0"
+    "square-z\0"
+    "squid\0"
+    "squirrel\0"
+    "staff\0"
+    "standard-definition\0"
+    "rectangle-sd\0"
+    "star-christmas\0"
+    "star-exclamation\0"
+    "star-sharp\0"
+    "star-sharp-half\0"
+    "star-sharp-half-stroke\0"
+    "star-sharp-half-alt\0"
+    "star-shooting\0"
+    "starfighter\0"
+    "starfighter-twin-ion-engine\0"
+    "starfighter-alt\0"
+    "starfighter-twin-ion-engine-advanced\0"
+    "starfighter-alt-advanced\0"
+    "stars\0"
+    "starship\0"
+    "starship-freighter\0"
+    "steak\0"
+    "steering-wheel\0"
+    "stocking\0"
+    "stomach\0"
+    "store-lock\0"
+    "strawberry\0"
+    "stretcher\0"
+    "subtitles\0"
+    "subtitles-slash\0"
+    "sun-bright\0"
+    "sun-alt\0"
+    "sun-cloud\0"
+    "sun-dust\0"
+    "sun-haze\0"
+    "sunglasses\0"
+    "sunrise\0"
+    "sunset\0"
+    "sushi\0"
+    "nigiri\0"
+    "sushi-roll\0"
+    "maki-roll\0"
+    "makizushi\0"
+    "swap\0"
+    "swap-arrows\0"
+    "sword\0"
+    "sword-laser\0"
+    "sword-laser-alt\0"
+    "swords\0"
+    "swords-laser\0"
+    "symbols\0"
+    "icons-alt\0"
+    "t-rex\0"
+    "table-cells-column-unlock\0"
+    "table-cells-lock\0"
+    "table-cells-unlock\0"
+    "table-layout\0"
+    "table-picnic\0"
+    "table-pivot\0"
+    "table-rows\0"
+    "rows\0"
+    "table-tree\0"
+    "tablet-rugged\0"
+    "tablet-screen\0"
+    "tablet-android-alt\0"
+    "taco\0"
+    "tally\0"
+    "tally-5\0"
+    "tally-1\0"
+    "tally-2\0"
+    "tally-3\0"
+    "tally-4\0"
+    "tamale\0"
+    "tank-water\0"
+    "taxi-bus\0"
+    "teddy-bear\0"
+    "telescope\0"
+    "temperature-list\0"
+    "temperature-snow\0"
+    "temperature-frigid\0"
+    "temperature-sun\0"
+    "temperature-hot\0"
+    "tennis-ball\0"
+    "tent-double-peak\0"
+    "text\0"
+    "text-size\0"
+    "theta\0"
+    "thought-bubble\0"
+    "tick\0"
+    "ticket-airline\0"
+    "ticket-perforated-plane\0"
+    "ticket-plane\0"
+    "ticket-perforated\0"
+    "tickets\0"
+    "tickets-airline\0"
+    "tickets-perforated-plane\0"
+    "tickets-plane\0"
+    "tickets-perforated\0"
+    "tickets-simple\0"
+    "tilde\0"
+    "timeline-arrow\0"
+    "timer\0"
+    "tire\0"
+    "tire-flat\0"
+    "tire-pressure-warning\0"
+    "tire-rugged\0"
+    "toggle-large-off\0"
+    "toggle-large-on\0"
+    "toilet-paper-blank\0"
+    "toilet-paper-alt\0"
+    "toilet-paper-blank-under\0"
+    "toilet-paper-reverse-alt\0"
+    "toilet-paper-check\0"
+    "toilet-paper-under\0"
+    "toilet-paper-reverse\0"
+    "toilet-paper-under-slash\0"
+    "toilet-paper-reverse-slash\0"
+    "toilet-paper-xmark\0"
+    "tomato\0"
+    "tombstone\0"
+    "tombstone-blank\0"
+    "tombstone-alt\0"
+    "toothbrush\0"
+    "tower-control\0"
+    "traffic-cone\0"
+    "traffic-light-go\0"
+    "traffic-light-slow\0"
+    "traffic-light-stop\0"
+    "train-subway-tunnel\0"
+    "subway-tunnel\0"
+    "train-track\0"
+    "train-tunnel\0"
+    "transformer-bolt\0"
+    "transporter\0"
+    "transporter-1\0"
+    "transporter-2\0"
+    "transporter-3\0"
+    "transporter-4\0"
+    "transporter-5\0"
+    "transporter-6\0"
+    "transporter-7\0"
+    "transporter-empty\0"
+    "trash-can-check\0"
+    "trash-can-clock\0"
+    "trash-can-list\0"
+    "trash-can-plus\0"
+    "trash-can-slash\0"
+    "trash-alt-slash\0"
+    "trash-can-undo\0"
+    "trash-can-arrow-turn-left\0"
+    "trash-undo-alt\0"
+    "trash-can-xmark\0"
+    "trash-check\0"
+    "trash-clock\0"
+    "trash-list\0"
+    "trash-plus\0"
+    "trash-slash\0"
+    "trash-undo\0"
+    "trash-arrow-turn-left\0"
+    "trash-xmark\0"
+    "treasure-chest\0"
+    "tree-christmas\0"
+    "tree-deciduous\0"
+    "tree-alt\0"
+    "tree-decorated\0"
+    "tree-large\0"
+    "tree-palm\0"
+    "trees\0"
+    "triangle\0"
+    "triangle-instrument\0"
+    "triangle-music\0"
+    "triangle-person-digging\0"
+    "construction\0"
+    "tricycle\0"
+    "tricycle-adult\0"
+    "trillium\0"
+    "trophy-star\0"
+    "trophy-alt\0"
+    "truck-bolt\0"
+    "truck-clock\0"
+    "shipping-timed\0"
+    "truck-container\0"
+    "truck-container-empty\0"
+    "truck-fire\0"
+    "truck-flatbed\0"
+    "truck-ladder\0"
+    "truck-plow\0"
+    "truck-ramp\0"
+    "truck-ramp-couch\0"
+    "truck-couch\0"
+    "truck-tow\0"
+    "truck-utensils\0"
+    "trumpet\0"
+    "tty-answer\0"
+    "teletype-answer\0"
+    "tugrik-sign\0"
+    "turkey\0"
+    "turn-down-left\0"
+    "turn-down-right\0"
+    "turn-left\0"
+    "turn-left-down\0"
+    "turn-left-up\0"
+    "turn-right\0"
+    "turntable\0"
+    "turtle\0"
+    "tv-music\0"
+    "tv-retro\0"
+    "typewriter\0"
+    "ufo\0"
+    "ufo-beam\0"
+    "umbrella-simple\0"
+    "umbrella-alt\0"
+    "unicorn\0"
+    "uniform-martial-arts\0"
+    "union\0"
+    "up\0"
+    "arrow-alt-up\0"
+    "up-from-bracket\0"
+    "up-from-dotted-line\0"
+    "up-from-line\0"
+    "arrow-alt-from-bottom\0"
+    "up-left\0"
+    "up-right\0"
+    "up-to-bracket\0"
+    "up-to-dotted-line\0"
+    "up-to-line\0"
+    "arrow-alt-to-top\0"
+    "usb-drive\0"
+    "user-alien\0"
+    "user-beard-bolt\0"
+    "user-bounty-hunter\0"
+    "user-chef\0"
+    "user-cowboy\0"
+    "user-crown\0"
+    "user-doctor-hair\0"
+    "user-doctor-hair-long\0"
+    "user-doctor-message\0"
+    "user-md-chat\0"
+    "user-group-crown\0"
+    "users-crown\0"
+    "user-group-simple\0"
+    "user-hair\0"
+    "user-hair-buns\0"
+    "user-hair-long\0"
+    "user-hair-mullet\0"
+    "business-front\0"
+    "party-back\0"
+    "trian-balbot\0"
+    "user-headset\0"
+    "user-helmet-safety\0"
+    "user-construction\0"
+    "user-hard-hat\0"
+    "user-hoodie\0"
+    "user-magnifying-glass\0"
+    "user-music\0"
+    "user-nurse-hair\0"
+    "user-nurse-hair-long\0"
+    "user-pilot\0"
+    "user-pilot-tie\0"
+    "user-police\0"
+    "user-police-tie\0"
+    "user-robot\0"
+    "user-robot-xmarks\0"
+    "user-shakespeare\0"
+    "user-tie-hair\0"
+    "user-tie-hair-long\0"
+    "user-unlock\0"
+    "user-visor\0"
+    "user-vneck\0"
+    "user-vneck-hair\0"
+    "user-vneck-hair-long\0"
+    "users-medical\0"
+    "utensils-slash\0"
+    "utility-pole\0"
+    "utility-pole-double\0"
+    "vacuum\0"
+    "vacuum-robot\0"
+    "value-absolute\0"
+    "vector-circle\0"
+    "vector-polygon\0"
+    "vent-damper\0"
+    "video-arrow-down-left\0"
+    "video-arrow-up-right\0"
+    "video-plus\0"
+    "violin\0"
+    "volume\0"
+    "volume-medium\0"
+    "volume-slash\0"
+    "waffle\0"
+    "wagon-covered\0"
+    "walker\0"
+    "wand\0"
+    "warehouse-full\0"
+    "warehouse-alt\0"
+    "washing-machine\0"
+    "washer\0"
+    "watch\0"
+    "watch-apple\0"
+    "watch-calculator\0"
+    "watch-fitness\0"
+    "watch-smart\0"
+    "water-arrow-down\0"
+    "water-lower\0"
+    "water-arrow-up\0"
+    "water-rise\0"
+    "watermelon-slice\0"
+    "wave\0"
+    "wave-pulse\0"
+    "heart-rate\0"
+    "wave-sine\0"
+    "wave-triangle\0"
+    "waveform\0"
+    "waveform-lines\0"
+    "waveform-path\0"
+    "waves-sine\0"
+    "webhook\0"
+    "whale\0"
+    "wheat\0"
+    "wheat-awn-slash\0"
+    "wheat-slash\0"
+    "whiskey-glass-ice\0"
+    "glass-whiskey-rocks\0"
+    "whistle\0"
+    "wifi-exclamation\0"
+    "wifi-fair\0"
+    "wifi-2\0"
+    "wifi-slash\0"
+    "wifi-weak\0"
+    "wifi-1\0"
+    "wind-turbine\0"
+    "wind-warning\0"
+    "wind-circle-exclamation\0"
+    "window\0"
+    "window-flip\0"
+    "window-alt\0"
+    "window-frame\0"
+    "window-frame-open\0"
+    "windsock\0"
+    "wine-glass-crack\0"
+    "fragile\0"
+    "wreath\0"
+    "wreath-laurel\0"
+    "wrench-simple\0"
+    "xmark-large\0"
+    "xmark-to-slot\0"
+    "times-to-slot\0"
+    "vote-nay\0"
+#endif
+    "";
 
+static constexpr fa::QtAwesomeNamedIcon faCommonIconArray[] = {
+    { 0, fa::fa_0 } , // 0
+    { 2, fa::fa_1 } , // 1
+    { 4, fa::fa_2 } , // 2
+    { 6, fa::fa_3 } , // 3
+    { 8, fa::fa_4 } , // 4
+    { 10, fa::fa_5 } , // 5
+    { 12, fa::fa_6 } , // 6
+    { 14, fa::fa_7 } , // 7
+    { 16, fa::fa_8 } , // 8
+    { 18, fa::fa_9 } , // 9
+    { 20, fa::fa_a } , // a
+    { 17334, fa::fa_ad } , // ad
+    { 17001, fa::fa_add } , // add
+    { 22, fa::fa_address_book } , // address-book
+    { 48, fa::fa_address_card } , // address-card
+    { 5448, fa::fa_adjust } , // adjust
+    { 19177, fa::fa_air_freshener } , // air-freshener
+    { 80, fa::fa_align_center } , // align-center
+    { 93, fa::fa_align_justify } , // align-justify
+    { 107, fa::fa_align_left } , // align-left
+    { 118, fa::fa_align_right } , // align-right
+    { 10546, fa::fa_allergies } , // allergies
+    { 22073, fa::fa_ambulance } , // ambulance
+    { 10944, fa::fa_american_sign_language_interpreting } , // american-sign-language-interpreting
+    { 130, fa::fa_anchor } , // anchor
+    { 137, fa::fa_anchor_circle_check } , // anchor-circle-check
+    { 157, fa::fa_anchor_circle_exclamation } , // anchor-circle-exclamation
+    { 183, fa::fa_anchor_circle_xmark } , // anchor-circle-xmark
+    { 203, fa::fa_anchor_lock } , // anchor-lock
+    { 270, fa::fa_angle_double_down } , // angle-double-down
+    { 300, fa::fa_angle_double_left } , // angle-double-left
+    { 331, fa::fa_angle_double_right } , // angle-double-right
+    { 360, fa::fa_angle_double_up } , // angle-double-up
+    { 215, fa::fa_angle_down } , // angle-down
+    { 226, fa::fa_angle_left } , // angle-left
+    { 237, fa::fa_angle_right } , // angle-right
+    { 249, fa::fa_angle_up } , // angle-up
+    { 258, fa::fa_angles_down } , // angles-down
+    { 288, fa::fa_angles_left } , // angles-left
+    { 318, fa::fa_angles_right } , // angles-right
+    { 350, fa::fa_angles_up } , // angles-up
+    { 7916, fa::fa_angry } , // angry
+    { 376, fa::fa_ankh } , // ankh
+    { 393, fa::fa_apple_alt } , // apple-alt
+    { 381, fa::fa_apple_whole } , // apple-whole
+    { 3149, fa::fa_archive } , // archive
+    { 403, fa::fa_archway } , // archway
+    { 4557, fa::fa_area_chart } , // area-chart
+    { 5344, fa::fa_arrow_alt_circle_down } , // arrow-alt-circle-down
+    { 5491, fa::fa_arrow_alt_circle_left } , // arrow-alt-circle-left
+    { 5715, fa::fa_arrow_alt_circle_right } , // arrow-alt-circle-right
+    { 5772, fa::fa_arrow_alt_circle_up } , // arrow-alt-circle-up
+    { 4973, fa::fa_arrow_circle_down } , // arrow-circle-down
+    { 5009, fa::fa_arrow_circle_left } , // arrow-circle-left
+    { 5046, fa::fa_arrow_circle_right } , // arrow-circle-right
+    { 5081, fa::fa_arrow_circle_up } , // arrow-circle-up
+    { 411, fa::fa_arrow_down } , // arrow-down
+    { 422, fa::fa_arrow_down_1_9 } , // arrow-down-1-9
+    { 472, fa::fa_arrow_down_9_1 } , // arrow-down-9-1
+    { 527, fa::fa_arrow_down_a_z } , // arrow-down-a-z
+    { 573, fa::fa_arrow_down_long } , // arrow-down-long
+    { 605, fa::fa_arrow_down_short_wide } , // arrow-down-short-wide
+    { 665, fa::fa_arrow_down_up_across_line } , // arrow-down-up-across-line
+    { 691, fa::fa_arrow_down_up_lock } , // arrow-down-up-lock
+    { 710, fa::fa_arrow_down_wide_short } , // arrow-down-wide-short
+    { 765, fa::fa_arrow_down_z_a } , // arrow-down-z-a
+    { 816, fa::fa_arrow_left } , // arrow-left
+    { 827, fa::fa_arrow_left_long } , // arrow-left-long
+    { 1068, fa::fa_arrow_left_rotate } , // arrow-left-rotate
+    { 859, fa::fa_arrow_pointer } , // arrow-pointer
+    { 887, fa::fa_arrow_right } , // arrow-right
+    { 899, fa::fa_arrow_right_arrow_left } , // arrow-right-arrow-left
+    { 931, fa::fa_arrow_right_from_bracket } , // arrow-right-from-bracket
+    { 9135, fa::fa_arrow_right_from_file } , // arrow-right-from-file
+    { 965, fa::fa_arrow_right_long } , // arrow-right-long
+    { 1150, fa::fa_arrow_right_rotate } , // arrow-right-rotate
+    { 999, fa::fa_arrow_right_to_bracket } , // arrow-right-to-bracket
+    { 1030, fa::fa_arrow_right_to_city } , // arrow-right-to-city
+    { 9211, fa::fa_arrow_right_to_file } , // arrow-right-to-file
+    { 1086, fa::fa_arrow_rotate_back } , // arrow-rotate-back
+    { 1104, fa::fa_arrow_rotate_backward } , // arrow-rotate-backward
+    { 1169, fa::fa_arrow_rotate_forward } , // arrow-rotate-forward
+    { 1050, fa::fa_arrow_rotate_left } , // arrow-rotate-left
+    { 1131, fa::fa_arrow_rotate_right } , // arrow-rotate-right
+    { 1195, fa::fa_arrow_trend_down } , // arrow-trend-down
+    { 1212, fa::fa_arrow_trend_up } , // arrow-trend-up
+    { 1227, fa::fa_arrow_turn_down } , // arrow-turn-down
+    { 1254, fa::fa_arrow_turn_up } , // arrow-turn-up
+    { 1277, fa::fa_arrow_up } , // arrow-up
+    { 1286, fa::fa_arrow_up_1_9 } , // arrow-up-1-9
+    { 1315, fa::fa_arrow_up_9_1 } , // arrow-up-9-1
+    { 1348, fa::fa_arrow_up_a_z } , // arrow-up-a-z
+    { 1375, fa::fa_arrow_up_from_bracket } , // arrow-up-from-bracket
+    { 1397, fa::fa_arrow_up_from_ground_water } , // arrow-up-from-ground-water
+    { 1424, fa::fa_arrow_up_from_water_pump } , // arrow-up-from-water-pump
+    { 1449, fa::fa_arrow_up_long } , // arrow-up-long
+    { 1477, fa::fa_arrow_up_right_dots } , // arrow-up-right-dots
+    { 1497, fa::fa_arrow_up_right_from_square } , // arrow-up-right-from-square
+    { 1538, fa::fa_arrow_up_short_wide } , // arrow-up-short-wide
+    { 1577, fa::fa_arrow_up_wide_short } , // arrow-up-wide-short
+    { 1612, fa::fa_arrow_up_z_a } , // arrow-up-z-a
+    { 1935, fa::fa_arrows } , // arrows
+    { 22405, fa::fa_arrows_alt } , // arrows-alt
+    { 13206, fa::fa_arrows_alt_h } , // arrows-alt-h
+    { 22373, fa::fa_arrows_alt_v } , // arrows-alt-v
+    { 1643, fa::fa_arrows_down_to_line } , // arrows-down-to-line
+    { 1663, fa::fa_arrows_down_to_people } , // arrows-down-to-people
+    { 1703, fa::fa_arrows_h } , // arrows-h
+    { 1685, fa::fa_arrows_left_right } , // arrows-left-right
+    { 1712, fa::fa_arrows_left_right_to_line } , // arrows-left-right-to-line
+    { 1738, fa::fa_arrows_rotate } , // arrows-rotate
+    { 1765, fa::fa_arrows_spin } , // arrows-spin
+    { 1777, fa::fa_arrows_split_up_and_left } , // arrows-split-up-and-left
+    { 1802, fa::fa_arrows_to_circle } , // arrows-to-circle
+    { 1819, fa::fa_arrows_to_dot } , // arrows-to-dot
+    { 1833, fa::fa_arrows_to_eye } , // arrows-to-eye
+    { 1847, fa::fa_arrows_turn_right } , // arrows-turn-right
+    { 1865, fa::fa_arrows_turn_to_dots } , // arrows-turn-to-dots
+    { 1885, fa::fa_arrows_up_down } , // arrows-up-down
+    { 1909, fa::fa_arrows_up_down_left_right } , // arrows-up-down-left-right
+    { 1942, fa::fa_arrows_up_to_line } , // arrows-up-to-line
+    { 1900, fa::fa_arrows_v } , // arrows-v
+    { 10980, fa::fa_asl_interpreting } , // asl-interpreting
+    { 7414, fa::fa_assistive_listening_systems } , // assistive-listening-systems
+    { 1960, fa::fa_asterisk } , // asterisk
+    { 1969, fa::fa_at } , // at
+    { 2820, fa::fa_atlas } , // atlas
+    { 1972, fa::fa_atom } , // atom
+    { 1977, fa::fa_audio_description } , // audio-description
+    { 1995, fa::fa_austral_sign } , // austral-sign
+    { 4112, fa::fa_automobile } , // automobile
+    { 2008, fa::fa_award } , // award
+    { 2014, fa::fa_b } , // b
+    { 2016, fa::fa_baby } , // baby
+    { 2021, fa::fa_baby_carriage } , // baby-carriage
+    { 6785, fa::fa_backspace } , // backspace
+    { 2049, fa::fa_backward } , // backward
+    { 2058, fa::fa_backward_fast } , // backward-fast
+    { 2086, fa::fa_backward_step } , // backward-step
+    { 2114, fa::fa_bacon } , // bacon
+    { 2120, fa::fa_bacteria } , // bacteria
+    { 2129, fa::fa_bacterium } , // bacterium
+    { 2139, fa::fa_bag_shopping } , // bag-shopping
+    { 2165, fa::fa_bahai } , // bahai
+    { 2178, fa::fa_baht_sign } , // baht-sign
+    { 18077, fa::fa_balance_scale } , // balance-scale
+    { 18108, fa::fa_balance_scale_left } , // balance-scale-left
+    { 18149, fa::fa_balance_scale_right } , // balance-scale-right
+    { 2188, fa::fa_ban } , // ban
+    { 2199, fa::fa_ban_smoking } , // ban-smoking
+    { 2231, fa::fa_band_aid } , // band-aid
+    { 2223, fa::fa_bandage } , // bandage
+    { 2240, fa::fa_bangladeshi_taka_sign } , // bangladeshi-taka-sign
+    { 3599, fa::fa_bank } , // bank
+    { 4578, fa::fa_bar_chart } , // bar-chart
+    { 2262, fa::fa_barcode } , // barcode
+    { 2270, fa::fa_bars } , // bars
+    { 2283, fa::fa_bars_progress } , // bars-progress
+    { 2307, fa::fa_bars_staggered } , // bars-staggered
+    { 2337, fa::fa_baseball } , // baseball
+    { 2346, fa::fa_baseball_ball } , // baseball-ball
+    { 2360, fa::fa_baseball_bat_ball } , // baseball-bat-ball
+    { 2378, fa::fa_basket_shopping } , // basket-shopping
+    { 2410, fa::fa_basketball } , // basketball
+    { 2421, fa::fa_basketball_ball } , // basketball-ball
+    { 2437, fa::fa_bath } , // bath
+    { 2442, fa::fa_bathtub } , // bathtub
+    { 2487, fa::fa_battery } , // battery
+    { 2464, fa::fa_battery_0 } , // battery-0
+    { 2544, fa::fa_battery_2 } , // battery-2
+    { 2518, fa::fa_battery_3 } , // battery-3
+    { 2577, fa::fa_battery_4 } , // battery-4
+    { 2495, fa::fa_battery_5 } , // battery-5
+    { 4135, fa::fa_battery_car } , // battery-car
+    { 2450, fa::fa_battery_empty } , // battery-empty
+    { 2474, fa::fa_battery_full } , // battery-full
+    { 2505, fa::fa_battery_half } , // battery-half
+    { 2528, fa::fa_battery_quarter } , // battery-quarter
+    { 2554, fa::fa_battery_three_quarters } , // battery-three-quarters
+    { 2587, fa::fa_bed } , // bed
+    { 2591, fa::fa_bed_pulse } , // bed-pulse
+    { 2627, fa::fa_beer } , // beer
+    { 2612, fa::fa_beer_mug_empty } , // beer-mug-empty
+    { 2632, fa::fa_bell } , // bell
+    { 2637, fa::fa_bell_concierge } , // bell-concierge
+    { 2667, fa::fa_bell_slash } , // bell-slash
+    { 2678, fa::fa_bezier_curve } , // bezier-curve
+    { 2837, fa::fa_bible } , // bible
+    { 2691, fa::fa_bicycle } , // bicycle
+    { 15638, fa::fa_biking } , // biking
+    { 2699, fa::fa_binoculars } , // binoculars
+    { 2710, fa::fa_biohazard } , // biohazard
+    { 3856, fa::fa_birthday_cake } , // birthday-cake
+    { 2720, fa::fa_bitcoin_sign } , // bitcoin-sign
+    { 4452, fa::fa_blackboard } , // blackboard
+    { 2733, fa::fa_blender } , // blender
+    { 2741, fa::fa_blender_phone } , // blender-phone
+    { 16550, fa::fa_blind } , // blind
+    { 2755, fa::fa_blog } , // blog
+    { 2760, fa::fa_bold } , // bold
+    { 2765, fa::fa_bolt } , // bolt
+    { 2774, fa::fa_bolt_lightning } , // bolt-lightning
+    { 2789, fa::fa_bomb } , // bomb
+    { 2794, fa::fa_bone } , // bone
+    { 2799, fa::fa_bong } , // bong
+    { 2804, fa::fa_book } , // book
+    { 2809, fa::fa_book_atlas } , // book-atlas
+    { 2826, fa::fa_book_bible } , // book-bible
+    { 2843, fa::fa_book_bookmark } , // book-bookmark
+    { 2972, fa::fa_book_dead } , // book-dead
+    { 2857, fa::fa_book_journal_whills } , // book-journal-whills
+    { 2892, fa::fa_book_medical } , // book-medical
+    { 2905, fa::fa_book_open } , // book-open
+    { 2915, fa::fa_book_open_reader } , // book-open-reader
+    { 2944, fa::fa_book_quran } , // book-quran
+    { 2932, fa::fa_book_reader } , // book-reader
+    { 2961, fa::fa_book_skull } , // book-skull
+    { 2982, fa::fa_book_tanakh } , // book-tanakh
+    { 3001, fa::fa_bookmark } , // bookmark
+    { 3010, fa::fa_border_all } , // border-all
+    { 3021, fa::fa_border_none } , // border-none
+    { 3049, fa::fa_border_style } , // border-style
+    { 3033, fa::fa_border_top_left } , // border-top-left
+    { 3062, fa::fa_bore_hole } , // bore-hole
+    { 3072, fa::fa_bottle_droplet } , // bottle-droplet
+    { 3087, fa::fa_bottle_water } , // bottle-water
+    { 3100, fa::fa_bowl_food } , // bowl-food
+    { 3110, fa::fa_bowl_rice } , // bowl-rice
+    { 3120, fa::fa_bowling_ball } , // bowling-ball
+    { 3133, fa::fa_box } , // box
+    { 3137, fa::fa_box_archive } , // box-archive
+    { 3157, fa::fa_box_open } , // box-open
+    { 3166, fa::fa_box_tissue } , // box-tissue
+    { 3205, fa::fa_boxes } , // boxes
+    { 3211, fa::fa_boxes_alt } , // boxes-alt
+    { 3177, fa::fa_boxes_packing } , // boxes-packing
+    { 3191, fa::fa_boxes_stacked } , // boxes-stacked
+    { 3221, fa::fa_braille } , // braille
+    { 3229, fa::fa_brain } , // brain
+    { 3235, fa::fa_brazilian_real_sign } , // brazilian-real-sign
+    { 3255, fa::fa_bread_slice } , // bread-slice
+    { 3267, fa::fa_bridge } , // bridge
+    { 3274, fa::fa_bridge_circle_check } , // bridge-circle-check
+    { 3294, fa::fa_bridge_circle_exclamation } , // bridge-circle-exclamation
+    { 3320, fa::fa_bridge_circle_xmark } , // bridge-circle-xmark
+    { 3340, fa::fa_bridge_lock } , // bridge-lock
+    { 3352, fa::fa_bridge_water } , // bridge-water
+    { 3365, fa::fa_briefcase } , // briefcase
+    { 3810, fa::fa_briefcase_clock } , // briefcase-clock
+    { 3375, fa::fa_briefcase_medical } , // briefcase-medical
+    { 21622, fa::fa_broadcast_tower } , // broadcast-tower
+    { 3393, fa::fa_broom } , // broom
+    { 3399, fa::fa_broom_ball } , // broom-ball
+    { 3441, fa::fa_brush } , // brush
+    { 3447, fa::fa_bucket } , // bucket
+    { 3454, fa::fa_bug } , // bug
+    { 3458, fa::fa_bug_slash } , // bug-slash
+    { 3468, fa::fa_bugs } , // bugs
+    { 3473, fa::fa_building } , // building
+    { 3482, fa::fa_building_circle_arrow_right } , // building-circle-arrow-right
+    { 3510, fa::fa_building_circle_check } , // building-circle-check
+    { 3532, fa::fa_building_circle_exclamation } , // building-circle-exclamation
+    { 3560, fa::fa_building_circle_xmark } , // building-circle-xmark
+    { 3582, fa::fa_building_columns } , // building-columns
+    { 3634, fa::fa_building_flag } , // building-flag
+    { 3648, fa::fa_building_lock } , // building-lock
+    { 3662, fa::fa_building_ngo } , // building-ngo
+    { 3675, fa::fa_building_shield } , // building-shield
+    { 3691, fa::fa_building_un } , // building-un
+    { 3703, fa::fa_building_user } , // building-user
+    { 3717, fa::fa_building_wheat } , // building-wheat
+    { 3732, fa::fa_bullhorn } , // bullhorn
+    { 3741, fa::fa_bullseye } , // bullseye
+    { 3750, fa::fa_burger } , // burger
+    { 9647, fa::fa_burn } , // burn
+    { 3767, fa::fa_burst } , // burst
+    { 3773, fa::fa_bus } , // bus
+    { 3788, fa::fa_bus_alt } , // bus-alt
+    { 3777, fa::fa_bus_simple } , // bus-simple
+    { 3796, fa::fa_business_time } , // business-time
+    { 3826, fa::fa_c } , // c
+    { 20714, fa::fa_cab } , // cab
+    { 3828, fa::fa_cable_car } , // cable-car
+    { 3870, fa::fa_cake } , // cake
+    { 3843, fa::fa_cake_candles } , // cake-candles
+    { 3875, fa::fa_calculator } , // calculator
+    { 3886, fa::fa_calendar } , // calendar
+    { 3937, fa::fa_calendar_alt } , // calendar-alt
+    { 3895, fa::fa_calendar_check } , // calendar-check
+    { 3910, fa::fa_calendar_day } , // calendar-day
+    { 3923, fa::fa_calendar_days } , // calendar-days
+    { 3950, fa::fa_calendar_minus } , // calendar-minus
+    { 3965, fa::fa_calendar_plus } , // calendar-plus
+    { 4008, fa::fa_calendar_times } , // calendar-times
+    { 3979, fa::fa_calendar_week } , // calendar-week
+    { 3993, fa::fa_calendar_xmark } , // calendar-xmark
+    { 4023, fa::fa_camera } , // camera
+    { 4030, fa::fa_camera_alt } , // camera-alt
+    { 4041, fa::fa_camera_retro } , // camera-retro
+    { 4054, fa::fa_camera_rotate } , // camera-rotate
+    { 4068, fa::fa_campground } , // campground
+    { 2192, fa::fa_cancel } , // cancel
+    { 4079, fa::fa_candy_cane } , // candy-cane
+    { 4090, fa::fa_cannabis } , // cannabis
+    { 4099, fa::fa_capsules } , // capsules
+    { 4108, fa::fa_car } , // car
+    { 4183, fa::fa_car_alt } , // car-alt
+    { 4123, fa::fa_car_battery } , // car-battery
+    { 4147, fa::fa_car_burst } , // car-burst
+    { 4157, fa::fa_car_crash } , // car-crash
+    { 4167, fa::fa_car_on } , // car-on
+    { 4174, fa::fa_car_rear } , // car-rear
+    { 4191, fa::fa_car_side } , // car-side
+    { 4200, fa::fa_car_tunnel } , // car-tunnel
+    { 4211, fa::fa_caravan } , // caravan
+    { 4219, fa::fa_caret_down } , // caret-down
+    { 4230, fa::fa_caret_left } , // caret-left
+    { 4241, fa::fa_caret_right } , // caret-right
+    { 19273, fa::fa_caret_square_down } , // caret-square-down
+    { 19309, fa::fa_caret_square_left } , // caret-square-left
+    { 19346, fa::fa_caret_square_right } , // caret-square-right
+    { 19381, fa::fa_caret_square_up } , // caret-square-up
+    { 4253, fa::fa_caret_up } , // caret-up
+    { 2035, fa::fa_carriage_baby } , // carriage-baby
+    { 4262, fa::fa_carrot } , // carrot
+    { 4269, fa::fa_cart_arrow_down } , // cart-arrow-down
+    { 4285, fa::fa_cart_flatbed } , // cart-flatbed
+    { 4312, fa::fa_cart_flatbed_suitcase } , // cart-flatbed-suitcase
+    { 4347, fa::fa_cart_plus } , // cart-plus
+    { 4357, fa::fa_cart_shopping } , // cart-shopping
+    { 4385, fa::fa_cash_register } , // cash-register
+    { 4399, fa::fa_cat } , // cat
+    { 4403, fa::fa_cedi_sign } , // cedi-sign
+    { 4413, fa::fa_cent_sign } , // cent-sign
+    { 4423, fa::fa_certificate } , // certificate
+    { 13290, fa::fa_chain } , // chain
+    { 13307, fa::fa_chain_broken } , // chain-broken
+    { 13320, fa::fa_chain_slash } , // chain-slash
+    { 4435, fa::fa_chair } , // chair
+    { 4441, fa::fa_chalkboard } , // chalkboard
+    { 4479, fa::fa_chalkboard_teacher } , // chalkboard-teacher
+    { 4463, fa::fa_chalkboard_user } , // chalkboard-user
+    { 4498, fa::fa_champagne_glasses } , // champagne-glasses
+    { 4529, fa::fa_charging_station } , // charging-station
+    { 4546, fa::fa_chart_area } , // chart-area
+    { 4568, fa::fa_chart_bar } , // chart-bar
+    { 4588, fa::fa_chart_column } , // chart-column
+    { 4601, fa::fa_chart_diagram } , // chart-diagram
+    { 4615, fa::fa_chart_gantt } , // chart-gantt
+    { 4627, fa::fa_chart_line } , // chart-line
+    { 4649, fa::fa_chart_pie } , // chart-pie
+    { 4669, fa::fa_chart_simple } , // chart-simple
+    { 4682, fa::fa_check } , // check
+    { 5110, fa::fa_check_circle } , // check-circle
+    { 4688, fa::fa_check_double } , // check-double
+    { 19410, fa::fa_check_square } , // check-square
+    { 4701, fa::fa_check_to_slot } , // check-to-slot
+    { 4724, fa::fa_cheese } , // cheese
+    { 4731, fa::fa_chess } , // chess
+    { 4737, fa::fa_chess_bishop } , // chess-bishop
+    { 4750, fa::fa_chess_board } , // chess-board
+    { 4762, fa::fa_chess_king } , // chess-king
+    { 4773, fa::fa_chess_knight } , // chess-knight
+    { 4786, fa::fa_chess_pawn } , // chess-pawn
+    { 4797, fa::fa_chess_queen } , // chess-queen
+    { 4809, fa::fa_chess_rook } , // chess-rook
+    { 5143, fa::fa_chevron_circle_down } , // chevron-circle-down
+    { 5183, fa::fa_chevron_circle_left } , // chevron-circle-left
+    { 5224, fa::fa_chevron_circle_right } , // chevron-circle-right
+    { 5263, fa::fa_chevron_circle_up } , // chevron-circle-up
+    { 4820, fa::fa_chevron_down } , // chevron-down
+    { 4833, fa::fa_chevron_left } , // chevron-left
+    { 4846, fa::fa_chevron_right } , // chevron-right
+    { 4860, fa::fa_chevron_up } , // chevron-up
+    { 4871, fa::fa_child } , // child
+    { 4877, fa::fa_child_combatant } , // child-combatant
+    { 4905, fa::fa_child_dress } , // child-dress
+    { 4917, fa::fa_child_reaching } , // child-reaching
+    { 4893, fa::fa_child_rifle } , // child-rifle
+    { 4932, fa::fa_children } , // children
+    { 4941, fa::fa_church } , // church
+    { 4948, fa::fa_circle } , // circle
+    { 4955, fa::fa_circle_arrow_down } , // circle-arrow-down
+    { 4991, fa::fa_circle_arrow_left } , // circle-arrow-left
+    { 5027, fa::fa_circle_arrow_right } , // circle-arrow-right
+    { 5065, fa::fa_circle_arrow_up } , // circle-arrow-up
+    { 5097, fa::fa_circle_check } , // circle-check
+    { 5123, fa::fa_circle_chevron_down } , // circle-chevron-down
+    { 5163, fa::fa_circle_chevron_left } , // circle-chevron-left
+    { 5203, fa::fa_circle_chevron_right } , // circle-chevron-right
+    { 5245, fa::fa_circle_chevron_up } , // circle-chevron-up
+    { 5281, fa::fa_circle_dollar_to_slot } , // circle-dollar-to-slot
+    { 5310, fa::fa_circle_dot } , // circle-dot
+    { 5332, fa::fa_circle_down } , // circle-down
+    { 5366, fa::fa_circle_exclamation } , // circle-exclamation
+    { 5404, fa::fa_circle_h } , // circle-h
+    { 5429, fa::fa_circle_half_stroke } , // circle-half-stroke
+    { 5455, fa::fa_circle_info } , // circle-info
+    { 5479, fa::fa_circle_left } , // circle-left
+    { 5513, fa::fa_circle_minus } , // circle-minus
+    { 5539, fa::fa_circle_nodes } , // circle-nodes
+    { 5552, fa::fa_circle_notch } , // circle-notch
+    { 5565, fa::fa_circle_pause } , // circle-pause
+    { 5591, fa::fa_circle_play } , // circle-play
+    { 5615, fa::fa_circle_plus } , // circle-plus
+    { 5639, fa::fa_circle_question } , // circle-question
+    { 5671, fa::fa_circle_radiation } , // circle-radiation
+    { 5702, fa::fa_circle_right } , // circle-right
+    { 5738, fa::fa_circle_stop } , // circle-stop
+    { 5762, fa::fa_circle_up } , // circle-up
+    { 5792, fa::fa_circle_user } , // circle-user
+    { 5816, fa::fa_circle_xmark } , // circle-xmark
+    { 5855, fa::fa_city } , // city
+    { 5860, fa::fa_clapperboard } , // clapperboard
+    { 12176, fa::fa_clinic_medical } , // clinic-medical
+    { 5873, fa::fa_clipboard } , // clipboard
+    { 5883, fa::fa_clipboard_check } , // clipboard-check
+    { 5899, fa::fa_clipboard_list } , // clipboard-list
+    { 5914, fa::fa_clipboard_question } , // clipboard-question
+    { 5933, fa::fa_clipboard_user } , // clipboard-user
+    { 5948, fa::fa_clock } , // clock
+    { 5954, fa::fa_clock_four } , // clock-four
+    { 5965, fa::fa_clock_rotate_left } , // clock-rotate-left
+    { 5991, fa::fa_clone } , // clone
+    { 23866, fa::fa_close } , // close
+    { 5997, fa::fa_closed_captioning } , // closed-captioning
+    { 6015, fa::fa_cloud } , // cloud
+    { 6021, fa::fa_cloud_arrow_down } , // cloud-arrow-down
+    { 6072, fa::fa_cloud_arrow_up } , // cloud-arrow-up
+    { 6117, fa::fa_cloud_bolt } , // cloud-bolt
+    { 6038, fa::fa_cloud_download } , // cloud-download
+    { 6053, fa::fa_cloud_download_alt } , // cloud-download-alt
+    { 6141, fa::fa_cloud_meatball } , // cloud-meatball
+    { 6156, fa::fa_cloud_moon } , // cloud-moon
+    { 6167, fa::fa_cloud_moon_rain } , // cloud-moon-rain
+    { 6183, fa::fa_cloud_rain } , // cloud-rain
+    { 6194, fa::fa_cloud_showers_heavy } , // cloud-showers-heavy
+    { 6214, fa::fa_cloud_showers_water } , // cloud-showers-water
+    { 6234, fa::fa_cloud_sun } , // cloud-sun
+    { 6244, fa::fa_cloud_sun_rain } , // cloud-sun-rain
+    { 6087, fa::fa_cloud_upload } , // cloud-upload
+    { 6100, fa::fa_cloud_upload_alt } , // cloud-upload-alt
+    { 6259, fa::fa_clover } , // clover
+    { 23918, fa::fa_cny } , // cny
+    { 14100, fa::fa_cocktail } , // cocktail
+    { 6266, fa::fa_code } , // code
+    { 6271, fa::fa_code_branch } , // code-branch
+    { 6283, fa::fa_code_commit } , // code-commit
+    { 6295, fa::fa_code_compare } , // code-compare
+    { 6308, fa::fa_code_fork } , // code-fork
+    { 6318, fa::fa_code_merge } , // code-merge
+    { 6329, fa::fa_code_pull_request } , // code-pull-request
+    { 14952, fa::fa_coffee } , // coffee
+    { 10185, fa::fa_cog } , // cog
+    { 10195, fa::fa_cogs } , // cogs
+    { 6347, fa::fa_coins } , // coins
+    { 6353, fa::fa_colon_sign } , // colon-sign
+    { 20476, fa::fa_columns } , // columns
+    { 6364, fa::fa_comment } , // comment
+    { 14282, fa::fa_comment_alt } , // comment-alt
+    { 6372, fa::fa_comment_dollar } , // comment-dollar
+    { 6387, fa::fa_comment_dots } , // comment-dots
+    { 6411, fa::fa_comment_medical } , // comment-medical
+    { 6427, fa::fa_comment_nodes } , // comment-nodes
+    { 6441, fa::fa_comment_slash } , // comment-slash
+    { 6455, fa::fa_comment_sms } , // comment-sms
+    { 6400, fa::fa_commenting } , // commenting
+    { 6471, fa::fa_comments } , // comments
+    { 6480, fa::fa_comments_dollar } , // comments-dollar
+    { 6496, fa::fa_compact_disc } , // compact-disc
+    { 6509, fa::fa_compass } , // compass
+    { 6517, fa::fa_compass_drafting } , // compass-drafting
+    { 6551, fa::fa_compress } , // compress
+    { 7178, fa::fa_compress_alt } , // compress-alt
+    { 14445, fa::fa_compress_arrows_alt } , // compress-arrows-alt
+    { 6560, fa::fa_computer } , // computer
+    { 6569, fa::fa_computer_mouse } , // computer-mouse
+    { 2652, fa::fa_concierge_bell } , // concierge-bell
+    { 35, fa::fa_contact_book } , // contact-book
+    { 61, fa::fa_contact_card } , // contact-card
+    { 6590, fa::fa_cookie } , // cookie
+    { 6597, fa::fa_cookie_bite } , // cookie-bite
+    { 6609, fa::fa_copy } , // copy
+    { 6614, fa::fa_copyright } , // copyright
+    { 6624, fa::fa_couch } , // couch
+    { 6630, fa::fa_cow } , // cow
+    { 6634, fa::fa_credit_card } , // credit-card
+    { 6646, fa::fa_credit_card_alt } , // credit-card-alt
+    { 6662, fa::fa_crop } , // crop
+    { 6679, fa::fa_crop_alt } , // crop-alt
+    { 6667, fa::fa_crop_simple } , // crop-simple
+    { 6688, fa::fa_cross } , // cross
+    { 6694, fa::fa_crosshairs } , // crosshairs
+    { 6705, fa::fa_crow } , // crow
+    { 6710, fa::fa_crown } , // crown
+    { 6716, fa::fa_crutch } , // crutch
+    { 6723, fa::fa_cruzeiro_sign } , // cruzeiro-sign
+    { 6737, fa::fa_cube } , // cube
+    { 6742, fa::fa_cubes } , // cubes
+    { 6748, fa::fa_cubes_stacked } , // cubes-stacked
+    { 18275, fa::fa_cut } , // cut
+    { 22988, fa::fa_cutlery } , // cutlery
+    { 6762, fa::fa_d } , // d
+    { 9985, fa::fa_dashboard } , // dashboard
+    { 6764, fa::fa_database } , // database
+    { 7373, fa::fa_deaf } , // deaf
+    { 7378, fa::fa_deafness } , // deafness
+    { 15128, fa::fa_dedent } , // dedent
+    { 6773, fa::fa_delete_left } , // delete-left
+    { 6795, fa::fa_democrat } , // democrat
+    { 6804, fa::fa_desktop } , // desktop
+    { 6812, fa::fa_desktop_alt } , // desktop-alt
+    { 6824, fa::fa_dharmachakra } , // dharmachakra
+    { 15895, fa::fa_diagnoses } , // diagnoses
+    { 6837, fa::fa_diagram_next } , // diagram-next
+    { 6850, fa::fa_diagram_predecessor } , // diagram-predecessor
+    { 6870, fa::fa_diagram_project } , // diagram-project
+    { 6902, fa::fa_diagram_successor } , // diagram-successor
+    { 6920, fa::fa_diamond } , // diamond
+    { 6928, fa::fa_diamond_turn_right } , // diamond-turn-right
+    { 6958, fa::fa_dice } , // dice
+    { 6963, fa::fa_dice_d20 } , // dice-d20
+    { 6972, fa::fa_dice_d6 } , // dice-d6
+    { 6980, fa::fa_dice_five } , // dice-five
+    { 6990, fa::fa_dice_four } , // dice-four
+    { 7000, fa::fa_dice_one } , // dice-one
+    { 7009, fa::fa_dice_six } , // dice-six
+    { 7018, fa::fa_dice_three } , // dice-three
+    { 7029, fa::fa_dice_two } , // dice-two
+    { 15865, fa::fa_digging } , // digging
+    { 20658, fa::fa_digital_tachograph } , // digital-tachograph
+    { 6947, fa::fa_directions } , // directions
+    { 7038, fa::fa_disease } , // disease
+    { 7046, fa::fa_display } , // display
+    { 7054, fa::fa_divide } , // divide
+    { 7933, fa::fa_dizzy } , // dizzy
+    { 7061, fa::fa_dna } , // dna
+    { 7065, fa::fa_dog } , // dog
+    { 7081, fa::fa_dollar } , // dollar
+    { 7069, fa::fa_dollar_sign } , // dollar-sign
+    { 7092, fa::fa_dolly } , // dolly
+    { 7098, fa::fa_dolly_box } , // dolly-box
+    { 4298, fa::fa_dolly_flatbed } , // dolly-flatbed
+    { 5303, fa::fa_donate } , // donate
+    { 7108, fa::fa_dong_sign } , // dong-sign
+    { 7118, fa::fa_door_closed } , // door-closed
+    { 7130, fa::fa_door_open } , // door-open
+    { 5321, fa::fa_dot_circle } , // dot-circle
+    { 7140, fa::fa_dove } , // dove
+    { 7145, fa::fa_down_left_and_up_right_to_center } , // down-left-and-up-right-to-center
+    { 7191, fa::fa_down_long } , // down-long
+    { 7221, fa::fa_download } , // download
+    { 6534, fa::fa_drafting_compass } , // drafting-compass
+    { 7230, fa::fa_dragon } , // dragon
+    { 7237, fa::fa_draw_polygon } , // draw-polygon
+    { 12695, fa::fa_drivers_license } , // drivers-license
+    { 7250, fa::fa_droplet } , // droplet
+    { 7263, fa::fa_droplet_slash } , // droplet-slash
+    { 7288, fa::fa_drum } , // drum
+    { 7293, fa::fa_drum_steelpan } , // drum-steelpan
+    { 7307, fa::fa_drumstick_bite } , // drumstick-bite
+    { 7322, fa::fa_dumbbell } , // dumbbell
+    { 7331, fa::fa_dumpster } , // dumpster
+    { 7340, fa::fa_dumpster_fire } , // dumpster-fire
+    { 7354, fa::fa_dungeon } , // dungeon
+    { 7362, fa::fa_e } , // e
+    { 7364, fa::fa_ear_deaf } , // ear-deaf
+    { 7403, fa::fa_ear_listen } , // ear-listen
+    { 7483, fa::fa_earth } , // earth
+    { 7442, fa::fa_earth_africa } , // earth-africa
+    { 7489, fa::fa_earth_america } , // earth-america
+    { 7468, fa::fa_earth_americas } , // earth-americas
+    { 7518, fa::fa_earth_asia } , // earth-asia
+    { 7540, fa::fa_earth_europe } , // earth-europe
+    { 7566, fa::fa_earth_oceania } , // earth-oceania
+    { 15371, fa::fa_edit } , // edit
+    { 7594, fa::fa_egg } , // egg
+    { 7598, fa::fa_eject } , // eject
+    { 7604, fa::fa_elevator } , // elevator
+    { 7613, fa::fa_ellipsis } , // ellipsis
+    { 7622, fa::fa_ellipsis_h } , // ellipsis-h
+    { 7651, fa::fa_ellipsis_v } , // ellipsis-v
+    { 7633, fa::fa_ellipsis_vertical } , // ellipsis-vertical
+    { 7662, fa::fa_envelope } , // envelope
+    { 7671, fa::fa_envelope_circle_check } , // envelope-circle-check
+    { 7693, fa::fa_envelope_open } , // envelope-open
+    { 7707, fa::fa_envelope_open_text } , // envelope-open-text
+    { 19439, fa::fa_envelope_square } , // envelope-square
+    { 7726, fa::fa_envelopes_bulk } , // envelopes-bulk
+    { 7751, fa::fa_equals } , // equals
+    { 7758, fa::fa_eraser } , // eraser
+    { 7765, fa::fa_ethernet } , // ethernet
+    { 7784, fa::fa_eur } , // eur
+    { 7788, fa::fa_euro } , // euro
+    { 7774, fa::fa_euro_sign } , // euro-sign
+    { 922, fa::fa_exchange } , // exchange
+    { 17568, fa::fa_exchange_alt } , // exchange-alt
+    { 7793, fa::fa_exclamation } , // exclamation
+    { 5385, fa::fa_exclamation_circle } , // exclamation-circle
+    { 21900, fa::fa_exclamation_triangle } , // exclamation-triangle
+    { 7805, fa::fa_expand } , // expand
+    { 22477, fa::fa_expand_alt } , // expand-alt
+    { 14227, fa::fa_expand_arrows_alt } , // expand-arrows-alt
+    { 7812, fa::fa_explosion } , // explosion
+    { 1524, fa::fa_external_link } , // external-link
+    { 22509, fa::fa_external_link_alt } , // external-link-alt
+    { 19220, fa::fa_external_link_square } , // external-link-square
+    { 19856, fa::fa_external_link_square_alt } , // external-link-square-alt
+    { 7822, fa::fa_eye } , // eye
+    { 7826, fa::fa_eye_dropper } , // eye-dropper
+    { 7838, fa::fa_eye_dropper_empty } , // eye-dropper-empty
+    { 7867, fa::fa_eye_low_vision } , // eye-low-vision
+    { 7893, fa::fa_eye_slash } , // eye-slash
+    { 7856, fa::fa_eyedropper } , // eyedropper
+    { 7903, fa::fa_f } , // f
+    { 7905, fa::fa_face_angry } , // face-angry
+    { 7922, fa::fa_face_dizzy } , // face-dizzy
+    { 7939, fa::fa_face_flushed } , // face-flushed
+    { 7960, fa::fa_face_frown } , // face-frown
+    { 7977, fa::fa_face_frown_open } , // face-frown-open
+    { 8004, fa::fa_face_grimace } , // face-grimace
+    { 8025, fa::fa_face_grin } , // face-grin
+    { 8040, fa::fa_face_grin_beam } , // face-grin-beam
+    { 8065, fa::fa_face_grin_beam_sweat } , // face-grin-beam-sweat
+    { 8102, fa::fa_face_grin_hearts } , // face-grin-hearts
+    { 8131, fa::fa_face_grin_squint } , // face-grin-squint
+    { 8160, fa::fa_face_grin_squint_tears } , // face-grin-squint-tears
+    { 8201, fa::fa_face_grin_stars } , // face-grin-stars
+    { 8228, fa::fa_face_grin_tears } , // face-grin-tears
+    { 8255, fa::fa_face_grin_tongue } , // face-grin-tongue
+    { 8284, fa::fa_face_grin_tongue_squint } , // face-grin-tongue-squint
+    { 8327, fa::fa_face_grin_tongue_wink } , // face-grin-tongue-wink
+    { 8366, fa::fa_face_grin_wide } , // face-grin-wide
+    { 8390, fa::fa_face_grin_wink } , // face-grin-wink
+    { 8415, fa::fa_face_kiss } , // face-kiss
+    { 8430, fa::fa_face_kiss_beam } , // face-kiss-beam
+    { 8455, fa::fa_face_kiss_wink_heart } , // face-kiss-wink-heart
+    { 8492, fa::fa_face_laugh } , // face-laugh
+    { 8509, fa::fa_face_laugh_beam } , // face-laugh-beam
+    { 8536, fa::fa_face_laugh_squint } , // face-laugh-squint
+    { 8567, fa::fa_face_laugh_wink } , // face-laugh-wink
+    { 8594, fa::fa_face_meh } , // face-meh
+    { 8607, fa::fa_face_meh_blank } , // face-meh-blank
+    { 8632, fa::fa_face_rolling_eyes } , // face-rolling-eyes
+    { 8667, fa::fa_face_sad_cry } , // face-sad-cry
+    { 8688, fa::fa_face_sad_tear } , // face-sad-tear
+    { 8711, fa::fa_face_smile } , // face-smile
+    { 8728, fa::fa_face_smile_beam } , // face-smile-beam
+    { 8755, fa::fa_face_smile_wink } , // face-smile-wink
+    { 8782, fa::fa_face_surprise } , // face-surprise
+    { 8805, fa::fa_face_tired } , // face-tired
+    { 8822, fa::fa_fan } , // fan
+    { 2072, fa::fa_fast_backward } , // fast-backward
+    { 9874, fa::fa_fast_forward } , // fast-forward
+    { 8826, fa::fa_faucet } , // faucet
+    { 8833, fa::fa_faucet_drip } , // faucet-drip
+    { 8845, fa::fa_fax } , // fax
+    { 8849, fa::fa_feather } , // feather
+    { 8873, fa::fa_feather_alt } , // feather-alt
+    { 8857, fa::fa_feather_pointed } , // feather-pointed
+    { 17884, fa::fa_feed } , // feed
+    { 15918, fa::fa_female } , // female
+    { 8885, fa::fa_ferry } , // ferry
+    { 12890, fa::fa_fighter_jet } , // fighter-jet
+    { 8891, fa::fa_file } , // file
+    { 9275, fa::fa_file_alt } , // file-alt
+    { 9460, fa::fa_file_archive } , // file-archive
+    { 8896, fa::fa_file_arrow_down } , // file-arrow-down
+    { 8926, fa::fa_file_arrow_up } , // file-arrow-up
+    { 8952, fa::fa_file_audio } , // file-audio
+    { 8963, fa::fa_file_circle_check } , // file-circle-check
+    { 8981, fa::fa_file_circle_exclamation } , // file-circle-exclamation
+    { 9005, fa::fa_file_circle_minus } , // file-circle-minus
+    { 9023, fa::fa_file_circle_plus } , // file-circle-plus
+    { 9040, fa::fa_file_circle_question } , // file-circle-question
+    { 9061, fa::fa_file_circle_xmark } , // file-circle-xmark
+    { 15264, fa::fa_file_clipboard } , // file-clipboard
+    { 9079, fa::fa_file_code } , // file-code
+    { 9089, fa::fa_file_contract } , // file-contract
+    { 9103, fa::fa_file_csv } , // file-csv
+    { 8912, fa::fa_file_download } , // file-download
+    { 9325, fa::fa_file_edit } , // file-edit
+    { 9112, fa::fa_file_excel } , // file-excel
+    { 9123, fa::fa_file_export } , // file-export
+    { 9157, fa::fa_file_fragment } , // file-fragment
+    { 9171, fa::fa_file_half_dashed } , // file-half-dashed
+    { 9188, fa::fa_file_image } , // file-image
+    { 9199, fa::fa_file_import } , // file-import
+    { 9231, fa::fa_file_invoice } , // file-invoice
+    { 9244, fa::fa_file_invoice_dollar } , // file-invoice-dollar
+    { 9264, fa::fa_file_lines } , // file-lines
+    { 9294, fa::fa_file_medical } , // file-medical
+    { 9421, fa::fa_file_medical_alt } , // file-medical-alt
+    { 9307, fa::fa_file_pdf } , // file-pdf
+    { 9316, fa::fa_file_pen } , // file-pen
+    { 9335, fa::fa_file_powerpoint } , // file-powerpoint
+    { 9351, fa::fa_file_prescription } , // file-prescription
+    { 9369, fa::fa_file_shield } , // file-shield
+    { 9381, fa::fa_file_signature } , // file-signature
+    { 9284, fa::fa_file_text } , // file-text
+    { 8940, fa::fa_file_upload } , // file-upload
+    { 9396, fa::fa_file_video } , // file-video
+    { 9407, fa::fa_file_waveform } , // file-waveform
+    { 9438, fa::fa_file_word } , // file-word
+    { 9448, fa::fa_file_zipper } , // file-zipper
+    { 9473, fa::fa_fill } , // fill
+    { 9478, fa::fa_fill_drip } , // fill-drip
+    { 9488, fa::fa_film } , // film
+    { 9493, fa::fa_filter } , // filter
+    { 9500, fa::fa_filter_circle_dollar } , // filter-circle-dollar
+    { 9535, fa::fa_filter_circle_xmark } , // filter-circle-xmark
+    { 9555, fa::fa_fingerprint } , // fingerprint
+    { 9567, fa::fa_fire } , // fire
+    { 9620, fa::fa_fire_alt } , // fire-alt
+    { 9572, fa::fa_fire_burner } , // fire-burner
+    { 9584, fa::fa_fire_extinguisher } , // fire-extinguisher
+    { 9602, fa::fa_fire_flame_curved } , // fire-flame-curved
+    { 9629, fa::fa_fire_flame_simple } , // fire-flame-simple
+    { 12986, fa::fa_first_aid } , // first-aid
+    { 9652, fa::fa_fish } , // fish
+    { 9657, fa::fa_fish_fins } , // fish-fins
+    { 10566, fa::fa_fist_raised } , // fist-raised
+    { 9667, fa::fa_flag } , // flag
+    { 9672, fa::fa_flag_checkered } , // flag-checkered
+    { 9687, fa::fa_flag_usa } , // flag-usa
+    { 9696, fa::fa_flask } , // flask
+    { 9702, fa::fa_flask_vial } , // flask-vial
+    { 9713, fa::fa_floppy_disk } , // floppy-disk
+    { 9730, fa::fa_florin_sign } , // florin-sign
+    { 7952, fa::fa_flushed } , // flushed
+    { 9742, fa::fa_folder } , // folder
+    { 9749, fa::fa_folder_blank } , // folder-blank
+    { 9762, fa::fa_folder_closed } , // folder-closed
+    { 9776, fa::fa_folder_minus } , // folder-minus
+    { 9789, fa::fa_folder_open } , // folder-open
+    { 9801, fa::fa_folder_plus } , // folder-plus
+    { 9813, fa::fa_folder_tree } , // folder-tree
+    { 9825, fa::fa_font } , // font
+    { 9830, fa::fa_football } , // football
+    { 9839, fa::fa_football_ball } , // football-ball
+    { 9853, fa::fa_forward } , // forward
+    { 9861, fa::fa_forward_fast } , // forward-fast
+    { 9887, fa::fa_forward_step } , // forward-step
+    { 9913, fa::fa_franc_sign } , // franc-sign
+    { 9924, fa::fa_frog } , // frog
+    { 7971, fa::fa_frown } , // frown
+    { 7993, fa::fa_frown_open } , // frown-open
+    { 9521, fa::fa_funnel_dollar } , // funnel-dollar
+    { 9929, fa::fa_futbol } , // futbol
+    { 9936, fa::fa_futbol_ball } , // futbol-ball
+    { 9960, fa::fa_g } , // g
+    { 9962, fa::fa_gamepad } , // gamepad
+    { 9970, fa::fa_gas_pump } , // gas-pump
+    { 9979, fa::fa_gauge } , // gauge
+    { 10028, fa::fa_gauge_high } , // gauge-high
+    { 9995, fa::fa_gauge_med } , // gauge-med
+    { 10074, fa::fa_gauge_simple } , // gauge-simple
+    { 10123, fa::fa_gauge_simple_high } , // gauge-simple-high
+    { 10087, fa::fa_gauge_simple_med } , // gauge-simple-med
+    { 10168, fa::fa_gavel } , // gavel
+    { 20113, fa::fa_gbp } , // gbp
+    { 10180, fa::fa_gear } , // gear
+    { 10189, fa::fa_gears } , // gears
+    { 10200, fa::fa_gem } , // gem
+    { 10204, fa::fa_genderless } , // genderless
+    { 10215, fa::fa_ghost } , // ghost
+    { 10221, fa::fa_gift } , // gift
+    { 10226, fa::fa_gifts } , // gifts
+    { 4516, fa::fa_glass_cheers } , // glass-cheers
+    { 14129, fa::fa_glass_martini } , // glass-martini
+    { 14061, fa::fa_glass_martini_alt } , // glass-martini-alt
+    { 10232, fa::fa_glass_water } , // glass-water
+    { 10244, fa::fa_glass_water_droplet } , // glass-water-droplet
+    { 23678, fa::fa_glass_whiskey } , // glass-whiskey
+    { 10264, fa::fa_glasses } , // glasses
+    { 10272, fa::fa_globe } , // globe
+    { 7455, fa::fa_globe_africa } , // globe-africa
+    { 7503, fa::fa_globe_americas } , // globe-americas
+    { 7529, fa::fa_globe_asia } , // globe-asia
+    { 7553, fa::fa_globe_europe } , // globe-europe
+    { 7580, fa::fa_globe_oceania } , // globe-oceania
+    { 10292, fa::fa_golf_ball } , // golf-ball
+    { 10278, fa::fa_golf_ball_tee } , // golf-ball-tee
+    { 10302, fa::fa_gopuram } , // gopuram
+    { 10310, fa::fa_graduation_cap } , // graduation-cap
+    { 10338, fa::fa_greater_than } , // greater-than
+    { 10351, fa::fa_greater_than_equal } , // greater-than-equal
+    { 8017, fa::fa_grimace } , // grimace
+    { 8035, fa::fa_grin } , // grin
+    { 8381, fa::fa_grin_alt } , // grin-alt
+    { 8055, fa::fa_grin_beam } , // grin-beam
+    { 8086, fa::fa_grin_beam_sweat } , // grin-beam-sweat
+    { 8119, fa::fa_grin_hearts } , // grin-hearts
+    { 8148, fa::fa_grin_squint } , // grin-squint
+    { 8183, fa::fa_grin_squint_tears } , // grin-squint-tears
+    { 8217, fa::fa_grin_stars } , // grin-stars
+    { 8244, fa::fa_grin_tears } , // grin-tears
+    { 8272, fa::fa_grin_tongue } , // grin-tongue
+    { 8308, fa::fa_grin_tongue_squint } , // grin-tongue-squint
+    { 8349, fa::fa_grin_tongue_wink } , // grin-tongue-wink
+    { 8405, fa::fa_grin_wink } , // grin-wink
+    { 10370, fa::fa_grip } , // grip
+    { 10375, fa::fa_grip_horizontal } , // grip-horizontal
+    { 10391, fa::fa_grip_lines } , // grip-lines
+    { 10402, fa::fa_grip_lines_vertical } , // grip-lines-vertical
+    { 10422, fa::fa_grip_vertical } , // grip-vertical
+    { 10436, fa::fa_group_arrows_rotate } , // group-arrows-rotate
+    { 10456, fa::fa_guarani_sign } , // guarani-sign
+    { 10469, fa::fa_guitar } , // guitar
+    { 10476, fa::fa_gun } , // gun
+    { 10480, fa::fa_h } , // h
+    { 19476, fa::fa_h_square } , // h-square
+    { 3757, fa::fa_hamburger } , // hamburger
+    { 10482, fa::fa_hammer } , // hammer
+    { 10489, fa::fa_hamsa } , // hamsa
+    { 10495, fa::fa_hand } , // hand
+    { 10511, fa::fa_hand_back_fist } , // hand-back-fist
+    { 10536, fa::fa_hand_dots } , // hand-dots
+    { 10556, fa::fa_hand_fist } , // hand-fist
+    { 10578, fa::fa_hand_holding } , // hand-holding
+    { 10591, fa::fa_hand_holding_dollar } , // hand-holding-dollar
+    { 10628, fa::fa_hand_holding_droplet } , // hand-holding-droplet
+    { 10668, fa::fa_hand_holding_hand } , // hand-holding-hand
+    { 10686, fa::fa_hand_holding_heart } , // hand-holding-heart
+    { 10705, fa::fa_hand_holding_medical } , // hand-holding-medical
+    { 10611, fa::fa_hand_holding_usd } , // hand-holding-usd
+    { 10649, fa::fa_hand_holding_water } , // hand-holding-water
+    { 10726, fa::fa_hand_lizard } , // hand-lizard
+    { 10738, fa::fa_hand_middle_finger } , // hand-middle-finger
+    { 10500, fa::fa_hand_paper } , // hand-paper
+    { 10757, fa::fa_hand_peace } , // hand-peace
+    { 10768, fa::fa_hand_point_down } , // hand-point-down
+    { 10784, fa::fa_hand_point_left } , // hand-point-left
+    { 10800, fa::fa_hand_point_right } , // hand-point-right
+    { 10817, fa::fa_hand_point_up } , // hand-point-up
+    { 10831, fa::fa_hand_pointer } , // hand-pointer
+    { 10526, fa::fa_hand_rock } , // hand-rock
+    { 10844, fa::fa_hand_scissors } , // hand-scissors
+    { 10858, fa::fa_hand_sparkles } , // hand-sparkles
+    { 10872, fa::fa_hand_spock } , // hand-spock
+    { 10883, fa::fa_handcuffs } , // handcuffs
+    { 10893, fa::fa_hands } , // hands
+    { 10997, fa::fa_hands_american_sign_language_interpreting } , // hands-american-sign-language-interpreting
+    { 10921, fa::fa_hands_asl_interpreting } , // hands-asl-interpreting
+    { 11039, fa::fa_hands_bound } , // hands-bound
+    { 11051, fa::fa_hands_bubbles } , // hands-bubbles
+    { 11076, fa::fa_hands_clapping } , // hands-clapping
+    { 11200, fa::fa_hands_helping } , // hands-helping
+    { 11091, fa::fa_hands_holding } , // hands-holding
+    { 11105, fa::fa_hands_holding_child } , // hands-holding-child
+    { 11125, fa::fa_hands_holding_circle } , // hands-holding-circle
+    { 11146, fa::fa_hands_praying } , // hands-praying
+    { 11065, fa::fa_hands_wash } , // hands-wash
+    { 11174, fa::fa_handshake } , // handshake
+    { 11231, fa::fa_handshake_alt } , // handshake-alt
+    { 11268, fa::fa_handshake_alt_slash } , // handshake-alt-slash
+    { 11184, fa::fa_handshake_angle } , // handshake-angle
+    { 11214, fa::fa_handshake_simple } , // handshake-simple
+    { 11245, fa::fa_handshake_simple_slash } , // handshake-simple-slash
+    { 11288, fa::fa_handshake_slash } , // handshake-slash
+    { 11304, fa::fa_hanukiah } , // hanukiah
+    { 11313, fa::fa_hard_drive } , // hard-drive
+    { 11724, fa::fa_hard_hat } , // hard-hat
+    { 7387, fa::fa_hard_of_hearing } , // hard-of-hearing
+    { 11328, fa::fa_hashtag } , // hashtag
+    { 11336, fa::fa_hat_cowboy } , // hat-cowboy
+    { 11347, fa::fa_hat_cowboy_side } , // hat-cowboy-side
+    { 11733, fa::fa_hat_hard } , // hat-hard
+    { 11363, fa::fa_hat_wizard } , // hat-wizard
+    { 2171, fa::fa_haykal } , // haykal
+    { 11324, fa::fa_hdd } , // hdd
+    { 11374, fa::fa_head_side_cough } , // head-side-cough
+    { 11390, fa::fa_head_side_cough_slash } , // head-side-cough-slash
+    { 11412, fa::fa_head_side_mask } , // head-side-mask
+    { 11427, fa::fa_head_side_virus } , // head-side-virus
+    { 11451, fa::fa_header } , // header
+    { 11443, fa::fa_heading } , // heading
+    { 11458, fa::fa_headphones } , // headphones
+    { 11487, fa::fa_headphones_alt } , // headphones-alt
+    { 11469, fa::fa_headphones_simple } , // headphones-simple
+    { 11502, fa::fa_headset } , // headset
+    { 11510, fa::fa_heart } , // heart
+    { 11646, fa::fa_heart_broken } , // heart-broken
+    { 11516, fa::fa_heart_circle_bolt } , // heart-circle-bolt
+    { 11534, fa::fa_heart_circle_check } , // heart-circle-check
+    { 11553, fa::fa_heart_circle_exclamation } , // heart-circle-exclamation
+    { 11578, fa::fa_heart_circle_minus } , // heart-circle-minus
+    { 11597, fa::fa_heart_circle_plus } , // heart-circle-plus
+    { 11615, fa::fa_heart_circle_xmark } , // heart-circle-xmark
+    { 11634, fa::fa_heart_crack } , // heart-crack
+    { 12654, fa::fa_heart_music_camera_bolt } , // heart-music-camera-bolt
+    { 11659, fa::fa_heart_pulse } , // heart-pulse
+    { 11671, fa::fa_heartbeat } , // heartbeat
+    { 11681, fa::fa_helicopter } , // helicopter
+    { 11692, fa::fa_helicopter_symbol } , // helicopter-symbol
+    { 11710, fa::fa_helmet_safety } , // helmet-safety
+    { 11742, fa::fa_helmet_un } , // helmet-un
+    { 11752, fa::fa_hexagon_nodes } , // hexagon-nodes
+    { 11766, fa::fa_hexagon_nodes_bolt } , // hexagon-nodes-bolt
+    { 11785, fa::fa_highlighter } , // highlighter
+    { 16045, fa::fa_hiking } , // hiking
+    { 11797, fa::fa_hill_avalanche } , // hill-avalanche
+    { 11812, fa::fa_hill_rockslide } , // hill-rockslide
+    { 11827, fa::fa_hippo } , // hippo
+    { 5983, fa::fa_history } , // history
+    { 11833, fa::fa_hockey_puck } , // hockey-puck
+    { 11845, fa::fa_holly_berry } , // holly-berry
+    { 12073, fa::fa_home } , // home
+    { 12078, fa::fa_home_alt } , // home-alt
+    { 12113, fa::fa_home_lg } , // home-lg
+    { 12087, fa::fa_home_lg_alt } , // home-lg-alt
+    { 12578, fa::fa_home_user } , // home-user
+    { 11857, fa::fa_horse } , // horse
+    { 11863, fa::fa_horse_head } , // horse-head
+    { 11874, fa::fa_hospital } , // hospital
+    { 11883, fa::fa_hospital_alt } , // hospital-alt
+    { 5413, fa::fa_hospital_symbol } , // hospital-symbol
+    { 11910, fa::fa_hospital_user } , // hospital-user
+    { 11896, fa::fa_hospital_wide } , // hospital-wide
+    { 11939, fa::fa_hot_tub } , // hot-tub
+    { 11924, fa::fa_hot_tub_person } , // hot-tub-person
+    { 11947, fa::fa_hotdog } , // hotdog
+    { 11954, fa::fa_hotel } , // hotel
+    { 11960, fa::fa_hourglass } , // hourglass
+    { 12055, fa::fa_hourglass_1 } , // hourglass-1
+    { 12027, fa::fa_hourglass_2 } , // hourglass-2
+    { 12000, fa::fa_hourglass_3 } , // hourglass-3
+    { 11970, fa::fa_hourglass_empty } , // hourglass-empty
+    { 11986, fa::fa_hourglass_end } , // hourglass-end
+    { 12012, fa::fa_hourglass_half } , // hourglass-half
+    { 12039, fa::fa_hourglass_start } , // hourglass-start
+    { 12067, fa::fa_house } , // house
+    { 12099, fa::fa_house_chimney } , // house-chimney
+    { 12121, fa::fa_house_chimney_crack } , // house-chimney-crack
+    { 12154, fa::fa_house_chimney_medical } , // house-chimney-medical
+    { 12191, fa::fa_house_chimney_user } , // house-chimney-user
+    { 12210, fa::fa_house_chimney_window } , // house-chimney-window
+    { 12231, fa::fa_house_circle_check } , // house-circle-check
+    { 12250, fa::fa_house_circle_exclamation } , // house-circle-exclamation
+    { 12275, fa::fa_house_circle_xmark } , // house-circle-xmark
+    { 12294, fa::fa_house_crack } , // house-crack
+    { 12141, fa::fa_house_damage } , // house-damage
+    { 12306, fa::fa_house_fire } , // house-fire
+    { 12317, fa::fa_house_flag } , // house-flag
+    { 12328, fa::fa_house_flood_water } , // house-flood-water
+    { 12346, fa::fa_house_flood_water_circle_arrow_right } , // house-flood-water-circle-arrow-right
+    { 12383, fa::fa_house_laptop } , // house-laptop
+    { 12409, fa::fa_house_lock } , // house-lock
+    { 12420, fa::fa_house_medical } , // house-medical
+    { 12434, fa::fa_house_medical_circle_check } , // house-medical-circle-check
+    { 12461, fa::fa_house_medical_circle_exclamation } , // house-medical-circle-exclamation
+    { 12494, fa::fa_house_medical_circle_xmark } , // house-medical-circle-xmark
+    { 12521, fa::fa_house_medical_flag } , // house-medical-flag
+    { 12540, fa::fa_house_signal } , // house-signal
+    { 12553, fa::fa_house_tsunami } , // house-tsunami
+    { 12567, fa::fa_house_user } , // house-user
+    { 12601, fa::fa_hryvnia } , // hryvnia
+    { 12588, fa::fa_hryvnia_sign } , // hryvnia-sign
+    { 12609, fa::fa_hurricane } , // hurricane
+    { 12619, fa::fa_i } , // i
+    { 12621, fa::fa_i_cursor } , // i-cursor
+    { 12630, fa::fa_ice_cream } , // ice-cream
+    { 12640, fa::fa_icicles } , // icicles
+    { 12648, fa::fa_icons } , // icons
+    { 12678, fa::fa_id_badge } , // id-badge
+    { 12687, fa::fa_id_card } , // id-card
+    { 12724, fa::fa_id_card_alt } , // id-card-alt
+    { 12711, fa::fa_id_card_clip } , // id-card-clip
+    { 12736, fa::fa_igloo } , // igloo
+    { 18509, fa::fa_ils } , // ils
+    { 12742, fa::fa_image } , // image
+    { 12748, fa::fa_image_portrait } , // image-portrait
+    { 12772, fa::fa_images } , // images
+    { 12779, fa::fa_inbox } , // inbox
+    { 12785, fa::fa_indent } , // indent
+    { 12810, fa::fa_indian_rupee } , // indian-rupee
+    { 12792, fa::fa_indian_rupee_sign } , // indian-rupee-sign
+    { 12827, fa::fa_industry } , // industry
+    { 12836, fa::fa_infinity } , // infinity
+    { 12845, fa::fa_info } , // info
+    { 5467, fa::fa_info_circle } , // info-circle
+    { 12823, fa::fa_inr } , // inr
+    { 3604, fa::fa_institution } , // institution
+    { 12850, fa::fa_italic } , // italic
+    { 12857, fa::fa_j } , // j
+    { 12859, fa::fa_jar } , // jar
+    { 12863, fa::fa_jar_wheat } , // jar-wheat
+    { 12873, fa::fa_jedi } , // jedi
+    { 12878, fa::fa_jet_fighter } , // jet-fighter
+    { 12902, fa::fa_jet_fighter_up } , // jet-fighter-up
+    { 12917, fa::fa_joint } , // joint
+    { 2877, fa::fa_journal_whills } , // journal-whills
+    { 23922, fa::fa_jpy } , // jpy
+    { 12923, fa::fa_jug_detergent } , // jug-detergent
+    { 12937, fa::fa_k } , // k
+    { 12939, fa::fa_kaaba } , // kaaba
+    { 12945, fa::fa_key } , // key
+    { 12949, fa::fa_keyboard } , // keyboard
+    { 12958, fa::fa_khanda } , // khanda
+    { 12965, fa::fa_kip_sign } , // kip-sign
+    { 8425, fa::fa_kiss } , // kiss
+    { 8445, fa::fa_kiss_beam } , // kiss-beam
+    { 8476, fa::fa_kiss_wink_heart } , // kiss-wink-heart
+    { 12974, fa::fa_kit_medical } , // kit-medical
+    { 12996, fa::fa_kitchen_set } , // kitchen-set
+    { 13008, fa::fa_kiwi_bird } , // kiwi-bird
+    { 23832, fa::fa_krw } , // krw
+    { 13018, fa::fa_l } , // l
+    { 23499, fa::fa_ladder_water } , // ladder-water
+    { 13020, fa::fa_land_mine_on } , // land-mine-on
+    { 13033, fa::fa_landmark } , // landmark
+    { 13056, fa::fa_landmark_alt } , // landmark-alt
+    { 13042, fa::fa_landmark_dome } , // landmark-dome
+    { 13069, fa::fa_landmark_flag } , // landmark-flag
+    { 13083, fa::fa_language } , // language
+    { 13092, fa::fa_laptop } , // laptop
+    { 13099, fa::fa_laptop_code } , // laptop-code
+    { 13111, fa::fa_laptop_file } , // laptop-file
+    { 12396, fa::fa_laptop_house } , // laptop-house
+    { 13123, fa::fa_laptop_medical } , // laptop-medical
+    { 13138, fa::fa_lari_sign } , // lari-sign
+    { 8503, fa::fa_laugh } , // laugh
+    { 8525, fa::fa_laugh_beam } , // laugh-beam
+    { 8554, fa::fa_laugh_squint } , // laugh-squint
+    { 8583, fa::fa_laugh_wink } , // laugh-wink
+    { 13148, fa::fa_layer_group } , // layer-group
+    { 13160, fa::fa_leaf } , // leaf
+    { 13165, fa::fa_left_long } , // left-long
+    { 13195, fa::fa_left_right } , // left-right
+    { 10174, fa::fa_legal } , // legal
+    { 13219, fa::fa_lemon } , // lemon
+    { 13225, fa::fa_less_than } , // less-than
+    { 13235, fa::fa_less_than_equal } , // less-than-equal
+    { 1243, fa::fa_level_down } , // level-down
+    { 22222, fa::fa_level_down_alt } , // level-down-alt
+    { 1268, fa::fa_level_up } , // level-up
+    { 22245, fa::fa_level_up_alt } , // level-up-alt
+    { 13251, fa::fa_life_ring } , // life-ring
+    { 13261, fa::fa_lightbulb } , // lightbulb
+    { 4638, fa::fa_line_chart } , // line-chart
+    { 13271, fa::fa_lines_leaning } , // lines-leaning
+    { 13285, fa::fa_link } , // link
+    { 13296, fa::fa_link_slash } , // link-slash
+    { 13339, fa::fa_lira_sign } , // lira-sign
+    { 13349, fa::fa_list } , // list
+    { 13392, fa::fa_list_1_2 } , // list-1-2
+    { 17352, fa::fa_list_alt } , // list-alt
+    { 13367, fa::fa_list_check } , // list-check
+    { 13422, fa::fa_list_dots } , // list-dots
+    { 13401, fa::fa_list_numeric } , // list-numeric
+    { 13384, fa::fa_list_ol } , // list-ol
+    { 13354, fa::fa_list_squares } , // list-squares
+    { 13414, fa::fa_list_ul } , // list-ul
+    { 13432, fa::fa_litecoin_sign } , // litecoin-sign
+    { 13481, fa::fa_location } , // location
+    { 13446, fa::fa_location_arrow } , // location-arrow
+    { 13461, fa::fa_location_crosshairs } , // location-crosshairs
+    { 13490, fa::fa_location_dot } , // location-dot
+    { 13518, fa::fa_location_pin } , // location-pin
+    { 13542, fa::fa_location_pin_lock } , // location-pin-lock
+    { 13560, fa::fa_lock } , // lock
+    { 13565, fa::fa_lock_open } , // lock-open
+    { 13575, fa::fa_locust } , // locust
+    { 7201, fa::fa_long_arrow_alt_down } , // long-arrow-alt-down
+    { 13175, fa::fa_long_arrow_alt_left } , // long-arrow-alt-left
+    { 17592, fa::fa_long_arrow_alt_right } , // long-arrow-alt-right
+    { 22424, fa::fa_long_arrow_alt_up } , // long-arrow-alt-up
+    { 589, fa::fa_long_arrow_down } , // long-arrow-down
+    { 843, fa::fa_long_arrow_left } , // long-arrow-left
+    { 982, fa::fa_long_arrow_right } , // long-arrow-right
+    { 1463, fa::fa_long_arrow_up } , // long-arrow-up
+    { 7882, fa::fa_low_vision } , // low-vision
+    { 4334, fa::fa_luggage_cart } , // luggage-cart
+    { 13582, fa::fa_lungs } , // lungs
+    { 13588, fa::fa_lungs_virus } , // lungs-virus
+    { 13600, fa::fa_m } , // m
+    { 23410, fa::fa_magic } , // magic
+    { 23436, fa::fa_magic_wand_sparkles } , // magic-wand-sparkles
+    { 13602, fa::fa_magnet } , // magnet
+    { 13609, fa::fa_magnifying_glass } , // magnifying-glass
+    { 13633, fa::fa_magnifying_glass_arrow_right } , // magnifying-glass-arrow-right
+    { 13662, fa::fa_magnifying_glass_chart } , // magnifying-glass-chart
+    { 13685, fa::fa_magnifying_glass_dollar } , // magnifying-glass-dollar
+    { 13723, fa::fa_magnifying_glass_location } , // magnifying-glass-location
+    { 13765, fa::fa_magnifying_glass_minus } , // magnifying-glass-minus
+    { 13801, fa::fa_magnifying_glass_plus } , // magnifying-glass-plus
+    { 7741, fa::fa_mail_bulk } , // mail-bulk
+    { 18417, fa::fa_mail_forward } , // mail-forward
+    { 17454, fa::fa_mail_reply } , // mail-reply
+    { 17475, fa::fa_mail_reply_all } , // mail-reply-all
+    { 15567, fa::fa_male } , // male
+    { 13835, fa::fa_manat_sign } , // manat-sign
+    { 13846, fa::fa_map } , // map
+    { 13850, fa::fa_map_location } , // map-location
+    { 13874, fa::fa_map_location_dot } , // map-location-dot
+    { 13863, fa::fa_map_marked } , // map-marked
+    { 13891, fa::fa_map_marked_alt } , // map-marked-alt
+    { 13531, fa::fa_map_marker } , // map-marker
+    { 13503, fa::fa_map_marker_alt } , // map-marker-alt
+    { 13906, fa::fa_map_pin } , // map-pin
+    { 18849, fa::fa_map_signs } , // map-signs
+    { 13914, fa::fa_marker } , // marker
+    { 13921, fa::fa_mars } , // mars
+    { 13926, fa::fa_mars_and_venus } , // mars-and-venus
+    { 13941, fa::fa_mars_and_venus_burst } , // mars-and-venus-burst
+    { 13962, fa::fa_mars_double } , // mars-double
+    { 13974, fa::fa_mars_stroke } , // mars-stroke
+    { 14004, fa::fa_mars_stroke_h } , // mars-stroke-h
+    { 13986, fa::fa_mars_stroke_right } , // mars-stroke-right
+    { 14018, fa::fa_mars_stroke_up } , // mars-stroke-up
+    { 14033, fa::fa_mars_stroke_v } , // mars-stroke-v
+    { 14047, fa::fa_martini_glass } , // martini-glass
+    { 14079, fa::fa_martini_glass_citrus } , // martini-glass-citrus
+    { 14109, fa::fa_martini_glass_empty } , // martini-glass-empty
+    { 14143, fa::fa_mask } , // mask
+    { 14148, fa::fa_mask_face } , // mask-face
+    { 14158, fa::fa_mask_ventilator } , // mask-ventilator
+    { 14174, fa::fa_masks_theater } , // masks-theater
+    { 14202, fa::fa_mattress_pillow } , // mattress-pillow
+    { 14218, fa::fa_maximize } , // maximize
+    { 14245, fa::fa_medal } , // medal
+    { 20260, fa::fa_medkit } , // medkit
+    { 8603, fa::fa_meh } , // meh
+    { 8622, fa::fa_meh_blank } , // meh-blank
+    { 8650, fa::fa_meh_rolling_eyes } , // meh-rolling-eyes
+    { 14251, fa::fa_memory } , // memory
+    { 14258, fa::fa_menorah } , // menorah
+    { 14266, fa::fa_mercury } , // mercury
+    { 14274, fa::fa_message } , // message
+    { 14294, fa::fa_meteor } , // meteor
+    { 14301, fa::fa_microchip } , // microchip
+    { 14311, fa::fa_microphone } , // microphone
+    { 14339, fa::fa_microphone_alt } , // microphone-alt
+    { 14377, fa::fa_microphone_alt_slash } , // microphone-alt-slash
+    { 14322, fa::fa_microphone_lines } , // microphone-lines
+    { 14354, fa::fa_microphone_lines_slash } , // microphone-lines-slash
+    { 14398, fa::fa_microphone_slash } , // microphone-slash
+    { 14415, fa::fa_microscope } , // microscope
+    { 14426, fa::fa_mill_sign } , // mill-sign
+    { 14436, fa::fa_minimize } , // minimize
+    { 14465, fa::fa_minus } , // minus
+    { 5526, fa::fa_minus_circle } , // minus-circle
+    { 19498, fa::fa_minus_square } , // minus-square
+    { 14480, fa::fa_mitten } , // mitten
+    { 14487, fa::fa_mobile } , // mobile
+    { 14603, fa::fa_mobile_alt } , // mobile-alt
+    { 14494, fa::fa_mobile_android } , // mobile-android
+    { 14563, fa::fa_mobile_android_alt } , // mobile-android-alt
+    { 14522, fa::fa_mobile_button } , // mobile-button
+    { 14509, fa::fa_mobile_phone } , // mobile-phone
+    { 14536, fa::fa_mobile_retro } , // mobile-retro
+    { 14549, fa::fa_mobile_screen } , // mobile-screen
+    { 14582, fa::fa_mobile_screen_button } , // mobile-screen-button
+    { 14614, fa::fa_money_bill } , // money-bill
+    { 14625, fa::fa_money_bill_1 } , // money-bill-1
+    { 14653, fa::fa_money_bill_1_wave } , // money-bill-1-wave
+    { 14638, fa::fa_money_bill_alt } , // money-bill-alt
+    { 14691, fa::fa_money_bill_transfer } , // money-bill-transfer
+    { 14711, fa::fa_money_bill_trend_up } , // money-bill-trend-up
+    { 14731, fa::fa_money_bill_wave } , // money-bill-wave
+    { 14671, fa::fa_money_bill_wave_alt } , // money-bill-wave-alt
+    { 14747, fa::fa_money_bill_wheat } , // money-bill-wheat
+    { 14764, fa::fa_money_bills } , // money-bills
+    { 14776, fa::fa_money_check } , // money-check
+    { 14807, fa::fa_money_check_alt } , // money-check-alt
+    { 14788, fa::fa_money_check_dollar } , // money-check-dollar
+    { 14823, fa::fa_monument } , // monument
+    { 14832, fa::fa_moon } , // moon
+    { 10325, fa::fa_mortar_board } , // mortar-board
+    { 14837, fa::fa_mortar_pestle } , // mortar-pestle
+    { 14851, fa::fa_mosque } , // mosque
+    { 14858, fa::fa_mosquito } , // mosquito
+    { 14867, fa::fa_mosquito_net } , // mosquito-net
+    { 14880, fa::fa_motorcycle } , // motorcycle
+    { 14891, fa::fa_mound } , // mound
+    { 14897, fa::fa_mountain } , // mountain
+    { 14906, fa::fa_mountain_city } , // mountain-city
+    { 14920, fa::fa_mountain_sun } , // mountain-sun
+    { 6584, fa::fa_mouse } , // mouse
+    { 873, fa::fa_mouse_pointer } , // mouse-pointer
+    { 14933, fa::fa_mug_hot } , // mug-hot
+    { 14941, fa::fa_mug_saucer } , // mug-saucer
+    { 23872, fa::fa_multiply } , // multiply
+    { 3616, fa::fa_museum } , // museum
+    { 14959, fa::fa_music } , // music
+    { 14965, fa::fa_n } , // n
+    { 14967, fa::fa_naira_sign } , // naira-sign
+    { 2275, fa::fa_navicon } , // navicon
+    { 14978, fa::fa_network_wired } , // network-wired
+    { 14992, fa::fa_neuter } , // neuter
+    { 14999, fa::fa_newspaper } , // newspaper
+    { 15009, fa::fa_not_equal } , // not-equal
+    { 15019, fa::fa_notdef } , // notdef
+    { 15026, fa::fa_note_sticky } , // note-sticky
+    { 15050, fa::fa_notes_medical } , // notes-medical
+    { 15064, fa::fa_o } , // o
+    { 15066, fa::fa_object_group } , // object-group
+    { 15079, fa::fa_object_ungroup } , // object-ungroup
+    { 15094, fa::fa_oil_can } , // oil-can
+    { 15102, fa::fa_oil_well } , // oil-well
+    { 15111, fa::fa_om } , // om
+    { 15114, fa::fa_otter } , // otter
+    { 15120, fa::fa_outdent } , // outdent
+    { 15135, fa::fa_p } , // p
+    { 15137, fa::fa_pager } , // pager
+    { 15167, fa::fa_paint_brush } , // paint-brush
+    { 15143, fa::fa_paint_roller } , // paint-roller
+    { 15156, fa::fa_paintbrush } , // paintbrush
+    { 15179, fa::fa_palette } , // palette
+    { 15187, fa::fa_pallet } , // pallet
+    { 15194, fa::fa_panorama } , // panorama
+    { 15203, fa::fa_paper_plane } , // paper-plane
+    { 15215, fa::fa_paperclip } , // paperclip
+    { 15225, fa::fa_parachute_box } , // parachute-box
+    { 15239, fa::fa_paragraph } , // paragraph
+    { 19537, fa::fa_parking } , // parking
+    { 15249, fa::fa_passport } , // passport
+    { 19078, fa::fa_pastafarianism } , // pastafarianism
+    { 15258, fa::fa_paste } , // paste
+    { 15279, fa::fa_pause } , // pause
+    { 5578, fa::fa_pause_circle } , // pause-circle
+    { 15285, fa::fa_paw } , // paw
+    { 15289, fa::fa_peace } , // peace
+    { 15295, fa::fa_pen } , // pen
+    { 15308, fa::fa_pen_alt } , // pen-alt
+    { 15299, fa::fa_pen_clip } , // pen-clip
+    { 15316, fa::fa_pen_fancy } , // pen-fancy
+    { 15326, fa::fa_pen_nib } , // pen-nib
+    { 15334, fa::fa_pen_ruler } , // pen-ruler
+    { 19556, fa::fa_pen_square } , // pen-square
+    { 15357, fa::fa_pen_to_square } , // pen-to-square
+    { 15376, fa::fa_pencil } , // pencil
+    { 15383, fa::fa_pencil_alt } , // pencil-alt
+    { 15344, fa::fa_pencil_ruler } , // pencil-ruler
+    { 19567, fa::fa_pencil_square } , // pencil-square
+    { 15394, fa::fa_people_arrows } , // people-arrows
+    { 15408, fa::fa_people_arrows_left_right } , // people-arrows-left-right
+    { 15450, fa::fa_people_carry } , // people-carry
+    { 15433, fa::fa_people_carry_box } , // people-carry-box
+    { 15463, fa::fa_people_group } , // people-group
+    { 15476, fa::fa_people_line } , // people-line
+    { 15488, fa::fa_people_pulling } , // people-pulling
+    { 15503, fa::fa_people_robbery } , // people-robbery
+    { 15518, fa::fa_people_roof } , // people-roof
+    { 15530, fa::fa_pepper_hot } , // pepper-hot
+    { 15541, fa::fa_percent } , // percent
+    { 15549, fa::fa_percentage } , // percentage
+    { 15560, fa::fa_person } , // person
+    { 15572, fa::fa_person_arrow_down_to_line } , // person-arrow-down-to-line
+    { 15598, fa::fa_person_arrow_up_from_line } , // person-arrow-up-from-line
+    { 15624, fa::fa_person_biking } , // person-biking
+    { 15645, fa::fa_person_booth } , // person-booth
+    { 15658, fa::fa_person_breastfeeding } , // person-breastfeeding
+    { 15679, fa::fa_person_burst } , // person-burst
+    { 15692, fa::fa_person_cane } , // person-cane
+    { 15704, fa::fa_person_chalkboard } , // person-chalkboard
+    { 15722, fa::fa_person_circle_check } , // person-circle-check
+    { 15742, fa::fa_person_circle_exclamation } , // person-circle-exclamation
+    { 15768, fa::fa_person_circle_minus } , // person-circle-minus
+    { 15788, fa::fa_person_circle_plus } , // person-circle-plus
+    { 15807, fa::fa_person_circle_question } , // person-circle-question
+    { 15830, fa::fa_person_circle_xmark } , // person-circle-xmark
+    { 15850, fa::fa_person_digging } , // person-digging
+    { 15873, fa::fa_person_dots_from_line } , // person-dots-from-line
+    { 15905, fa::fa_person_dress } , // person-dress
+    { 15925, fa::fa_person_dress_burst } , // person-dress-burst
+    { 15944, fa::fa_person_drowning } , // person-drowning
+    { 15960, fa::fa_person_falling } , // person-falling
+    { 15975, fa::fa_person_falling_burst } , // person-falling-burst
+    { 15996, fa::fa_person_half_dress } , // person-half-dress
+    { 16014, fa::fa_person_harassing } , // person-harassing
+    { 16031, fa::fa_person_hiking } , // person-hiking
+    { 16052, fa::fa_person_military_pointing } , // person-military-pointing
+    { 16077, fa::fa_person_military_rifle } , // person-military-rifle
+    { 16099, fa::fa_person_military_to_person } , // person-military-to-person
+    { 16125, fa::fa_person_praying } , // person-praying
+    { 16145, fa::fa_person_pregnant } , // person-pregnant
+    { 16161, fa::fa_person_rays } , // person-rays
+    { 16173, fa::fa_person_rifle } , // person-rifle
+    { 16186, fa::fa_person_running } , // person-running
+    { 16209, fa::fa_person_shelter } , // person-shelter
+    { 16224, fa::fa_person_skating } , // person-skating
+    { 16247, fa::fa_person_skiing } , // person-skiing
+    { 16268, fa::fa_person_skiing_nordic } , // person-skiing-nordic
+    { 16303, fa::fa_person_snowboarding } , // person-snowboarding
+    { 16336, fa::fa_person_swimming } , // person-swimming
+    { 16360, fa::fa_person_through_window } , // person-through-window
+    { 16382, fa::fa_person_walking } , // person-walking
+    { 16405, fa::fa_person_walking_arrow_loop_left } , // person-walking-arrow-loop-left
+    { 16436, fa::fa_person_walking_arrow_right } , // person-walking-arrow-right
+    { 16463, fa::fa_person_walking_dashed_line_arrow_right } , // person-walking-dashed-line-arrow-right
+    { 16502, fa::fa_person_walking_luggage } , // person-walking-luggage
+    { 16525, fa::fa_person_walking_with_cane } , // person-walking-with-cane
+    { 16556, fa::fa_peseta_sign } , // peseta-sign
+    { 16568, fa::fa_peso_sign } , // peso-sign
+    { 16578, fa::fa_phone } , // phone
+    { 16595, fa::fa_phone_alt } , // phone-alt
+    { 16584, fa::fa_phone_flip } , // phone-flip
+    { 16605, fa::fa_phone_slash } , // phone-slash
+    { 19617, fa::fa_phone_square } , // phone-square
+    { 19648, fa::fa_phone_square_alt } , // phone-square-alt
+    { 16617, fa::fa_phone_volume } , // phone-volume
+    { 16651, fa::fa_photo_film } , // photo-film
+    { 16662, fa::fa_photo_video } , // photo-video
+    { 4659, fa::fa_pie_chart } , // pie-chart
+    { 16674, fa::fa_piggy_bank } , // piggy-bank
+    { 16685, fa::fa_pills } , // pills
+    { 20528, fa::fa_ping_pong_paddle_ball } , // ping-pong-paddle-ball
+    { 16691, fa::fa_pizza_slice } , // pizza-slice
+    { 16703, fa::fa_place_of_worship } , // place-of-worship
+    { 16720, fa::fa_plane } , // plane
+    { 16726, fa::fa_plane_arrival } , // plane-arrival
+    { 16740, fa::fa_plane_circle_check } , // plane-circle-check
+    { 16759, fa::fa_plane_circle_exclamation } , // plane-circle-exclamation
+    { 16784, fa::fa_plane_circle_xmark } , // plane-circle-xmark
+    { 16803, fa::fa_plane_departure } , // plane-departure
+    { 16819, fa::fa_plane_lock } , // plane-lock
+    { 16830, fa::fa_plane_slash } , // plane-slash
+    { 16842, fa::fa_plane_up } , // plane-up
+    { 16851, fa::fa_plant_wilt } , // plant-wilt
+    { 16862, fa::fa_plate_wheat } , // plate-wheat
+    { 16874, fa::fa_play } , // play
+    { 5603, fa::fa_play_circle } , // play-circle
+    { 16879, fa::fa_plug } , // plug
+    { 16884, fa::fa_plug_circle_bolt } , // plug-circle-bolt
+    { 16901, fa::fa_plug_circle_check } , // plug-circle-check
+    { 16919, fa::fa_plug_circle_exclamation } , // plug-circle-exclamation
+    { 16943, fa::fa_plug_circle_minus } , // plug-circle-minus
+    { 16961, fa::fa_plug_circle_plus } , // plug-circle-plus
+    { 16978, fa::fa_plug_circle_xmark } , // plug-circle-xmark
+    { 16996, fa::fa_plus } , // plus
+    { 5627, fa::fa_plus_circle } , // plus-circle
+    { 17005, fa::fa_plus_minus } , // plus-minus
+    { 19677, fa::fa_plus_square } , // plus-square
+    { 17016, fa::fa_podcast } , // podcast
+    { 19740, fa::fa_poll } , // poll
+    { 19712, fa::fa_poll_h } , // poll-h
+    { 17024, fa::fa_poo } , // poo
+    { 17038, fa::fa_poo_bolt } , // poo-bolt
+    { 17028, fa::fa_poo_storm } , // poo-storm
+    { 17047, fa::fa_poop } , // poop
+    { 12763, fa::fa_portrait } , // portrait
+    { 20117, fa::fa_pound_sign } , // pound-sign
+    { 17052, fa::fa_power_off } , // power-off
+    { 16140, fa::fa_pray } , // pray
+    { 11160, fa::fa_praying_hands } , // praying-hands
+    { 17062, fa::fa_prescription } , // prescription
+    { 17075, fa::fa_prescription_bottle } , // prescription-bottle
+    { 17123, fa::fa_prescription_bottle_alt } , // prescription-bottle-alt
+    { 17095, fa::fa_prescription_bottle_medical } , // prescription-bottle-medical
+    { 17147, fa::fa_print } , // print
+    { 2601, fa::fa_procedures } , // procedures
+    { 6886, fa::fa_project_diagram } , // project-diagram
+    { 17153, fa::fa_pump_medical } , // pump-medical
+    { 17166, fa::fa_pump_soap } , // pump-soap
+    { 17176, fa::fa_puzzle_piece } , // puzzle-piece
+    { 17189, fa::fa_q } , // q
+    { 17191, fa::fa_qrcode } , // qrcode
+    { 17198, fa::fa_question } , // question
+    { 5655, fa::fa_question_circle } , // question-circle
+    { 3410, fa::fa_quidditch } , // quidditch
+    { 3420, fa::fa_quidditch_broom_ball } , // quidditch-broom-ball
+    { 17207, fa::fa_quote_left } , // quote-left
+    { 17218, fa::fa_quote_left_alt } , // quote-left-alt
+    { 17233, fa::fa_quote_right } , // quote-right
+    { 17245, fa::fa_quote_right_alt } , // quote-right-alt
+    { 2955, fa::fa_quran } , // quran
+    { 17261, fa::fa_r } , // r
+    { 17263, fa::fa_radiation } , // radiation
+    { 5688, fa::fa_radiation_alt } , // radiation-alt
+    { 17273, fa::fa_radio } , // radio
+    { 17279, fa::fa_rainbow } , // rainbow
+    { 18744, fa::fa_random } , // random
+    { 17287, fa::fa_ranking_star } , // ranking-star
+    { 17300, fa::fa_receipt } , // receipt
+    { 17308, fa::fa_record_vinyl } , // record-vinyl
+    { 17321, fa::fa_rectangle_ad } , // rectangle-ad
+    { 17337, fa::fa_rectangle_list } , // rectangle-list
+    { 17377, fa::fa_rectangle_times } , // rectangle-times
+    { 17361, fa::fa_rectangle_xmark } , // rectangle-xmark
+    { 17422, fa::fa_recycle } , // recycle
+    { 1190, fa::fa_redo } , // redo
+    { 17850, fa::fa_redo_alt } , // redo-alt
+    { 1752, fa::fa_refresh } , // refresh
+    { 17430, fa::fa_registered } , // registered
+    { 23881, fa::fa_remove } , // remove
+    { 21326, fa::fa_remove_format } , // remove-format
+    { 2322, fa::fa_reorder } , // reorder
+    { 17441, fa::fa_repeat } , // repeat
+    { 17448, fa::fa_reply } , // reply
+    { 17465, fa::fa_reply_all } , // reply-all
+    { 17490, fa::fa_republican } , // republican
+    { 17501, fa::fa_restroom } , // restroom
+    { 17510, fa::fa_retweet } , // retweet
+    { 17518, fa::fa_ribbon } , // ribbon
+    { 17525, fa::fa_right_from_bracket } , // right-from-bracket
+    { 17557, fa::fa_right_left } , // right-left
+    { 17581, fa::fa_right_long } , // right-long
+    { 17613, fa::fa_right_to_bracket } , // right-to-bracket
+    { 17642, fa::fa_ring } , // ring
+    { 23926, fa::fa_rmb } , // rmb
+    { 17647, fa::fa_road } , // road
+    { 17652, fa::fa_road_barrier } , // road-barrier
+    { 17665, fa::fa_road_bridge } , // road-bridge
+    { 17677, fa::fa_road_circle_check } , // road-circle-check
+    { 17695, fa::fa_road_circle_exclamation } , // road-circle-exclamation
+    { 17719, fa::fa_road_circle_xmark } , // road-circle-xmark
+    { 17737, fa::fa_road_lock } , // road-lock
+    { 17747, fa::fa_road_spikes } , // road-spikes
+    { 17759, fa::fa_robot } , // robot
+    { 17765, fa::fa_rocket } , // rocket
+    { 19945, fa::fa_rod_asclepius } , // rod-asclepius
+    { 19959, fa::fa_rod_snake } , // rod-snake
+    { 17772, fa::fa_rotate } , // rotate
+    { 17800, fa::fa_rotate_back } , // rotate-back
+    { 17812, fa::fa_rotate_backward } , // rotate-backward
+    { 17859, fa::fa_rotate_forward } , // rotate-forward
+    { 17788, fa::fa_rotate_left } , // rotate-left
+    { 17837, fa::fa_rotate_right } , // rotate-right
+    { 17900, fa::fa_rouble } , // rouble
+    { 17874, fa::fa_route } , // route
+    { 17880, fa::fa_rss } , // rss
+    { 19793, fa::fa_rss_square } , // rss-square
+    { 17907, fa::fa_rub } , // rub
+    { 17911, fa::fa_ruble } , // ruble
+    { 17889, fa::fa_ruble_sign } , // ruble-sign
+    { 17917, fa::fa_rug } , // rug
+    { 17921, fa::fa_ruler } , // ruler
+    { 17927, fa::fa_ruler_combined } , // ruler-combined
+    { 17942, fa::fa_ruler_horizontal } , // ruler-horizontal
+    { 17959, fa::fa_ruler_vertical } , // ruler-vertical
+    { 16201, fa::fa_running } , // running
+    { 17985, fa::fa_rupee } , // rupee
+    { 17974, fa::fa_rupee_sign } , // rupee-sign
+    { 17991, fa::fa_rupiah_sign } , // rupiah-sign
+    { 18003, fa::fa_s } , // s
+    { 18005, fa::fa_sack_dollar } , // sack-dollar
+    { 18017, fa::fa_sack_xmark } , // sack-xmark
+    { 8680, fa::fa_sad_cry } , // sad-cry
+    { 8702, fa::fa_sad_tear } , // sad-tear
+    { 18028, fa::fa_sailboat } , // sailboat
+    { 18037, fa::fa_satellite } , // satellite
+    { 18047, fa::fa_satellite_dish } , // satellite-dish
+    { 9725, fa::fa_save } , // save
+    { 18062, fa::fa_scale_balanced } , // scale-balanced
+    { 18091, fa::fa_scale_unbalanced } , // scale-unbalanced
+    { 18127, fa::fa_scale_unbalanced_flip } , // scale-unbalanced-flip
+    { 18169, fa::fa_school } , // school
+    { 18176, fa::fa_school_circle_check } , // school-circle-check
+    { 18196, fa::fa_school_circle_exclamation } , // school-circle-exclamation
+    { 18222, fa::fa_school_circle_xmark } , // school-circle-xmark
+    { 18242, fa::fa_school_flag } , // school-flag
+    { 18254, fa::fa_school_lock } , // school-lock
+    { 18266, fa::fa_scissors } , // scissors
+    { 18279, fa::fa_screwdriver } , // screwdriver
+    { 18291, fa::fa_screwdriver_wrench } , // screwdriver-wrench
+    { 18316, fa::fa_scroll } , // scroll
+    { 18323, fa::fa_scroll_torah } , // scroll-torah
+    { 18342, fa::fa_sd_card } , // sd-card
+    { 13626, fa::fa_search } , // search
+    { 13709, fa::fa_search_dollar } , // search-dollar
+    { 13749, fa::fa_search_location } , // search-location
+    { 13788, fa::fa_search_minus } , // search-minus
+    { 13823, fa::fa_search_plus } , // search-plus
+    { 18350, fa::fa_section } , // section
+    { 18358, fa::fa_seedling } , // seedling
+    { 18374, fa::fa_server } , // server
+    { 18381, fa::fa_shapes } , // shapes
+    { 18411, fa::fa_share } , // share
+    { 18473, fa::fa_share_alt } , // share-alt
+    { 19823, fa::fa_share_alt_square } , // share-alt-square
+    { 18430, fa::fa_share_from_square } , // share-from-square
+    { 18461, fa::fa_share_nodes } , // share-nodes
+    { 18448, fa::fa_share_square } , // share-square
+    { 18483, fa::fa_sheet_plastic } , // sheet-plastic
+    { 18513, fa::fa_shekel } , // shekel
+    { 18497, fa::fa_shekel_sign } , // shekel-sign
+    { 18520, fa::fa_sheqel } , // sheqel
+    { 18527, fa::fa_sheqel_sign } , // sheqel-sign
+    { 18539, fa::fa_shield } , // shield
+    { 18595, fa::fa_shield_alt } , // shield-alt
+    { 18546, fa::fa_shield_blank } , // shield-blank
+    { 18559, fa::fa_shield_cat } , // shield-cat
+    { 18570, fa::fa_shield_dog } , // shield-dog
+    { 18581, fa::fa_shield_halved } , // shield-halved
+    { 18606, fa::fa_shield_heart } , // shield-heart
+    { 18619, fa::fa_shield_virus } , // shield-virus
+    { 18632, fa::fa_ship } , // ship
+    { 22006, fa::fa_shipping_fast } , // shipping-fast
+    { 18637, fa::fa_shirt } , // shirt
+    { 18658, fa::fa_shoe_prints } , // shoe-prints
+    { 18670, fa::fa_shop } , // shop
+    { 18685, fa::fa_shop_lock } , // shop-lock
+    { 18695, fa::fa_shop_slash } , // shop-slash
+    { 2152, fa::fa_shopping_bag } , // shopping-bag
+    { 2394, fa::fa_shopping_basket } , // shopping-basket
+    { 4371, fa::fa_shopping_cart } , // shopping-cart
+    { 18722, fa::fa_shower } , // shower
+    { 18729, fa::fa_shrimp } , // shrimp
+    { 18736, fa::fa_shuffle } , // shuffle
+    { 18751, fa::fa_shuttle_space } , // shuttle-space
+    { 23010, fa::fa_shuttle_van } , // shuttle-van
+    { 18792, fa::fa_sign } , // sign
+    { 18779, fa::fa_sign_hanging } , // sign-hanging
+    { 1022, fa::fa_sign_in } , // sign-in
+    { 17630, fa::fa_sign_in_alt } , // sign-in-alt
+    { 10899, fa::fa_sign_language } , // sign-language
+    { 956, fa::fa_sign_out } , // sign-out
+    { 17544, fa::fa_sign_out_alt } , // sign-out-alt
+    { 18797, fa::fa_signal } , // signal
+    { 18804, fa::fa_signal_5 } , // signal-5
+    { 18813, fa::fa_signal_perfect } , // signal-perfect
+    { 18828, fa::fa_signature } , // signature
+    { 10913, fa::fa_signing } , // signing
+    { 18838, fa::fa_signs_post } , // signs-post
+    { 18859, fa::fa_sim_card } , // sim-card
+    { 18868, fa::fa_sink } , // sink
+    { 18873, fa::fa_sitemap } , // sitemap
+    { 16239, fa::fa_skating } , // skating
+    { 16261, fa::fa_skiing } , // skiing
+    { 16289, fa::fa_skiing_nordic } , // skiing-nordic
+    { 18881, fa::fa_skull } , // skull
+    { 18887, fa::fa_skull_crossbones } , // skull-crossbones
+    { 18904, fa::fa_slash } , // slash
+    { 18910, fa::fa_sleigh } , // sleigh
+    { 18917, fa::fa_sliders } , // sliders
+    { 18925, fa::fa_sliders_h } , // sliders-h
+    { 8722, fa::fa_smile } , // smile
+    { 8744, fa::fa_smile_beam } , // smile-beam
+    { 8771, fa::fa_smile_wink } , // smile-wink
+    { 18935, fa::fa_smog } , // smog
+    { 18940, fa::fa_smoking } , // smoking
+    { 2211, fa::fa_smoking_ban } , // smoking-ban
+    { 6467, fa::fa_sms } , // sms
+    { 16323, fa::fa_snowboarding } , // snowboarding
+    { 18948, fa::fa_snowflake } , // snowflake
+    { 18958, fa::fa_snowman } , // snowman
+    { 18966, fa::fa_snowplow } , // snowplow
+    { 18975, fa::fa_soap } , // soap
+    { 9948, fa::fa_soccer_ball } , // soccer-ball
+    { 18980, fa::fa_socks } , // socks
+    { 18986, fa::fa_solar_panel } , // solar-panel
+    { 18998, fa::fa_sort } , // sort
+    { 542, fa::fa_sort_alpha_asc } , // sort-alpha-asc
+    { 780, fa::fa_sort_alpha_desc } , // sort-alpha-desc
+    { 557, fa::fa_sort_alpha_down } , // sort-alpha-down
+    { 796, fa::fa_sort_alpha_down_alt } , // sort-alpha-down-alt
+    { 1361, fa::fa_sort_alpha_up } , // sort-alpha-up
+    { 1625, fa::fa_sort_alpha_up_alt } , // sort-alpha-up-alt
+    { 732, fa::fa_sort_amount_asc } , // sort-amount-asc
+    { 627, fa::fa_sort_amount_desc } , // sort-amount-desc
+    { 748, fa::fa_sort_amount_down } , // sort-amount-down
+    { 644, fa::fa_sort_amount_down_alt } , // sort-amount-down-alt
+    { 1597, fa::fa_sort_amount_up } , // sort-amount-up
+    { 1558, fa::fa_sort_amount_up_alt } , // sort-amount-up-alt
+    { 19040, fa::fa_sort_asc } , // sort-asc
+    { 19022, fa::fa_sort_desc } , // sort-desc
+    { 19012, fa::fa_sort_down } , // sort-down
+    { 437, fa::fa_sort_numeric_asc } , // sort-numeric-asc
+    { 487, fa::fa_sort_numeric_desc } , // sort-numeric-desc
+    { 454, fa::fa_sort_numeric_down } , // sort-numeric-down
+    { 505, fa::fa_sort_numeric_down_alt } , // sort-numeric-down-alt
+    { 1299, fa::fa_sort_numeric_up } , // sort-numeric-up
+    { 1328, fa::fa_sort_numeric_up_alt } , // sort-numeric-up-alt
+    { 19032, fa::fa_sort_up } , // sort-up
+    { 19049, fa::fa_spa } , // spa
+    { 18765, fa::fa_space_shuttle } , // space-shuttle
+    { 19053, fa::fa_spaghetti_monster_flying } , // spaghetti-monster-flying
+    { 19093, fa::fa_spell_check } , // spell-check
+    { 19105, fa::fa_spider } , // spider
+    { 19112, fa::fa_spinner } , // spinner
+    { 19120, fa::fa_splotch } , // splotch
+    { 19128, fa::fa_spoon } , // spoon
+    { 19148, fa::fa_spray_can } , // spray-can
+    { 19158, fa::fa_spray_can_sparkles } , // spray-can-sparkles
+    { 18367, fa::fa_sprout } , // sprout
+    { 19191, fa::fa_square } , // square
+    { 19198, fa::fa_square_arrow_up_right } , // square-arrow-up-right
+    { 19241, fa::fa_square_binary } , // square-binary
+    { 19255, fa::fa_square_caret_down } , // square-caret-down
+    { 19291, fa::fa_square_caret_left } , // square-caret-left
+    { 19327, fa::fa_square_caret_right } , // square-caret-right
+    { 19365, fa::fa_square_caret_up } , // square-caret-up
+    { 19397, fa::fa_square_check } , // square-check
+    { 19423, fa::fa_square_envelope } , // square-envelope
+    { 19455, fa::fa_square_full } , // square-full
+    { 19467, fa::fa_square_h } , // square-h
+    { 19485, fa::fa_square_minus } , // square-minus
+    { 19511, fa::fa_square_nfi } , // square-nfi
+    { 19522, fa::fa_square_parking } , // square-parking
+    { 19545, fa::fa_square_pen } , // square-pen
+    { 19581, fa::fa_square_person_confined } , // square-person-confined
+    { 19604, fa::fa_square_phone } , // square-phone
+    { 19630, fa::fa_square_phone_flip } , // square-phone-flip
+    { 19665, fa::fa_square_plus } , // square-plus
+    { 19689, fa::fa_square_poll_horizontal } , // square-poll-horizontal
+    { 19719, fa::fa_square_poll_vertical } , // square-poll-vertical
+    { 19766, fa::fa_square_root_alt } , // square-root-alt
+    { 19745, fa::fa_square_root_variable } , // square-root-variable
+    { 19782, fa::fa_square_rss } , // square-rss
+    { 19804, fa::fa_square_share_nodes } , // square-share-nodes
+    { 19840, fa::fa_square_up_right } , // square-up-right
+    { 19881, fa::fa_square_virus } , // square-virus
+    { 19894, fa::fa_square_xmark } , // square-xmark
+    { 19969, fa::fa_staff_aesculapius } , // staff-aesculapius
+    { 19933, fa::fa_staff_snake } , // staff-snake
+    { 19987, fa::fa_stairs } , // stairs
+    { 19994, fa::fa_stamp } , // stamp
+    { 20000, fa::fa_stapler } , // stapler
+    { 20008, fa::fa_star } , // star
+    { 20013, fa::fa_star_and_crescent } , // star-and-crescent
+    { 20031, fa::fa_star_half } , // star-half
+    { 20058, fa::fa_star_half_alt } , // star-half-alt
+    { 20041, fa::fa_star_half_stroke } , // star-half-stroke
+    { 20072, fa::fa_star_of_david } , // star-of-david
+    { 20086, fa::fa_star_of_life } , // star-of-life
+    { 2100, fa::fa_step_backward } , // step-backward
+    { 9900, fa::fa_step_forward } , // step-forward
+    { 20099, fa::fa_sterling_sign } , // sterling-sign
+    { 20128, fa::fa_stethoscope } , // stethoscope
+    { 15038, fa::fa_sticky_note } , // sticky-note
+    { 20140, fa::fa_stop } , // stop
+    { 5750, fa::fa_stop_circle } , // stop-circle
+    { 20145, fa::fa_stopwatch } , // stopwatch
+    { 20155, fa::fa_stopwatch_20 } , // stopwatch-20
+    { 20168, fa::fa_store } , // store
+    { 18675, fa::fa_store_alt } , // store-alt
+    { 18706, fa::fa_store_alt_slash } , // store-alt-slash
+    { 20174, fa::fa_store_slash } , // store-slash
+    { 2330, fa::fa_stream } , // stream
+    { 20186, fa::fa_street_view } , // street-view
+    { 20198, fa::fa_strikethrough } , // strikethrough
+    { 20212, fa::fa_stroopwafel } , // stroopwafel
+    { 20224, fa::fa_subscript } , // subscript
+    { 14471, fa::fa_subtract } , // subtract
+    { 21726, fa::fa_subway } , // subway
+    { 20234, fa::fa_suitcase } , // suitcase
+    { 20243, fa::fa_suitcase_medical } , // suitcase-medical
+    { 20267, fa::fa_suitcase_rolling } , // suitcase-rolling
+    { 20284, fa::fa_sun } , // sun
+    { 20288, fa::fa_sun_plant_wilt } , // sun-plant-wilt
+    { 20303, fa::fa_superscript } , // superscript
+    { 8796, fa::fa_surprise } , // surprise
+    { 20315, fa::fa_swatchbook } , // swatchbook
+    { 16352, fa::fa_swimmer } , // swimmer
+    { 23512, fa::fa_swimming_pool } , // swimming-pool
+    { 20326, fa::fa_synagogue } , // synagogue
+    { 1760, fa::fa_sync } , // sync
+    { 17779, fa::fa_sync_alt } , // sync-alt
+    { 20336, fa::fa_syringe } , // syringe
+    { 20344, fa::fa_t } , // t
+    { 18643, fa::fa_t_shirt } , // t-shirt
+    { 20346, fa::fa_table } , // table
+    { 20352, fa::fa_table_cells } , // table-cells
+    { 20367, fa::fa_table_cells_column_lock } , // table-cells-column-lock
+    { 20391, fa::fa_table_cells_large } , // table-cells-large
+    { 20418, fa::fa_table_cells_row_lock } , // table-cells-row-lock
+    { 20439, fa::fa_table_cells_row_unlock } , // table-cells-row-unlock
+    { 20462, fa::fa_table_columns } , // table-columns
+    { 20484, fa::fa_table_list } , // table-list
+    { 20550, fa::fa_table_tennis } , // table-tennis
+    { 20503, fa::fa_table_tennis_paddle_ball } , // table-tennis-paddle-ball
+    { 20563, fa::fa_tablet } , // tablet
+    { 20620, fa::fa_tablet_alt } , // tablet-alt
+    { 20570, fa::fa_tablet_android } , // tablet-android
+    { 20585, fa::fa_tablet_button } , // tablet-button
+    { 20599, fa::fa_tablet_screen_button } , // tablet-screen-button
+    { 20631, fa::fa_tablets } , // tablets
+    { 20639, fa::fa_tachograph_digital } , // tachograph-digital
+    { 10141, fa::fa_tachometer } , // tachometer
+    { 10039, fa::fa_tachometer_alt } , // tachometer-alt
+    { 10005, fa::fa_tachometer_alt_average } , // tachometer-alt-average
+    { 10054, fa::fa_tachometer_alt_fast } , // tachometer-alt-fast
+    { 10104, fa::fa_tachometer_average } , // tachometer-average
+    { 10152, fa::fa_tachometer_fast } , // tachometer-fast
+    { 20677, fa::fa_tag } , // tag
+    { 20681, fa::fa_tags } , // tags
+    { 2994, fa::fa_tanakh } , // tanakh
+    { 20686, fa::fa_tape } , // tape
+    { 20691, fa::fa_tarp } , // tarp
+    { 20696, fa::fa_tarp_droplet } , // tarp-droplet
+    { 13378, fa::fa_tasks } , // tasks
+    { 2297, fa::fa_tasks_alt } , // tasks-alt
+    { 20709, fa::fa_taxi } , // taxi
+    { 20718, fa::fa_teeth } , // teeth
+    { 20724, fa::fa_teeth_open } , // teeth-open
+    { 22168, fa::fa_teletype } , // teletype
+    { 22261, fa::fa_television } , // television
+    { 20829, fa::fa_temperature_0 } , // temperature-0
+    { 21052, fa::fa_temperature_1 } , // temperature-1
+    { 20954, fa::fa_temperature_2 } , // temperature-2
+    { 21127, fa::fa_temperature_3 } , // temperature-3
+    { 20892, fa::fa_temperature_4 } , // temperature-4
+    { 20735, fa::fa_temperature_arrow_down } , // temperature-arrow-down
+    { 20775, fa::fa_temperature_arrow_up } , // temperature-arrow-up
+    { 20758, fa::fa_temperature_down } , // temperature-down
+    { 20811, fa::fa_temperature_empty } , // temperature-empty
+    { 20875, fa::fa_temperature_full } , // temperature-full
+    { 20937, fa::fa_temperature_half } , // temperature-half
+    { 20999, fa::fa_temperature_high } , // temperature-high
+    { 21016, fa::fa_temperature_low } , // temperature-low
+    { 21032, fa::fa_temperature_quarter } , // temperature-quarter
+    { 21100, fa::fa_temperature_three_quarters } , // temperature-three-quarters
+    { 20796, fa::fa_temperature_up } , // temperature-up
+    { 21193, fa::fa_tenge } , // tenge
+    { 21182, fa::fa_tenge_sign } , // tenge-sign
+    { 21199, fa::fa_tent } , // tent
+    { 21204, fa::fa_tent_arrow_down_to_line } , // tent-arrow-down-to-line
+    { 21228, fa::fa_tent_arrow_left_right } , // tent-arrow-left-right
+    { 21250, fa::fa_tent_arrow_turn_left } , // tent-arrow-turn-left
+    { 21271, fa::fa_tent_arrows_down } , // tent-arrows-down
+    { 21288, fa::fa_tents } , // tents
+    { 21294, fa::fa_terminal } , // terminal
+    { 21303, fa::fa_text_height } , // text-height
+    { 21315, fa::fa_text_slash } , // text-slash
+    { 21340, fa::fa_text_width } , // text-width
+    { 20364, fa::fa_th } , // th
+    { 20409, fa::fa_th_large } , // th-large
+    { 20495, fa::fa_th_list } , // th-list
+    { 14188, fa::fa_theater_masks } , // theater-masks
+    { 21351, fa::fa_thermometer } , // thermometer
+    { 20843, fa::fa_thermometer_0 } , // thermometer-0
+    { 21066, fa::fa_thermometer_1 } , // thermometer-1
+    { 20968, fa::fa_thermometer_2 } , // thermometer-2
+    { 21141, fa::fa_thermometer_3 } , // thermometer-3
+    { 20906, fa::fa_thermometer_4 } , // thermometer-4
+    { 20857, fa::fa_thermometer_empty } , // thermometer-empty
+    { 20920, fa::fa_thermometer_full } , // thermometer-full
+    { 20982, fa::fa_thermometer_half } , // thermometer-half
+    { 21080, fa::fa_thermometer_quarter } , // thermometer-quarter
+    { 21155, fa::fa_thermometer_three_quarters } , // thermometer-three-quarters
+    { 21395, fa::fa_thumb_tack } , // thumb-tack
+    { 21422, fa::fa_thumb_tack_slash } , // thumb-tack-slash
+    { 21363, fa::fa_thumbs_down } , // thumbs-down
+    { 21375, fa::fa_thumbs_up } , // thumbs-up
+    { 21385, fa::fa_thumbtack } , // thumbtack
+    { 21406, fa::fa_thumbtack_slash } , // thumbtack-slash
+    { 6128, fa::fa_thunderstorm } , // thunderstorm
+    { 21439, fa::fa_ticket } , // ticket
+    { 21460, fa::fa_ticket_alt } , // ticket-alt
+    { 21446, fa::fa_ticket_simple } , // ticket-simple
+    { 21471, fa::fa_timeline } , // timeline
+    { 23888, fa::fa_times } , // times
+    { 5829, fa::fa_times_circle } , // times-circle
+    { 17393, fa::fa_times_rectangle } , // times-rectangle
+    { 19907, fa::fa_times_square } , // times-square
+    { 7258, fa::fa_tint } , // tint
+    { 7277, fa::fa_tint_slash } , // tint-slash
+    { 8816, fa::fa_tired } , // tired
+    { 21480, fa::fa_toggle_off } , // toggle-off
+    { 21491, fa::fa_toggle_on } , // toggle-on
+    { 21501, fa::fa_toilet } , // toilet
+    { 21508, fa::fa_toilet_paper } , // toilet-paper
+    { 21521, fa::fa_toilet_paper_slash } , // toilet-paper-slash
+    { 21540, fa::fa_toilet_portable } , // toilet-portable
+    { 21556, fa::fa_toilets_portable } , // toilets-portable
+    { 21573, fa::fa_toolbox } , // toolbox
+    { 18310, fa::fa_tools } , // tools
+    { 21581, fa::fa_tooth } , // tooth
+    { 18336, fa::fa_torah } , // torah
+    { 21587, fa::fa_torii_gate } , // torii-gate
+    { 21598, fa::fa_tornado } , // tornado
+    { 21606, fa::fa_tower_broadcast } , // tower-broadcast
+    { 21638, fa::fa_tower_cell } , // tower-cell
+    { 21649, fa::fa_tower_observation } , // tower-observation
+    { 21667, fa::fa_tractor } , // tractor
+    { 21675, fa::fa_trademark } , // trademark
+    { 21685, fa::fa_traffic_light } , // traffic-light
+    { 21699, fa::fa_trailer } , // trailer
+    { 21707, fa::fa_train } , // train
+    { 21713, fa::fa_train_subway } , // train-subway
+    { 21733, fa::fa_train_tram } , // train-tram
+    { 3838, fa::fa_tram } , // tram
+    { 21744, fa::fa_transgender } , // transgender
+    { 21756, fa::fa_transgender_alt } , // transgender-alt
+    { 21772, fa::fa_trash } , // trash
+    { 21817, fa::fa_trash_alt } , // trash-alt
+    { 21778, fa::fa_trash_arrow_up } , // trash-arrow-up
+    { 21807, fa::fa_trash_can } , // trash-can
+    { 21827, fa::fa_trash_can_arrow_up } , // trash-can-arrow-up
+    { 21793, fa::fa_trash_restore } , // trash-restore
+    { 21846, fa::fa_trash_restore_alt } , // trash-restore-alt
+    { 21864, fa::fa_tree } , // tree
+    { 21869, fa::fa_tree_city } , // tree-city
+    { 18388, fa::fa_triangle_circle_square } , // triangle-circle-square
+    { 21879, fa::fa_triangle_exclamation } , // triangle-exclamation
+    { 21929, fa::fa_trophy } , // trophy
+    { 21936, fa::fa_trowel } , // trowel
+    { 21943, fa::fa_trowel_bricks } , // trowel-bricks
+    { 21957, fa::fa_truck } , // truck
+    { 21963, fa::fa_truck_arrow_right } , // truck-arrow-right
+    { 21981, fa::fa_truck_droplet } , // truck-droplet
+    { 21995, fa::fa_truck_fast } , // truck-fast
+    { 22020, fa::fa_truck_field } , // truck-field
+    { 22032, fa::fa_truck_field_un } , // truck-field-un
+    { 22047, fa::fa_truck_front } , // truck-front
+    { 22150, fa::fa_truck_loading } , // truck-loading
+    { 22059, fa::fa_truck_medical } , // truck-medical
+    { 22083, fa::fa_truck_monster } , // truck-monster
+    { 22097, fa::fa_truck_moving } , // truck-moving
+    { 22110, fa::fa_truck_pickup } , // truck-pickup
+    { 22123, fa::fa_truck_plane } , // truck-plane
+    { 22135, fa::fa_truck_ramp_box } , // truck-ramp-box
+    { 22195, fa::fa_try } , // try
+    { 18651, fa::fa_tshirt } , // tshirt
+    { 22164, fa::fa_tty } , // tty
+    { 22199, fa::fa_turkish_lira } , // turkish-lira
+    { 22177, fa::fa_turkish_lira_sign } , // turkish-lira-sign
+    { 22212, fa::fa_turn_down } , // turn-down
+    { 22237, fa::fa_turn_up } , // turn-up
+    { 22258, fa::fa_tv } , // tv
+    { 22272, fa::fa_tv_alt } , // tv-alt
+    { 22279, fa::fa_u } , // u
+    { 22281, fa::fa_umbrella } , // umbrella
+    { 22290, fa::fa_umbrella_beach } , // umbrella-beach
+    { 22305, fa::fa_underline } , // underline
+    { 1126, fa::fa_undo } , // undo
+    { 17828, fa::fa_undo_alt } , // undo-alt
+    { 22315, fa::fa_universal_access } , // universal-access
+    { 3623, fa::fa_university } , // university
+    { 13332, fa::fa_unlink } , // unlink
+    { 22332, fa::fa_unlock } , // unlock
+    { 22354, fa::fa_unlock_alt } , // unlock-alt
+    { 22339, fa::fa_unlock_keyhole } , // unlock-keyhole
+    { 19003, fa::fa_unsorted } , // unsorted
+    { 22365, fa::fa_up_down } , // up-down
+    { 22386, fa::fa_up_down_left_right } , // up-down-left-right
+    { 22416, fa::fa_up_long } , // up-long
+    { 22442, fa::fa_up_right_and_down_left_from_center } , // up-right-and-down-left-from-center
+    { 22488, fa::fa_up_right_from_square } , // up-right-from-square
+    { 22527, fa::fa_upload } , // upload
+    { 7088, fa::fa_usd } , // usd
+    { 22534, fa::fa_user } , // user
+    { 22677, fa::fa_user_alt } , // user-alt
+    { 22703, fa::fa_user_alt_slash } , // user-alt-slash
+    { 22539, fa::fa_user_astronaut } , // user-astronaut
+    { 22554, fa::fa_user_check } , // user-check
+    { 5804, fa::fa_user_circle } , // user-circle
+    { 22565, fa::fa_user_clock } , // user-clock
+    { 22606, fa::fa_user_cog } , // user-cog
+    { 22576, fa::fa_user_doctor } , // user-doctor
+    { 22770, fa::fa_user_edit } , // user-edit
+    { 22640, fa::fa_user_friends } , // user-friends
+    { 22596, fa::fa_user_gear } , // user-gear
+    { 22615, fa::fa_user_graduate } , // user-graduate
+    { 22629, fa::fa_user_group } , // user-group
+    { 22653, fa::fa_user_injured } , // user-injured
+    { 22666, fa::fa_user_large } , // user-large
+    { 22686, fa::fa_user_large_slash } , // user-large-slash
+    { 22718, fa::fa_user_lock } , // user-lock
+    { 22588, fa::fa_user_md } , // user-md
+    { 22728, fa::fa_user_minus } , // user-minus
+    { 22739, fa::fa_user_ninja } , // user-ninja
+    { 22750, fa::fa_user_nurse } , // user-nurse
+    { 22761, fa::fa_user_pen } , // user-pen
+    { 22780, fa::fa_user_plus } , // user-plus
+    { 22790, fa::fa_user_secret } , // user-secret
+    { 22802, fa::fa_user_shield } , // user-shield
+    { 22814, fa::fa_user_slash } , // user-slash
+    { 22825, fa::fa_user_tag } , // user-tag
+    { 22834, fa::fa_user_tie } , // user-tie
+    { 22854, fa::fa_user_times } , // user-times
+    { 22843, fa::fa_user_xmark } , // user-xmark
+    { 22865, fa::fa_users } , // users
+    { 22871, fa::fa_users_between_lines } , // users-between-lines
+    { 22902, fa::fa_users_cog } , // users-cog
+    { 22891, fa::fa_users_gear } , // users-gear
+    { 22912, fa::fa_users_line } , // users-line
+    { 22923, fa::fa_users_rays } , // users-rays
+    { 22934, fa::fa_users_rectangle } , // users-rectangle
+    { 22950, fa::fa_users_slash } , // users-slash
+    { 22962, fa::fa_users_viewfinder } , // users-viewfinder
+    { 19134, fa::fa_utensil_spoon } , // utensil-spoon
+    { 22979, fa::fa_utensils } , // utensils
+    { 22996, fa::fa_v } , // v
+    { 22998, fa::fa_van_shuttle } , // van-shuttle
+    { 23022, fa::fa_vault } , // vault
+    { 74, fa::fa_vcard } , // vcard
+    { 23028, fa::fa_vector_square } , // vector-square
+    { 23042, fa::fa_venus } , // venus
+    { 23048, fa::fa_venus_double } , // venus-double
+    { 23061, fa::fa_venus_mars } , // venus-mars
+    { 23072, fa::fa_vest } , // vest
+    { 23077, fa::fa_vest_patches } , // vest-patches
+    { 23090, fa::fa_vial } , // vial
+    { 23095, fa::fa_vial_circle_check } , // vial-circle-check
+    { 23113, fa::fa_vial_virus } , // vial-virus
+    { 23124, fa::fa_vials } , // vials
+    { 23130, fa::fa_video } , // video
+    { 23136, fa::fa_video_camera } , // video-camera
+    { 23149, fa::fa_video_slash } , // video-slash
+    { 23161, fa::fa_vihara } , // vihara
+    { 23168, fa::fa_virus } , // virus
+    { 23174, fa::fa_virus_covid } , // virus-covid
+    { 23186, fa::fa_virus_covid_slash } , // virus-covid-slash
+    { 23204, fa::fa_virus_slash } , // virus-slash
+    { 23216, fa::fa_viruses } , // viruses
+    { 23224, fa::fa_voicemail } , // voicemail
+    { 23234, fa::fa_volcano } , // volcano
+    { 23242, fa::fa_volleyball } , // volleyball
+    { 23253, fa::fa_volleyball_ball } , // volleyball-ball
+    { 16630, fa::fa_volume_control_phone } , // volume-control-phone
+    { 23302, fa::fa_volume_down } , // volume-down
+    { 23269, fa::fa_volume_high } , // volume-high
+    { 23291, fa::fa_volume_low } , // volume-low
+    { 23338, fa::fa_volume_mute } , // volume-mute
+    { 23314, fa::fa_volume_off } , // volume-off
+    { 23350, fa::fa_volume_times } , // volume-times
+    { 23281, fa::fa_volume_up } , // volume-up
+    { 23325, fa::fa_volume_xmark } , // volume-xmark
+    { 4715, fa::fa_vote_yea } , // vote-yea
+    { 23363, fa::fa_vr_cardboard } , // vr-cardboard
+    { 23376, fa::fa_w } , // w
+    { 23378, fa::fa_walkie_talkie } , // walkie-talkie
+    { 16397, fa::fa_walking } , // walking
+    { 23392, fa::fa_wallet } , // wallet
+    { 23399, fa::fa_wand_magic } , // wand-magic
+    { 23416, fa::fa_wand_magic_sparkles } , // wand-magic-sparkles
+    { 23456, fa::fa_wand_sparkles } , // wand-sparkles
+    { 23470, fa::fa_warehouse } , // warehouse
+    { 21921, fa::fa_warning } , // warning
+    { 23480, fa::fa_water } , // water
+    { 23486, fa::fa_water_ladder } , // water-ladder
+    { 23526, fa::fa_wave_square } , // wave-square
+    { 23566, fa::fa_weight } , // weight
+    { 23538, fa::fa_weight_hanging } , // weight-hanging
+    { 23553, fa::fa_weight_scale } , // weight-scale
+    { 23583, fa::fa_wheat_alt } , // wheat-alt
+    { 23573, fa::fa_wheat_awn } , // wheat-awn
+    { 23593, fa::fa_wheat_awn_circle_exclamation } , // wheat-awn-circle-exclamation
+    { 23622, fa::fa_wheelchair } , // wheelchair
+    { 23649, fa::fa_wheelchair_alt } , // wheelchair-alt
+    { 23633, fa::fa_wheelchair_move } , // wheelchair-move
+    { 23664, fa::fa_whiskey_glass } , // whiskey-glass
+    { 23692, fa::fa_wifi } , // wifi
+    { 23697, fa::fa_wifi_3 } , // wifi-3
+    { 23704, fa::fa_wifi_strong } , // wifi-strong
+    { 23716, fa::fa_wind } , // wind
+    { 17409, fa::fa_window_close } , // window-close
+    { 23721, fa::fa_window_maximize } , // window-maximize
+    { 23737, fa::fa_window_minimize } , // window-minimize
+    { 23753, fa::fa_window_restore } , // window-restore
+    { 23768, fa::fa_wine_bottle } , // wine-bottle
+    { 23780, fa::fa_wine_glass } , // wine-glass
+    { 23808, fa::fa_wine_glass_alt } , // wine-glass-alt
+    { 23791, fa::fa_wine_glass_empty } , // wine-glass-empty
+    { 23836, fa::fa_won } , // won
+    { 23823, fa::fa_won_sign } , // won-sign
+    { 23840, fa::fa_worm } , // worm
+    { 23845, fa::fa_wrench } , // wrench
+    { 23852, fa::fa_x } , // x
+    { 23854, fa::fa_x_ray } , // x-ray
+    { 23860, fa::fa_xmark } , // xmark
+    { 5842, fa::fa_xmark_circle } , // xmark-circle
+    { 19920, fa::fa_xmark_square } , // xmark-square
+    { 23894, fa::fa_xmarks_lines } , // xmarks-lines
+    { 23907, fa::fa_y } , // y
+    { 23930, fa::fa_yen } , // yen
+    { 23909, fa::fa_yen_sign } , // yen-sign
+    { 23934, fa::fa_yin_yang } , // yin-yang
+    { 23943, fa::fa_z } , // z
+    { 2770, fa::fa_zap }  // zap
 };
+static constexpr int faCommonIconCount = 1962;
 
-#ifdef FONT_AWESOME_PRO
-static const fa::QtAwesomeNamedIcon faProIconArray[] = {
-    { "00", fa::fa_00 } ,
-    { "360-degrees", fa::fa_360_degrees } ,
-    { "abacus", fa::fa_abacus } ,
-    { "accent-grave", fa::fa_accent_grave } ,
-    { "acorn", fa::fa_acorn } ,
-    { "air-conditioner", fa::fa_air_conditioner } ,
-    { "airplay", fa::fa_airplay } ,
-    { "alarm-clock", fa::fa_alarm_clock } ,
-    { "alarm-exclamation", fa::fa_alarm_exclamation } ,
-    { "alarm-plus", fa::fa_alarm_plus } ,
-    { "alarm-snooze", fa::fa_alarm_snooze } ,
-    { "album", fa::fa_album } ,
-    { "album-circle-plus", fa::fa_album_circle_plus } ,
-    { "album-circle-user", fa::fa_album_circle_user } ,
-    { "album-collection", fa::fa_album_collection } ,
-    { "album-collection-circle-plus", fa::fa_album_collection_circle_plus } ,
-    { "album-collection-circle-user", fa::fa_album_collection_circle_user } ,
-    { "alicorn", fa::fa_alicorn } ,
-    { "alien", fa::fa_alien } ,
-    { "alien-8bit", fa::fa_alien_8bit } ,
-    { "alien-monster", fa::fa_alien_monster } ,
-    { "align-slash", fa::fa_align_slash } ,
-    { "alt", fa::fa_alt } ,
-    { "amp-guitar", fa::fa_amp_guitar } ,
-    { "ampersand", fa::fa_ampersand } ,
-    { "angel", fa::fa_angel } ,
-    { "angle", fa::fa_angle } ,
-    { "angle-90", fa::fa_angle_90 } ,
-    { "angles-up-down", fa::fa_angles_up_down } ,
-    { "ant", fa::fa_ant } ,
-    { "apartment", fa::fa_apartment } ,
-    { "aperture", fa::fa_aperture } ,
-    { "apostrophe", fa::fa_apostrophe } ,
-    { "apple-core", fa::fa_apple_core } ,
-    { "arrow-down-arrow-up", fa::fa_arrow_down_arrow_up } ,
-    { "sort-alt", fa::fa_sort_alt } ,
-    { "arrow-down-big-small", fa::fa_arrow_down_big_small } ,
-    { "sort-size-down", fa::fa_sort_size_down } ,
-    { "arrow-down-from-arc", fa::fa_arrow_down_from_arc } ,
-    { "arrow-down-from-bracket", fa::fa_arrow_down_from_bracket } ,
-    { "arrow-down-from-dotted-line", fa::fa_arrow_down_from_dotted_line } ,
-    { "arrow-down-from-line", fa::fa_arrow_down_from_line } ,
-    { "arrow-from-top", fa::fa_arrow_from_top } ,
-    { "arrow-down-left", fa::fa_arrow_down_left } ,
-    { "arrow-down-left-and-arrow-up-right-to-center", fa::fa_arrow_down_left_and_arrow_up_right_to_center } ,
-    { "arrow-down-right", fa::fa_arrow_down_right } ,
-    { "arrow-down-small-big", fa::fa_arrow_down_small_big } ,
-    { "sort-size-down-alt", fa::fa_sort_size_down_alt } ,
-    { "arrow-down-square-triangle", fa::fa_arrow_down_square_triangle } ,
-    { "sort-shapes-down-alt", fa::fa_sort_shapes_down_alt } ,
-    { "arrow-down-to-arc", fa::fa_arrow_down_to_arc } ,
-    { "arrow-down-to-bracket", fa::fa_arrow_down_to_bracket } ,
-    { "arrow-down-to-dotted-line", fa::fa_arrow_down_to_dotted_line } ,
-    { "arrow-down-to-line", fa::fa_arrow_down_to_line } ,
-    { "arrow-to-bottom", fa::fa_arrow_to_bottom } ,
-    { "arrow-down-to-square", fa::fa_arrow_down_to_square } ,
-    { "arrow-down-triangle-square", fa::fa_arrow_down_triangle_square } ,
-    { "sort-shapes-down", fa::fa_sort_shapes_down } ,
-    { "arrow-left-from-arc", fa::fa_arrow_left_from_arc } ,
-    { "arrow-left-from-bracket", fa::fa_arrow_left_from_bracket } ,
-    { "arrow-left-from-line", fa::fa_arrow_left_from_line } ,
-    { "arrow-from-right", fa::fa_arrow_from_right } ,
-    { "arrow-left-long-to-line", fa::fa_arrow_left_long_to_line } ,
-    { "arrow-left-to-arc", fa::fa_arrow_left_to_arc } ,
-    { "arrow-left-to-bracket", fa::fa_arrow_left_to_bracket } ,
-    { "arrow-left-to-line", fa::fa_arrow_left_to_line } ,
-    { "arrow-to-left", fa::fa_arrow_to_left } ,
-    { "arrow-progress", fa::fa_arrow_progress } ,
-    { "arrow-right-from-arc", fa::fa_arrow_right_from_arc } ,
-    { "arrow-right-from-line", fa::fa_arrow_right_from_line } ,
-    { "arrow-from-left", fa::fa_arrow_from_left } ,
-    { "arrow-right-long-to-line", fa::fa_arrow_right_long_to_line } ,
-    { "arrow-right-to-arc", fa::fa_arrow_right_to_arc } ,
-    { "arrow-right-to-line", fa::fa_arrow_right_to_line } ,
-    { "arrow-to-right", fa::fa_arrow_to_right } ,
-    { "arrow-turn-down-left", fa::fa_arrow_turn_down_left } ,
-    { "arrow-turn-down-right", fa::fa_arrow_turn_down_right } ,
-    { "arrow-turn-left", fa::fa_arrow_turn_left } ,
-    { "arrow-turn-left-down", fa::fa_arrow_turn_left_down } ,
-    { "arrow-turn-left-up", fa::fa_arrow_turn_left_up } ,
-    { "arrow-turn-right", fa::fa_arrow_turn_right } ,
-    { "arrow-up-arrow-down", fa::fa_arrow_up_arrow_down } ,
-    { "sort-up-down", fa::fa_sort_up_down } ,
-    { "arrow-up-big-small", fa::fa_arrow_up_big_small } ,
-    { "sort-size-up", fa::fa_sort_size_up } ,
-    { "arrow-up-from-arc", fa::fa_arrow_up_from_arc } ,
-    { "arrow-up-from-dotted-line", fa::fa_arrow_up_from_dotted_line } ,
-    { "arrow-up-from-line", fa::fa_arrow_up_from_line } ,
-    { "arrow-from-bottom", fa::fa_arrow_from_bottom } ,
-    { "arrow-up-from-square", fa::fa_arrow_up_from_square } ,
-    { "arrow-up-left", fa::fa_arrow_up_left } ,
-    { "arrow-up-left-from-circle", fa::fa_arrow_up_left_from_circle } ,
-    { "arrow-up-right", fa::fa_arrow_up_right } ,
-    { "arrow-up-right-and-arrow-down-left-from-center", fa::fa_arrow_up_right_and_arrow_down_left_from_center } ,
-    { "arrow-up-small-big", fa::fa_arrow_up_small_big } ,
-    { "sort-size-up-alt", fa::fa_sort_size_up_alt } ,
-    { "arrow-up-square-triangle", fa::fa_arrow_up_square_triangle } ,
-    { "sort-shapes-up-alt", fa::fa_sort_shapes_up_alt } ,
-    { "arrow-up-to-arc", fa::fa_arrow_up_to_arc } ,
-    { "arrow-up-to-bracket", fa::fa_arrow_up_to_bracket } ,
-    { "arrow-up-to-dotted-line", fa::fa_arrow_up_to_dotted_line } ,
-    { "arrow-up-to-line", fa::fa_arrow_up_to_line } ,
-    { "arrow-to-top", fa::fa_arrow_to_top } ,
-    { "arrow-up-triangle-square", fa::fa_arrow_up_triangle_square } ,
-    { "sort-shapes-up", fa::fa_sort_shapes_up } ,
-    { "arrows-cross", fa::fa_arrows_cross } ,
-    { "arrows-from-dotted-line", fa::fa_arrows_from_dotted_line } ,
-    { "arrows-from-line", fa::fa_arrows_from_line } ,
-    { "arrows-maximize", fa::fa_arrows_maximize } ,
-    { "expand-arrows", fa::fa_expand_arrows } ,
-    { "arrows-minimize", fa::fa_arrows_minimize } ,
-    { "compress-arrows", fa::fa_compress_arrows } ,
-    { "arrows-repeat", fa::fa_arrows_repeat } ,
-    { "repeat-alt", fa::fa_repeat_alt } ,
-    { "arrows-repeat-1", fa::fa_arrows_repeat_1 } ,
-    { "repeat-1-alt", fa::fa_repeat_1_alt } ,
-    { "arrows-retweet", fa::fa_arrows_retweet } ,
-    { "retweet-alt", fa::fa_retweet_alt } ,
-    { "arrows-rotate-reverse", fa::fa_arrows_rotate_reverse } ,
-    { "arrows-to-dotted-line", fa::fa_arrows_to_dotted_line } ,
-    { "arrows-to-line", fa::fa_arrows_to_line } ,
-    { "atom-simple", fa::fa_atom_simple } ,
-    { "atom-alt", fa::fa_atom_alt } ,
-    { "audio-description-slash", fa::fa_audio_description_slash } ,
-    { "avocado", fa::fa_avocado } ,
-    { "award-simple", fa::fa_award_simple } ,
-    { "axe", fa::fa_axe } ,
-    { "axe-battle", fa::fa_axe_battle } ,
-    { "backpack", fa::fa_backpack } ,
-    { "badge", fa::fa_badge } ,
-    { "badge-check", fa::fa_badge_check } ,
-    { "badge-dollar", fa::fa_badge_dollar } ,
-    { "badge-percent", fa::fa_badge_percent } ,
-    { "badge-sheriff", fa::fa_badge_sheriff } ,
-    { "badger-honey", fa::fa_badger_honey } ,
-    { "badminton", fa::fa_badminton } ,
-    { "bag-seedling", fa::fa_bag_seedling } ,
-    { "bag-shopping-minus", fa::fa_bag_shopping_minus } ,
-    { "bag-shopping-plus", fa::fa_bag_shopping_plus } ,
-    { "bagel", fa::fa_bagel } ,
-    { "bags-shopping", fa::fa_bags_shopping } ,
-    { "baguette", fa::fa_baguette } ,
-    { "ball-pile", fa::fa_ball_pile } ,
-    { "balloon", fa::fa_balloon } ,
-    { "balloons", fa::fa_balloons } ,
-    { "ballot", fa::fa_ballot } ,
-    { "ballot-check", fa::fa_ballot_check } ,
-    { "ban-bug", fa::fa_ban_bug } ,
-    { "debug", fa::fa_debug } ,
-    { "ban-parking", fa::fa_ban_parking } ,
-    { "parking-circle-slash", fa::fa_parking_circle_slash } ,
-    { "banana", fa::fa_banana } ,
-    { "banjo", fa::fa_banjo } ,
-    { "barcode-read", fa::fa_barcode_read } ,
-    { "barcode-scan", fa::fa_barcode_scan } ,
-    { "bars-filter", fa::fa_bars_filter } ,
-    { "bars-sort", fa::fa_bars_sort } ,
-    { "basket-shopping-minus", fa::fa_basket_shopping_minus } ,
-    { "basket-shopping-plus", fa::fa_basket_shopping_plus } ,
-    { "basket-shopping-simple", fa::fa_basket_shopping_simple } ,
-    { "shopping-basket-alt", fa::fa_shopping_basket_alt } ,
-    { "basketball-hoop", fa::fa_basketball_hoop } ,
-    { "bat", fa::fa_bat } ,
-    { "battery-bolt", fa::fa_battery_bolt } ,
-    { "battery-exclamation", fa::fa_battery_exclamation } ,
-    { "battery-low", fa::fa_battery_low } ,
-    { "battery-1", fa::fa_battery_1 } ,
-    { "battery-slash", fa::fa_battery_slash } ,
-    { "bed-bunk", fa::fa_bed_bunk } ,
-    { "bed-empty", fa::fa_bed_empty } ,
-    { "bed-front", fa::fa_bed_front } ,
-    { "bed-alt", fa::fa_bed_alt } ,
-    { "bee", fa::fa_bee } ,
-    { "beer-mug", fa::fa_beer_mug } ,
-    { "beer-foam", fa::fa_beer_foam } ,
-    { "bell-exclamation", fa::fa_bell_exclamation } ,
-    { "bell-on", fa::fa_bell_on } ,
-    { "bell-plus", fa::fa_bell_plus } ,
-    { "bell-ring", fa::fa_bell_ring } ,
-    { "bell-school", fa::fa_bell_school } ,
-    { "bell-school-slash", fa::fa_bell_school_slash } ,
-    { "bells", fa::fa_bells } ,
-    { "bench-tree", fa::fa_bench_tree } ,
-    { "billboard", fa::fa_billboard } ,
-    { "bin-bottles", fa::fa_bin_bottles } ,
-    { "bin-bottles-recycle", fa::fa_bin_bottles_recycle } ,
-    { "bin-recycle", fa::fa_bin_recycle } ,
-    { "binary", fa::fa_binary } ,
-    { "binary-circle-check", fa::fa_binary_circle_check } ,
-    { "binary-lock", fa::fa_binary_lock } ,
-    { "binary-slash", fa::fa_binary_slash } ,
-    { "bird", fa::fa_bird } ,
-    { "blanket", fa::fa_blanket } ,
-    { "blanket-fire", fa::fa_blanket_fire } ,
-    { "blinds", fa::fa_blinds } ,
-    { "blinds-open", fa::fa_blinds_open } ,
-    { "blinds-raised", fa::fa_blinds_raised } ,
-    { "block", fa::fa_block } ,
-    { "block-brick", fa::fa_block_brick } ,
-    { "wall-brick", fa::fa_wall_brick } ,
-    { "block-brick-fire", fa::fa_block_brick_fire } ,
-    { "firewall", fa::fa_firewall } ,
-    { "block-question", fa::fa_block_question } ,
-    { "block-quote", fa::fa_block_quote } ,
-    { "blueberries", fa::fa_blueberries } ,
-    { "bolt-auto", fa::fa_bolt_auto } ,
-    { "bolt-slash", fa::fa_bolt_slash } ,
-    { "bone-break", fa::fa_bone_break } ,
-    { "book-arrow-right", fa::fa_book_arrow_right } ,
-    { "book-arrow-up", fa::fa_book_arrow_up } ,
-    { "book-blank", fa::fa_book_blank } ,
-    { "book-alt", fa::fa_book_alt } ,
-    { "book-circle-arrow-right", fa::fa_book_circle_arrow_right } ,
-    { "book-circle-arrow-up", fa::fa_book_circle_arrow_up } ,
-    { "book-copy", fa::fa_book_copy } ,
-    { "book-font", fa::fa_book_font } ,
-    { "book-heart", fa::fa_book_heart } ,
-    { "book-open-cover", fa::fa_book_open_cover } ,
-    { "book-open-alt", fa::fa_book_open_alt } ,
-    { "book-section", fa::fa_book_section } ,
-    { "book-law", fa::fa_book_law } ,
-    { "book-sparkles", fa::fa_book_sparkles } ,
-    { "book-spells", fa::fa_book_spells } ,
-    { "book-user", fa::fa_book_user } ,
-    { "bookmark-slash", fa::fa_bookmark_slash } ,
-    { "books", fa::fa_books } ,
-    { "books-medical", fa::fa_books_medical } ,
-    { "boombox", fa::fa_boombox } ,
-    { "boot", fa::fa_boot } ,
-    { "boot-heeled", fa::fa_boot_heeled } ,
-    { "booth-curtain", fa::fa_booth_curtain } ,
-    { "border-bottom", fa::fa_border_bottom } ,
-    { "border-bottom-right", fa::fa_border_bottom_right } ,
-    { "border-style-alt", fa::fa_border_style_alt } ,
-    { "border-center-h", fa::fa_border_center_h } ,
-    { "border-center-v", fa::fa_border_center_v } ,
-    { "border-inner", fa::fa_border_inner } ,
-    { "border-left", fa::fa_border_left } ,
-    { "border-outer", fa::fa_border_outer } ,
-    { "border-right", fa::fa_border_right } ,
-    { "border-top", fa::fa_border_top } ,
-    { "bottle-baby", fa::fa_bottle_baby } ,
-    { "bow-arrow", fa::fa_bow_arrow } ,
-    { "bowl-chopsticks", fa::fa_bowl_chopsticks } ,
-    { "bowl-chopsticks-noodles", fa::fa_bowl_chopsticks_noodles } ,
-    { "bowl-hot", fa::fa_bowl_hot } ,
-    { "soup", fa::fa_soup } ,
-    { "bowl-scoop", fa::fa_bowl_scoop } ,
-    { "bowl-shaved-ice", fa::fa_bowl_shaved_ice } ,
-    { "bowl-scoops", fa::fa_bowl_scoops } ,
-    { "bowl-soft-serve", fa::fa_bowl_soft_serve } ,
-    { "bowl-spoon", fa::fa_bowl_spoon } ,
-    { "bowling-ball-pin", fa::fa_bowling_ball_pin } ,
-    { "bowling-pins", fa::fa_bowling_pins } ,
-    { "box-ballot", fa::fa_box_ballot } ,
-    { "box-check", fa::fa_box_check } ,
-    { "box-circle-check", fa::fa_box_circle_check } ,
-    { "box-dollar", fa::fa_box_dollar } ,
-    { "box-usd", fa::fa_box_usd } ,
-    { "box-heart", fa::fa_box_heart } ,
-    { "box-open-full", fa::fa_box_open_full } ,
-    { "box-full", fa::fa_box_full } ,
-    { "box-taped", fa::fa_box_taped } ,
-    { "box-alt", fa::fa_box_alt } ,
-    { "boxing-glove", fa::fa_boxing_glove } ,
-    { "glove-boxing", fa::fa_glove_boxing } ,
-    { "bracket-curly", fa::fa_bracket_curly } ,
-    { "bracket-curly-left", fa::fa_bracket_curly_left } ,
-    { "bracket-curly-right", fa::fa_bracket_curly_right } ,
-    { "bracket-round", fa::fa_bracket_round } ,
-    { "parenthesis", fa::fa_parenthesis } ,
-    { "bracket-round-right", fa::fa_bracket_round_right } ,
-    { "bracket-square", fa::fa_bracket_square } ,
-    { "bracket", fa::fa_bracket } ,
-    { "bracket-left", fa::fa_bracket_left } ,
-    { "bracket-square-right", fa::fa_bracket_square_right } ,
-    { "brackets-curly", fa::fa_brackets_curly } ,
-    { "brackets-round", fa::fa_brackets_round } ,
-    { "parentheses", fa::fa_parentheses } ,
-    { "brackets-square", fa::fa_brackets_square } ,
-    { "brackets", fa::fa_brackets } ,
-    { "brain-arrow-curved-right", fa::fa_brain_arrow_curved_right } ,
-    { "mind-share", fa::fa_mind_share } ,
-    { "brain-circuit", fa::fa_brain_circuit } ,
-    { "brake-warning", fa::fa_brake_warning } ,
-    { "bread-loaf", fa::fa_bread_loaf } ,
-    { "bread-slice-butter", fa::fa_bread_slice_butter } ,
-    { "bridge-suspension", fa::fa_bridge_suspension } ,
-    { "briefcase-arrow-right", fa::fa_briefcase_arrow_right } ,
-    { "briefcase-blank", fa::fa_briefcase_blank } ,
-    { "brightness", fa::fa_brightness } ,
-    { "brightness-low", fa::fa_brightness_low } ,
-    { "bring-forward", fa::fa_bring_forward } ,
-    { "bring-front", fa::fa_bring_front } ,
-    { "broccoli", fa::fa_broccoli } ,
-    { "broom-wide", fa::fa_broom_wide } ,
-    { "browser", fa::fa_browser } ,
-    { "browsers", fa::fa_browsers } ,
-    { "building-magnifying-glass", fa::fa_building_magnifying_glass } ,
-    { "building-memo", fa::fa_building_memo } ,
-    { "buildings", fa::fa_buildings } ,
-    { "bulldozer", fa::fa_bulldozer } ,
-    { "bullseye-arrow", fa::fa_bullseye_arrow } ,
-    { "bullseye-pointer", fa::fa_bullseye_pointer } ,
-    { "buoy", fa::fa_buoy } ,
-    { "buoy-mooring", fa::fa_buoy_mooring } ,
-    { "burger-cheese", fa::fa_burger_cheese } ,
-    { "cheeseburger", fa::fa_cheeseburger } ,
-    { "burger-fries", fa::fa_burger_fries } ,
-    { "burger-glass", fa::fa_burger_glass } ,
-    { "burger-lettuce", fa::fa_burger_lettuce } ,
-    { "burger-soda", fa::fa_burger_soda } ,
-    { "burrito", fa::fa_burrito } ,
-    { "bus-school", fa::fa_bus_school } ,
-    { "butter", fa::fa_butter } ,
-    { "cabin", fa::fa_cabin } ,
-    { "cabinet-filing", fa::fa_cabinet_filing } ,
-    { "cactus", fa::fa_cactus } ,
-    { "caduceus", fa::fa_caduceus } ,
-    { "cake-slice", fa::fa_cake_slice } ,
-    { "shortcake", fa::fa_shortcake } ,
-    { "calculator-simple", fa::fa_calculator_simple } ,
-    { "calculator-alt", fa::fa_calculator_alt } ,
-    { "calendar-arrow-down", fa::fa_calendar_arrow_down } ,
-    { "calendar-download", fa::fa_calendar_download } ,
-    { "calendar-arrow-up", fa::fa_calendar_arrow_up } ,
-    { "calendar-upload", fa::fa_calendar_upload } ,
-    { "calendar-circle-exclamation", fa::fa_calendar_circle_exclamation } ,
-    { "calendar-circle-minus", fa::fa_calendar_circle_minus } ,
-    { "calendar-circle-plus", fa::fa_calendar_circle_plus } ,
-    { "calendar-circle-user", fa::fa_calendar_circle_user } ,
-    { "calendar-clock", fa::fa_calendar_clock } ,
-    { "calendar-time", fa::fa_calendar_time } ,
-    { "calendar-exclamation", fa::fa_calendar_exclamation } ,
-    { "calendar-heart", fa::fa_calendar_heart } ,
-    { "calendar-image", fa::fa_calendar_image } ,
-    { "calendar-lines", fa::fa_calendar_lines } ,
-    { "calendar-note", fa::fa_calendar_note } ,
-    { "calendar-lines-pen", fa::fa_calendar_lines_pen } ,
-    { "calendar-pen", fa::fa_calendar_pen } ,
-    { "calendar-edit", fa::fa_calendar_edit } ,
-    { "calendar-range", fa::fa_calendar_range } ,
-    { "calendar-star", fa::fa_calendar_star } ,
-    { "calendar-users", fa::fa_calendar_users } ,
-    { "calendars", fa::fa_calendars } ,
-    { "camcorder", fa::fa_camcorder } ,
-    { "video-handheld", fa::fa_video_handheld } ,
-    { "camera-cctv", fa::fa_camera_cctv } ,
-    { "cctv", fa::fa_cctv } ,
-    { "camera-movie", fa::fa_camera_movie } ,
-    { "camera-polaroid", fa::fa_camera_polaroid } ,
-    { "camera-security", fa::fa_camera_security } ,
-    { "camera-home", fa::fa_camera_home } ,
-    { "camera-slash", fa::fa_camera_slash } ,
-    { "camera-viewfinder", fa::fa_camera_viewfinder } ,
-    { "screenshot", fa::fa_screenshot } ,
-    { "camera-web", fa::fa_camera_web } ,
-    { "webcam", fa::fa_webcam } ,
-    { "camera-web-slash", fa::fa_camera_web_slash } ,
-    { "webcam-slash", fa::fa_webcam_slash } ,
-    { "campfire", fa::fa_campfire } ,
-    { "can-food", fa::fa_can_food } ,
-    { "candle-holder", fa::fa_candle_holder } ,
-    { "candy", fa::fa_candy } ,
-    { "candy-bar", fa::fa_candy_bar } ,
-    { "chocolate-bar", fa::fa_chocolate_bar } ,
-    { "candy-corn", fa::fa_candy_corn } ,
-    { "cannon", fa::fa_cannon } ,
-    { "car-bolt", fa::fa_car_bolt } ,
-    { "car-building", fa::fa_car_building } ,
-    { "car-bump", fa::fa_car_bump } ,
-    { "car-bus", fa::fa_car_bus } ,
-    { "car-circle-bolt", fa::fa_car_circle_bolt } ,
-    { "car-garage", fa::fa_car_garage } ,
-    { "car-mirrors", fa::fa_car_mirrors } ,
-    { "car-side-bolt", fa::fa_car_side_bolt } ,
-    { "car-tilt", fa::fa_car_tilt } ,
-    { "car-wash", fa::fa_car_wash } ,
-    { "car-wrench", fa::fa_car_wrench } ,
-    { "car-mechanic", fa::fa_car_mechanic } ,
-    { "caravan-simple", fa::fa_caravan_simple } ,
-    { "caravan-alt", fa::fa_caravan_alt } ,
-    { "card-club", fa::fa_card_club } ,
-    { "card-diamond", fa::fa_card_diamond } ,
-    { "card-heart", fa::fa_card_heart } ,
-    { "card-spade", fa::fa_card_spade } ,
-    { "cards", fa::fa_cards } ,
-    { "cards-blank", fa::fa_cards_blank } ,
-    { "carpool", fa::fa_carpool } ,
-    { "car-people", fa::fa_car_people } ,
-    { "cars", fa::fa_cars } ,
-    { "cart-arrow-up", fa::fa_cart_arrow_up } ,
-    { "cart-circle-arrow-down", fa::fa_cart_circle_arrow_down } ,
-    { "cart-circle-arrow-up", fa::fa_cart_circle_arrow_up } ,
-    { "cart-circle-check", fa::fa_cart_circle_check } ,
-    { "cart-circle-exclamation", fa::fa_cart_circle_exclamation } ,
-    { "cart-circle-plus", fa::fa_cart_circle_plus } ,
-    { "cart-circle-xmark", fa::fa_cart_circle_xmark } ,
-    { "cart-flatbed-boxes", fa::fa_cart_flatbed_boxes } ,
-    { "dolly-flatbed-alt", fa::fa_dolly_flatbed_alt } ,
-    { "cart-flatbed-empty", fa::fa_cart_flatbed_empty } ,
-    { "dolly-flatbed-empty", fa::fa_dolly_flatbed_empty } ,
-    { "cart-minus", fa::fa_cart_minus } ,
-    { "cart-shopping-fast", fa::fa_cart_shopping_fast } ,
-    { "cart-xmark", fa::fa_cart_xmark } ,
-    { "cassette-betamax", fa::fa_cassette_betamax } ,
-    { "betamax", fa::fa_betamax } ,
-    { "cassette-tape", fa::fa_cassette_tape } ,
-    { "cassette-vhs", fa::fa_cassette_vhs } ,
-    { "vhs", fa::fa_vhs } ,
-    { "castle", fa::fa_castle } ,
-    { "cat-space", fa::fa_cat_space } ,
-    { "cauldron", fa::fa_cauldron } ,
-    { "chair-office", fa::fa_chair_office } ,
-    { "champagne-glass", fa::fa_champagne_glass } ,
-    { "glass-champagne", fa::fa_glass_champagne } ,
-    { "chart-bullet", fa::fa_chart_bullet } ,
-    { "chart-candlestick", fa::fa_chart_candlestick } ,
-    { "chart-fft", fa::fa_chart_fft } ,
-    { "chart-kanban", fa::fa_chart_kanban } ,
-    { "chart-line-down", fa::fa_chart_line_down } ,
-    { "chart-line-up", fa::fa_chart_line_up } ,
-    { "chart-line-up-down", fa::fa_chart_line_up_down } ,
-    { "chart-mixed", fa::fa_chart_mixed } ,
-    { "analytics", fa::fa_analytics } ,
-    { "chart-mixed-up-circle-currency", fa::fa_chart_mixed_up_circle_currency } ,
-    { "chart-mixed-up-circle-dollar", fa::fa_chart_mixed_up_circle_dollar } ,
-    { "chart-network", fa::fa_chart_network } ,
-    { "chart-pie-simple", fa::fa_chart_pie_simple } ,
-    { "chart-pie-alt", fa::fa_chart_pie_alt } ,
-    { "chart-pie-simple-circle-currency", fa::fa_chart_pie_simple_circle_currency } ,
-    { "chart-pie-simple-circle-dollar", fa::fa_chart_pie_simple_circle_dollar } ,
-    { "chart-pyramid", fa::fa_chart_pyramid } ,
-    { "chart-radar", fa::fa_chart_radar } ,
-    { "chart-scatter", fa::fa_chart_scatter } ,
-    { "chart-scatter-3d", fa::fa_chart_scatter_3d } ,
-    { "chart-scatter-bubble", fa::fa_chart_scatter_bubble } ,
-    { "chart-simple-horizontal", fa::fa_chart_simple_horizontal } ,
-    { "chart-sine", fa::fa_chart_sine } ,
-    { "chart-tree-map", fa::fa_chart_tree_map } ,
-    { "chart-user", fa::fa_chart_user } ,
-    { "user-chart", fa::fa_user_chart } ,
-    { "chart-waterfall", fa::fa_chart_waterfall } ,
-    { "cheese-swiss", fa::fa_cheese_swiss } ,
-    { "cherries", fa::fa_cherries } ,
-    { "chess-bishop-piece", fa::fa_chess_bishop_piece } ,
-    { "chess-bishop-alt", fa::fa_chess_bishop_alt } ,
-    { "chess-clock", fa::fa_chess_clock } ,
-    { "chess-clock-flip", fa::fa_chess_clock_flip } ,
-    { "chess-clock-alt", fa::fa_chess_clock_alt } ,
-    { "chess-king-piece", fa::fa_chess_king_piece } ,
-    { "chess-king-alt", fa::fa_chess_king_alt } ,
-    { "chess-knight-piece", fa::fa_chess_knight_piece } ,
-    { "chess-knight-alt", fa::fa_chess_knight_alt } ,
-    { "chess-pawn-piece", fa::fa_chess_pawn_piece } ,
-    { "chess-pawn-alt", fa::fa_chess_pawn_alt } ,
-    { "chess-queen-piece", fa::fa_chess_queen_piece } ,
-    { "chess-queen-alt", fa::fa_chess_queen_alt } ,
-    { "chess-rook-piece", fa::fa_chess_rook_piece } ,
-    { "chess-rook-alt", fa::fa_chess_rook_alt } ,
-    { "chestnut", fa::fa_chestnut } ,
-    { "chevrons-down", fa::fa_chevrons_down } ,
-    { "chevron-double-down", fa::fa_chevron_double_down } ,
-    { "chevrons-left", fa::fa_chevrons_left } ,
-    { "chevron-double-left", fa::fa_chevron_double_left } ,
-    { "chevrons-right", fa::fa_chevrons_right } ,
-    { "chevron-double-right", fa::fa_chevron_double_right } ,
-    { "chevrons-up", fa::fa_chevrons_up } ,
-    { "chevron-double-up", fa::fa_chevron_double_up } ,
-    { "chf-sign", fa::fa_chf_sign } ,
-    { "chimney", fa::fa_chimney } ,
-    { "chopsticks", fa::fa_chopsticks } ,
-    { "circle-0", fa::fa_circle_0 } ,
-    { "circle-1", fa::fa_circle_1 } ,
-    { "circle-2", fa::fa_circle_2 } ,
-    { "circle-3", fa::fa_circle_3 } ,
-    { "circle-4", fa::fa_circle_4 } ,
-    { "circle-5", fa::fa_circle_5 } ,
-    { "circle-6", fa::fa_circle_6 } ,
-    { "circle-7", fa::fa_circle_7 } ,
-    { "circle-8", fa::fa_circle_8 } ,
-    { "circle-9", fa::fa_circle_9 } ,
-    { "circle-a", fa::fa_circle_a } ,
-    { "circle-ampersand", fa::fa_circle_ampersand } ,
-    { "circle-arrow-down-left", fa::fa_circle_arrow_down_left } ,
-    { "circle-arrow-down-right", fa::fa_circle_arrow_down_right } ,
-    { "circle-arrow-up-left", fa::fa_circle_arrow_up_left } ,
-    { "circle-arrow-up-right", fa::fa_circle_arrow_up_right } ,
-    { "circle-b", fa::fa_circle_b } ,
-    { "circle-bolt", fa::fa_circle_bolt } ,
-    { "circle-book-open", fa::fa_circle_book_open } ,
-    { "book-circle", fa::fa_book_circle } ,
-    { "circle-bookmark", fa::fa_circle_bookmark } ,
-    { "bookmark-circle", fa::fa_bookmark_circle } ,
-    { "circle-c", fa::fa_circle_c } ,
-    { "circle-calendar", fa::fa_circle_calendar } ,
-    { "calendar-circle", fa::fa_calendar_circle } ,
-    { "circle-camera", fa::fa_circle_camera } ,
-    { "camera-circle", fa::fa_camera_circle } ,
-    { "circle-caret-down", fa::fa_circle_caret_down } ,
-    { "caret-circle-down", fa::fa_caret_circle_down } ,
-    { "circle-caret-left", fa::fa_circle_caret_left } ,
-    { "caret-circle-left", fa::fa_caret_circle_left } ,
-    { "circle-caret-right", fa::fa_circle_caret_right } ,
-    { "caret-circle-right", fa::fa_caret_circle_right } ,
-    { "circle-caret-up", fa::fa_circle_caret_up } ,
-    { "caret-circle-up", fa::fa_caret_circle_up } ,
-    { "circle-d", fa::fa_circle_d } ,
-    { "circle-dashed", fa::fa_circle_dashed } ,
-    { "circle-divide", fa::fa_circle_divide } ,
-    { "circle-dollar", fa::fa_circle_dollar } ,
-    { "dollar-circle", fa::fa_dollar_circle } ,
-    { "usd-circle", fa::fa_usd_circle } ,
-    { "circle-down-left", fa::fa_circle_down_left } ,
-    { "circle-down-right", fa::fa_circle_down_right } ,
-    { "circle-e", fa::fa_circle_e } ,
-    { "circle-ellipsis", fa::fa_circle_ellipsis } ,
-    { "circle-ellipsis-vertical", fa::fa_circle_ellipsis_vertical } ,
-    { "circle-envelope", fa::fa_circle_envelope } ,
-    { "envelope-circle", fa::fa_envelope_circle } ,
-    { "circle-euro", fa::fa_circle_euro } ,
-    { "circle-exclamation-check", fa::fa_circle_exclamation_check } ,
-    { "circle-f", fa::fa_circle_f } ,
-    { "circle-g", fa::fa_circle_g } ,
-    { "circle-gf", fa::fa_circle_gf } ,
-    { "circle-half", fa::fa_circle_half } ,
-    { "circle-heart", fa::fa_circle_heart } ,
-    { "heart-circle", fa::fa_heart_circle } ,
-    { "circle-i", fa::fa_circle_i } ,
-    { "circle-j", fa::fa_circle_j } ,
-    { "circle-k", fa::fa_circle_k } ,
-    { "circle-l", fa::fa_circle_l } ,
-    { "circle-location-arrow", fa::fa_circle_location_arrow } ,
-    { "location-circle", fa::fa_location_circle } ,
-    { "circle-m", fa::fa_circle_m } ,
-    { "circle-microphone", fa::fa_circle_microphone } ,
-    { "microphone-circle", fa::fa_microphone_circle } ,
-    { "circle-microphone-lines", fa::fa_circle_microphone_lines } ,
-    { "microphone-circle-alt", fa::fa_microphone_circle_alt } ,
-    { "circle-n", fa::fa_circle_n } ,
-    { "circle-o", fa::fa_circle_o } ,
-    { "circle-p", fa::fa_circle_p } ,
-    { "circle-parking", fa::fa_circle_parking } ,
-    { "parking-circle", fa::fa_parking_circle } ,
-    { "circle-phone", fa::fa_circle_phone } ,
-    { "phone-circle", fa::fa_phone_circle } ,
-    { "circle-phone-flip", fa::fa_circle_phone_flip } ,
-    { "phone-circle-alt", fa::fa_phone_circle_alt } ,
-    { "circle-phone-hangup", fa::fa_circle_phone_hangup } ,
-    { "phone-circle-down", fa::fa_phone_circle_down } ,
-    { "circle-q", fa::fa_circle_q } ,
-    { "circle-quarter", fa::fa_circle_quarter } ,
-    { "circle-quarter-stroke", fa::fa_circle_quarter_stroke } ,
-    { "circle-quarters", fa::fa_circle_quarters } ,
-    { "circle-r", fa::fa_circle_r } ,
-    { "circle-s", fa::fa_circle_s } ,
-    { "circle-small", fa::fa_circle_small } ,
-    { "circle-sort", fa::fa_circle_sort } ,
-    { "sort-circle", fa::fa_sort_circle } ,
-    { "circle-sort-down", fa::fa_circle_sort_down } ,
-    { "sort-circle-down", fa::fa_sort_circle_down } ,
-    { "circle-sort-up", fa::fa_circle_sort_up } ,
-    { "sort-circle-up", fa::fa_sort_circle_up } ,
-    { "circle-star", fa::fa_circle_star } ,
-    { "star-circle", fa::fa_star_circle } ,
-    { "circle-sterling", fa::fa_circle_sterling } ,
-    { "circle-t", fa::fa_circle_t } ,
-    { "circle-three-quarters", fa::fa_circle_three_quarters } ,
-    { "circle-three-quarters-stroke", fa::fa_circle_three_quarters_stroke } ,
-    { "circle-trash", fa::fa_circle_trash } ,
-    { "trash-circle", fa::fa_trash_circle } ,
-    { "circle-u", fa::fa_circle_u } ,
-    { "circle-up-left", fa::fa_circle_up_left } ,
-    { "circle-up-right", fa::fa_circle_up_right } ,
-    { "circle-v", fa::fa_circle_v } ,
-    { "circle-video", fa::fa_circle_video } ,
-    { "video-circle", fa::fa_video_circle } ,
-    { "circle-w", fa::fa_circle_w } ,
-    { "circle-waveform-lines", fa::fa_circle_waveform_lines } ,
-    { "waveform-circle", fa::fa_waveform_circle } ,
-    { "circle-wifi", fa::fa_circle_wifi } ,
-    { "circle-wifi-circle-wifi", fa::fa_circle_wifi_circle_wifi } ,
-    { "circle-wifi-group", fa::fa_circle_wifi_group } ,
-    { "circle-x", fa::fa_circle_x } ,
-    { "circle-y", fa::fa_circle_y } ,
-    { "circle-yen", fa::fa_circle_yen } ,
-    { "circle-z", fa::fa_circle_z } ,
-    { "circles-overlap", fa::fa_circles_overlap } ,
-    { "circles-overlap-3", fa::fa_circles_overlap_3 } ,
-    { "pronoun", fa::fa_pronoun } ,
-    { "citrus", fa::fa_citrus } ,
-    { "citrus-slice", fa::fa_citrus_slice } ,
-    { "clapperboard-play", fa::fa_clapperboard_play } ,
-    { "clarinet", fa::fa_clarinet } ,
-    { "claw-marks", fa::fa_claw_marks } ,
-    { "clipboard-list-check", fa::fa_clipboard_list_check } ,
-    { "clipboard-medical", fa::fa_clipboard_medical } ,
-    { "clipboard-prescription", fa::fa_clipboard_prescription } ,
-    { "clock-desk", fa::fa_clock_desk } ,
-    { "clock-eight", fa::fa_clock_eight } ,
-    { "clock-eight-thirty", fa::fa_clock_eight_thirty } ,
-    { "clock-eleven", fa::fa_clock_eleven } ,
-    { "clock-eleven-thirty", fa::fa_clock_eleven_thirty } ,
-    { "clock-five", fa::fa_clock_five } ,
-    { "clock-five-thirty", fa::fa_clock_five_thirty } ,
-    { "clock-four-thirty", fa::fa_clock_four_thirty } ,
-    { "clock-nine", fa::fa_clock_nine } ,
-    { "clock-nine-thirty", fa::fa_clock_nine_thirty } ,
-    { "clock-one", fa::fa_clock_one } ,
-    { "clock-one-thirty", fa::fa_clock_one_thirty } ,
-    { "clock-seven", fa::fa_clock_seven } ,
-    { "clock-seven-thirty", fa::fa_clock_seven_thirty } ,
-    { "clock-six", fa::fa_clock_six } ,
-    { "clock-six-thirty", fa::fa_clock_six_thirty } ,
-    { "clock-ten", fa::fa_clock_ten } ,
-    { "clock-ten-thirty", fa::fa_clock_ten_thirty } ,
-    { "clock-three", fa::fa_clock_three } ,
-    { "clock-three-thirty", fa::fa_clock_three_thirty } ,
-    { "clock-twelve", fa::fa_clock_twelve } ,
-    { "clock-twelve-thirty", fa::fa_clock_twelve_thirty } ,
-    { "clock-two", fa::fa_clock_two } ,
-    { "clock-two-thirty", fa::fa_clock_two_thirty } ,
-    { "closed-captioning-slash", fa::fa_closed_captioning_slash } ,
-    { "clothes-hanger", fa::fa_clothes_hanger } ,
-    { "cloud-binary", fa::fa_cloud_binary } ,
-    { "cloud-bolt-moon", fa::fa_cloud_bolt_moon } ,
-    { "thunderstorm-moon", fa::fa_thunderstorm_moon } ,
-    { "cloud-bolt-sun", fa::fa_cloud_bolt_sun } ,
-    { "thunderstorm-sun", fa::fa_thunderstorm_sun } ,
-    { "cloud-check", fa::fa_cloud_check } ,
-    { "cloud-drizzle", fa::fa_cloud_drizzle } ,
-    { "cloud-exclamation", fa::fa_cloud_exclamation } ,
-    { "cloud-fog", fa::fa_cloud_fog } ,
-    { "fog", fa::fa_fog } ,
-    { "cloud-hail", fa::fa_cloud_hail } ,
-    { "cloud-hail-mixed", fa::fa_cloud_hail_mixed } ,
-    { "cloud-minus", fa::fa_cloud_minus } ,
-    { "cloud-music", fa::fa_cloud_music } ,
-    { "cloud-plus", fa::fa_cloud_plus } ,
-    { "cloud-question", fa::fa_cloud_question } ,
-    { "cloud-rainbow", fa::fa_cloud_rainbow } ,
-    { "cloud-showers", fa::fa_cloud_showers } ,
-    { "cloud-slash", fa::fa_cloud_slash } ,
-    { "cloud-sleet", fa::fa_cloud_sleet } ,
-    { "cloud-snow", fa::fa_cloud_snow } ,
-    { "cloud-word", fa::fa_cloud_word } ,
-    { "cloud-xmark", fa::fa_cloud_xmark } ,
-    { "clouds", fa::fa_clouds } ,
-    { "clouds-moon", fa::fa_clouds_moon } ,
-    { "clouds-sun", fa::fa_clouds_sun } ,
-    { "club", fa::fa_club } ,
-    { "coconut", fa::fa_coconut } ,
-    { "code-pull-request-closed", fa::fa_code_pull_request_closed } ,
-    { "code-pull-request-draft", fa::fa_code_pull_request_draft } ,
-    { "code-simple", fa::fa_code_simple } ,
-    { "coffee-bean", fa::fa_coffee_bean } ,
-    { "coffee-beans", fa::fa_coffee_beans } ,
-    { "coffee-pot", fa::fa_coffee_pot } ,
-    { "coffin", fa::fa_coffin } ,
-    { "coffin-cross", fa::fa_coffin_cross } ,
-    { "coin", fa::fa_coin } ,
-    { "coin-blank", fa::fa_coin_blank } ,
-    { "coin-front", fa::fa_coin_front } ,
-    { "coin-vertical", fa::fa_coin_vertical } ,
-    { "colon", fa::fa_colon } ,
-    { "columns-3", fa::fa_columns_3 } ,
-    { "comet", fa::fa_comet } ,
-    { "comma", fa::fa_comma } ,
-    { "command", fa::fa_command } ,
-    { "comment-arrow-down", fa::fa_comment_arrow_down } ,
-    { "comment-arrow-up", fa::fa_comment_arrow_up } ,
-    { "comment-arrow-up-right", fa::fa_comment_arrow_up_right } ,
-    { "comment-captions", fa::fa_comment_captions } ,
-    { "comment-check", fa::fa_comment_check } ,
-    { "comment-code", fa::fa_comment_code } ,
-    { "comment-exclamation", fa::fa_comment_exclamation } ,
-    { "comment-heart", fa::fa_comment_heart } ,
-    { "comment-image", fa::fa_comment_image } ,
-    { "comment-lines", fa::fa_comment_lines } ,
-    { "comment-middle", fa::fa_comment_middle } ,
-    { "comment-middle-top", fa::fa_comment_middle_top } ,
-    { "comment-minus", fa::fa_comment_minus } ,
-    { "comment-music", fa::fa_comment_music } ,
-    { "comment-pen", fa::fa_comment_pen } ,
-    { "comment-edit", fa::fa_comment_edit } ,
-    { "comment-plus", fa::fa_comment_plus } ,
-    { "comment-question", fa::fa_comment_question } ,
-    { "comment-quote", fa::fa_comment_quote } ,
-    { "comment-smile", fa::fa_comment_smile } ,
-    { "comment-text", fa::fa_comment_text } ,
-    { "comment-xmark", fa::fa_comment_xmark } ,
-    { "comment-times", fa::fa_comment_times } ,
-    { "comments-question", fa::fa_comments_question } ,
-    { "comments-question-check", fa::fa_comments_question_check } ,
-    { "compass-slash", fa::fa_compass_slash } ,
-    { "compress-wide", fa::fa_compress_wide } ,
-    { "computer-classic", fa::fa_computer_classic } ,
-    { "computer-mouse-scrollwheel", fa::fa_computer_mouse_scrollwheel } ,
-    { "mouse-alt", fa::fa_mouse_alt } ,
-    { "computer-speaker", fa::fa_computer_speaker } ,
-    { "container-storage", fa::fa_container_storage } ,
-    { "conveyor-belt", fa::fa_conveyor_belt } ,
-    { "conveyor-belt-arm", fa::fa_conveyor_belt_arm } ,
-    { "conveyor-belt-boxes", fa::fa_conveyor_belt_boxes } ,
-    { "conveyor-belt-alt", fa::fa_conveyor_belt_alt } ,
-    { "conveyor-belt-empty", fa::fa_conveyor_belt_empty } ,
-    { "corn", fa::fa_corn } ,
-    { "corner", fa::fa_corner } ,
-    { "court-sport", fa::fa_court_sport } ,
-    { "cowbell", fa::fa_cowbell } ,
-    { "cowbell-circle-plus", fa::fa_cowbell_circle_plus } ,
-    { "cowbell-more", fa::fa_cowbell_more } ,
-    { "crab", fa::fa_crab } ,
-    { "crate-apple", fa::fa_crate_apple } ,
-    { "apple-crate", fa::fa_apple_crate } ,
-    { "crate-empty", fa::fa_crate_empty } ,
-    { "credit-card-blank", fa::fa_credit_card_blank } ,
-    { "credit-card-front", fa::fa_credit_card_front } ,
-    { "cricket-bat-ball", fa::fa_cricket_bat_ball } ,
-    { "cricket", fa::fa_cricket } ,
-    { "croissant", fa::fa_croissant } ,
-    { "crosshairs-simple", fa::fa_crosshairs_simple } ,
-    { "crutches", fa::fa_crutches } ,
-    { "crystal-ball", fa::fa_crystal_ball } ,
-    { "cucumber", fa::fa_cucumber } ,
-    { "cup-straw", fa::fa_cup_straw } ,
-    { "cup-straw-swoosh", fa::fa_cup_straw_swoosh } ,
-    { "cup-togo", fa::fa_cup_togo } ,
-    { "coffee-togo", fa::fa_coffee_togo } ,
-    { "cupcake", fa::fa_cupcake } ,
-    { "curling-stone", fa::fa_curling_stone } ,
-    { "curling", fa::fa_curling } ,
-    { "custard", fa::fa_custard } ,
-    { "dagger", fa::fa_dagger } ,
-    { "dash", fa::fa_dash } ,
-    { "minus-large", fa::fa_minus_large } ,
-    { "deer", fa::fa_deer } ,
-    { "deer-rudolph", fa::fa_deer_rudolph } ,
-    { "delete-right", fa::fa_delete_right } ,
-    { "desktop-arrow-down", fa::fa_desktop_arrow_down } ,
-    { "diagram-cells", fa::fa_diagram_cells } ,
-    { "diagram-lean-canvas", fa::fa_diagram_lean_canvas } ,
-    { "diagram-nested", fa::fa_diagram_nested } ,
-    { "diagram-previous", fa::fa_diagram_previous } ,
-    { "diagram-sankey", fa::fa_diagram_sankey } ,
-    { "diagram-subtask", fa::fa_diagram_subtask } ,
-    { "diagram-venn", fa::fa_diagram_venn } ,
-    { "dial", fa::fa_dial } ,
-    { "dial-med-high", fa::fa_dial_med_high } ,
-    { "dial-high", fa::fa_dial_high } ,
-    { "dial-low", fa::fa_dial_low } ,
-    { "dial-max", fa::fa_dial_max } ,
-    { "dial-med", fa::fa_dial_med } ,
-    { "dial-med-low", fa::fa_dial_med_low } ,
-    { "dial-min", fa::fa_dial_min } ,
-    { "dial-off", fa::fa_dial_off } ,
-    { "diamond-exclamation", fa::fa_diamond_exclamation } ,
-    { "diamond-half", fa::fa_diamond_half } ,
-    { "diamond-half-stroke", fa::fa_diamond_half_stroke } ,
-    { "diamonds-4", fa::fa_diamonds_4 } ,
-    { "dice-d10", fa::fa_dice_d10 } ,
-    { "dice-d12", fa::fa_dice_d12 } ,
-    { "dice-d4", fa::fa_dice_d4 } ,
-    { "dice-d8", fa::fa_dice_d8 } ,
-    { "dinosaur", fa::fa_dinosaur } ,
-    { "diploma", fa::fa_diploma } ,
-    { "scroll-ribbon", fa::fa_scroll_ribbon } ,
-    { "disc-drive", fa::fa_disc_drive } ,
-    { "display-arrow-down", fa::fa_display_arrow_down } ,
-    { "display-chart-up", fa::fa_display_chart_up } ,
-    { "display-chart-up-circle-currency", fa::fa_display_chart_up_circle_currency } ,
-    { "display-chart-up-circle-dollar", fa::fa_display_chart_up_circle_dollar } ,
-    { "display-code", fa::fa_display_code } ,
-    { "desktop-code", fa::fa_desktop_code } ,
-    { "display-medical", fa::fa_display_medical } ,
-    { "desktop-medical", fa::fa_desktop_medical } ,
-    { "display-slash", fa::fa_display_slash } ,
-    { "desktop-slash", fa::fa_desktop_slash } ,
-    { "distribute-spacing-horizontal", fa::fa_distribute_spacing_horizontal } ,
-    { "distribute-spacing-vertical", fa::fa_distribute_spacing_vertical } ,
-    { "ditto", fa::fa_ditto } ,
-    { "do-not-enter", fa::fa_do_not_enter } ,
-    { "dog-leashed", fa::fa_dog_leashed } ,
-    { "dolly-empty", fa::fa_dolly_empty } ,
-    { "dolphin", fa::fa_dolphin } ,
-    { "donut", fa::fa_donut } ,
-    { "doughnut", fa::fa_doughnut } ,
-    { "down", fa::fa_down } ,
-    { "arrow-alt-down", fa::fa_arrow_alt_down } ,
-    { "down-from-bracket", fa::fa_down_from_bracket } ,
-    { "down-from-dotted-line", fa::fa_down_from_dotted_line } ,
-    { "down-from-line", fa::fa_down_from_line } ,
-    { "arrow-alt-from-top", fa::fa_arrow_alt_from_top } ,
-    { "down-left", fa::fa_down_left } ,
-    { "down-right", fa::fa_down_right } ,
-    { "down-to-bracket", fa::fa_down_to_bracket } ,
-    { "down-to-dotted-line", fa::fa_down_to_dotted_line } ,
-    { "down-to-line", fa::fa_down_to_line } ,
-    { "arrow-alt-to-bottom", fa::fa_arrow_alt_to_bottom } ,
-    { "draw-circle", fa::fa_draw_circle } ,
-    { "draw-square", fa::fa_draw_square } ,
-    { "dreidel", fa::fa_dreidel } ,
-    { "drone", fa::fa_drone } ,
-    { "drone-front", fa::fa_drone_front } ,
-    { "drone-alt", fa::fa_drone_alt } ,
-    { "droplet-degree", fa::fa_droplet_degree } ,
-    { "dewpoint", fa::fa_dewpoint } ,
-    { "droplet-percent", fa::fa_droplet_percent } ,
-    { "humidity", fa::fa_humidity } ,
-    { "drumstick", fa::fa_drumstick } ,
-    { "dryer", fa::fa_dryer } ,
-    { "dryer-heat", fa::fa_dryer_heat } ,
-    { "dryer-alt", fa::fa_dryer_alt } ,
-    { "duck", fa::fa_duck } ,
-    { "ear", fa::fa_ear } ,
-    { "ear-muffs", fa::fa_ear_muffs } ,
-    { "eclipse", fa::fa_eclipse } ,
-    { "egg-fried", fa::fa_egg_fried } ,
-    { "eggplant", fa::fa_eggplant } ,
-    { "elephant", fa::fa_elephant } ,
-    { "ellipsis-stroke", fa::fa_ellipsis_stroke } ,
-    { "ellipsis-h-alt", fa::fa_ellipsis_h_alt } ,
-    { "ellipsis-stroke-vertical", fa::fa_ellipsis_stroke_vertical } ,
-    { "ellipsis-v-alt", fa::fa_ellipsis_v_alt } ,
-    { "empty-set", fa::fa_empty_set } ,
-    { "engine", fa::fa_engine } ,
-    { "engine-warning", fa::fa_engine_warning } ,
-    { "engine-exclamation", fa::fa_engine_exclamation } ,
-    { "envelope-dot", fa::fa_envelope_dot } ,
-    { "envelope-badge", fa::fa_envelope_badge } ,
-    { "envelope-open-dollar", fa::fa_envelope_open_dollar } ,
-    { "envelopes", fa::fa_envelopes } ,
-    { "escalator", fa::fa_escalator } ,
-    { "excavator", fa::fa_excavator } ,
-    { "expand-wide", fa::fa_expand_wide } ,
-    { "eye-dropper-full", fa::fa_eye_dropper_full } ,
-    { "eye-dropper-half", fa::fa_eye_dropper_half } ,
-    { "eye-evil", fa::fa_eye_evil } ,
-    { "eyes", fa::fa_eyes } ,
-    { "face-angry-horns", fa::fa_face_angry_horns } ,
-    { "face-anguished", fa::fa_face_anguished } ,
-    { "face-anxious-sweat", fa::fa_face_anxious_sweat } ,
-    { "face-astonished", fa::fa_face_astonished } ,
-    { "face-awesome", fa::fa_face_awesome } ,
-    { "gave-dandy", fa::fa_gave_dandy } ,
-    { "face-beam-hand-over-mouth", fa::fa_face_beam_hand_over_mouth } ,
-    { "face-clouds", fa::fa_face_clouds } ,
-    { "face-confounded", fa::fa_face_confounded } ,
-    { "face-confused", fa::fa_face_confused } ,
-    { "face-cowboy-hat", fa::fa_face_cowboy_hat } ,
-    { "face-diagonal-mouth", fa::fa_face_diagonal_mouth } ,
-    { "face-disappointed", fa::fa_face_disappointed } ,
-    { "face-disguise", fa::fa_face_disguise } ,
-    { "face-dotted", fa::fa_face_dotted } ,
-    { "face-downcast-sweat", fa::fa_face_downcast_sweat } ,
-    { "face-drooling", fa::fa_face_drooling } ,
-    { "face-exhaling", fa::fa_face_exhaling } ,
-    { "face-explode", fa::fa_face_explode } ,
-    { "exploding-head", fa::fa_exploding_head } ,
-    { "face-expressionless", fa::fa_face_expressionless } ,
-    { "face-eyes-xmarks", fa::fa_face_eyes_xmarks } ,
-    { "face-fearful", fa::fa_face_fearful } ,
-    { "face-frown-slight", fa::fa_face_frown_slight } ,
-    { "face-glasses", fa::fa_face_glasses } ,
-    { "face-hand-over-mouth", fa::fa_face_hand_over_mouth } ,
-    { "face-hand-peeking", fa::fa_face_hand_peeking } ,
-    { "face-hand-yawn", fa::fa_face_hand_yawn } ,
-    { "face-head-bandage", fa::fa_face_head_bandage } ,
-    { "face-holding-back-tears", fa::fa_face_holding_back_tears } ,
-    { "face-hushed", fa::fa_face_hushed } ,
-    { "face-icicles", fa::fa_face_icicles } ,
-    { "face-kiss-closed-eyes", fa::fa_face_kiss_closed_eyes } ,
-    { "face-lying", fa::fa_face_lying } ,
-    { "face-mask", fa::fa_face_mask } ,
-    { "face-melting", fa::fa_face_melting } ,
-    { "face-monocle", fa::fa_face_monocle } ,
-    { "face-nauseated", fa::fa_face_nauseated } ,
-    { "face-nose-steam", fa::fa_face_nose_steam } ,
-    { "face-party", fa::fa_face_party } ,
-    { "face-pensive", fa::fa_face_pensive } ,
-    { "face-persevering", fa::fa_face_persevering } ,
-    { "face-pleading", fa::fa_face_pleading } ,
-    { "face-pouting", fa::fa_face_pouting } ,
-    { "face-raised-eyebrow", fa::fa_face_raised_eyebrow } ,
-    { "face-relieved", fa::fa_face_relieved } ,
-    { "face-sad-sweat", fa::fa_face_sad_sweat } ,
-    { "face-saluting", fa::fa_face_saluting } ,
-    { "face-scream", fa::fa_face_scream } ,
-    { "face-shush", fa::fa_face_shush } ,
-    { "face-sleeping", fa::fa_face_sleeping } ,
-    { "face-sleepy", fa::fa_face_sleepy } ,
-    { "face-smile-halo", fa::fa_face_smile_halo } ,
-    { "face-smile-hearts", fa::fa_face_smile_hearts } ,
-    { "face-smile-horns", fa::fa_face_smile_horns } ,
-    { "face-smile-plus", fa::fa_face_smile_plus } ,
-    { "smile-plus", fa::fa_smile_plus } ,
-    { "face-smile-relaxed", fa::fa_face_smile_relaxed } ,
-    { "face-smile-tear", fa::fa_face_smile_tear } ,
-    { "face-smile-tongue", fa::fa_face_smile_tongue } ,
-    { "face-smile-upside-down", fa::fa_face_smile_upside_down } ,
-    { "face-smiling-hands", fa::fa_face_smiling_hands } ,
-    { "face-smirking", fa::fa_face_smirking } ,
-    { "face-spiral-eyes", fa::fa_face_spiral_eyes } ,
-    { "face-sunglasses", fa::fa_face_sunglasses } ,
-    { "face-swear", fa::fa_face_swear } ,
-    { "face-thermometer", fa::fa_face_thermometer } ,
-    { "face-thinking", fa::fa_face_thinking } ,
-    { "face-tissue", fa::fa_face_tissue } ,
-    { "face-tongue-money", fa::fa_face_tongue_money } ,
-    { "face-tongue-sweat", fa::fa_face_tongue_sweat } ,
-    { "face-unamused", fa::fa_face_unamused } ,
-    { "face-viewfinder", fa::fa_face_viewfinder } ,
-    { "face-vomit", fa::fa_face_vomit } ,
-    { "face-weary", fa::fa_face_weary } ,
-    { "face-woozy", fa::fa_face_woozy } ,
-    { "face-worried", fa::fa_face_worried } ,
-    { "face-zany", fa::fa_face_zany } ,
-    { "face-zipper", fa::fa_face_zipper } ,
-    { "falafel", fa::fa_falafel } ,
-    { "family", fa::fa_family } ,
-    { "family-dress", fa::fa_family_dress } ,
-    { "family-pants", fa::fa_family_pants } ,
-    { "fan-table", fa::fa_fan_table } ,
-    { "farm", fa::fa_farm } ,
-    { "barn-silo", fa::fa_barn_silo } ,
-    { "fence", fa::fa_fence } ,
-    { "ferris-wheel", fa::fa_ferris_wheel } ,
-    { "field-hockey-stick-ball", fa::fa_field_hockey_stick_ball } ,
-    { "field-hockey", fa::fa_field_hockey } ,
-    { "file-binary", fa::fa_file_binary } ,
-    { "file-cad", fa::fa_file_cad } ,
-    { "file-certificate", fa::fa_file_certificate } ,
-    { "file-award", fa::fa_file_award } ,
-    { "file-chart-column", fa::fa_file_chart_column } ,
-    { "file-chart-line", fa::fa_file_chart_line } ,
-    { "file-chart-pie", fa::fa_file_chart_pie } ,
-    { "file-check", fa::fa_file_check } ,
-    { "file-circle-info", fa::fa_file_circle_info } ,
-    { "file-dashed-line", fa::fa_file_dashed_line } ,
-    { "page-break", fa::fa_page_break } ,
-    { "file-doc", fa::fa_file_doc } ,
-    { "file-eps", fa::fa_file_eps } ,
-    { "file-exclamation", fa::fa_file_exclamation } ,
-    { "file-gif", fa::fa_file_gif } ,
-    { "file-heart", fa::fa_file_heart } ,
-    { "file-jpg", fa::fa_file_jpg } ,
-    { "file-lock", fa::fa_file_lock } ,
-    { "file-magnifying-glass", fa::fa_file_magnifying_glass } ,
-    { "file-search", fa::fa_file_search } ,
-    { "file-minus", fa::fa_file_minus } ,
-    { "file-mov", fa::fa_file_mov } ,
-    { "file-mp3", fa::fa_file_mp3 } ,
-    { "file-mp4", fa::fa_file_mp4 } ,
-    { "file-music", fa::fa_file_music } ,
-    { "file-plus", fa::fa_file_plus } ,
-    { "file-plus-minus", fa::fa_file_plus_minus } ,
-    { "file-png", fa::fa_file_png } ,
-    { "file-ppt", fa::fa_file_ppt } ,
-    { "file-slash", fa::fa_file_slash } ,
-    { "file-spreadsheet", fa::fa_file_spreadsheet } ,
-    { "file-svg", fa::fa_file_svg } ,
-    { "file-user", fa::fa_file_user } ,
-    { "file-vector", fa::fa_file_vector } ,
-    { "file-xls", fa::fa_file_xls } ,
-    { "file-xmark", fa::fa_file_xmark } ,
-    { "file-times", fa::fa_file_times } ,
-    { "file-xml", fa::fa_file_xml } ,
-    { "file-zip", fa::fa_file_zip } ,
-    { "files", fa::fa_files } ,
-    { "files-medical", fa::fa_files_medical } ,
-    { "film-canister", fa::fa_film_canister } ,
-    { "film-cannister", fa::fa_film_cannister } ,
-    { "film-simple", fa::fa_film_simple } ,
-    { "film-alt", fa::fa_film_alt } ,
-    { "film-slash", fa::fa_film_slash } ,
-    { "films", fa::fa_films } ,
-    { "filter-list", fa::fa_filter_list } ,
-    { "filter-slash", fa::fa_filter_slash } ,
-    { "filters", fa::fa_filters } ,
-    { "fire-flame", fa::fa_fire_flame } ,
-    { "flame", fa::fa_flame } ,
-    { "fire-hydrant", fa::fa_fire_hydrant } ,
-    { "fire-smoke", fa::fa_fire_smoke } ,
-    { "fireplace", fa::fa_fireplace } ,
-    { "fish-bones", fa::fa_fish_bones } ,
-    { "fish-cooked", fa::fa_fish_cooked } ,
-    { "fishing-rod", fa::fa_fishing_rod } ,
-    { "flag-pennant", fa::fa_flag_pennant } ,
-    { "pennant", fa::fa_pennant } ,
-    { "flag-swallowtail", fa::fa_flag_swallowtail } ,
-    { "flag-alt", fa::fa_flag_alt } ,
-    { "flashlight", fa::fa_flashlight } ,
-    { "flask-gear", fa::fa_flask_gear } ,
-    { "flask-round-poison", fa::fa_flask_round_poison } ,
-    { "flask-poison", fa::fa_flask_poison } ,
-    { "flask-round-potion", fa::fa_flask_round_potion } ,
-    { "flask-potion", fa::fa_flask_potion } ,
-    { "flatbread", fa::fa_flatbread } ,
-    { "flatbread-stuffed", fa::fa_flatbread_stuffed } ,
-    { "floppy-disk-circle-arrow-right", fa::fa_floppy_disk_circle_arrow_right } ,
-    { "save-circle-arrow-right", fa::fa_save_circle_arrow_right } ,
-    { "floppy-disk-circle-xmark", fa::fa_floppy_disk_circle_xmark } ,
-    { "floppy-disk-times", fa::fa_floppy_disk_times } ,
-    { "save-circle-xmark", fa::fa_save_circle_xmark } ,
-    { "save-times", fa::fa_save_times } ,
-    { "floppy-disk-pen", fa::fa_floppy_disk_pen } ,
-    { "floppy-disks", fa::fa_floppy_disks } ,
-    { "flower", fa::fa_flower } ,
-    { "flower-daffodil", fa::fa_flower_daffodil } ,
-    { "flower-tulip", fa::fa_flower_tulip } ,
-    { "flute", fa::fa_flute } ,
-    { "flux-capacitor", fa::fa_flux_capacitor } ,
-    { "flying-disc", fa::fa_flying_disc } ,
-    { "folder-arrow-down", fa::fa_folder_arrow_down } ,
-    { "folder-download", fa::fa_folder_download } ,
-    { "folder-arrow-up", fa::fa_folder_arrow_up } ,
-    { "folder-upload", fa::fa_folder_upload } ,
-    { "folder-bookmark", fa::fa_folder_bookmark } ,
-    { "folder-check", fa::fa_folder_check } ,
-    { "folder-gear", fa::fa_folder_gear } ,
-    { "folder-cog", fa::fa_folder_cog } ,
-    { "folder-grid", fa::fa_folder_grid } ,
-    { "folder-heart", fa::fa_folder_heart } ,
-    { "folder-image", fa::fa_folder_image } ,
-    { "folder-magnifying-glass", fa::fa_folder_magnifying_glass } ,
-    { "folder-search", fa::fa_folder_search } ,
-    { "folder-medical", fa::fa_folder_medical } ,
-    { "folder-music", fa::fa_folder_music } ,
-    { "folder-user", fa::fa_folder_user } ,
-    { "folder-xmark", fa::fa_folder_xmark } ,
-    { "folder-times", fa::fa_folder_times } ,
-    { "folders", fa::fa_folders } ,
-    { "fondue-pot", fa::fa_fondue_pot } ,
-    { "font-case", fa::fa_font_case } ,
-    { "football-helmet", fa::fa_football_helmet } ,
-    { "fork", fa::fa_fork } ,
-    { "utensil-fork", fa::fa_utensil_fork } ,
-    { "fork-knife", fa::fa_fork_knife } ,
-    { "utensils-alt", fa::fa_utensils_alt } ,
-    { "forklift", fa::fa_forklift } ,
-    { "fort", fa::fa_fort } ,
-    { "frame", fa::fa_frame } ,
-    { "french-fries", fa::fa_french_fries } ,
-    { "function", fa::fa_function } ,
-    { "galaxy", fa::fa_galaxy } ,
-    { "gallery-thumbnails", fa::fa_gallery_thumbnails } ,
-    { "game-board", fa::fa_game_board } ,
-    { "game-board-simple", fa::fa_game_board_simple } ,
-    { "game-board-alt", fa::fa_game_board_alt } ,
-    { "game-console-handheld", fa::fa_game_console_handheld } ,
-    { "game-console-handheld-crank", fa::fa_game_console_handheld_crank } ,
-    { "gamepad-modern", fa::fa_gamepad_modern } ,
-    { "gamepad-alt", fa::fa_gamepad_alt } ,
-    { "garage", fa::fa_garage } ,
-    { "garage-car", fa::fa_garage_car } ,
-    { "garage-open", fa::fa_garage_open } ,
-    { "garlic", fa::fa_garlic } ,
-    { "gas-pump-slash", fa::fa_gas_pump_slash } ,
-    { "gauge-circle-bolt", fa::fa_gauge_circle_bolt } ,
-    { "gauge-circle-minus", fa::fa_gauge_circle_minus } ,
-    { "gauge-circle-plus", fa::fa_gauge_circle_plus } ,
-    { "gauge-low", fa::fa_gauge_low } ,
-    { "tachometer-alt-slow", fa::fa_tachometer_alt_slow } ,
-    { "gauge-max", fa::fa_gauge_max } ,
-    { "tachometer-alt-fastest", fa::fa_tachometer_alt_fastest } ,
-    { "gauge-min", fa::fa_gauge_min } ,
-    { "tachometer-alt-slowest", fa::fa_tachometer_alt_slowest } ,
-    { "gauge-simple-low", fa::fa_gauge_simple_low } ,
-    { "tachometer-slow", fa::fa_tachometer_slow } ,
-    { "gauge-simple-max", fa::fa_gauge_simple_max } ,
-    { "tachometer-fastest", fa::fa_tachometer_fastest } ,
-    { "gauge-simple-min", fa::fa_gauge_simple_min } ,
-    { "tachometer-slowest", fa::fa_tachometer_slowest } ,
-    { "gear-code", fa::fa_gear_code } ,
-    { "gear-complex", fa::fa_gear_complex } ,
-    { "gear-complex-code", fa::fa_gear_complex_code } ,
-    { "gif", fa::fa_gif } ,
-    { "gift-card", fa::fa_gift_card } ,
-    { "gingerbread-man", fa::fa_gingerbread_man } ,
-    { "glass", fa::fa_glass } ,
-    { "glass-citrus", fa::fa_glass_citrus } ,
-    { "glass-empty", fa::fa_glass_empty } ,
-    { "glass-half", fa::fa_glass_half } ,
-    { "glass-half-empty", fa::fa_glass_half_empty } ,
-    { "glass-half-full", fa::fa_glass_half_full } ,
-    { "glasses-round", fa::fa_glasses_round } ,
-    { "glasses-alt", fa::fa_glasses_alt } ,
-    { "globe-pointer", fa::fa_globe_pointer } ,
-    { "globe-snow", fa::fa_globe_snow } ,
-    { "globe-stand", fa::fa_globe_stand } ,
-    { "globe-wifi", fa::fa_globe_wifi } ,
-    { "goal-net", fa::fa_goal_net } ,
-    { "golf-club", fa::fa_golf_club } ,
-    { "golf-flag-hole", fa::fa_golf_flag_hole } ,
-    { "gramophone", fa::fa_gramophone } ,
-    { "grapes", fa::fa_grapes } ,
-    { "grate", fa::fa_grate } ,
-    { "grate-droplet", fa::fa_grate_droplet } ,
-    { "grid", fa::fa_grid } ,
-    { "grid-3", fa::fa_grid_3 } ,
-    { "grid-2", fa::fa_grid_2 } ,
-    { "grid-2-plus", fa::fa_grid_2_plus } ,
-    { "grid-4", fa::fa_grid_4 } ,
-    { "grid-5", fa::fa_grid_5 } ,
-    { "grid-dividers", fa::fa_grid_dividers } ,
-    { "grid-horizontal", fa::fa_grid_horizontal } ,
-    { "grid-round", fa::fa_grid_round } ,
-    { "grid-round-2", fa::fa_grid_round_2 } ,
-    { "grid-round-2-plus", fa::fa_grid_round_2_plus } ,
-    { "grid-round-4", fa::fa_grid_round_4 } ,
-    { "grid-round-5", fa::fa_grid_round_5 } ,
-    { "grill", fa::fa_grill } ,
-    { "grill-fire", fa::fa_grill_fire } ,
-    { "grill-hot", fa::fa_grill_hot } ,
-    { "grip-dots", fa::fa_grip_dots } ,
-    { "grip-dots-vertical", fa::fa_grip_dots_vertical } ,
-    { "guitar-electric", fa::fa_guitar_electric } ,
-    { "guitars", fa::fa_guitars } ,
-    { "gun-slash", fa::fa_gun_slash } ,
-    { "gun-squirt", fa::fa_gun_squirt } ,
-    { "h1", fa::fa_h1 } ,
-    { "h2", fa::fa_h2 } ,
-    { "h3", fa::fa_h3 } ,
-    { "h4", fa::fa_h4 } ,
-    { "h5", fa::fa_h5 } ,
-    { "h6", fa::fa_h6 } ,
-    { "hammer-brush", fa::fa_hammer_brush } ,
-    { "hammer-crash", fa::fa_hammer_crash } ,
-    { "hammer-war", fa::fa_hammer_war } ,
-    { "hand-back-point-down", fa::fa_hand_back_point_down } ,
-    { "hand-back-point-left", fa::fa_hand_back_point_left } ,
-    { "hand-back-point-ribbon", fa::fa_hand_back_point_ribbon } ,
-    { "hand-back-point-right", fa::fa_hand_back_point_right } ,
-    { "hand-back-point-up", fa::fa_hand_back_point_up } ,
-    { "hand-fingers-crossed", fa::fa_hand_fingers_crossed } ,
-    { "hand-heart", fa::fa_hand_heart } ,
-    { "hand-holding-box", fa::fa_hand_holding_box } ,
-    { "hand-holding-circle-dollar", fa::fa_hand_holding_circle_dollar } ,
-    { "hand-holding-magic", fa::fa_hand_holding_magic } ,
-    { "hand-holding-seedling", fa::fa_hand_holding_seedling } ,
-    { "hand-holding-skull", fa::fa_hand_holding_skull } ,
-    { "hand-horns", fa::fa_hand_horns } ,
-    { "hand-love", fa::fa_hand_love } ,
-    { "hand-point-ribbon", fa::fa_hand_point_ribbon } ,
-    { "hand-wave", fa::fa_hand_wave } ,
-    { "hands-holding-diamond", fa::fa_hands_holding_diamond } ,
-    { "hand-receiving", fa::fa_hand_receiving } ,
-    { "hands-holding-dollar", fa::fa_hands_holding_dollar } ,
-    { "hands-usd", fa::fa_hands_usd } ,
-    { "hands-holding-heart", fa::fa_hands_holding_heart } ,
-    { "hands-heart", fa::fa_hands_heart } ,
-    { "hashtag-lock", fa::fa_hashtag_lock } ,
-    { "hat-beach", fa::fa_hat_beach } ,
-    { "hat-chef", fa::fa_hat_chef } ,
-    { "hat-santa", fa::fa_hat_santa } ,
-    { "hat-winter", fa::fa_hat_winter } ,
-    { "hat-witch", fa::fa_hat_witch } ,
-    { "head-side", fa::fa_head_side } ,
-    { "head-side-brain", fa::fa_head_side_brain } ,
-    { "head-side-gear", fa::fa_head_side_gear } ,
-    { "head-side-goggles", fa::fa_head_side_goggles } ,
-    { "head-vr", fa::fa_head_vr } ,
-    { "head-side-headphones", fa::fa_head_side_headphones } ,
-    { "head-side-heart", fa::fa_head_side_heart } ,
-    { "head-side-medical", fa::fa_head_side_medical } ,
-    { "heart-half", fa::fa_heart_half } ,
-    { "heart-half-stroke", fa::fa_heart_half_stroke } ,
-    { "heart-half-alt", fa::fa_heart_half_alt } ,
-    { "heat", fa::fa_heat } ,
-    { "helmet-battle", fa::fa_helmet_battle } ,
-    { "hexagon", fa::fa_hexagon } ,
-    { "hexagon-check", fa::fa_hexagon_check } ,
-    { "hexagon-divide", fa::fa_hexagon_divide } ,
-    { "hexagon-exclamation", fa::fa_hexagon_exclamation } ,
-    { "hexagon-image", fa::fa_hexagon_image } ,
-    { "hexagon-minus", fa::fa_hexagon_minus } ,
-    { "minus-hexagon", fa::fa_minus_hexagon } ,
-    { "hexagon-plus", fa::fa_hexagon_plus } ,
-    { "plus-hexagon", fa::fa_plus_hexagon } ,
-    { "hexagon-vertical-nft", fa::fa_hexagon_vertical_nft } ,
-    { "hexagon-vertical-nft-slanted", fa::fa_hexagon_vertical_nft_slanted } ,
-    { "hexagon-xmark", fa::fa_hexagon_xmark } ,
-    { "times-hexagon", fa::fa_times_hexagon } ,
-    { "xmark-hexagon", fa::fa_xmark_hexagon } ,
-    { "high-definition", fa::fa_high_definition } ,
-    { "rectangle-hd", fa::fa_rectangle_hd } ,
-    { "highlighter-line", fa::fa_highlighter_line } ,
-    { "hockey-mask", fa::fa_hockey_mask } ,
-    { "hockey-stick-puck", fa::fa_hockey_stick_puck } ,
-    { "hockey-sticks", fa::fa_hockey_sticks } ,
-    { "honey-pot", fa::fa_honey_pot } ,
-    { "hood-cloak", fa::fa_hood_cloak } ,
-    { "horizontal-rule", fa::fa_horizontal_rule } ,
-    { "horse-saddle", fa::fa_horse_saddle } ,
-    { "hose", fa::fa_hose } ,
-    { "hose-reel", fa::fa_hose_reel } ,
-    { "hospitals", fa::fa_hospitals } ,
-    { "hourglass-clock", fa::fa_hourglass_clock } ,
-    { "house-blank", fa::fa_house_blank } ,
-    { "home-blank", fa::fa_home_blank } ,
-    { "house-building", fa::fa_house_building } ,
-    { "house-chimney-blank", fa::fa_house_chimney_blank } ,
-    { "house-chimney-heart", fa::fa_house_chimney_heart } ,
-    { "house-day", fa::fa_house_day } ,
-    { "house-heart", fa::fa_house_heart } ,
-    { "home-heart", fa::fa_home_heart } ,
-    { "house-night", fa::fa_house_night } ,
-    { "house-person-leave", fa::fa_house_person_leave } ,
-    { "house-leave", fa::fa_house_leave } ,
-    { "house-person-depart", fa::fa_house_person_depart } ,
-    { "house-person-return", fa::fa_house_person_return } ,
-    { "house-person-arrive", fa::fa_house_person_arrive } ,
-    { "house-return", fa::fa_house_return } ,
-    { "house-tree", fa::fa_house_tree } ,
-    { "house-turret", fa::fa_house_turret } ,
-    { "house-water", fa::fa_house_water } ,
-    { "house-flood", fa::fa_house_flood } ,
-    { "house-window", fa::fa_house_window } ,
-    { "hundred-points", fa::fa_hundred_points } ,
-    { "100", fa::fa_100 } ,
-    { "hydra", fa::fa_hydra } ,
-    { "hyphen", fa::fa_hyphen } ,
-    { "ice-skate", fa::fa_ice_skate } ,
-    { "image-landscape", fa::fa_image_landscape } ,
-    { "landscape", fa::fa_landscape } ,
-    { "image-polaroid", fa::fa_image_polaroid } ,
-    { "image-polaroid-user", fa::fa_image_polaroid_user } ,
-    { "image-slash", fa::fa_image_slash } ,
-    { "image-user", fa::fa_image_user } ,
-    { "images-user", fa::fa_images_user } ,
-    { "inbox-full", fa::fa_inbox_full } ,
-    { "inbox-in", fa::fa_inbox_in } ,
-    { "inbox-arrow-down", fa::fa_inbox_arrow_down } ,
-    { "inbox-out", fa::fa_inbox_out } ,
-    { "inbox-arrow-up", fa::fa_inbox_arrow_up } ,
-    { "inboxes", fa::fa_inboxes } ,
-    { "industry-windows", fa::fa_industry_windows } ,
-    { "industry-alt", fa::fa_industry_alt } ,
-    { "inhaler", fa::fa_inhaler } ,
-    { "input-numeric", fa::fa_input_numeric } ,
-    { "input-pipe", fa::fa_input_pipe } ,
-    { "input-text", fa::fa_input_text } ,
-    { "integral", fa::fa_integral } ,
-    { "interrobang", fa::fa_interrobang } ,
-    { "intersection", fa::fa_intersection } ,
-    { "island-tropical", fa::fa_island_tropical } ,
-    { "island-tree-palm", fa::fa_island_tree_palm } ,
-    { "jack-o-lantern", fa::fa_jack_o_lantern } ,
-    { "joystick", fa::fa_joystick } ,
-    { "jug", fa::fa_jug } ,
-    { "jug-bottle", fa::fa_jug_bottle } ,
-    { "kazoo", fa::fa_kazoo } ,
-    { "kerning", fa::fa_kerning } ,
-    { "key-skeleton", fa::fa_key_skeleton } ,
-    { "key-skeleton-left-right", fa::fa_key_skeleton_left_right } ,
-    { "keyboard-brightness", fa::fa_keyboard_brightness } ,
-    { "keyboard-brightness-low", fa::fa_keyboard_brightness_low } ,
-    { "keyboard-down", fa::fa_keyboard_down } ,
-    { "keyboard-left", fa::fa_keyboard_left } ,
-    { "keynote", fa::fa_keynote } ,
-    { "kidneys", fa::fa_kidneys } ,
-    { "kite", fa::fa_kite } ,
-    { "kiwi-fruit", fa::fa_kiwi_fruit } ,
-    { "knife", fa::fa_knife } ,
-    { "utensil-knife", fa::fa_utensil_knife } ,
-    { "knife-kitchen", fa::fa_knife_kitchen } ,
-    { "lacrosse-stick", fa::fa_lacrosse_stick } ,
-    { "lacrosse-stick-ball", fa::fa_lacrosse_stick_ball } ,
-    { "lambda", fa::fa_lambda } ,
-    { "lamp", fa::fa_lamp } ,
-    { "lamp-desk", fa::fa_lamp_desk } ,
-    { "lamp-floor", fa::fa_lamp_floor } ,
-    { "lamp-street", fa::fa_lamp_street } ,
-    { "landmark-magnifying-glass", fa::fa_landmark_magnifying_glass } ,
-    { "laptop-arrow-down", fa::fa_laptop_arrow_down } ,
-    { "laptop-binary", fa::fa_laptop_binary } ,
-    { "laptop-mobile", fa::fa_laptop_mobile } ,
-    { "phone-laptop", fa::fa_phone_laptop } ,
-    { "laptop-slash", fa::fa_laptop_slash } ,
-    { "lasso", fa::fa_lasso } ,
-    { "lasso-sparkles", fa::fa_lasso_sparkles } ,
-    { "layer-minus", fa::fa_layer_minus } ,
-    { "layer-group-minus", fa::fa_layer_group_minus } ,
-    { "layer-plus", fa::fa_layer_plus } ,
-    { "layer-group-plus", fa::fa_layer_group_plus } ,
-    { "leaf-heart", fa::fa_leaf_heart } ,
-    { "leaf-maple", fa::fa_leaf_maple } ,
-    { "leaf-oak", fa::fa_leaf_oak } ,
-    { "leafy-green", fa::fa_leafy_green } ,
-    { "left", fa::fa_left } ,
-    { "arrow-alt-left", fa::fa_arrow_alt_left } ,
-    { "left-from-bracket", fa::fa_left_from_bracket } ,
-    { "left-from-line", fa::fa_left_from_line } ,
-    { "arrow-alt-from-right", fa::fa_arrow_alt_from_right } ,
-    { "left-long-to-line", fa::fa_left_long_to_line } ,
-    { "left-to-bracket", fa::fa_left_to_bracket } ,
-    { "left-to-line", fa::fa_left_to_line } ,
-    { "arrow-alt-to-left", fa::fa_arrow_alt_to_left } ,
-    { "light-ceiling", fa::fa_light_ceiling } ,
-    { "light-emergency", fa::fa_light_emergency } ,
-    { "light-emergency-on", fa::fa_light_emergency_on } ,
-    { "light-switch", fa::fa_light_switch } ,
-    { "light-switch-off", fa::fa_light_switch_off } ,
-    { "light-switch-on", fa::fa_light_switch_on } ,
-    { "lightbulb-cfl", fa::fa_lightbulb_cfl } ,
-    { "lightbulb-cfl-on", fa::fa_lightbulb_cfl_on } ,
-    { "lightbulb-dollar", fa::fa_lightbulb_dollar } ,
-    { "lightbulb-exclamation", fa::fa_lightbulb_exclamation } ,
-    { "lightbulb-exclamation-on", fa::fa_lightbulb_exclamation_on } ,
-    { "lightbulb-gear", fa::fa_lightbulb_gear } ,
-    { "lightbulb-message", fa::fa_lightbulb_message } ,
-    { "lightbulb-on", fa::fa_lightbulb_on } ,
-    { "lightbulb-slash", fa::fa_lightbulb_slash } ,
-    { "lighthouse", fa::fa_lighthouse } ,
-    { "lights-holiday", fa::fa_lights_holiday } ,
-    { "line-columns", fa::fa_line_columns } ,
-    { "line-height", fa::fa_line_height } ,
-    { "link-horizontal", fa::fa_link_horizontal } ,
-    { "chain-horizontal", fa::fa_chain_horizontal } ,
-    { "link-horizontal-slash", fa::fa_link_horizontal_slash } ,
-    { "chain-horizontal-slash", fa::fa_chain_horizontal_slash } ,
-    { "link-simple", fa::fa_link_simple } ,
-    { "link-simple-slash", fa::fa_link_simple_slash } ,
-    { "lips", fa::fa_lips } ,
-    { "list-dropdown", fa::fa_list_dropdown } ,
-    { "list-music", fa::fa_list_music } ,
-    { "list-radio", fa::fa_list_radio } ,
-    { "list-timeline", fa::fa_list_timeline } ,
-    { "list-tree", fa::fa_list_tree } ,
-    { "loader", fa::fa_loader } ,
-    { "lobster", fa::fa_lobster } ,
-    { "location-arrow-up", fa::fa_location_arrow_up } ,
-    { "location-check", fa::fa_location_check } ,
-    { "map-marker-check", fa::fa_map_marker_check } ,
-    { "location-crosshairs-slash", fa::fa_location_crosshairs_slash } ,
-    { "location-slash", fa::fa_location_slash } ,
-    { "location-dot-slash", fa::fa_location_dot_slash } ,
-    { "map-marker-alt-slash", fa::fa_map_marker_alt_slash } ,
-    { "location-exclamation", fa::fa_location_exclamation } ,
-    { "map-marker-exclamation", fa::fa_map_marker_exclamation } ,
-    { "location-minus", fa::fa_location_minus } ,
-    { "map-marker-minus", fa::fa_map_marker_minus } ,
-    { "location-pen", fa::fa_location_pen } ,
-    { "map-marker-edit", fa::fa_map_marker_edit } ,
-    { "location-pin-slash", fa::fa_location_pin_slash } ,
-    { "map-marker-slash", fa::fa_map_marker_slash } ,
-    { "location-plus", fa::fa_location_plus } ,
-    { "map-marker-plus", fa::fa_map_marker_plus } ,
-    { "location-question", fa::fa_location_question } ,
-    { "map-marker-question", fa::fa_map_marker_question } ,
-    { "location-smile", fa::fa_location_smile } ,
-    { "map-marker-smile", fa::fa_map_marker_smile } ,
-    { "location-xmark", fa::fa_location_xmark } ,
-    { "map-marker-times", fa::fa_map_marker_times } ,
-    { "map-marker-xmark", fa::fa_map_marker_xmark } ,
-    { "lock-a", fa::fa_lock_a } ,
-    { "lock-hashtag", fa::fa_lock_hashtag } ,
-    { "lock-keyhole", fa::fa_lock_keyhole } ,
-    { "lock-alt", fa::fa_lock_alt } ,
-    { "lock-keyhole-open", fa::fa_lock_keyhole_open } ,
-    { "lock-open-alt", fa::fa_lock_open_alt } ,
-    { "lollipop", fa::fa_lollipop } ,
-    { "lollypop", fa::fa_lollypop } ,
-    { "loveseat", fa::fa_loveseat } ,
-    { "couch-small", fa::fa_couch_small } ,
-    { "luchador-mask", fa::fa_luchador_mask } ,
-    { "luchador", fa::fa_luchador } ,
-    { "mask-luchador", fa::fa_mask_luchador } ,
-    { "mace", fa::fa_mace } ,
-    { "magnifying-glass-arrows-rotate", fa::fa_magnifying_glass_arrows_rotate } ,
-    { "magnifying-glass-music", fa::fa_magnifying_glass_music } ,
-    { "magnifying-glass-play", fa::fa_magnifying_glass_play } ,
-    { "magnifying-glass-waveform", fa::fa_magnifying_glass_waveform } ,
-    { "mailbox", fa::fa_mailbox } ,
-    { "mailbox-flag-up", fa::fa_mailbox_flag_up } ,
-    { "mandolin", fa::fa_mandolin } ,
-    { "mango", fa::fa_mango } ,
-    { "manhole", fa::fa_manhole } ,
-    { "mask-snorkel", fa::fa_mask_snorkel } ,
-    { "meat", fa::fa_meat } ,
-    { "megaphone", fa::fa_megaphone } ,
-    { "melon", fa::fa_melon } ,
-    { "melon-slice", fa::fa_melon_slice } ,
-    { "memo", fa::fa_memo } ,
-    { "memo-circle-check", fa::fa_memo_circle_check } ,
-    { "memo-circle-info", fa::fa_memo_circle_info } ,
-    { "memo-pad", fa::fa_memo_pad } ,
-    { "merge", fa::fa_merge } ,
-    { "message-arrow-down", fa::fa_message_arrow_down } ,
-    { "comment-alt-arrow-down", fa::fa_comment_alt_arrow_down } ,
-    { "message-arrow-up", fa::fa_message_arrow_up } ,
-    { "comment-alt-arrow-up", fa::fa_comment_alt_arrow_up } ,
-    { "message-arrow-up-right", fa::fa_message_arrow_up_right } ,
-    { "message-bot", fa::fa_message_bot } ,
-    { "message-captions", fa::fa_message_captions } ,
-    { "comment-alt-captions", fa::fa_comment_alt_captions } ,
-    { "message-check", fa::fa_message_check } ,
-    { "comment-alt-check", fa::fa_comment_alt_check } ,
-    { "message-code", fa::fa_message_code } ,
-    { "message-dollar", fa::fa_message_dollar } ,
-    { "comment-alt-dollar", fa::fa_comment_alt_dollar } ,
-    { "message-dots", fa::fa_message_dots } ,
-    { "comment-alt-dots", fa::fa_comment_alt_dots } ,
-    { "messaging", fa::fa_messaging } ,
-    { "message-exclamation", fa::fa_message_exclamation } ,
-    { "comment-alt-exclamation", fa::fa_comment_alt_exclamation } ,
-    { "message-heart", fa::fa_message_heart } ,
-    { "message-image", fa::fa_message_image } ,
-    { "comment-alt-image", fa::fa_comment_alt_image } ,
-    { "message-lines", fa::fa_message_lines } ,
-    { "comment-alt-lines", fa::fa_comment_alt_lines } ,
-    { "message-medical", fa::fa_message_medical } ,
-    { "comment-alt-medical", fa::fa_comment_alt_medical } ,
-    { "message-middle", fa::fa_message_middle } ,
-    { "comment-middle-alt", fa::fa_comment_middle_alt } ,
-    { "message-middle-top", fa::fa_message_middle_top } ,
-    { "comment-middle-top-alt", fa::fa_comment_middle_top_alt } ,
-    { "message-minus", fa::fa_message_minus } ,
-    { "comment-alt-minus", fa::fa_comment_alt_minus } ,
-    { "message-music", fa::fa_message_music } ,
-    { "comment-alt-music", fa::fa_comment_alt_music } ,
-    { "message-pen", fa::fa_message_pen } ,
-    { "comment-alt-edit", fa::fa_comment_alt_edit } ,
-    { "message-edit", fa::fa_message_edit } ,
-    { "message-plus", fa::fa_message_plus } ,
-    { "comment-alt-plus", fa::fa_comment_alt_plus } ,
-    { "message-question", fa::fa_message_question } ,
-    { "message-quote", fa::fa_message_quote } ,
-    { "comment-alt-quote", fa::fa_comment_alt_quote } ,
-    { "message-slash", fa::fa_message_slash } ,
-    { "comment-alt-slash", fa::fa_comment_alt_slash } ,
-    { "message-smile", fa::fa_message_smile } ,
-    { "comment-alt-smile", fa::fa_comment_alt_smile } ,
-    { "message-sms", fa::fa_message_sms } ,
-    { "message-text", fa::fa_message_text } ,
-    { "comment-alt-text", fa::fa_comment_alt_text } ,
-    { "message-xmark", fa::fa_message_xmark } ,
-    { "comment-alt-times", fa::fa_comment_alt_times } ,
-    { "message-times", fa::fa_message_times } ,
-    { "messages", fa::fa_messages } ,
-    { "comments-alt", fa::fa_comments_alt } ,
-    { "messages-dollar", fa::fa_messages_dollar } ,
-    { "comments-alt-dollar", fa::fa_comments_alt_dollar } ,
-    { "messages-question", fa::fa_messages_question } ,
-    { "meter", fa::fa_meter } ,
-    { "meter-bolt", fa::fa_meter_bolt } ,
-    { "meter-droplet", fa::fa_meter_droplet } ,
-    { "meter-fire", fa::fa_meter_fire } ,
-    { "microchip-ai", fa::fa_microchip_ai } ,
-    { "microphone-stand", fa::fa_microphone_stand } ,
-    { "microwave", fa::fa_microwave } ,
-    { "mistletoe", fa::fa_mistletoe } ,
-    { "mobile-notch", fa::fa_mobile_notch } ,
-    { "mobile-iphone", fa::fa_mobile_iphone } ,
-    { "mobile-signal", fa::fa_mobile_signal } ,
-    { "mobile-signal-out", fa::fa_mobile_signal_out } ,
-    { "money-bill-simple", fa::fa_money_bill_simple } ,
-    { "money-bill-simple-wave", fa::fa_money_bill_simple_wave } ,
-    { "money-bills-simple", fa::fa_money_bills_simple } ,
-    { "money-bills-alt", fa::fa_money_bills_alt } ,
-    { "money-check-dollar-pen", fa::fa_money_check_dollar_pen } ,
-    { "money-check-edit-alt", fa::fa_money_check_edit_alt } ,
-    { "money-check-pen", fa::fa_money_check_pen } ,
-    { "money-check-edit", fa::fa_money_check_edit } ,
-    { "money-from-bracket", fa::fa_money_from_bracket } ,
-    { "money-simple-from-bracket", fa::fa_money_simple_from_bracket } ,
-    { "monitor-waveform", fa::fa_monitor_waveform } ,
-    { "monitor-heart-rate", fa::fa_monitor_heart_rate } ,
-    { "monkey", fa::fa_monkey } ,
-    { "moon-cloud", fa::fa_moon_cloud } ,
-    { "moon-over-sun", fa::fa_moon_over_sun } ,
-    { "eclipse-alt", fa::fa_eclipse_alt } ,
-    { "moon-stars", fa::fa_moon_stars } ,
-    { "moped", fa::fa_moped } ,
-    { "mountains", fa::fa_mountains } ,
-    { "mouse-field", fa::fa_mouse_field } ,
-    { "mp3-player", fa::fa_mp3_player } ,
-    { "mug", fa::fa_mug } ,
-    { "mug-marshmallows", fa::fa_mug_marshmallows } ,
-    { "mug-tea", fa::fa_mug_tea } ,
-    { "mug-tea-saucer", fa::fa_mug_tea_saucer } ,
-    { "mushroom", fa::fa_mushroom } ,
-    { "music-magnifying-glass", fa::fa_music_magnifying_glass } ,
-    { "music-note", fa::fa_music_note } ,
-    { "music-alt", fa::fa_music_alt } ,
-    { "music-note-slash", fa::fa_music_note_slash } ,
-    { "music-alt-slash", fa::fa_music_alt_slash } ,
-    { "music-slash", fa::fa_music_slash } ,
-    { "mustache", fa::fa_mustache } ,
-    { "narwhal", fa::fa_narwhal } ,
-    { "nesting-dolls", fa::fa_nesting_dolls } ,
-    { "nfc", fa::fa_nfc } ,
-    { "nfc-lock", fa::fa_nfc_lock } ,
-    { "nfc-magnifying-glass", fa::fa_nfc_magnifying_glass } ,
-    { "nfc-pen", fa::fa_nfc_pen } ,
-    { "nfc-signal", fa::fa_nfc_signal } ,
-    { "nfc-slash", fa::fa_nfc_slash } ,
-    { "nfc-trash", fa::fa_nfc_trash } ,
-    { "nose", fa::fa_nose } ,
-    { "note", fa::fa_note } ,
-    { "note-medical", fa::fa_note_medical } ,
-    { "notebook", fa::fa_notebook } ,
-    { "notes", fa::fa_notes } ,
-    { "object-exclude", fa::fa_object_exclude } ,
-    { "object-intersect", fa::fa_object_intersect } ,
-    { "object-subtract", fa::fa_object_subtract } ,
-    { "object-union", fa::fa_object_union } ,
-    { "objects-align-bottom", fa::fa_objects_align_bottom } ,
-    { "objects-align-center-horizontal", fa::fa_objects_align_center_horizontal } ,
-    { "objects-align-center-vertical", fa::fa_objects_align_center_vertical } ,
-    { "objects-align-left", fa::fa_objects_align_left } ,
-    { "objects-align-right", fa::fa_objects_align_right } ,
-    { "objects-align-top", fa::fa_objects_align_top } ,
-    { "objects-column", fa::fa_objects_column } ,
-    { "octagon", fa::fa_octagon } ,
-    { "octagon-check", fa::fa_octagon_check } ,
-    { "octagon-divide", fa::fa_octagon_divide } ,
-    { "octagon-exclamation", fa::fa_octagon_exclamation } ,
-    { "octagon-minus", fa::fa_octagon_minus } ,
-    { "minus-octagon", fa::fa_minus_octagon } ,
-    { "octagon-plus", fa::fa_octagon_plus } ,
-    { "plus-octagon", fa::fa_plus_octagon } ,
-    { "octagon-xmark", fa::fa_octagon_xmark } ,
-    { "times-octagon", fa::fa_times_octagon } ,
-    { "xmark-octagon", fa::fa_xmark_octagon } ,
-    { "octopus", fa::fa_octopus } ,
-    { "oil-can-drip", fa::fa_oil_can_drip } ,
-    { "oil-temperature", fa::fa_oil_temperature } ,
-    { "oil-temp", fa::fa_oil_temp } ,
-    { "olive", fa::fa_olive } ,
-    { "olive-branch", fa::fa_olive_branch } ,
-    { "omega", fa::fa_omega } ,
-    { "onion", fa::fa_onion } ,
-    { "option", fa::fa_option } ,
-    { "ornament", fa::fa_ornament } ,
-    { "outlet", fa::fa_outlet } ,
-    { "oven", fa::fa_oven } ,
-    { "overline", fa::fa_overline } ,
-    { "page", fa::fa_page } ,
-    { "page-caret-down", fa::fa_page_caret_down } ,
-    { "file-caret-down", fa::fa_file_caret_down } ,
-    { "page-caret-up", fa::fa_page_caret_up } ,
-    { "file-caret-up", fa::fa_file_caret_up } ,
-    { "paintbrush-fine", fa::fa_paintbrush_fine } ,
-    { "paint-brush-alt", fa::fa_paint_brush_alt } ,
-    { "paint-brush-fine", fa::fa_paint_brush_fine } ,
-    { "paintbrush-alt", fa::fa_paintbrush_alt } ,
-    { "paintbrush-pencil", fa::fa_paintbrush_pencil } ,
-    { "pallet-box", fa::fa_pallet_box } ,
-    { "pallet-boxes", fa::fa_pallet_boxes } ,
-    { "palette-boxes", fa::fa_palette_boxes } ,
-    { "pallet-alt", fa::fa_pallet_alt } ,
-    { "pan-food", fa::fa_pan_food } ,
-    { "pan-frying", fa::fa_pan_frying } ,
-    { "pancakes", fa::fa_pancakes } ,
-    { "panel-ews", fa::fa_panel_ews } ,
-    { "panel-fire", fa::fa_panel_fire } ,
-    { "paper-plane-top", fa::fa_paper_plane_top } ,
-    { "paper-plane-alt", fa::fa_paper_plane_alt } ,
-    { "send", fa::fa_send } ,
-    { "paperclip-vertical", fa::fa_paperclip_vertical } ,
-    { "paragraph-left", fa::fa_paragraph_left } ,
-    { "paragraph-rtl", fa::fa_paragraph_rtl } ,
-    { "party-bell", fa::fa_party_bell } ,
-    { "party-horn", fa::fa_party_horn } ,
-    { "paw-claws", fa::fa_paw_claws } ,
-    { "paw-simple", fa::fa_paw_simple } ,
-    { "paw-alt", fa::fa_paw_alt } ,
-    { "peach", fa::fa_peach } ,
-    { "peanut", fa::fa_peanut } ,
-    { "peanuts", fa::fa_peanuts } ,
-    { "peapod", fa::fa_peapod } ,
-    { "pear", fa::fa_pear } ,
-    { "pedestal", fa::fa_pedestal } ,
-    { "pegasus", fa::fa_pegasus } ,
-    { "pen-circle", fa::fa_pen_circle } ,
-    { "pen-clip-slash", fa::fa_pen_clip_slash } ,
-    { "pen-alt-slash", fa::fa_pen_alt_slash } ,
-    { "pen-fancy-slash", fa::fa_pen_fancy_slash } ,
-    { "pen-field", fa::fa_pen_field } ,
-    { "pen-line", fa::fa_pen_line } ,
-    { "pen-nib-slash", fa::fa_pen_nib_slash } ,
-    { "pen-paintbrush", fa::fa_pen_paintbrush } ,
-    { "pencil-paintbrush", fa::fa_pencil_paintbrush } ,
-    { "pen-slash", fa::fa_pen_slash } ,
-    { "pen-swirl", fa::fa_pen_swirl } ,
-    { "pencil-mechanical", fa::fa_pencil_mechanical } ,
-    { "pencil-slash", fa::fa_pencil_slash } ,
-    { "people", fa::fa_people } ,
-    { "people-dress", fa::fa_people_dress } ,
-    { "people-dress-simple", fa::fa_people_dress_simple } ,
-    { "people-pants", fa::fa_people_pants } ,
-    { "people-pants-simple", fa::fa_people_pants_simple } ,
-    { "people-simple", fa::fa_people_simple } ,
-    { "pepper", fa::fa_pepper } ,
-    { "period", fa::fa_period } ,
-    { "person-biking-mountain", fa::fa_person_biking_mountain } ,
-    { "biking-mountain", fa::fa_biking_mountain } ,
-    { "person-carry-box", fa::fa_person_carry_box } ,
-    { "person-carry", fa::fa_person_carry } ,
-    { "person-dolly", fa::fa_person_dolly } ,
-    { "person-dolly-empty", fa::fa_person_dolly_empty } ,
-    { "person-dress-fairy", fa::fa_person_dress_fairy } ,
-    { "person-dress-simple", fa::fa_person_dress_simple } ,
-    { "person-fairy", fa::fa_person_fairy } ,
-    { "person-from-portal", fa::fa_person_from_portal } ,
-    { "portal-exit", fa::fa_portal_exit } ,
-    { "person-pinball", fa::fa_person_pinball } ,
-    { "person-running-fast", fa::fa_person_running_fast } ,
-    { "person-seat", fa::fa_person_seat } ,
-    { "person-seat-reclined", fa::fa_person_seat_reclined } ,
-    { "person-sign", fa::fa_person_sign } ,
-    { "person-simple", fa::fa_person_simple } ,
-    { "person-ski-jumping", fa::fa_person_ski_jumping } ,
-    { "ski-jump", fa::fa_ski_jump } ,
-    { "person-ski-lift", fa::fa_person_ski_lift } ,
-    { "ski-lift", fa::fa_ski_lift } ,
-    { "person-sledding", fa::fa_person_sledding } ,
-    { "sledding", fa::fa_sledding } ,
-    { "person-snowmobiling", fa::fa_person_snowmobiling } ,
-    { "snowmobile", fa::fa_snowmobile } ,
-    { "person-to-door", fa::fa_person_to_door } ,
-    { "person-to-portal", fa::fa_person_to_portal } ,
-    { "portal-enter", fa::fa_portal_enter } ,
-    { "phone-arrow-down-left", fa::fa_phone_arrow_down_left } ,
-    { "phone-arrow-down", fa::fa_phone_arrow_down } ,
-    { "phone-incoming", fa::fa_phone_incoming } ,
-    { "phone-arrow-right", fa::fa_phone_arrow_right } ,
-    { "phone-arrow-up-right", fa::fa_phone_arrow_up_right } ,
-    { "phone-arrow-up", fa::fa_phone_arrow_up } ,
-    { "phone-outgoing", fa::fa_phone_outgoing } ,
-    { "phone-hangup", fa::fa_phone_hangup } ,
-    { "phone-intercom", fa::fa_phone_intercom } ,
-    { "phone-missed", fa::fa_phone_missed } ,
-    { "phone-office", fa::fa_phone_office } ,
-    { "phone-plus", fa::fa_phone_plus } ,
-    { "phone-rotary", fa::fa_phone_rotary } ,
-    { "phone-xmark", fa::fa_phone_xmark } ,
-    { "photo-film-music", fa::fa_photo_film_music } ,
-    { "pi", fa::fa_pi } ,
-    { "piano", fa::fa_piano } ,
-    { "piano-keyboard", fa::fa_piano_keyboard } ,
-    { "pickaxe", fa::fa_pickaxe } ,
-    { "pickleball", fa::fa_pickleball } ,
-    { "pie", fa::fa_pie } ,
-    { "pig", fa::fa_pig } ,
-    { "pinata", fa::fa_pinata } ,
-    { "pinball", fa::fa_pinball } ,
-    { "pineapple", fa::fa_pineapple } ,
-    { "pipe", fa::fa_pipe } ,
-    { "pipe-circle-check", fa::fa_pipe_circle_check } ,
-    { "pipe-collar", fa::fa_pipe_collar } ,
-    { "pipe-section", fa::fa_pipe_section } ,
-    { "pipe-smoking", fa::fa_pipe_smoking } ,
-    { "pipe-valve", fa::fa_pipe_valve } ,
-    { "pizza", fa::fa_pizza } ,
-    { "plane-engines", fa::fa_plane_engines } ,
-    { "plane-alt", fa::fa_plane_alt } ,
-    { "plane-prop", fa::fa_plane_prop } ,
-    { "plane-tail", fa::fa_plane_tail } ,
-    { "plane-up-slash", fa::fa_plane_up_slash } ,
-    { "planet-moon", fa::fa_planet_moon } ,
-    { "planet-ringed", fa::fa_planet_ringed } ,
-    { "plate-utensils", fa::fa_plate_utensils } ,
-    { "play-pause", fa::fa_play_pause } ,
-    { "plus-large", fa::fa_plus_large } ,
-    { "podium", fa::fa_podium } ,
-    { "podium-star", fa::fa_podium_star } ,
-    { "police-box", fa::fa_police_box } ,
-    { "poll-people", fa::fa_poll_people } ,
-    { "pompebled", fa::fa_pompebled } ,
-    { "pool-8-ball", fa::fa_pool_8_ball } ,
-    { "popcorn", fa::fa_popcorn } ,
-    { "popsicle", fa::fa_popsicle } ,
-    { "pot-food", fa::fa_pot_food } ,
-    { "potato", fa::fa_potato } ,
-    { "prescription-bottle-pill", fa::fa_prescription_bottle_pill } ,
-    { "presentation-screen", fa::fa_presentation_screen } ,
-    { "presentation", fa::fa_presentation } ,
-    { "pretzel", fa::fa_pretzel } ,
-    { "print-magnifying-glass", fa::fa_print_magnifying_glass } ,
-    { "print-search", fa::fa_print_search } ,
-    { "print-slash", fa::fa_print_slash } ,
-    { "projector", fa::fa_projector } ,
-    { "pump", fa::fa_pump } ,
-    { "pumpkin", fa::fa_pumpkin } ,
-    { "puzzle", fa::fa_puzzle } ,
-    { "puzzle-piece-simple", fa::fa_puzzle_piece_simple } ,
-    { "puzzle-piece-alt", fa::fa_puzzle_piece_alt } ,
-    { "quotes", fa::fa_quotes } ,
-    { "rabbit", fa::fa_rabbit } ,
-    { "rabbit-running", fa::fa_rabbit_running } ,
-    { "rabbit-fast", fa::fa_rabbit_fast } ,
-    { "raccoon", fa::fa_raccoon } ,
-    { "racquet", fa::fa_racquet } ,
-    { "radar", fa::fa_radar } ,
-    { "radio-tuner", fa::fa_radio_tuner } ,
-    { "radio-alt", fa::fa_radio_alt } ,
-    { "raindrops", fa::fa_raindrops } ,
-    { "ram", fa::fa_ram } ,
-    { "ramp-loading", fa::fa_ramp_loading } ,
-    { "raygun", fa::fa_raygun } ,
-    { "rectangle", fa::fa_rectangle } ,
-    { "rectangle-landscape", fa::fa_rectangle_landscape } ,
-    { "rectangle-barcode", fa::fa_rectangle_barcode } ,
-    { "barcode-alt", fa::fa_barcode_alt } ,
-    { "rectangle-code", fa::fa_rectangle_code } ,
-    { "rectangle-history", fa::fa_rectangle_history } ,
-    { "rectangle-history-circle-plus", fa::fa_rectangle_history_circle_plus } ,
-    { "rectangle-history-circle-user", fa::fa_rectangle_history_circle_user } ,
-    { "rectangle-pro", fa::fa_rectangle_pro } ,
-    { "pro", fa::fa_pro } ,
-    { "rectangle-terminal", fa::fa_rectangle_terminal } ,
-    { "rectangle-vertical", fa::fa_rectangle_vertical } ,
-    { "rectangle-portrait", fa::fa_rectangle_portrait } ,
-    { "rectangle-vertical-history", fa::fa_rectangle_vertical_history } ,
-    { "rectangle-wide", fa::fa_rectangle_wide } ,
-    { "rectangles-mixed", fa::fa_rectangles_mixed } ,
-    { "reel", fa::fa_reel } ,
-    { "reflect-both", fa::fa_reflect_both } ,
-    { "reflect-horizontal", fa::fa_reflect_horizontal } ,
-    { "reflect-vertical", fa::fa_reflect_vertical } ,
-    { "refrigerator", fa::fa_refrigerator } ,
-    { "repeat-1", fa::fa_repeat_1 } ,
-    { "reply-clock", fa::fa_reply_clock } ,
-    { "reply-time", fa::fa_reply_time } ,
-    { "restroom-simple", fa::fa_restroom_simple } ,
-    { "rhombus", fa::fa_rhombus } ,
-    { "right", fa::fa_right } ,
-    { "arrow-alt-right", fa::fa_arrow_alt_right } ,
-    { "right-from-line", fa::fa_right_from_line } ,
-    { "arrow-alt-from-left", fa::fa_arrow_alt_from_left } ,
-    { "right-left-large", fa::fa_right_left_large } ,
-    { "right-long-to-line", fa::fa_right_long_to_line } ,
-    { "right-to-line", fa::fa_right_to_line } ,
-    { "arrow-alt-to-right", fa::fa_arrow_alt_to_right } ,
-    { "ring-diamond", fa::fa_ring_diamond } ,
-    { "rings-wedding", fa::fa_rings_wedding } ,
-    { "robot-astromech", fa::fa_robot_astromech } ,
-    { "rocket-launch", fa::fa_rocket_launch } ,
-    { "roller-coaster", fa::fa_roller_coaster } ,
-    { "rotate-exclamation", fa::fa_rotate_exclamation } ,
-    { "rotate-reverse", fa::fa_rotate_reverse } ,
-    { "route-highway", fa::fa_route_highway } ,
-    { "route-interstate", fa::fa_route_interstate } ,
-    { "router", fa::fa_router } ,
-    { "rugby-ball", fa::fa_rugby_ball } ,
-    { "ruler-triangle", fa::fa_ruler_triangle } ,
-    { "rv", fa::fa_rv } ,
-    { "sack", fa::fa_sack } ,
-    { "salad", fa::fa_salad } ,
-    { "bowl-salad", fa::fa_bowl_salad } ,
-    { "salt-shaker", fa::fa_salt_shaker } ,
-    { "sandwich", fa::fa_sandwich } ,
-    { "sausage", fa::fa_sausage } ,
-    { "saxophone", fa::fa_saxophone } ,
-    { "saxophone-fire", fa::fa_saxophone_fire } ,
-    { "sax-hot", fa::fa_sax_hot } ,
-    { "scalpel", fa::fa_scalpel } ,
-    { "scalpel-line-dashed", fa::fa_scalpel_line_dashed } ,
-    { "scalpel-path", fa::fa_scalpel_path } ,
-    { "scanner-gun", fa::fa_scanner_gun } ,
-    { "scanner", fa::fa_scanner } ,
-    { "scanner-image", fa::fa_scanner_image } ,
-    { "scanner-keyboard", fa::fa_scanner_keyboard } ,
-    { "scanner-touchscreen", fa::fa_scanner_touchscreen } ,
-    { "scarecrow", fa::fa_scarecrow } ,
-    { "scarf", fa::fa_scarf } ,
-    { "screen-users", fa::fa_screen_users } ,
-    { "users-class", fa::fa_users_class } ,
-    { "screencast", fa::fa_screencast } ,
-    { "scribble", fa::fa_scribble } ,
-    { "scroll-old", fa::fa_scroll_old } ,
-    { "scrubber", fa::fa_scrubber } ,
-    { "scythe", fa::fa_scythe } ,
-    { "sd-cards", fa::fa_sd_cards } ,
-    { "seal", fa::fa_seal } ,
-    { "seal-exclamation", fa::fa_seal_exclamation } ,
-    { "seal-question", fa::fa_seal_question } ,
-    { "seat-airline", fa::fa_seat_airline } ,
-    { "semicolon", fa::fa_semicolon } ,
-    { "send-back", fa::fa_send_back } ,
-    { "send-backward", fa::fa_send_backward } ,
-    { "sensor", fa::fa_sensor } ,
-    { "sensor-cloud", fa::fa_sensor_cloud } ,
-    { "sensor-smoke", fa::fa_sensor_smoke } ,
-    { "sensor-fire", fa::fa_sensor_fire } ,
-    { "sensor-on", fa::fa_sensor_on } ,
-    { "sensor-triangle-exclamation", fa::fa_sensor_triangle_exclamation } ,
-    { "sensor-alert", fa::fa_sensor_alert } ,
-    { "share-all", fa::fa_share_all } ,
-    { "sheep", fa::fa_sheep } ,
-    { "shelves", fa::fa_shelves } ,
-    { "inventory", fa::fa_inventory } ,
-    { "shelves-empty", fa::fa_shelves_empty } ,
-    { "shield-check", fa::fa_shield_check } ,
-    { "shield-cross", fa::fa_shield_cross } ,
-    { "shield-exclamation", fa::fa_shield_exclamation } ,
-    { "shield-keyhole", fa::fa_shield_keyhole } ,
-    { "shield-minus", fa::fa_shield_minus } ,
-    { "shield-plus", fa::fa_shield_plus } ,
-    { "shield-quartered", fa::fa_shield_quartered } ,
-    { "shield-slash", fa::fa_shield_slash } ,
-    { "shield-xmark", fa::fa_shield_xmark } ,
-    { "shield-times", fa::fa_shield_times } ,
-    { "shirt-long-sleeve", fa::fa_shirt_long_sleeve } ,
-    { "shirt-running", fa::fa_shirt_running } ,
-    { "shirt-tank-top", fa::fa_shirt_tank_top } ,
-    { "shish-kebab", fa::fa_shish_kebab } ,
-    { "shovel", fa::fa_shovel } ,
-    { "shovel-snow", fa::fa_shovel_snow } ,
-    { "shower-down", fa::fa_shower_down } ,
-    { "shower-alt", fa::fa_shower_alt } ,
-    { "shredder", fa::fa_shredder } ,
-    { "shutters", fa::fa_shutters } ,
-    { "shuttlecock", fa::fa_shuttlecock } ,
-    { "sickle", fa::fa_sickle } ,
-    { "sidebar", fa::fa_sidebar } ,
-    { "sidebar-flip", fa::fa_sidebar_flip } ,
-    { "sigma", fa::fa_sigma } ,
-    { "sign-post", fa::fa_sign_post } ,
-    { "sign-posts", fa::fa_sign_posts } ,
-    { "sign-posts-wrench", fa::fa_sign_posts_wrench } ,
-    { "signal-bars", fa::fa_signal_bars } ,
-    { "signal-alt", fa::fa_signal_alt } ,
-    { "signal-alt-4", fa::fa_signal_alt_4 } ,
-    { "signal-bars-strong", fa::fa_signal_bars_strong } ,
-    { "signal-bars-fair", fa::fa_signal_bars_fair } ,
-    { "signal-alt-2", fa::fa_signal_alt_2 } ,
-    { "signal-bars-good", fa::fa_signal_bars_good } ,
-    { "signal-alt-3", fa::fa_signal_alt_3 } ,
-    { "signal-bars-slash", fa::fa_signal_bars_slash } ,
-    { "signal-alt-slash", fa::fa_signal_alt_slash } ,
-    { "signal-bars-weak", fa::fa_signal_bars_weak } ,
-    { "signal-alt-1", fa::fa_signal_alt_1 } ,
-    { "signal-fair", fa::fa_signal_fair } ,
-    { "signal-2", fa::fa_signal_2 } ,
-    { "signal-good", fa::fa_signal_good } ,
-    { "signal-3", fa::fa_signal_3 } ,
-    { "signal-slash", fa::fa_signal_slash } ,
-    { "signal-stream", fa::fa_signal_stream } ,
-    { "signal-stream-slash", fa::fa_signal_stream_slash } ,
-    { "signal-strong", fa::fa_signal_strong } ,
-    { "signal-4", fa::fa_signal_4 } ,
-    { "signal-weak", fa::fa_signal_weak } ,
-    { "signal-1", fa::fa_signal_1 } ,
-    { "signature-lock", fa::fa_signature_lock } ,
-    { "signature-slash", fa::fa_signature_slash } ,
-    { "sim-cards", fa::fa_sim_cards } ,
-    { "siren", fa::fa_siren } ,
-    { "siren-on", fa::fa_siren_on } ,
-    { "skeleton", fa::fa_skeleton } ,
-    { "skeleton-ribs", fa::fa_skeleton_ribs } ,
-    { "ski-boot", fa::fa_ski_boot } ,
-    { "ski-boot-ski", fa::fa_ski_boot_ski } ,
-    { "skull-cow", fa::fa_skull_cow } ,
-    { "slash-back", fa::fa_slash_back } ,
-    { "slash-forward", fa::fa_slash_forward } ,
-    { "slider", fa::fa_slider } ,
-    { "sliders-simple", fa::fa_sliders_simple } ,
-    { "sliders-up", fa::fa_sliders_up } ,
-    { "sliders-v", fa::fa_sliders_v } ,
-    { "slot-machine", fa::fa_slot_machine } ,
-    { "smoke", fa::fa_smoke } ,
-    { "snake", fa::fa_snake } ,
-    { "snooze", fa::fa_snooze } ,
-    { "zzz", fa::fa_zzz } ,
-    { "snow-blowing", fa::fa_snow_blowing } ,
-    { "snowflake-droplets", fa::fa_snowflake_droplets } ,
-    { "snowflakes", fa::fa_snowflakes } ,
-    { "snowman-head", fa::fa_snowman_head } ,
-    { "frosty-head", fa::fa_frosty_head } ,
-    { "soft-serve", fa::fa_soft_serve } ,
-    { "creemee", fa::fa_creemee } ,
-    { "solar-system", fa::fa_solar_system } ,
-    { "space-station-moon", fa::fa_space_station_moon } ,
-    { "space-station-moon-construction", fa::fa_space_station_moon_construction } ,
-    { "space-station-moon-alt", fa::fa_space_station_moon_alt } ,
-    { "spade", fa::fa_spade } ,
-    { "sparkle", fa::fa_sparkle } ,
-    { "sparkles", fa::fa_sparkles } ,
-    { "speaker", fa::fa_speaker } ,
-    { "speakers", fa::fa_speakers } ,
-    { "spider-black-widow", fa::fa_spider_black_widow } ,
-    { "spider-web", fa::fa_spider_web } ,
-    { "spinner-scale", fa::fa_spinner_scale } ,
-    { "spinner-third", fa::fa_spinner_third } ,
-    { "split", fa::fa_split } ,
-    { "sportsball", fa::fa_sportsball } ,
-    { "sprinkler", fa::fa_sprinkler } ,
-    { "sprinkler-ceiling", fa::fa_sprinkler_ceiling } ,
-    { "square-0", fa::fa_square_0 } ,
-    { "square-1", fa::fa_square_1 } ,
-    { "square-2", fa::fa_square_2 } ,
-    { "square-3", fa::fa_square_3 } ,
-    { "square-4", fa::fa_square_4 } ,
-    { "square-5", fa::fa_square_5 } ,
-    { "square-6", fa::fa_square_6 } ,
-    { "square-7", fa::fa_square_7 } ,
-    { "square-8", fa::fa_square_8 } ,
-    { "square-9", fa::fa_square_9 } ,
-    { "square-a", fa::fa_square_a } ,
-    { "square-a-lock", fa::fa_square_a_lock } ,
-    { "square-ampersand", fa::fa_square_ampersand } ,
-    { "square-arrow-down", fa::fa_square_arrow_down } ,
-    { "arrow-square-down", fa::fa_arrow_square_down } ,
-    { "square-arrow-down-left", fa::fa_square_arrow_down_left } ,
-    { "square-arrow-down-right", fa::fa_square_arrow_down_right } ,
-    { "square-arrow-left", fa::fa_square_arrow_left } ,
-    { "arrow-square-left", fa::fa_arrow_square_left } ,
-    { "square-arrow-right", fa::fa_square_arrow_right } ,
-    { "arrow-square-right", fa::fa_arrow_square_right } ,
-    { "square-arrow-up", fa::fa_square_arrow_up } ,
-    { "arrow-square-up", fa::fa_arrow_square_up } ,
-    { "square-arrow-up-left", fa::fa_square_arrow_up_left } ,
-    { "square-b", fa::fa_square_b } ,
-    { "square-bolt", fa::fa_square_bolt } ,
-    { "square-c", fa::fa_square_c } ,
-    { "square-chevron-down", fa::fa_square_chevron_down } ,
-    { "chevron-square-down", fa::fa_chevron_square_down } ,
-    { "square-chevron-left", fa::fa_square_chevron_left } ,
-    { "chevron-square-left", fa::fa_chevron_square_left } ,
-    { "square-chevron-right", fa::fa_square_chevron_right } ,
-    { "chevron-square-right", fa::fa_chevron_square_right } ,
-    { "square-chevron-up", fa::fa_square_chevron_up } ,
-    { "chevron-square-up", fa::fa_chevron_square_up } ,
-    { "square-code", fa::fa_square_code } ,
-    { "square-d", fa::fa_square_d } ,
-    { "square-dashed", fa::fa_square_dashed } ,
-    { "square-dashed-circle-plus", fa::fa_square_dashed_circle_plus } ,
-    { "square-divide", fa::fa_square_divide } ,
-    { "square-dollar", fa::fa_square_dollar } ,
-    { "dollar-square", fa::fa_dollar_square } ,
-    { "usd-square", fa::fa_usd_square } ,
-    { "square-down", fa::fa_square_down } ,
-    { "arrow-alt-square-down", fa::fa_arrow_alt_square_down } ,
-    { "square-down-left", fa::fa_square_down_left } ,
-    { "square-down-right", fa::fa_square_down_right } ,
-    { "square-e", fa::fa_square_e } ,
-    { "square-ellipsis", fa::fa_square_ellipsis } ,
-    { "square-ellipsis-vertical", fa::fa_square_ellipsis_vertical } ,
-    { "square-exclamation", fa::fa_square_exclamation } ,
-    { "exclamation-square", fa::fa_exclamation_square } ,
-    { "square-f", fa::fa_square_f } ,
-    { "square-fragile", fa::fa_square_fragile } ,
-    { "box-fragile", fa::fa_box_fragile } ,
-    { "square-wine-glass-crack", fa::fa_square_wine_glass_crack } ,
-    { "square-g", fa::fa_square_g } ,
-    { "square-heart", fa::fa_square_heart } ,
-    { "heart-square", fa::fa_heart_square } ,
-    { "square-i", fa::fa_square_i } ,
-    { "square-info", fa::fa_square_info } ,
-    { "info-square", fa::fa_info_square } ,
-    { "square-j", fa::fa_square_j } ,
-    { "square-k", fa::fa_square_k } ,
-    { "square-kanban", fa::fa_square_kanban } ,
-    { "square-l", fa::fa_square_l } ,
-    { "square-left", fa::fa_square_left } ,
-    { "arrow-alt-square-left", fa::fa_arrow_alt_square_left } ,
-    { "square-list", fa::fa_square_list } ,
-    { "square-m", fa::fa_square_m } ,
-    { "square-n", fa::fa_square_n } ,
-    { "square-o", fa::fa_square_o } ,
-    { "square-p", fa::fa_square_p } ,
-    { "square-parking-slash", fa::fa_square_parking_slash } ,
-    { "parking-slash", fa::fa_parking_slash } ,
-    { "square-phone-hangup", fa::fa_square_phone_hangup } ,
-    { "phone-square-down", fa::fa_phone_square_down } ,
-    { "square-q", fa::fa_square_q } ,
-    { "square-quarters", fa::fa_square_quarters } ,
-    { "square-question", fa::fa_square_question } ,
-    { "question-square", fa::fa_question_square } ,
-    { "square-quote", fa::fa_square_quote } ,
-    { "square-r", fa::fa_square_r } ,
-    { "square-right", fa::fa_square_right } ,
-    { "arrow-alt-square-right", fa::fa_arrow_alt_square_right } ,
-    { "square-ring", fa::fa_square_ring } ,
-    { "square-root", fa::fa_square_root } ,
-    { "square-s", fa::fa_square_s } ,
-    { "square-sliders", fa::fa_square_sliders } ,
-    { "sliders-h-square", fa::fa_sliders_h_square } ,
-    { "square-sliders-vertical", fa::fa_square_sliders_vertical } ,
-    { "sliders-v-square", fa::fa_sliders_v_square } ,
-    { "square-small", fa::fa_square_small } ,
-    { "square-star", fa::fa_square_star } ,
-    { "square-t", fa::fa_square_t } ,
-    { "square-terminal", fa::fa_square_terminal } ,
-    { "square-this-way-up", fa::fa_square_this_way_up } ,
-    { "box-up", fa::fa_box_up } ,
-    { "square-u", fa::fa_square_u } ,
-    { "square-up", fa::fa_square_up } ,
-    { "arrow-alt-square-up", fa::fa_arrow_alt_square_up } ,
-    { "square-up-left", fa::fa_square_up_left } ,
-    { "square-user", fa::fa_square_user } ,
-    { "square-v", fa::fa_square_v } ,
-    { "square-w", fa::fa_square_w } ,
-    { "square-x", fa::fa_square_x } ,
-    { "square-y", fa::fa_square_y } ,
-    { "square-z", fa::fa_square_z } ,
-    { "squid", fa::fa_squid } ,
-    { "squirrel", fa::fa_squirrel } ,
-    { "staff", fa::fa_staff } ,
-    { "standard-definition", fa::fa_standard_definition } ,
-    { "rectangle-sd", fa::fa_rectangle_sd } ,
-    { "star-christmas", fa::fa_star_christmas } ,
-    { "star-exclamation", fa::fa_star_exclamation } ,
-    { "star-sharp", fa::fa_star_sharp } ,
-    { "star-sharp-half", fa::fa_star_sharp_half } ,
-    { "star-sharp-half-stroke", fa::fa_star_sharp_half_stroke } ,
-    { "star-sharp-half-alt", fa::fa_star_sharp_half_alt } ,
-    { "star-shooting", fa::fa_star_shooting } ,
-    { "starfighter", fa::fa_starfighter } ,
-    { "starfighter-twin-ion-engine", fa::fa_starfighter_twin_ion_engine } ,
-    { "starfighter-alt", fa::fa_starfighter_alt } ,
-    { "starfighter-twin-ion-engine-advanced", fa::fa_starfighter_twin_ion_engine_advanced } ,
-    { "starfighter-alt-advanced", fa::fa_starfighter_alt_advanced } ,
-    { "stars", fa::fa_stars } ,
-    { "starship", fa::fa_starship } ,
-    { "starship-freighter", fa::fa_starship_freighter } ,
-    { "steak", fa::fa_steak } ,
-    { "steering-wheel", fa::fa_steering_wheel } ,
-    { "stocking", fa::fa_stocking } ,
-    { "stomach", fa::fa_stomach } ,
-    { "store-lock", fa::fa_store_lock } ,
-    { "strawberry", fa::fa_strawberry } ,
-    { "stretcher", fa::fa_stretcher } ,
-    { "subtitles", fa::fa_subtitles } ,
-    { "subtitles-slash", fa::fa_subtitles_slash } ,
-    { "sun-bright", fa::fa_sun_bright } ,
-    { "sun-alt", fa::fa_sun_alt } ,
-    { "sun-cloud", fa::fa_sun_cloud } ,
-    { "sun-dust", fa::fa_sun_dust } ,
-    { "sun-haze", fa::fa_sun_haze } ,
-    { "sunglasses", fa::fa_sunglasses } ,
-    { "sunrise", fa::fa_sunrise } ,
-    { "sunset", fa::fa_sunset } ,
-    { "sushi", fa::fa_sushi } ,
-    { "nigiri", fa::fa_nigiri } ,
-    { "sushi-roll", fa::fa_sushi_roll } ,
-    { "maki-roll", fa::fa_maki_roll } ,
-    { "makizushi", fa::fa_makizushi } ,
-    { "swap", fa::fa_swap } ,
-    { "swap-arrows", fa::fa_swap_arrows } ,
-    { "sword", fa::fa_sword } ,
-    { "sword-laser", fa::fa_sword_laser } ,
-    { "sword-laser-alt", fa::fa_sword_laser_alt } ,
-    { "swords", fa::fa_swords } ,
-    { "swords-laser", fa::fa_swords_laser } ,
-    { "symbols", fa::fa_symbols } ,
-    { "icons-alt", fa::fa_icons_alt } ,
-    { "t-rex", fa::fa_t_rex } ,
-    { "table-cells-column-unlock", fa::fa_table_cells_column_unlock } ,
-    { "table-cells-lock", fa::fa_table_cells_lock } ,
-    { "table-cells-unlock", fa::fa_table_cells_unlock } ,
-    { "table-layout", fa::fa_table_layout } ,
-    { "table-picnic", fa::fa_table_picnic } ,
-    { "table-pivot", fa::fa_table_pivot } ,
-    { "table-rows", fa::fa_table_rows } ,
-    { "rows", fa::fa_rows } ,
-    { "table-tree", fa::fa_table_tree } ,
-    { "tablet-rugged", fa::fa_tablet_rugged } ,
-    { "tablet-screen", fa::fa_tablet_screen } ,
-    { "tablet-android-alt", fa::fa_tablet_android_alt } ,
-    { "taco", fa::fa_taco } ,
-    { "tally", fa::fa_tally } ,
-    { "tally-5", fa::fa_tally_5 } ,
-    { "tally-1", fa::fa_tally_1 } ,
-    { "tally-2", fa::fa_tally_2 } ,
-    { "tally-3", fa::fa_tally_3 } ,
-    { "tally-4", fa::fa_tally_4 } ,
-    { "tamale", fa::fa_tamale } ,
-    { "tank-water", fa::fa_tank_water } ,
-    { "taxi-bus", fa::fa_taxi_bus } ,
-    { "teddy-bear", fa::fa_teddy_bear } ,
-    { "telescope", fa::fa_telescope } ,
-    { "temperature-list", fa::fa_temperature_list } ,
-    { "temperature-snow", fa::fa_temperature_snow } ,
-    { "temperature-frigid", fa::fa_temperature_frigid } ,
-    { "temperature-sun", fa::fa_temperature_sun } ,
-    { "temperature-hot", fa::fa_temperature_hot } ,
-    { "tennis-ball", fa::fa_tennis_ball } ,
-    { "tent-double-peak", fa::fa_tent_double_peak } ,
-    { "text", fa::fa_text } ,
-    { "text-size", fa::fa_text_size } ,
-    { "theta", fa::fa_theta } ,
-    { "thought-bubble", fa::fa_thought_bubble } ,
-    { "tick", fa::fa_tick } ,
-    { "ticket-airline", fa::fa_ticket_airline } ,
-    { "ticket-perforated-plane", fa::fa_ticket_perforated_plane } ,
-    { "ticket-plane", fa::fa_ticket_plane } ,
-    { "ticket-perforated", fa::fa_ticket_perforated } ,
-    { "tickets", fa::fa_tickets } ,
-    { "tickets-airline", fa::fa_tickets_airline } ,
-    { "tickets-perforated-plane", fa::fa_tickets_perforated_plane } ,
-    { "tickets-plane", fa::fa_tickets_plane } ,
-    { "tickets-perforated", fa::fa_tickets_perforated } ,
-    { "tickets-simple", fa::fa_tickets_simple } ,
-    { "tilde", fa::fa_tilde } ,
-    { "timeline-arrow", fa::fa_timeline_arrow } ,
-    { "timer", fa::fa_timer } ,
-    { "tire", fa::fa_tire } ,
-    { "tire-flat", fa::fa_tire_flat } ,
-    { "tire-pressure-warning", fa::fa_tire_pressure_warning } ,
-    { "tire-rugged", fa::fa_tire_rugged } ,
-    { "toggle-large-off", fa::fa_toggle_large_off } ,
-    { "toggle-large-on", fa::fa_toggle_large_on } ,
-    { "toilet-paper-blank", fa::fa_toilet_paper_blank } ,
-    { "toilet-paper-alt", fa::fa_toilet_paper_alt } ,
-    { "toilet-paper-blank-under", fa::fa_toilet_paper_blank_under } ,
-    { "toilet-paper-reverse-alt", fa::fa_toilet_paper_reverse_alt } ,
-    { "toilet-paper-check", fa::fa_toilet_paper_check } ,
-    { "toilet-paper-under", fa::fa_toilet_paper_under } ,
-    { "toilet-paper-reverse", fa::fa_toilet_paper_reverse } ,
-    { "toilet-paper-under-slash", fa::fa_toilet_paper_under_slash } ,
-    { "toilet-paper-reverse-slash", fa::fa_toilet_paper_reverse_slash } ,
-    { "toilet-paper-xmark", fa::fa_toilet_paper_xmark } ,
-    { "tomato", fa::fa_tomato } ,
-    { "tombstone", fa::fa_tombstone } ,
-    { "tombstone-blank", fa::fa_tombstone_blank } ,
-    { "tombstone-alt", fa::fa_tombstone_alt } ,
-    { "toothbrush", fa::fa_toothbrush } ,
-    { "tower-control", fa::fa_tower_control } ,
-    { "traffic-cone", fa::fa_traffic_cone } ,
-    { "traffic-light-go", fa::fa_traffic_light_go } ,
-    { "traffic-light-slow", fa::fa_traffic_light_slow } ,
-    { "traffic-light-stop", fa::fa_traffic_light_stop } ,
-    { "train-subway-tunnel", fa::fa_train_subway_tunnel } ,
-    { "subway-tunnel", fa::fa_subway_tunnel } ,
-    { "train-track", fa::fa_train_track } ,
-    { "train-tunnel", fa::fa_train_tunnel } ,
-    { "transformer-bolt", fa::fa_transformer_bolt } ,
-    { "transporter", fa::fa_transporter } ,
-    { "transporter-1", fa::fa_transporter_1 } ,
-    { "transporter-2", fa::fa_transporter_2 } ,
-    { "transporter-3", fa::fa_transporter_3 } ,
-    { "transporter-4", fa::fa_transporter_4 } ,
-    { "transporter-5", fa::fa_transporter_5 } ,
-    { "transporter-6", fa::fa_transporter_6 } ,
-    { "transporter-7", fa::fa_transporter_7 } ,
-    { "transporter-empty", fa::fa_transporter_empty } ,
-    { "trash-can-check", fa::fa_trash_can_check } ,
-    { "trash-can-clock", fa::fa_trash_can_clock } ,
-    { "trash-can-list", fa::fa_trash_can_list } ,
-    { "trash-can-plus", fa::fa_trash_can_plus } ,
-    { "trash-can-slash", fa::fa_trash_can_slash } ,
-    { "trash-alt-slash", fa::fa_trash_alt_slash } ,
-    { "trash-can-undo", fa::fa_trash_can_undo } ,
-    { "trash-can-arrow-turn-left", fa::fa_trash_can_arrow_turn_left } ,
-    { "trash-undo-alt", fa::fa_trash_undo_alt } ,
-    { "trash-can-xmark", fa::fa_trash_can_xmark } ,
-    { "trash-check", fa::fa_trash_check } ,
-    { "trash-clock", fa::fa_trash_clock } ,
-    { "trash-list", fa::fa_trash_list } ,
-    { "trash-plus", fa::fa_trash_plus } ,
-    { "trash-slash", fa::fa_trash_slash } ,
-    { "trash-undo", fa::fa_trash_undo } ,
-    { "trash-arrow-turn-left", fa::fa_trash_arrow_turn_left } ,
-    { "trash-xmark", fa::fa_trash_xmark } ,
-    { "treasure-chest", fa::fa_treasure_chest } ,
-    { "tree-christmas", fa::fa_tree_christmas } ,
-    { "tree-deciduous", fa::fa_tree_deciduous } ,
-    { "tree-alt", fa::fa_tree_alt } ,
-    { "tree-decorated", fa::fa_tree_decorated } ,
-    { "tree-large", fa::fa_tree_large } ,
-    { "tree-palm", fa::fa_tree_palm } ,
-    { "trees", fa::fa_trees } ,
-    { "triangle", fa::fa_triangle } ,
-    { "triangle-instrument", fa::fa_triangle_instrument } ,
-    { "triangle-music", fa::fa_triangle_music } ,
-    { "triangle-person-digging", fa::fa_triangle_person_digging } ,
-    { "construction", fa::fa_construction } ,
-    { "tricycle", fa::fa_tricycle } ,
-    { "tricycle-adult", fa::fa_tricycle_adult } ,
-    { "trillium", fa::fa_trillium } ,
-    { "trophy-star", fa::fa_trophy_star } ,
-    { "trophy-alt", fa::fa_trophy_alt } ,
-    { "truck-bolt", fa::fa_truck_bolt } ,
-    { "truck-clock", fa::fa_truck_clock } ,
-    { "shipping-timed", fa::fa_shipping_timed } ,
-    { "truck-container", fa::fa_truck_container } ,
-    { "truck-container-empty", fa::fa_truck_container_empty } ,
-    { "truck-fire", fa::fa_truck_fire } ,
-    { "truck-flatbed", fa::fa_truck_flatbed } ,
-    { "truck-ladder", fa::fa_truck_ladder } ,
-    { "truck-plow", fa::fa_truck_plow } ,
-    { "truck-ramp", fa::fa_truck_ramp } ,
-    { "truck-ramp-couch", fa::fa_truck_ramp_couch } ,
-    { "truck-couch", fa::fa_truck_couch } ,
-    { "truck-tow", fa::fa_truck_tow } ,
-    { "truck-utensils", fa::fa_truck_utensils } ,
-    { "trumpet", fa::fa_trumpet } ,
-    { "tty-answer", fa::fa_tty_answer } ,
-    { "teletype-answer", fa::fa_teletype_answer } ,
-    { "tugrik-sign", fa::fa_tugrik_sign } ,
-    { "turkey", fa::fa_turkey } ,
-    { "turn-down-left", fa::fa_turn_down_left } ,
-    { "turn-down-right", fa::fa_turn_down_right } ,
-    { "turn-left", fa::fa_turn_left } ,
-    { "turn-left-down", fa::fa_turn_left_down } ,
-    { "turn-left-up", fa::fa_turn_left_up } ,
-    { "turn-right", fa::fa_turn_right } ,
-    { "turntable", fa::fa_turntable } ,
-    { "turtle", fa::fa_turtle } ,
-    { "tv-music", fa::fa_tv_music } ,
-    { "tv-retro", fa::fa_tv_retro } ,
-    { "typewriter", fa::fa_typewriter } ,
-    { "ufo", fa::fa_ufo } ,
-    { "ufo-beam", fa::fa_ufo_beam } ,
-    { "umbrella-simple", fa::fa_umbrella_simple } ,
-    { "umbrella-alt", fa::fa_umbrella_alt } ,
-    { "unicorn", fa::fa_unicorn } ,
-    { "uniform-martial-arts", fa::fa_uniform_martial_arts } ,
-    { "union", fa::fa_union } ,
-    { "up", fa::fa_up } ,
-    { "arrow-alt-up", fa::fa_arrow_alt_up } ,
-    { "up-from-bracket", fa::fa_up_from_bracket } ,
-    { "up-from-dotted-line", fa::fa_up_from_dotted_line } ,
-    { "up-from-line", fa::fa_up_from_line } ,
-    { "arrow-alt-from-bottom", fa::fa_arrow_alt_from_bottom } ,
-    { "up-left", fa::fa_up_left } ,
-    { "up-right", fa::fa_up_right } ,
-    { "up-to-bracket", fa::fa_up_to_bracket } ,
-    { "up-to-dotted-line", fa::fa_up_to_dotted_line } ,
-    { "up-to-line", fa::fa_up_to_line } ,
-    { "arrow-alt-to-top", fa::fa_arrow_alt_to_top } ,
-    { "usb-drive", fa::fa_usb_drive } ,
-    { "user-alien", fa::fa_user_alien } ,
-    { "user-beard-bolt", fa::fa_user_beard_bolt } ,
-    { "user-bounty-hunter", fa::fa_user_bounty_hunter } ,
-    { "user-chef", fa::fa_user_chef } ,
-    { "user-cowboy", fa::fa_user_cowboy } ,
-    { "user-crown", fa::fa_user_crown } ,
-    { "user-doctor-hair", fa::fa_user_doctor_hair } ,
-    { "user-doctor-hair-long", fa::fa_user_doctor_hair_long } ,
-    { "user-doctor-message", fa::fa_user_doctor_message } ,
-    { "user-md-chat", fa::fa_user_md_chat } ,
-    { "user-group-crown", fa::fa_user_group_crown } ,
-    { "users-crown", fa::fa_users_crown } ,
-    { "user-group-simple", fa::fa_user_group_simple } ,
-    { "user-hair", fa::fa_user_hair } ,
-    { "user-hair-buns", fa::fa_user_hair_buns } ,
-    { "user-hair-long", fa::fa_user_hair_long } ,
-    { "user-hair-mullet", fa::fa_user_hair_mullet } ,
-    { "business-front", fa::fa_business_front } ,
-    { "party-back", fa::fa_party_back } ,
-    { "trian-balbot", fa::fa_trian_balbot } ,
-    { "user-headset", fa::fa_user_headset } ,
-    { "user-helmet-safety", fa::fa_user_helmet_safety } ,
-    { "user-construction", fa::fa_user_construction } ,
-    { "user-hard-hat", fa::fa_user_hard_hat } ,
-    { "user-hoodie", fa::fa_user_hoodie } ,
-    { "user-magnifying-glass", fa::fa_user_magnifying_glass } ,
-    { "user-music", fa::fa_user_music } ,
-    { "user-nurse-hair", fa::fa_user_nurse_hair } ,
-    { "user-nurse-hair-long", fa::fa_user_nurse_hair_long } ,
-    { "user-pilot", fa::fa_user_pilot } ,
-    { "user-pilot-tie", fa::fa_user_pilot_tie } ,
-    { "user-police", fa::fa_user_police } ,
-    { "user-police-tie", fa::fa_user_police_tie } ,
-    { "user-robot", fa::fa_user_robot } ,
-    { "user-robot-xmarks", fa::fa_user_robot_xmarks } ,
-    { "user-shakespeare", fa::fa_user_shakespeare } ,
-    { "user-tie-hair", fa::fa_user_tie_hair } ,
-    { "user-tie-hair-long", fa::fa_user_tie_hair_long } ,
-    { "user-unlock", fa::fa_user_unlock } ,
-    { "user-visor", fa::fa_user_visor } ,
-    { "user-vneck", fa::fa_user_vneck } ,
-    { "user-vneck-hair", fa::fa_user_vneck_hair } ,
-    { "user-vneck-hair-long", fa::fa_user_vneck_hair_long } ,
-    { "users-medical", fa::fa_users_medical } ,
-    { "utensils-slash", fa::fa_utensils_slash } ,
-    { "utility-pole", fa::fa_utility_pole } ,
-    { "utility-pole-double", fa::fa_utility_pole_double } ,
-    { "vacuum", fa::fa_vacuum } ,
-    { "vacuum-robot", fa::fa_vacuum_robot } ,
-    { "value-absolute", fa::fa_value_absolute } ,
-    { "vector-circle", fa::fa_vector_circle } ,
-    { "vector-polygon", fa::fa_vector_polygon } ,
-    { "vent-damper", fa::fa_vent_damper } ,
-    { "video-arrow-down-left", fa::fa_video_arrow_down_left } ,
-    { "video-arrow-up-right", fa::fa_video_arrow_up_right } ,
-    { "video-plus", fa::fa_video_plus } ,
-    { "violin", fa::fa_violin } ,
-    { "volume", fa::fa_volume } ,
-    { "volume-medium", fa::fa_volume_medium } ,
-    { "volume-slash", fa::fa_volume_slash } ,
-    { "waffle", fa::fa_waffle } ,
-    { "wagon-covered", fa::fa_wagon_covered } ,
-    { "walker", fa::fa_walker } ,
-    { "wand", fa::fa_wand } ,
-    { "warehouse-full", fa::fa_warehouse_full } ,
-    { "warehouse-alt", fa::fa_warehouse_alt } ,
-    { "washing-machine", fa::fa_washing_machine } ,
-    { "washer", fa::fa_washer } ,
-    { "watch", fa::fa_watch } ,
-    { "watch-apple", fa::fa_watch_apple } ,
-    { "watch-calculator", fa::fa_watch_calculator } ,
-    { "watch-fitness", fa::fa_watch_fitness } ,
-    { "watch-smart", fa::fa_watch_smart } ,
-    { "water-arrow-down", fa::fa_water_arrow_down } ,
-    { "water-lower", fa::fa_water_lower } ,
-    { "water-arrow-up", fa::fa_water_arrow_up } ,
-    { "water-rise", fa::fa_water_rise } ,
-    { "watermelon-slice", fa::fa_watermelon_slice } ,
-    { "wave", fa::fa_wave } ,
-    { "wave-pulse", fa::fa_wave_pulse } ,
-    { "heart-rate", fa::fa_heart_rate } ,
-    { "wave-sine", fa::fa_wave_sine } ,
-    { "wave-triangle", fa::fa_wave_triangle } ,
-    { "waveform", fa::fa_waveform } ,
-    { "waveform-lines", fa::fa_waveform_lines } ,
-    { "waveform-path", fa::fa_waveform_path } ,
-    { "waves-sine", fa::fa_waves_sine } ,
-    { "webhook", fa::fa_webhook } ,
-    { "whale", fa::fa_whale } ,
-    { "wheat", fa::fa_wheat } ,
-    { "wheat-awn-slash", fa::fa_wheat_awn_slash } ,
-    { "wheat-slash", fa::fa_wheat_slash } ,
-    { "whiskey-glass-ice", fa::fa_whiskey_glass_ice } ,
-    { "glass-whiskey-rocks", fa::fa_glass_whiskey_rocks } ,
-    { "whistle", fa::fa_whistle } ,
-    { "wifi-exclamation", fa::fa_wifi_exclamation } ,
-    { "wifi-fair", fa::fa_wifi_fair } ,
-    { "wifi-2", fa::fa_wifi_2 } ,
-    { "wifi-slash", fa::fa_wifi_slash } ,
-    { "wifi-weak", fa::fa_wifi_weak } ,
-    { "wifi-1", fa::fa_wifi_1 } ,
-    { "wind-turbine", fa::fa_wind_turbine } ,
-    { "wind-warning", fa::fa_wind_warning } ,
-    { "wind-circle-exclamation", fa::fa_wind_circle_exclamation } ,
-    { "window", fa::fa_window } ,
-    { "window-flip", fa::fa_window_flip } ,
-    { "window-alt", fa::fa_window_alt } ,
-    { "window-frame", fa::fa_window_frame } ,
-    { "window-frame-open", fa::fa_window_frame_open } ,
-    { "windsock", fa::fa_windsock } ,
-    { "wine-glass-crack", fa::fa_wine_glass_crack } ,
-    { "fragile", fa::fa_fragile } ,
-    { "wreath", fa::fa_wreath } ,
-    { "wreath-laurel", fa::fa_wreath_laurel } ,
-    { "wrench-simple", fa::fa_wrench_simple } ,
-    { "xmark-large", fa::fa_xmark_large } ,
-    { "xmark-to-slot", fa::fa_xmark_to_slot } ,
-    { "times-to-slot", fa::fa_times_to_slot } ,
-    { "vote-nay", fa::fa_vote_nay } 
+static constexpr fa::QtAwesomeNamedIcon faBrandsIconArray[] = {
+    { 23945, fa::fa_42_group } , // 42-group
+    { 23963, fa::fa_500px } , // 500px
+    { 23969, fa::fa_accessible_icon } , // accessible-icon
+    { 23985, fa::fa_accusoft } , // accusoft
+    { 23994, fa::fa_adn } , // adn
+    { 23998, fa::fa_adversal } , // adversal
+    { 24007, fa::fa_affiliatetheme } , // affiliatetheme
+    { 24022, fa::fa_airbnb } , // airbnb
+    { 24029, fa::fa_algolia } , // algolia
+    { 24037, fa::fa_alipay } , // alipay
+    { 24044, fa::fa_amazon } , // amazon
+    { 24051, fa::fa_amazon_pay } , // amazon-pay
+    { 24062, fa::fa_amilia } , // amilia
+    { 24069, fa::fa_android } , // android
+    { 24077, fa::fa_angellist } , // angellist
+    { 24087, fa::fa_angrycreative } , // angrycreative
+    { 24101, fa::fa_angular } , // angular
+    { 24109, fa::fa_app_store } , // app-store
+    { 24119, fa::fa_app_store_ios } , // app-store-ios
+    { 24133, fa::fa_apper } , // apper
+    { 24139, fa::fa_apple } , // apple
+    { 24145, fa::fa_apple_pay } , // apple-pay
+    { 24155, fa::fa_artstation } , // artstation
+    { 24166, fa::fa_asymmetrik } , // asymmetrik
+    { 24177, fa::fa_atlassian } , // atlassian
+    { 24187, fa::fa_audible } , // audible
+    { 24195, fa::fa_autoprefixer } , // autoprefixer
+    { 24208, fa::fa_avianex } , // avianex
+    { 24216, fa::fa_aviato } , // aviato
+    { 24223, fa::fa_aws } , // aws
+    { 24227, fa::fa_bandcamp } , // bandcamp
+    { 24236, fa::fa_battle_net } , // battle-net
+    { 24247, fa::fa_behance } , // behance
+    { 27611, fa::fa_behance_square } , // behance-square
+    { 24255, fa::fa_bilibili } , // bilibili
+    { 24264, fa::fa_bimobject } , // bimobject
+    { 24274, fa::fa_bitbucket } , // bitbucket
+    { 24284, fa::fa_bitcoin } , // bitcoin
+    { 24292, fa::fa_bity } , // bity
+    { 24297, fa::fa_black_tie } , // black-tie
+    { 24307, fa::fa_blackberry } , // blackberry
+    { 24318, fa::fa_blogger } , // blogger
+    { 24326, fa::fa_blogger_b } , // blogger-b
+    { 24336, fa::fa_bluesky } , // bluesky
+    { 24344, fa::fa_bluetooth } , // bluetooth
+    { 24354, fa::fa_bluetooth_b } , // bluetooth-b
+    { 24366, fa::fa_bootstrap } , // bootstrap
+    { 24376, fa::fa_bots } , // bots
+    { 24381, fa::fa_brave } , // brave
+    { 24387, fa::fa_brave_reverse } , // brave-reverse
+    { 24401, fa::fa_btc } , // btc
+    { 24405, fa::fa_buffer } , // buffer
+    { 24412, fa::fa_buromobelexperte } , // buromobelexperte
+    { 24429, fa::fa_buy_n_large } , // buy-n-large
+    { 24441, fa::fa_buysellads } , // buysellads
+    { 24452, fa::fa_canadian_maple_leaf } , // canadian-maple-leaf
+    { 24472, fa::fa_cc_amazon_pay } , // cc-amazon-pay
+    { 24486, fa::fa_cc_amex } , // cc-amex
+    { 24494, fa::fa_cc_apple_pay } , // cc-apple-pay
+    { 24507, fa::fa_cc_diners_club } , // cc-diners-club
+    { 24522, fa::fa_cc_discover } , // cc-discover
+    { 24534, fa::fa_cc_jcb } , // cc-jcb
+    { 24541, fa::fa_cc_mastercard } , // cc-mastercard
+    { 24555, fa::fa_cc_paypal } , // cc-paypal
+    { 24565, fa::fa_cc_stripe } , // cc-stripe
+    { 24575, fa::fa_cc_visa } , // cc-visa
+    { 24583, fa::fa_centercode } , // centercode
+    { 24594, fa::fa_centos } , // centos
+    { 24601, fa::fa_chrome } , // chrome
+    { 24608, fa::fa_chromecast } , // chromecast
+    { 24619, fa::fa_cloudflare } , // cloudflare
+    { 24630, fa::fa_cloudscale } , // cloudscale
+    { 24641, fa::fa_cloudsmith } , // cloudsmith
+    { 24652, fa::fa_cloudversify } , // cloudversify
+    { 24665, fa::fa_cmplid } , // cmplid
+    { 24672, fa::fa_codepen } , // codepen
+    { 24680, fa::fa_codiepie } , // codiepie
+    { 24689, fa::fa_confluence } , // confluence
+    { 24700, fa::fa_connectdevelop } , // connectdevelop
+    { 24715, fa::fa_contao } , // contao
+    { 24722, fa::fa_cotton_bureau } , // cotton-bureau
+    { 24736, fa::fa_cpanel } , // cpanel
+    { 24743, fa::fa_creative_commons } , // creative-commons
+    { 24760, fa::fa_creative_commons_by } , // creative-commons-by
+    { 24780, fa::fa_creative_commons_nc } , // creative-commons-nc
+    { 24800, fa::fa_creative_commons_nc_eu } , // creative-commons-nc-eu
+    { 24823, fa::fa_creative_commons_nc_jp } , // creative-commons-nc-jp
+    { 24846, fa::fa_creative_commons_nd } , // creative-commons-nd
+    { 24866, fa::fa_creative_commons_pd } , // creative-commons-pd
+    { 24886, fa::fa_creative_commons_pd_alt } , // creative-commons-pd-alt
+    { 24910, fa::fa_creative_commons_remix } , // creative-commons-remix
+    { 24933, fa::fa_creative_commons_sa } , // creative-commons-sa
+    { 24953, fa::fa_creative_commons_sampling } , // creative-commons-sampling
+    { 24979, fa::fa_creative_commons_sampling_plus } , // creative-commons-sampling-plus
+    { 25010, fa::fa_creative_commons_share } , // creative-commons-share
+    { 25033, fa::fa_creative_commons_zero } , // creative-commons-zero
+    { 25055, fa::fa_critical_role } , // critical-role
+    { 25069, fa::fa_css } , // css
+    { 25073, fa::fa_css3 } , // css3
+    { 25078, fa::fa_css3_alt } , // css3-alt
+    { 25087, fa::fa_cuttlefish } , // cuttlefish
+    { 25098, fa::fa_d_and_d } , // d-and-d
+    { 25106, fa::fa_d_and_d_beyond } , // d-and-d-beyond
+    { 25121, fa::fa_dailymotion } , // dailymotion
+    { 25133, fa::fa_dart_lang } , // dart-lang
+    { 25143, fa::fa_dashcube } , // dashcube
+    { 25152, fa::fa_debian } , // debian
+    { 25159, fa::fa_deezer } , // deezer
+    { 25166, fa::fa_delicious } , // delicious
+    { 25176, fa::fa_deploydog } , // deploydog
+    { 25186, fa::fa_deskpro } , // deskpro
+    { 25194, fa::fa_dev } , // dev
+    { 25198, fa::fa_deviantart } , // deviantart
+    { 25209, fa::fa_dhl } , // dhl
+    { 25213, fa::fa_diaspora } , // diaspora
+    { 25222, fa::fa_digg } , // digg
+    { 25227, fa::fa_digital_ocean } , // digital-ocean
+    { 25241, fa::fa_discord } , // discord
+    { 25249, fa::fa_discourse } , // discourse
+    { 25259, fa::fa_dochub } , // dochub
+    { 25266, fa::fa_docker } , // docker
+    { 25273, fa::fa_draft2digital } , // draft2digital
+    { 25287, fa::fa_dribbble } , // dribbble
+    { 27657, fa::fa_dribbble_square } , // dribbble-square
+    { 25296, fa::fa_dropbox } , // dropbox
+    { 25304, fa::fa_drupal } , // drupal
+    { 25311, fa::fa_dyalog } , // dyalog
+    { 25318, fa::fa_earlybirds } , // earlybirds
+    { 25329, fa::fa_ebay } , // ebay
+    { 25334, fa::fa_edge } , // edge
+    { 25339, fa::fa_edge_legacy } , // edge-legacy
+    { 25351, fa::fa_elementor } , // elementor
+    { 25361, fa::fa_ello } , // ello
+    { 25366, fa::fa_ember } , // ember
+    { 25372, fa::fa_empire } , // empire
+    { 25379, fa::fa_envira } , // envira
+    { 25386, fa::fa_erlang } , // erlang
+    { 25393, fa::fa_ethereum } , // ethereum
+    { 25402, fa::fa_etsy } , // etsy
+    { 25407, fa::fa_evernote } , // evernote
+    { 25416, fa::fa_expeditedssl } , // expeditedssl
+    { 25429, fa::fa_facebook } , // facebook
+    { 25438, fa::fa_facebook_f } , // facebook-f
+    { 25449, fa::fa_facebook_messenger } , // facebook-messenger
+    { 27689, fa::fa_facebook_square } , // facebook-square
+    { 25468, fa::fa_fantasy_flight_games } , // fantasy-flight-games
+    { 25489, fa::fa_fedex } , // fedex
+    { 25495, fa::fa_fedora } , // fedora
+    { 25502, fa::fa_figma } , // figma
+    { 25508, fa::fa_files_pinwheel } , // files-pinwheel
+    { 25523, fa::fa_firefox } , // firefox
+    { 25531, fa::fa_firefox_browser } , // firefox-browser
+    { 25547, fa::fa_first_order } , // first-order
+    { 25559, fa::fa_first_order_alt } , // first-order-alt
+    { 25575, fa::fa_firstdraft } , // firstdraft
+    { 25586, fa::fa_flickr } , // flickr
+    { 25593, fa::fa_flipboard } , // flipboard
+    { 25603, fa::fa_flutter } , // flutter
+    { 25611, fa::fa_fly } , // fly
+    { 25615, fa::fa_font_awesome } , // font-awesome
+    { 27752, fa::fa_font_awesome_alt } , // font-awesome-alt
+    { 25628, fa::fa_font_awesome_flag } , // font-awesome-flag
+    { 25646, fa::fa_font_awesome_logo_full } , // font-awesome-logo-full
+    { 25669, fa::fa_fonticons } , // fonticons
+    { 25679, fa::fa_fonticons_fi } , // fonticons-fi
+    { 25692, fa::fa_fort_awesome } , // fort-awesome
+    { 25705, fa::fa_fort_awesome_alt } , // fort-awesome-alt
+    { 25722, fa::fa_forumbee } , // forumbee
+    { 25731, fa::fa_foursquare } , // foursquare
+    { 25742, fa::fa_free_code_camp } , // free-code-camp
+    { 25757, fa::fa_freebsd } , // freebsd
+    { 25765, fa::fa_fulcrum } , // fulcrum
+    { 25773, fa::fa_galactic_republic } , // galactic-republic
+    { 25791, fa::fa_galactic_senate } , // galactic-senate
+    { 25807, fa::fa_get_pocket } , // get-pocket
+    { 25818, fa::fa_gg } , // gg
+    { 25821, fa::fa_gg_circle } , // gg-circle
+    { 25831, fa::fa_git } , // git
+    { 25835, fa::fa_git_alt } , // git-alt
+    { 27780, fa::fa_git_square } , // git-square
+    { 25843, fa::fa_github } , // github
+    { 25850, fa::fa_github_alt } , // github-alt
+    { 27805, fa::fa_github_square } , // github-square
+    { 25861, fa::fa_gitkraken } , // gitkraken
+    { 25871, fa::fa_gitlab } , // gitlab
+    { 27833, fa::fa_gitlab_square } , // gitlab-square
+    { 25878, fa::fa_gitter } , // gitter
+    { 25885, fa::fa_glide } , // glide
+    { 25891, fa::fa_glide_g } , // glide-g
+    { 25899, fa::fa_gofore } , // gofore
+    { 25906, fa::fa_golang } , // golang
+    { 25913, fa::fa_goodreads } , // goodreads
+    { 25923, fa::fa_goodreads_g } , // goodreads-g
+    { 25935, fa::fa_google } , // google
+    { 25942, fa::fa_google_drive } , // google-drive
+    { 25955, fa::fa_google_pay } , // google-pay
+    { 25966, fa::fa_google_play } , // google-play
+    { 25978, fa::fa_google_plus } , // google-plus
+    { 25990, fa::fa_google_plus_g } , // google-plus-g
+    { 27866, fa::fa_google_plus_square } , // google-plus-square
+    { 26004, fa::fa_google_scholar } , // google-scholar
+    { 26019, fa::fa_google_wallet } , // google-wallet
+    { 26033, fa::fa_gratipay } , // gratipay
+    { 26042, fa::fa_grav } , // grav
+    { 26047, fa::fa_gripfire } , // gripfire
+    { 26056, fa::fa_grunt } , // grunt
+    { 26062, fa::fa_guilded } , // guilded
+    { 26070, fa::fa_gulp } , // gulp
+    { 26075, fa::fa_hacker_news } , // hacker-news
+    { 27904, fa::fa_hacker_news_square } , // hacker-news-square
+    { 26087, fa::fa_hackerrank } , // hackerrank
+    { 26098, fa::fa_hashnode } , // hashnode
+    { 26107, fa::fa_hips } , // hips
+    { 26112, fa::fa_hire_a_helper } , // hire-a-helper
+    { 26126, fa::fa_hive } , // hive
+    { 26131, fa::fa_hooli } , // hooli
+    { 26137, fa::fa_hornbill } , // hornbill
+    { 26146, fa::fa_hotjar } , // hotjar
+    { 26153, fa::fa_houzz } , // houzz
+    { 26159, fa::fa_html5 } , // html5
+    { 26165, fa::fa_hubspot } , // hubspot
+    { 26173, fa::fa_ideal } , // ideal
+    { 26179, fa::fa_imdb } , // imdb
+    { 23954, fa::fa_innosoft } , // innosoft
+    { 26184, fa::fa_instagram } , // instagram
+    { 27940, fa::fa_instagram_square } , // instagram-square
+    { 26194, fa::fa_instalod } , // instalod
+    { 26203, fa::fa_intercom } , // intercom
+    { 26212, fa::fa_internet_explorer } , // internet-explorer
+    { 26230, fa::fa_invision } , // invision
+    { 26239, fa::fa_ioxhost } , // ioxhost
+    { 26247, fa::fa_itch_io } , // itch-io
+    { 26255, fa::fa_itunes } , // itunes
+    { 26262, fa::fa_itunes_note } , // itunes-note
+    { 26274, fa::fa_java } , // java
+    { 26279, fa::fa_jedi_order } , // jedi-order
+    { 26290, fa::fa_jenkins } , // jenkins
+    { 26298, fa::fa_jira } , // jira
+    { 26303, fa::fa_joget } , // joget
+    { 26309, fa::fa_joomla } , // joomla
+    { 26316, fa::fa_js } , // js
+    { 27967, fa::fa_js_square } , // js-square
+    { 26319, fa::fa_jsfiddle } , // jsfiddle
+    { 26328, fa::fa_jxl } , // jxl
+    { 26332, fa::fa_kaggle } , // kaggle
+    { 26339, fa::fa_keybase } , // keybase
+    { 26347, fa::fa_keycdn } , // keycdn
+    { 26354, fa::fa_kickstarter } , // kickstarter
+    { 26385, fa::fa_kickstarter_k } , // kickstarter-k
+    { 26399, fa::fa_korvue } , // korvue
+    { 26406, fa::fa_laravel } , // laravel
+    { 26414, fa::fa_lastfm } , // lastfm
+    { 27991, fa::fa_lastfm_square } , // lastfm-square
+    { 26421, fa::fa_leanpub } , // leanpub
+    { 26429, fa::fa_less } , // less
+    { 26434, fa::fa_letterboxd } , // letterboxd
+    { 26445, fa::fa_line } , // line
+    { 26450, fa::fa_linkedin } , // linkedin
+    { 26459, fa::fa_linkedin_in } , // linkedin-in
+    { 26471, fa::fa_linode } , // linode
+    { 26478, fa::fa_linux } , // linux
+    { 26484, fa::fa_lyft } , // lyft
+    { 26489, fa::fa_magento } , // magento
+    { 26497, fa::fa_mailchimp } , // mailchimp
+    { 26507, fa::fa_mandalorian } , // mandalorian
+    { 26519, fa::fa_markdown } , // markdown
+    { 26528, fa::fa_mastodon } , // mastodon
+    { 26537, fa::fa_maxcdn } , // maxcdn
+    { 26544, fa::fa_mdb } , // mdb
+    { 26548, fa::fa_medapps } , // medapps
+    { 26556, fa::fa_medium } , // medium
+    { 26563, fa::fa_medium_m } , // medium-m
+    { 26572, fa::fa_medrt } , // medrt
+    { 26578, fa::fa_meetup } , // meetup
+    { 26585, fa::fa_megaport } , // megaport
+    { 26594, fa::fa_mendeley } , // mendeley
+    { 26603, fa::fa_meta } , // meta
+    { 26608, fa::fa_microblog } , // microblog
+    { 26618, fa::fa_microsoft } , // microsoft
+    { 26628, fa::fa_mintbit } , // mintbit
+    { 26636, fa::fa_mix } , // mix
+    { 26640, fa::fa_mixcloud } , // mixcloud
+    { 26649, fa::fa_mixer } , // mixer
+    { 26655, fa::fa_mizuni } , // mizuni
+    { 26662, fa::fa_modx } , // modx
+    { 26667, fa::fa_monero } , // monero
+    { 26674, fa::fa_napster } , // napster
+    { 26682, fa::fa_neos } , // neos
+    { 26687, fa::fa_nfc_directional } , // nfc-directional
+    { 26703, fa::fa_nfc_symbol } , // nfc-symbol
+    { 26714, fa::fa_nimblr } , // nimblr
+    { 26721, fa::fa_node } , // node
+    { 26726, fa::fa_node_js } , // node-js
+    { 26734, fa::fa_npm } , // npm
+    { 26738, fa::fa_ns8 } , // ns8
+    { 26742, fa::fa_nutritionix } , // nutritionix
+    { 26754, fa::fa_octopus_deploy } , // octopus-deploy
+    { 26769, fa::fa_odnoklassniki } , // odnoklassniki
+    { 28044, fa::fa_odnoklassniki_square } , // odnoklassniki-square
+    { 26783, fa::fa_odysee } , // odysee
+    { 26790, fa::fa_old_republic } , // old-republic
+    { 26803, fa::fa_opencart } , // opencart
+    { 26812, fa::fa_openid } , // openid
+    { 26819, fa::fa_opensuse } , // opensuse
+    { 26828, fa::fa_opera } , // opera
+    { 26834, fa::fa_optin_monster } , // optin-monster
+    { 26848, fa::fa_orcid } , // orcid
+    { 26854, fa::fa_osi } , // osi
+    { 26858, fa::fa_padlet } , // padlet
+    { 26865, fa::fa_page4 } , // page4
+    { 26871, fa::fa_pagelines } , // pagelines
+    { 26881, fa::fa_palfed } , // palfed
+    { 26888, fa::fa_patreon } , // patreon
+    { 26896, fa::fa_paypal } , // paypal
+    { 26903, fa::fa_perbyte } , // perbyte
+    { 26911, fa::fa_periscope } , // periscope
+    { 26921, fa::fa_phabricator } , // phabricator
+    { 26933, fa::fa_phoenix_framework } , // phoenix-framework
+    { 26951, fa::fa_phoenix_squadron } , // phoenix-squadron
+    { 26968, fa::fa_php } , // php
+    { 26972, fa::fa_pied_piper } , // pied-piper
+    { 26983, fa::fa_pied_piper_alt } , // pied-piper-alt
+    { 26998, fa::fa_pied_piper_hat } , // pied-piper-hat
+    { 27013, fa::fa_pied_piper_pp } , // pied-piper-pp
+    { 28083, fa::fa_pied_piper_square } , // pied-piper-square
+    { 27027, fa::fa_pinterest } , // pinterest
+    { 27037, fa::fa_pinterest_p } , // pinterest-p
+    { 28118, fa::fa_pinterest_square } , // pinterest-square
+    { 27049, fa::fa_pix } , // pix
+    { 27053, fa::fa_pixiv } , // pixiv
+    { 27059, fa::fa_playstation } , // playstation
+    { 27071, fa::fa_product_hunt } , // product-hunt
+    { 27084, fa::fa_pushed } , // pushed
+    { 27091, fa::fa_python } , // python
+    { 27098, fa::fa_qq } , // qq
+    { 27101, fa::fa_quinscape } , // quinscape
+    { 27111, fa::fa_quora } , // quora
+    { 27117, fa::fa_r_project } , // r-project
+    { 27127, fa::fa_raspberry_pi } , // raspberry-pi
+    { 27140, fa::fa_ravelry } , // ravelry
+    { 27148, fa::fa_react } , // react
+    { 27154, fa::fa_reacteurope } , // reacteurope
+    { 27166, fa::fa_readme } , // readme
+    { 27173, fa::fa_rebel } , // rebel
+    { 27179, fa::fa_red_river } , // red-river
+    { 27189, fa::fa_reddit } , // reddit
+    { 27196, fa::fa_reddit_alien } , // reddit-alien
+    { 28149, fa::fa_reddit_square } , // reddit-square
+    { 27209, fa::fa_redhat } , // redhat
+    { 29271, fa::fa_rendact } , // rendact
+    { 27216, fa::fa_renren } , // renren
+    { 27223, fa::fa_replyd } , // replyd
+    { 27230, fa::fa_researchgate } , // researchgate
+    { 27243, fa::fa_resolving } , // resolving
+    { 27253, fa::fa_rev } , // rev
+    { 27257, fa::fa_rocketchat } , // rocketchat
+    { 27268, fa::fa_rockrms } , // rockrms
+    { 27276, fa::fa_rust } , // rust
+    { 27281, fa::fa_safari } , // safari
+    { 27288, fa::fa_salesforce } , // salesforce
+    { 27299, fa::fa_sass } , // sass
+    { 27304, fa::fa_schlix } , // schlix
+    { 27311, fa::fa_screenpal } , // screenpal
+    { 27321, fa::fa_scribd } , // scribd
+    { 27328, fa::fa_searchengin } , // searchengin
+    { 27340, fa::fa_sellcast } , // sellcast
+    { 27349, fa::fa_sellsy } , // sellsy
+    { 27356, fa::fa_servicestack } , // servicestack
+    { 27369, fa::fa_shirtsinbulk } , // shirtsinbulk
+    { 27382, fa::fa_shoelace } , // shoelace
+    { 27391, fa::fa_shopify } , // shopify
+    { 27399, fa::fa_shopware } , // shopware
+    { 27408, fa::fa_signal_messenger } , // signal-messenger
+    { 27425, fa::fa_simplybuilt } , // simplybuilt
+    { 27437, fa::fa_sistrix } , // sistrix
+    { 27445, fa::fa_sith } , // sith
+    { 27450, fa::fa_sitrox } , // sitrox
+    { 27457, fa::fa_sketch } , // sketch
+    { 27464, fa::fa_skyatlas } , // skyatlas
+    { 27473, fa::fa_skype } , // skype
+    { 27479, fa::fa_slack } , // slack
+    { 27485, fa::fa_slack_hash } , // slack-hash
+    { 27496, fa::fa_slideshare } , // slideshare
+    { 27507, fa::fa_snapchat } , // snapchat
+    { 27516, fa::fa_snapchat_ghost } , // snapchat-ghost
+    { 28179, fa::fa_snapchat_square } , // snapchat-square
+    { 27531, fa::fa_soundcloud } , // soundcloud
+    { 27542, fa::fa_sourcetree } , // sourcetree
+    { 27553, fa::fa_space_awesome } , // space-awesome
+    { 27567, fa::fa_speakap } , // speakap
+    { 27575, fa::fa_speaker_deck } , // speaker-deck
+    { 27588, fa::fa_spotify } , // spotify
+    { 27596, fa::fa_square_behance } , // square-behance
+    { 27626, fa::fa_square_bluesky } , // square-bluesky
+    { 27641, fa::fa_square_dribbble } , // square-dribbble
+    { 27673, fa::fa_square_facebook } , // square-facebook
+    { 27705, fa::fa_square_font_awesome } , // square-font-awesome
+    { 27725, fa::fa_square_font_awesome_stroke } , // square-font-awesome-stroke
+    { 27769, fa::fa_square_git } , // square-git
+    { 27791, fa::fa_square_github } , // square-github
+    { 27819, fa::fa_square_gitlab } , // square-gitlab
+    { 27847, fa::fa_square_google_plus } , // square-google-plus
+    { 27885, fa::fa_square_hacker_news } , // square-hacker-news
+    { 27923, fa::fa_square_instagram } , // square-instagram
+    { 27957, fa::fa_square_js } , // square-js
+    { 26366, fa::fa_square_kickstarter } , // square-kickstarter
+    { 27977, fa::fa_square_lastfm } , // square-lastfm
+    { 28005, fa::fa_square_letterboxd } , // square-letterboxd
+    { 28023, fa::fa_square_odnoklassniki } , // square-odnoklassniki
+    { 28065, fa::fa_square_pied_piper } , // square-pied-piper
+    { 28101, fa::fa_square_pinterest } , // square-pinterest
+    { 28135, fa::fa_square_reddit } , // square-reddit
+    { 28163, fa::fa_square_snapchat } , // square-snapchat
+    { 28195, fa::fa_square_steam } , // square-steam
+    { 28221, fa::fa_square_threads } , // square-threads
+    { 28236, fa::fa_square_tumblr } , // square-tumblr
+    { 28264, fa::fa_square_twitter } , // square-twitter
+    { 28294, fa::fa_square_upwork } , // square-upwork
+    { 28308, fa::fa_square_viadeo } , // square-viadeo
+    { 28336, fa::fa_square_vimeo } , // square-vimeo
+    { 28362, fa::fa_square_web_awesome } , // square-web-awesome
+    { 28381, fa::fa_square_web_awesome_stroke } , // square-web-awesome-stroke
+    { 28407, fa::fa_square_whatsapp } , // square-whatsapp
+    { 28439, fa::fa_square_x_twitter } , // square-x-twitter
+    { 28456, fa::fa_square_xing } , // square-xing
+    { 28480, fa::fa_square_youtube } , // square-youtube
+    { 28510, fa::fa_squarespace } , // squarespace
+    { 28522, fa::fa_stack_exchange } , // stack-exchange
+    { 28537, fa::fa_stack_overflow } , // stack-overflow
+    { 28552, fa::fa_stackpath } , // stackpath
+    { 28562, fa::fa_staylinked } , // staylinked
+    { 28573, fa::fa_steam } , // steam
+    { 28208, fa::fa_steam_square } , // steam-square
+    { 28579, fa::fa_steam_symbol } , // steam-symbol
+    { 28592, fa::fa_sticker_mule } , // sticker-mule
+    { 28605, fa::fa_strava } , // strava
+    { 28612, fa::fa_stripe } , // stripe
+    { 28619, fa::fa_stripe_s } , // stripe-s
+    { 28628, fa::fa_stubber } , // stubber
+    { 28636, fa::fa_studiovinari } , // studiovinari
+    { 28649, fa::fa_stumbleupon } , // stumbleupon
+    { 28661, fa::fa_stumbleupon_circle } , // stumbleupon-circle
+    { 28680, fa::fa_superpowers } , // superpowers
+    { 28692, fa::fa_supple } , // supple
+    { 28699, fa::fa_suse } , // suse
+    { 28704, fa::fa_swift } , // swift
+    { 28710, fa::fa_symfony } , // symfony
+    { 28718, fa::fa_teamspeak } , // teamspeak
+    { 28728, fa::fa_telegram } , // telegram
+    { 28737, fa::fa_telegram_plane } , // telegram-plane
+    { 28752, fa::fa_tencent_weibo } , // tencent-weibo
+    { 28766, fa::fa_the_red_yeti } , // the-red-yeti
+    { 28779, fa::fa_themeco } , // themeco
+    { 28787, fa::fa_themeisle } , // themeisle
+    { 28797, fa::fa_think_peaks } , // think-peaks
+    { 28809, fa::fa_threads } , // threads
+    { 28817, fa::fa_tiktok } , // tiktok
+    { 28824, fa::fa_trade_federation } , // trade-federation
+    { 28841, fa::fa_trello } , // trello
+    { 28848, fa::fa_tumblr } , // tumblr
+    { 28250, fa::fa_tumblr_square } , // tumblr-square
+    { 28855, fa::fa_twitch } , // twitch
+    { 28862, fa::fa_twitter } , // twitter
+    { 28279, fa::fa_twitter_square } , // twitter-square
+    { 28870, fa::fa_typo3 } , // typo3
+    { 28876, fa::fa_uber } , // uber
+    { 28881, fa::fa_ubuntu } , // ubuntu
+    { 28888, fa::fa_uikit } , // uikit
+    { 28894, fa::fa_umbraco } , // umbraco
+    { 28902, fa::fa_uncharted } , // uncharted
+    { 28912, fa::fa_uniregistry } , // uniregistry
+    { 28924, fa::fa_unity } , // unity
+    { 28930, fa::fa_unsplash } , // unsplash
+    { 28939, fa::fa_untappd } , // untappd
+    { 28947, fa::fa_ups } , // ups
+    { 28951, fa::fa_upwork } , // upwork
+    { 28958, fa::fa_usb } , // usb
+    { 28962, fa::fa_usps } , // usps
+    { 28967, fa::fa_ussunnah } , // ussunnah
+    { 28976, fa::fa_vaadin } , // vaadin
+    { 28983, fa::fa_viacoin } , // viacoin
+    { 28991, fa::fa_viadeo } , // viadeo
+    { 28322, fa::fa_viadeo_square } , // viadeo-square
+    { 28998, fa::fa_viber } , // viber
+    { 29004, fa::fa_vimeo } , // vimeo
+    { 28349, fa::fa_vimeo_square } , // vimeo-square
+    { 29010, fa::fa_vimeo_v } , // vimeo-v
+    { 29018, fa::fa_vine } , // vine
+    { 29023, fa::fa_vk } , // vk
+    { 29026, fa::fa_vnv } , // vnv
+    { 29030, fa::fa_vuejs } , // vuejs
+    { 29036, fa::fa_watchman_monitoring } , // watchman-monitoring
+    { 29056, fa::fa_waze } , // waze
+    { 29061, fa::fa_web_awesome } , // web-awesome
+    { 29073, fa::fa_webflow } , // webflow
+    { 29081, fa::fa_weebly } , // weebly
+    { 29088, fa::fa_weibo } , // weibo
+    { 29094, fa::fa_weixin } , // weixin
+    { 29101, fa::fa_whatsapp } , // whatsapp
+    { 28423, fa::fa_whatsapp_square } , // whatsapp-square
+    { 29110, fa::fa_whmcs } , // whmcs
+    { 29116, fa::fa_wikipedia_w } , // wikipedia-w
+    { 29128, fa::fa_windows } , // windows
+    { 29136, fa::fa_wirsindhandwerk } , // wirsindhandwerk
+    { 29156, fa::fa_wix } , // wix
+    { 29160, fa::fa_wizards_of_the_coast } , // wizards-of-the-coast
+    { 29181, fa::fa_wodu } , // wodu
+    { 29186, fa::fa_wolf_pack_battalion } , // wolf-pack-battalion
+    { 29206, fa::fa_wordpress } , // wordpress
+    { 29216, fa::fa_wordpress_simple } , // wordpress-simple
+    { 29233, fa::fa_wpbeginner } , // wpbeginner
+    { 29244, fa::fa_wpexplorer } , // wpexplorer
+    { 29255, fa::fa_wpforms } , // wpforms
+    { 29263, fa::fa_wpressr } , // wpressr
+    { 29152, fa::fa_wsh } , // wsh
+    { 29279, fa::fa_x_twitter } , // x-twitter
+    { 29289, fa::fa_xbox } , // xbox
+    { 29294, fa::fa_xing } , // xing
+    { 28468, fa::fa_xing_square } , // xing-square
+    { 29299, fa::fa_y_combinator } , // y-combinator
+    { 29312, fa::fa_yahoo } , // yahoo
+    { 29318, fa::fa_yammer } , // yammer
+    { 29325, fa::fa_yandex } , // yandex
+    { 29332, fa::fa_yandex_international } , // yandex-international
+    { 29353, fa::fa_yarn } , // yarn
+    { 29358, fa::fa_yelp } , // yelp
+    { 29363, fa::fa_yoast } , // yoast
+    { 29369, fa::fa_youtube } , // youtube
+    { 28495, fa::fa_youtube_square } , // youtube-square
+    { 29377, fa::fa_zhihu }  // zhihu
+};
+static constexpr int faBrandsIconCount = 530;
 
+#ifdef FONT_AWESOME_PRO
+static constexpr fa::QtAwesomeNamedIcon faProIconArray[] = {
+    { 29383, fa::fa_00 } , // 00
+    { 46330, fa::fa_100 } , // 100
+    { 29386, fa::fa_360_degrees } , // 360-degrees
+    { 29398, fa::fa_abacus } , // abacus
+    { 29405, fa::fa_accent_grave } , // accent-grave
+    { 29418, fa::fa_acorn } , // acorn
+    { 29424, fa::fa_air_conditioner } , // air-conditioner
+    { 29440, fa::fa_airplay } , // airplay
+    { 29448, fa::fa_alarm_clock } , // alarm-clock
+    { 29460, fa::fa_alarm_exclamation } , // alarm-exclamation
+    { 29478, fa::fa_alarm_plus } , // alarm-plus
+    { 29489, fa::fa_alarm_snooze } , // alarm-snooze
+    { 29502, fa::fa_album } , // album
+    { 29508, fa::fa_album_circle_plus } , // album-circle-plus
+    { 29526, fa::fa_album_circle_user } , // album-circle-user
+    { 29544, fa::fa_album_collection } , // album-collection
+    { 29561, fa::fa_album_collection_circle_plus } , // album-collection-circle-plus
+    { 29590, fa::fa_album_collection_circle_user } , // album-collection-circle-user
+    { 29619, fa::fa_alicorn } , // alicorn
+    { 29627, fa::fa_alien } , // alien
+    { 29633, fa::fa_alien_8bit } , // alien-8bit
+    { 29644, fa::fa_alien_monster } , // alien-monster
+    { 29658, fa::fa_align_slash } , // align-slash
+    { 29670, fa::fa_alt } , // alt
+    { 29674, fa::fa_amp_guitar } , // amp-guitar
+    { 29685, fa::fa_ampersand } , // ampersand
+    { 35381, fa::fa_analytics } , // analytics
+    { 29695, fa::fa_angel } , // angel
+    { 29701, fa::fa_angle } , // angle
+    { 29707, fa::fa_angle_90 } , // angle-90
+    { 29716, fa::fa_angles_up_down } , // angles-up-down
+    { 29731, fa::fa_ant } , // ant
+    { 29735, fa::fa_apartment } , // apartment
+    { 29745, fa::fa_aperture } , // aperture
+    { 29754, fa::fa_apostrophe } , // apostrophe
+    { 29765, fa::fa_apple_core } , // apple-core
+    { 39578, fa::fa_apple_crate } , // apple-crate
+    { 40534, fa::fa_arrow_alt_down } , // arrow-alt-down
+    { 59715, fa::fa_arrow_alt_from_bottom } , // arrow-alt-from-bottom
+    { 53304, fa::fa_arrow_alt_from_left } , // arrow-alt-from-left
+    { 47245, fa::fa_arrow_alt_from_right } , // arrow-alt-from-right
+    { 40604, fa::fa_arrow_alt_from_top } , // arrow-alt-from-top
+    { 47197, fa::fa_arrow_alt_left } , // arrow-alt-left
+    { 53272, fa::fa_arrow_alt_right } , // arrow-alt-right
+    { 55930, fa::fa_arrow_alt_square_down } , // arrow-alt-square-down
+    { 56256, fa::fa_arrow_alt_square_left } , // arrow-alt-square-left
+    { 56491, fa::fa_arrow_alt_square_right } , // arrow-alt-square-right
+    { 56715, fa::fa_arrow_alt_square_up } , // arrow-alt-square-up
+    { 40693, fa::fa_arrow_alt_to_bottom } , // arrow-alt-to-bottom
+    { 47313, fa::fa_arrow_alt_to_left } , // arrow-alt-to-left
+    { 53374, fa::fa_arrow_alt_to_right } , // arrow-alt-to-right
+    { 59797, fa::fa_arrow_alt_to_top } , // arrow-alt-to-top
+    { 59653, fa::fa_arrow_alt_up } , // arrow-alt-up
+    { 29776, fa::fa_arrow_down_arrow_up } , // arrow-down-arrow-up
+    { 29805, fa::fa_arrow_down_big_small } , // arrow-down-big-small
+    { 29841, fa::fa_arrow_down_from_arc } , // arrow-down-from-arc
+    { 29861, fa::fa_arrow_down_from_bracket } , // arrow-down-from-bracket
+    { 29885, fa::fa_arrow_down_from_dotted_line } , // arrow-down-from-dotted-line
+    { 29913, fa::fa_arrow_down_from_line } , // arrow-down-from-line
+    { 29949, fa::fa_arrow_down_left } , // arrow-down-left
+    { 29965, fa::fa_arrow_down_left_and_arrow_up_right_to_center } , // arrow-down-left-and-arrow-up-right-to-center
+    { 30010, fa::fa_arrow_down_right } , // arrow-down-right
+    { 30027, fa::fa_arrow_down_small_big } , // arrow-down-small-big
+    { 30067, fa::fa_arrow_down_square_triangle } , // arrow-down-square-triangle
+    { 30115, fa::fa_arrow_down_to_arc } , // arrow-down-to-arc
+    { 30133, fa::fa_arrow_down_to_bracket } , // arrow-down-to-bracket
+    { 30155, fa::fa_arrow_down_to_dotted_line } , // arrow-down-to-dotted-line
+    { 30181, fa::fa_arrow_down_to_line } , // arrow-down-to-line
+    { 30216, fa::fa_arrow_down_to_square } , // arrow-down-to-square
+    { 30237, fa::fa_arrow_down_triangle_square } , // arrow-down-triangle-square
+    { 30857, fa::fa_arrow_from_bottom } , // arrow-from-bottom
+    { 30518, fa::fa_arrow_from_left } , // arrow-from-left
+    { 30346, fa::fa_arrow_from_right } , // arrow-from-right
+    { 29934, fa::fa_arrow_from_top } , // arrow-from-top
+    { 30281, fa::fa_arrow_left_from_arc } , // arrow-left-from-arc
+    { 30301, fa::fa_arrow_left_from_bracket } , // arrow-left-from-bracket
+    { 30325, fa::fa_arrow_left_from_line } , // arrow-left-from-line
+    { 30363, fa::fa_arrow_left_long_to_line } , // arrow-left-long-to-line
+    { 30387, fa::fa_arrow_left_to_arc } , // arrow-left-to-arc
+    { 30405, fa::fa_arrow_left_to_bracket } , // arrow-left-to-bracket
+    { 30427, fa::fa_arrow_left_to_line } , // arrow-left-to-line
+    { 30460, fa::fa_arrow_progress } , // arrow-progress
+    { 30475, fa::fa_arrow_right_from_arc } , // arrow-right-from-arc
+    { 30496, fa::fa_arrow_right_from_line } , // arrow-right-from-line
+    { 30534, fa::fa_arrow_right_long_to_line } , // arrow-right-long-to-line
+    { 30559, fa::fa_arrow_right_to_arc } , // arrow-right-to-arc
+    { 30578, fa::fa_arrow_right_to_line } , // arrow-right-to-line
+    { 55424, fa::fa_arrow_square_down } , // arrow-square-down
+    { 55507, fa::fa_arrow_square_left } , // arrow-square-left
+    { 55544, fa::fa_arrow_square_right } , // arrow-square-right
+    { 55579, fa::fa_arrow_square_up } , // arrow-square-up
+    { 30200, fa::fa_arrow_to_bottom } , // arrow-to-bottom
+    { 30446, fa::fa_arrow_to_left } , // arrow-to-left
+    { 30598, fa::fa_arrow_to_right } , // arrow-to-right
+    { 31155, fa::fa_arrow_to_top } , // arrow-to-top
+    { 30613, fa::fa_arrow_turn_down_left } , // arrow-turn-down-left
+    { 30634, fa::fa_arrow_turn_down_right } , // arrow-turn-down-right
+    { 30656, fa::fa_arrow_turn_left } , // arrow-turn-left
+    { 30672, fa::fa_arrow_turn_left_down } , // arrow-turn-left-down
+    { 30693, fa::fa_arrow_turn_left_up } , // arrow-turn-left-up
+    { 30712, fa::fa_arrow_turn_right } , // arrow-turn-right
+    { 30729, fa::fa_arrow_up_arrow_down } , // arrow-up-arrow-down
+    { 30762, fa::fa_arrow_up_big_small } , // arrow-up-big-small
+    { 30794, fa::fa_arrow_up_from_arc } , // arrow-up-from-arc
+    { 30812, fa::fa_arrow_up_from_dotted_line } , // arrow-up-from-dotted-line
+    { 30838, fa::fa_arrow_up_from_line } , // arrow-up-from-line
+    { 30875, fa::fa_arrow_up_from_square } , // arrow-up-from-square
+    { 30896, fa::fa_arrow_up_left } , // arrow-up-left
+    { 30910, fa::fa_arrow_up_left_from_circle } , // arrow-up-left-from-circle
+    { 30936, fa::fa_arrow_up_right } , // arrow-up-right
+    { 30951, fa::fa_arrow_up_right_and_arrow_down_left_from_center } , // arrow-up-right-and-arrow-down-left-from-center
+    { 30998, fa::fa_arrow_up_small_big } , // arrow-up-small-big
+    { 31034, fa::fa_arrow_up_square_triangle } , // arrow-up-square-triangle
+    { 31078, fa::fa_arrow_up_to_arc } , // arrow-up-to-arc
+    { 31094, fa::fa_arrow_up_to_bracket } , // arrow-up-to-bracket
+    { 31114, fa::fa_arrow_up_to_dotted_line } , // arrow-up-to-dotted-line
+    { 31138, fa::fa_arrow_up_to_line } , // arrow-up-to-line
+    { 31168, fa::fa_arrow_up_triangle_square } , // arrow-up-triangle-square
+    { 31208, fa::fa_arrows_cross } , // arrows-cross
+    { 31221, fa::fa_arrows_from_dotted_line } , // arrows-from-dotted-line
+    { 31245, fa::fa_arrows_from_line } , // arrows-from-line
+    { 31262, fa::fa_arrows_maximize } , // arrows-maximize
+    { 31292, fa::fa_arrows_minimize } , // arrows-minimize
+    { 31324, fa::fa_arrows_repeat } , // arrows-repeat
+    { 31349, fa::fa_arrows_repeat_1 } , // arrows-repeat-1
+    { 31378, fa::fa_arrows_retweet } , // arrows-retweet
+    { 31405, fa::fa_arrows_rotate_reverse } , // arrows-rotate-reverse
+    { 31427, fa::fa_arrows_to_dotted_line } , // arrows-to-dotted-line
+    { 31449, fa::fa_arrows_to_line } , // arrows-to-line
+    { 31476, fa::fa_atom_alt } , // atom-alt
+    { 31464, fa::fa_atom_simple } , // atom-simple
+    { 31485, fa::fa_audio_description_slash } , // audio-description-slash
+    { 31509, fa::fa_avocado } , // avocado
+    { 31517, fa::fa_award_simple } , // award-simple
+    { 31530, fa::fa_axe } , // axe
+    { 31534, fa::fa_axe_battle } , // axe-battle
+    { 31545, fa::fa_backpack } , // backpack
+    { 31554, fa::fa_badge } , // badge
+    { 31560, fa::fa_badge_check } , // badge-check
+    { 31572, fa::fa_badge_dollar } , // badge-dollar
+    { 31585, fa::fa_badge_percent } , // badge-percent
+    { 31599, fa::fa_badge_sheriff } , // badge-sheriff
+    { 31613, fa::fa_badger_honey } , // badger-honey
+    { 31626, fa::fa_badminton } , // badminton
+    { 31636, fa::fa_bag_seedling } , // bag-seedling
+    { 31649, fa::fa_bag_shopping_minus } , // bag-shopping-minus
+    { 31668, fa::fa_bag_shopping_plus } , // bag-shopping-plus
+    { 31686, fa::fa_bagel } , // bagel
+    { 31692, fa::fa_bags_shopping } , // bags-shopping
+    { 31706, fa::fa_baguette } , // baguette
+    { 31715, fa::fa_ball_pile } , // ball-pile
+    { 31725, fa::fa_balloon } , // balloon
+    { 31733, fa::fa_balloons } , // balloons
+    { 31742, fa::fa_ballot } , // ballot
+    { 31749, fa::fa_ballot_check } , // ballot-check
+    { 31762, fa::fa_ban_bug } , // ban-bug
+    { 31776, fa::fa_ban_parking } , // ban-parking
+    { 31809, fa::fa_banana } , // banana
+    { 31816, fa::fa_banjo } , // banjo
+    { 52904, fa::fa_barcode_alt } , // barcode-alt
+    { 31822, fa::fa_barcode_read } , // barcode-read
+    { 31835, fa::fa_barcode_scan } , // barcode-scan
+    { 42436, fa::fa_barn_silo } , // barn-silo
+    { 31848, fa::fa_bars_filter } , // bars-filter
+    { 31860, fa::fa_bars_sort } , // bars-sort
+    { 31870, fa::fa_basket_shopping_minus } , // basket-shopping-minus
+    { 31892, fa::fa_basket_shopping_plus } , // basket-shopping-plus
+    { 31913, fa::fa_basket_shopping_simple } , // basket-shopping-simple
+    { 31956, fa::fa_basketball_hoop } , // basketball-hoop
+    { 31972, fa::fa_bat } , // bat
+    { 32021, fa::fa_battery_1 } , // battery-1
+    { 31976, fa::fa_battery_bolt } , // battery-bolt
+    { 31989, fa::fa_battery_exclamation } , // battery-exclamation
+    { 32009, fa::fa_battery_low } , // battery-low
+    { 32031, fa::fa_battery_slash } , // battery-slash
+    { 32074, fa::fa_bed_alt } , // bed-alt
+    { 32045, fa::fa_bed_bunk } , // bed-bunk
+    { 32054, fa::fa_bed_empty } , // bed-empty
+    { 32064, fa::fa_bed_front } , // bed-front
+    { 32082, fa::fa_bee } , // bee
+    { 32095, fa::fa_beer_foam } , // beer-foam
+    { 32086, fa::fa_beer_mug } , // beer-mug
+    { 32105, fa::fa_bell_exclamation } , // bell-exclamation
+    { 32122, fa::fa_bell_on } , // bell-on
+    { 32130, fa::fa_bell_plus } , // bell-plus
+    { 32140, fa::fa_bell_ring } , // bell-ring
+    { 32150, fa::fa_bell_school } , // bell-school
+    { 32162, fa::fa_bell_school_slash } , // bell-school-slash
+    { 32180, fa::fa_bells } , // bells
+    { 32186, fa::fa_bench_tree } , // bench-tree
+    { 35156, fa::fa_betamax } , // betamax
+    { 51542, fa::fa_biking_mountain } , // biking-mountain
+    { 32197, fa::fa_billboard } , // billboard
+    { 32207, fa::fa_bin_bottles } , // bin-bottles
+    { 32219, fa::fa_bin_bottles_recycle } , // bin-bottles-recycle
+    { 32239, fa::fa_bin_recycle } , // bin-recycle
+    { 32251, fa::fa_binary } , // binary
+    { 32258, fa::fa_binary_circle_check } , // binary-circle-check
+    { 32278, fa::fa_binary_lock } , // binary-lock
+    { 32290, fa::fa_binary_slash } , // binary-slash
+    { 32303, fa::fa_bird } , // bird
+    { 32308, fa::fa_blanket } , // blanket
+    { 32316, fa::fa_blanket_fire } , // blanket-fire
+    { 32329, fa::fa_blinds } , // blinds
+    { 32336, fa::fa_blinds_open } , // blinds-open
+    { 32348, fa::fa_blinds_raised } , // blinds-raised
+    { 32362, fa::fa_block } , // block
+    { 32368, fa::fa_block_brick } , // block-brick
+    { 32391, fa::fa_block_brick_fire } , // block-brick-fire
+    { 32417, fa::fa_block_question } , // block-question
+    { 32432, fa::fa_block_quote } , // block-quote
+    { 32444, fa::fa_blueberries } , // blueberries
+    { 32456, fa::fa_bolt_auto } , // bolt-auto
+    { 32466, fa::fa_bolt_slash } , // bolt-slash
+    { 32477, fa::fa_bone_break } , // bone-break
+    { 32530, fa::fa_book_alt } , // book-alt
+    { 32488, fa::fa_book_arrow_right } , // book-arrow-right
+    { 32505, fa::fa_book_arrow_up } , // book-arrow-up
+    { 32519, fa::fa_book_blank } , // book-blank
+    { 36410, fa::fa_book_circle } , // book-circle
+    { 32539, fa::fa_book_circle_arrow_right } , // book-circle-arrow-right
+    { 32563, fa::fa_book_circle_arrow_up } , // book-circle-arrow-up
+    { 32584, fa::fa_book_copy } , // book-copy
+    { 32594, fa::fa_book_font } , // book-font
+    { 32604, fa::fa_book_heart } , // book-heart
+    { 32658, fa::fa_book_law } , // book-law
+    { 32631, fa::fa_book_open_alt } , // book-open-alt
+    { 32615, fa::fa_book_open_cover } , // book-open-cover
+    { 32645, fa::fa_book_section } , // book-section
+    { 32667, fa::fa_book_sparkles } , // book-sparkles
+    { 32681, fa::fa_book_spells } , // book-spells
+    { 32693, fa::fa_book_user } , // book-user
+    { 36438, fa::fa_bookmark_circle } , // bookmark-circle
+    { 32703, fa::fa_bookmark_slash } , // bookmark-slash
+    { 32718, fa::fa_books } , // books
+    { 32724, fa::fa_books_medical } , // books-medical
+    { 32738, fa::fa_boombox } , // boombox
+    { 32746, fa::fa_boot } , // boot
+    { 32751, fa::fa_boot_heeled } , // boot-heeled
+    { 32763, fa::fa_booth_curtain } , // booth-curtain
+    { 32777, fa::fa_border_bottom } , // border-bottom
+    { 32791, fa::fa_border_bottom_right } , // border-bottom-right
+    { 32828, fa::fa_border_center_h } , // border-center-h
+    { 32844, fa::fa_border_center_v } , // border-center-v
+    { 32860, fa::fa_border_inner } , // border-inner
+    { 32873, fa::fa_border_left } , // border-left
+    { 32885, fa::fa_border_outer } , // border-outer
+    { 32898, fa::fa_border_right } , // border-right
+    { 32811, fa::fa_border_style_alt } , // border-style-alt
+    { 32911, fa::fa_border_top } , // border-top
+    { 32922, fa::fa_bottle_baby } , // bottle-baby
+    { 32934, fa::fa_bow_arrow } , // bow-arrow
+    { 32944, fa::fa_bowl_chopsticks } , // bowl-chopsticks
+    { 32960, fa::fa_bowl_chopsticks_noodles } , // bowl-chopsticks-noodles
+    { 32984, fa::fa_bowl_hot } , // bowl-hot
+    { 53577, fa::fa_bowl_salad } , // bowl-salad
+    { 32998, fa::fa_bowl_scoop } , // bowl-scoop
+    { 33025, fa::fa_bowl_scoops } , // bowl-scoops
+    { 33009, fa::fa_bowl_shaved_ice } , // bowl-shaved-ice
+    { 33037, fa::fa_bowl_soft_serve } , // bowl-soft-serve
+    { 33053, fa::fa_bowl_spoon } , // bowl-spoon
+    { 33064, fa::fa_bowling_ball_pin } , // bowling-ball-pin
+    { 33081, fa::fa_bowling_pins } , // bowling-pins
+    { 33194, fa::fa_box_alt } , // box-alt
+    { 33094, fa::fa_box_ballot } , // box-ballot
+    { 33105, fa::fa_box_check } , // box-check
+    { 33115, fa::fa_box_circle_check } , // box-circle-check
+    { 33132, fa::fa_box_dollar } , // box-dollar
+    { 56099, fa::fa_box_fragile } , // box-fragile
+    { 33175, fa::fa_box_full } , // box-full
+    { 33151, fa::fa_box_heart } , // box-heart
+    { 33161, fa::fa_box_open_full } , // box-open-full
+    { 33184, fa::fa_box_taped } , // box-taped
+    { 56689, fa::fa_box_up } , // box-up
+    { 33143, fa::fa_box_usd } , // box-usd
+    { 33202, fa::fa_boxing_glove } , // boxing-glove
+    { 33342, fa::fa_bracket } , // bracket
+    { 33228, fa::fa_bracket_curly } , // bracket-curly
+    { 33242, fa::fa_bracket_curly_left } , // bracket-curly-left
+    { 33261, fa::fa_bracket_curly_right } , // bracket-curly-right
+    { 33350, fa::fa_bracket_left } , // bracket-left
+    { 33281, fa::fa_bracket_round } , // bracket-round
+    { 33307, fa::fa_bracket_round_right } , // bracket-round-right
+    { 33327, fa::fa_bracket_square } , // bracket-square
+    { 33363, fa::fa_bracket_square_right } , // bracket-square-right
+    { 33442, fa::fa_brackets } , // brackets
+    { 33384, fa::fa_brackets_curly } , // brackets-curly
+    { 33399, fa::fa_brackets_round } , // brackets-round
+    { 33426, fa::fa_brackets_square } , // brackets-square
+    { 33451, fa::fa_brain_arrow_curved_right } , // brain-arrow-curved-right
+    { 33487, fa::fa_brain_circuit } , // brain-circuit
+    { 33501, fa::fa_brake_warning } , // brake-warning
+    { 33515, fa::fa_bread_loaf } , // bread-loaf
+    { 33526, fa::fa_bread_slice_butter } , // bread-slice-butter
+    { 33545, fa::fa_bridge_suspension } , // bridge-suspension
+    { 33563, fa::fa_briefcase_arrow_right } , // briefcase-arrow-right
+    { 33585, fa::fa_briefcase_blank } , // briefcase-blank
+    { 33601, fa::fa_brightness } , // brightness
+    { 33612, fa::fa_brightness_low } , // brightness-low
+    { 33627, fa::fa_bring_forward } , // bring-forward
+    { 33641, fa::fa_bring_front } , // bring-front
+    { 33653, fa::fa_broccoli } , // broccoli
+    { 33662, fa::fa_broom_wide } , // broom-wide
+    { 33673, fa::fa_browser } , // browser
+    { 33681, fa::fa_browsers } , // browsers
+    { 33690, fa::fa_building_magnifying_glass } , // building-magnifying-glass
+    { 33716, fa::fa_building_memo } , // building-memo
+    { 33730, fa::fa_buildings } , // buildings
+    { 33740, fa::fa_bulldozer } , // bulldozer
+    { 33750, fa::fa_bullseye_arrow } , // bullseye-arrow
+    { 33765, fa::fa_bullseye_pointer } , // bullseye-pointer
+    { 33782, fa::fa_buoy } , // buoy
+    { 33787, fa::fa_buoy_mooring } , // buoy-mooring
+    { 33800, fa::fa_burger_cheese } , // burger-cheese
+    { 33827, fa::fa_burger_fries } , // burger-fries
+    { 33840, fa::fa_burger_glass } , // burger-glass
+    { 33853, fa::fa_burger_lettuce } , // burger-lettuce
+    { 33868, fa::fa_burger_soda } , // burger-soda
+    { 33880, fa::fa_burrito } , // burrito
+    { 33888, fa::fa_bus_school } , // bus-school
+    { 60079, fa::fa_business_front } , // business-front
+    { 33899, fa::fa_butter } , // butter
+    { 33906, fa::fa_cabin } , // cabin
+    { 33912, fa::fa_cabinet_filing } , // cabinet-filing
+    { 33927, fa::fa_cactus } , // cactus
+    { 33934, fa::fa_caduceus } , // caduceus
+    { 33943, fa::fa_cake_slice } , // cake-slice
+    { 33982, fa::fa_calculator_alt } , // calculator-alt
+    { 33964, fa::fa_calculator_simple } , // calculator-simple
+    { 33997, fa::fa_calendar_arrow_down } , // calendar-arrow-down
+    { 34035, fa::fa_calendar_arrow_up } , // calendar-arrow-up
+    { 36479, fa::fa_calendar_circle } , // calendar-circle
+    { 34069, fa::fa_calendar_circle_exclamation } , // calendar-circle-exclamation
+    { 34097, fa::fa_calendar_circle_minus } , // calendar-circle-minus
+    { 34119, fa::fa_calendar_circle_plus } , // calendar-circle-plus
+    { 34140, fa::fa_calendar_circle_user } , // calendar-circle-user
+    { 34161, fa::fa_calendar_clock } , // calendar-clock
+    { 34017, fa::fa_calendar_download } , // calendar-download
+    { 34302, fa::fa_calendar_edit } , // calendar-edit
+    { 34190, fa::fa_calendar_exclamation } , // calendar-exclamation
+    { 34211, fa::fa_calendar_heart } , // calendar-heart
+    { 34226, fa::fa_calendar_image } , // calendar-image
+    { 34241, fa::fa_calendar_lines } , // calendar-lines
+    { 34270, fa::fa_calendar_lines_pen } , // calendar-lines-pen
+    { 34256, fa::fa_calendar_note } , // calendar-note
+    { 34289, fa::fa_calendar_pen } , // calendar-pen
+    { 34316, fa::fa_calendar_range } , // calendar-range
+    { 34331, fa::fa_calendar_star } , // calendar-star
+    { 34176, fa::fa_calendar_time } , // calendar-time
+    { 34053, fa::fa_calendar_upload } , // calendar-upload
+    { 34345, fa::fa_calendar_users } , // calendar-users
+    { 34360, fa::fa_calendars } , // calendars
+    { 34370, fa::fa_camcorder } , // camcorder
+    { 34395, fa::fa_camera_cctv } , // camera-cctv
+    { 36509, fa::fa_camera_circle } , // camera-circle
+    { 34457, fa::fa_camera_home } , // camera-home
+    { 34412, fa::fa_camera_movie } , // camera-movie
+    { 34425, fa::fa_camera_polaroid } , // camera-polaroid
+    { 34441, fa::fa_camera_security } , // camera-security
+    { 34469, fa::fa_camera_slash } , // camera-slash
+    { 34482, fa::fa_camera_viewfinder } , // camera-viewfinder
+    { 34511, fa::fa_camera_web } , // camera-web
+    { 34529, fa::fa_camera_web_slash } , // camera-web-slash
+    { 34559, fa::fa_campfire } , // campfire
+    { 34568, fa::fa_can_food } , // can-food
+    { 34577, fa::fa_candle_holder } , // candle-holder
+    { 34591, fa::fa_candy } , // candy
+    { 34597, fa::fa_candy_bar } , // candy-bar
+    { 34621, fa::fa_candy_corn } , // candy-corn
+    { 34632, fa::fa_cannon } , // cannon
+    { 34639, fa::fa_car_bolt } , // car-bolt
+    { 34648, fa::fa_car_building } , // car-building
+    { 34661, fa::fa_car_bump } , // car-bump
+    { 34670, fa::fa_car_bus } , // car-bus
+    { 34678, fa::fa_car_circle_bolt } , // car-circle-bolt
+    { 34694, fa::fa_car_garage } , // car-garage
+    { 34760, fa::fa_car_mechanic } , // car-mechanic
+    { 34705, fa::fa_car_mirrors } , // car-mirrors
+    { 34871, fa::fa_car_people } , // car-people
+    { 34717, fa::fa_car_side_bolt } , // car-side-bolt
+    { 34731, fa::fa_car_tilt } , // car-tilt
+    { 34740, fa::fa_car_wash } , // car-wash
+    { 34749, fa::fa_car_wrench } , // car-wrench
+    { 34788, fa::fa_caravan_alt } , // caravan-alt
+    { 34773, fa::fa_caravan_simple } , // caravan-simple
+    { 34800, fa::fa_card_club } , // card-club
+    { 34810, fa::fa_card_diamond } , // card-diamond
+    { 34823, fa::fa_card_heart } , // card-heart
+    { 34834, fa::fa_card_spade } , // card-spade
+    { 34845, fa::fa_cards } , // cards
+    { 34851, fa::fa_cards_blank } , // cards-blank
+    { 36541, fa::fa_caret_circle_down } , // caret-circle-down
+    { 36577, fa::fa_caret_circle_left } , // caret-circle-left
+    { 36614, fa::fa_caret_circle_right } , // caret-circle-right
+    { 36649, fa::fa_caret_circle_up } , // caret-circle-up
+    { 34863, fa::fa_carpool } , // carpool
+    { 34882, fa::fa_cars } , // cars
+    { 34887, fa::fa_cart_arrow_up } , // cart-arrow-up
+    { 34901, fa::fa_cart_circle_arrow_down } , // cart-circle-arrow-down
+    { 34924, fa::fa_cart_circle_arrow_up } , // cart-circle-arrow-up
+    { 34945, fa::fa_cart_circle_check } , // cart-circle-check
+    { 34963, fa::fa_cart_circle_exclamation } , // cart-circle-exclamation
+    { 34987, fa::fa_cart_circle_plus } , // cart-circle-plus
+    { 35004, fa::fa_cart_circle_xmark } , // cart-circle-xmark
+    { 35022, fa::fa_cart_flatbed_boxes } , // cart-flatbed-boxes
+    { 35059, fa::fa_cart_flatbed_empty } , // cart-flatbed-empty
+    { 35098, fa::fa_cart_minus } , // cart-minus
+    { 35109, fa::fa_cart_shopping_fast } , // cart-shopping-fast
+    { 35128, fa::fa_cart_xmark } , // cart-xmark
+    { 35139, fa::fa_cassette_betamax } , // cassette-betamax
+    { 35164, fa::fa_cassette_tape } , // cassette-tape
+    { 35178, fa::fa_cassette_vhs } , // cassette-vhs
+    { 35195, fa::fa_castle } , // castle
+    { 35202, fa::fa_cat_space } , // cat-space
+    { 35212, fa::fa_cauldron } , // cauldron
+    { 34407, fa::fa_cctv } , // cctv
+    { 47650, fa::fa_chain_horizontal } , // chain-horizontal
+    { 47689, fa::fa_chain_horizontal_slash } , // chain-horizontal-slash
+    { 35221, fa::fa_chair_office } , // chair-office
+    { 35234, fa::fa_champagne_glass } , // champagne-glass
+    { 35266, fa::fa_chart_bullet } , // chart-bullet
+    { 35279, fa::fa_chart_candlestick } , // chart-candlestick
+    { 35297, fa::fa_chart_fft } , // chart-fft
+    { 35307, fa::fa_chart_kanban } , // chart-kanban
+    { 35320, fa::fa_chart_line_down } , // chart-line-down
+    { 35336, fa::fa_chart_line_up } , // chart-line-up
+    { 35350, fa::fa_chart_line_up_down } , // chart-line-up-down
+    { 35369, fa::fa_chart_mixed } , // chart-mixed
+    { 35391, fa::fa_chart_mixed_up_circle_currency } , // chart-mixed-up-circle-currency
+    { 35422, fa::fa_chart_mixed_up_circle_dollar } , // chart-mixed-up-circle-dollar
+    { 35451, fa::fa_chart_network } , // chart-network
+    { 35482, fa::fa_chart_pie_alt } , // chart-pie-alt
+    { 35465, fa::fa_chart_pie_simple } , // chart-pie-simple
+    { 35496, fa::fa_chart_pie_simple_circle_currency } , // chart-pie-simple-circle-currency
+    { 35529, fa::fa_chart_pie_simple_circle_dollar } , // chart-pie-simple-circle-dollar
+    { 35560, fa::fa_chart_pyramid } , // chart-pyramid
+    { 35574, fa::fa_chart_radar } , // chart-radar
+    { 35586, fa::fa_chart_scatter } , // chart-scatter
+    { 35600, fa::fa_chart_scatter_3d } , // chart-scatter-3d
+    { 35617, fa::fa_chart_scatter_bubble } , // chart-scatter-bubble
+    { 35638, fa::fa_chart_simple_horizontal } , // chart-simple-horizontal
+    { 35662, fa::fa_chart_sine } , // chart-sine
+    { 35673, fa::fa_chart_tree_map } , // chart-tree-map
+    { 35688, fa::fa_chart_user } , // chart-user
+    { 35710, fa::fa_chart_waterfall } , // chart-waterfall
+    { 35726, fa::fa_cheese_swiss } , // cheese-swiss
+    { 33814, fa::fa_cheeseburger } , // cheeseburger
+    { 35739, fa::fa_cherries } , // cherries
+    { 35767, fa::fa_chess_bishop_alt } , // chess-bishop-alt
+    { 35748, fa::fa_chess_bishop_piece } , // chess-bishop-piece
+    { 35784, fa::fa_chess_clock } , // chess-clock
+    { 35813, fa::fa_chess_clock_alt } , // chess-clock-alt
+    { 35796, fa::fa_chess_clock_flip } , // chess-clock-flip
+    { 35846, fa::fa_chess_king_alt } , // chess-king-alt
+    { 35829, fa::fa_chess_king_piece } , // chess-king-piece
+    { 35880, fa::fa_chess_knight_alt } , // chess-knight-alt
+    { 35861, fa::fa_chess_knight_piece } , // chess-knight-piece
+    { 35914, fa::fa_chess_pawn_alt } , // chess-pawn-alt
+    { 35897, fa::fa_chess_pawn_piece } , // chess-pawn-piece
+    { 35947, fa::fa_chess_queen_alt } , // chess-queen-alt
+    { 35929, fa::fa_chess_queen_piece } , // chess-queen-piece
+    { 35980, fa::fa_chess_rook_alt } , // chess-rook-alt
+    { 35963, fa::fa_chess_rook_piece } , // chess-rook-piece
+    { 35995, fa::fa_chestnut } , // chestnut
+    { 36018, fa::fa_chevron_double_down } , // chevron-double-down
+    { 36052, fa::fa_chevron_double_left } , // chevron-double-left
+    { 36087, fa::fa_chevron_double_right } , // chevron-double-right
+    { 36120, fa::fa_chevron_double_up } , // chevron-double-up
+    { 55666, fa::fa_chevron_square_down } , // chevron-square-down
+    { 55706, fa::fa_chevron_square_left } , // chevron-square-left
+    { 55747, fa::fa_chevron_square_right } , // chevron-square-right
+    { 55786, fa::fa_chevron_square_up } , // chevron-square-up
+    { 36004, fa::fa_chevrons_down } , // chevrons-down
+    { 36038, fa::fa_chevrons_left } , // chevrons-left
+    { 36072, fa::fa_chevrons_right } , // chevrons-right
+    { 36108, fa::fa_chevrons_up } , // chevrons-up
+    { 36138, fa::fa_chf_sign } , // chf-sign
+    { 36147, fa::fa_chimney } , // chimney
+    { 34607, fa::fa_chocolate_bar } , // chocolate-bar
+    { 36155, fa::fa_chopsticks } , // chopsticks
+    { 36166, fa::fa_circle_0 } , // circle-0
+    { 36175, fa::fa_circle_1 } , // circle-1
+    { 36184, fa::fa_circle_2 } , // circle-2
+    { 36193, fa::fa_circle_3 } , // circle-3
+    { 36202, fa::fa_circle_4 } , // circle-4
+    { 36211, fa::fa_circle_5 } , // circle-5
+    { 36220, fa::fa_circle_6 } , // circle-6
+    { 36229, fa::fa_circle_7 } , // circle-7
+    { 36238, fa::fa_circle_8 } , // circle-8
+    { 36247, fa::fa_circle_9 } , // circle-9
+    { 36256, fa::fa_circle_a } , // circle-a
+    { 36265, fa::fa_circle_ampersand } , // circle-ampersand
+    { 36282, fa::fa_circle_arrow_down_left } , // circle-arrow-down-left
+    { 36305, fa::fa_circle_arrow_down_right } , // circle-arrow-down-right
+    { 36329, fa::fa_circle_arrow_up_left } , // circle-arrow-up-left
+    { 36350, fa::fa_circle_arrow_up_right } , // circle-arrow-up-right
+    { 36372, fa::fa_circle_b } , // circle-b
+    { 36381, fa::fa_circle_bolt } , // circle-bolt
+    { 36393, fa::fa_circle_book_open } , // circle-book-open
+    { 36422, fa::fa_circle_bookmark } , // circle-bookmark
+    { 36454, fa::fa_circle_c } , // circle-c
+    { 36463, fa::fa_circle_calendar } , // circle-calendar
+    { 36495, fa::fa_circle_camera } , // circle-camera
+    { 36523, fa::fa_circle_caret_down } , // circle-caret-down
+    { 36559, fa::fa_circle_caret_left } , // circle-caret-left
+    { 36595, fa::fa_circle_caret_right } , // circle-caret-right
+    { 36633, fa::fa_circle_caret_up } , // circle-caret-up
+    { 36665, fa::fa_circle_d } , // circle-d
+    { 36674, fa::fa_circle_dashed } , // circle-dashed
+    { 36688, fa::fa_circle_divide } , // circle-divide
+    { 36702, fa::fa_circle_dollar } , // circle-dollar
+    { 36741, fa::fa_circle_down_left } , // circle-down-left
+    { 36758, fa::fa_circle_down_right } , // circle-down-right
+    { 36776, fa::fa_circle_e } , // circle-e
+    { 36785, fa::fa_circle_ellipsis } , // circle-ellipsis
+    { 36801, fa::fa_circle_ellipsis_vertical } , // circle-ellipsis-vertical
+    { 36826, fa::fa_circle_envelope } , // circle-envelope
+    { 36858, fa::fa_circle_euro } , // circle-euro
+    { 36870, fa::fa_circle_exclamation_check } , // circle-exclamation-check
+    { 36895, fa::fa_circle_f } , // circle-f
+    { 36904, fa::fa_circle_g } , // circle-g
+    { 36913, fa::fa_circle_gf } , // circle-gf
+    { 36923, fa::fa_circle_half } , // circle-half
+    { 36935, fa::fa_circle_heart } , // circle-heart
+    { 36961, fa::fa_circle_i } , // circle-i
+    { 36970, fa::fa_circle_j } , // circle-j
+    { 36979, fa::fa_circle_k } , // circle-k
+    { 36988, fa::fa_circle_l } , // circle-l
+    { 36997, fa::fa_circle_location_arrow } , // circle-location-arrow
+    { 37035, fa::fa_circle_m } , // circle-m
+    { 37044, fa::fa_circle_microphone } , // circle-microphone
+    { 37080, fa::fa_circle_microphone_lines } , // circle-microphone-lines
+    { 37126, fa::fa_circle_n } , // circle-n
+    { 37135, fa::fa_circle_o } , // circle-o
+    { 37144, fa::fa_circle_p } , // circle-p
+    { 37153, fa::fa_circle_parking } , // circle-parking
+    { 37183, fa::fa_circle_phone } , // circle-phone
+    { 37209, fa::fa_circle_phone_flip } , // circle-phone-flip
+    { 37244, fa::fa_circle_phone_hangup } , // circle-phone-hangup
+    { 37282, fa::fa_circle_q } , // circle-q
+    { 37291, fa::fa_circle_quarter } , // circle-quarter
+    { 37306, fa::fa_circle_quarter_stroke } , // circle-quarter-stroke
+    { 37328, fa::fa_circle_quarters } , // circle-quarters
+    { 37344, fa::fa_circle_r } , // circle-r
+    { 37353, fa::fa_circle_s } , // circle-s
+    { 37362, fa::fa_circle_small } , // circle-small
+    { 37375, fa::fa_circle_sort } , // circle-sort
+    { 37399, fa::fa_circle_sort_down } , // circle-sort-down
+    { 37433, fa::fa_circle_sort_up } , // circle-sort-up
+    { 37463, fa::fa_circle_star } , // circle-star
+    { 37487, fa::fa_circle_sterling } , // circle-sterling
+    { 37503, fa::fa_circle_t } , // circle-t
+    { 37512, fa::fa_circle_three_quarters } , // circle-three-quarters
+    { 37534, fa::fa_circle_three_quarters_stroke } , // circle-three-quarters-stroke
+    { 37563, fa::fa_circle_trash } , // circle-trash
+    { 37589, fa::fa_circle_u } , // circle-u
+    { 37598, fa::fa_circle_up_left } , // circle-up-left
+    { 37613, fa::fa_circle_up_right } , // circle-up-right
+    { 37629, fa::fa_circle_v } , // circle-v
+    { 37638, fa::fa_circle_video } , // circle-video
+    { 37664, fa::fa_circle_w } , // circle-w
+    { 37673, fa::fa_circle_waveform_lines } , // circle-waveform-lines
+    { 37711, fa::fa_circle_wifi } , // circle-wifi
+    { 37723, fa::fa_circle_wifi_circle_wifi } , // circle-wifi-circle-wifi
+    { 37747, fa::fa_circle_wifi_group } , // circle-wifi-group
+    { 37765, fa::fa_circle_x } , // circle-x
+    { 37774, fa::fa_circle_y } , // circle-y
+    { 37783, fa::fa_circle_yen } , // circle-yen
+    { 37794, fa::fa_circle_z } , // circle-z
+    { 37803, fa::fa_circles_overlap } , // circles-overlap
+    { 37819, fa::fa_circles_overlap_3 } , // circles-overlap-3
+    { 37845, fa::fa_citrus } , // citrus
+    { 37852, fa::fa_citrus_slice } , // citrus-slice
+    { 37865, fa::fa_clapperboard_play } , // clapperboard-play
+    { 37883, fa::fa_clarinet } , // clarinet
+    { 37892, fa::fa_claw_marks } , // claw-marks
+    { 37903, fa::fa_clipboard_list_check } , // clipboard-list-check
+    { 37924, fa::fa_clipboard_medical } , // clipboard-medical
+    { 37942, fa::fa_clipboard_prescription } , // clipboard-prescription
+    { 37965, fa::fa_clock_desk } , // clock-desk
+    { 37976, fa::fa_clock_eight } , // clock-eight
+    { 37988, fa::fa_clock_eight_thirty } , // clock-eight-thirty
+    { 38007, fa::fa_clock_eleven } , // clock-eleven
+    { 38020, fa::fa_clock_eleven_thirty } , // clock-eleven-thirty
+    { 38040, fa::fa_clock_five } , // clock-five
+    { 38051, fa::fa_clock_five_thirty } , // clock-five-thirty
+    { 38069, fa::fa_clock_four_thirty } , // clock-four-thirty
+    { 38087, fa::fa_clock_nine } , // clock-nine
+    { 38098, fa::fa_clock_nine_thirty } , // clock-nine-thirty
+    { 38116, fa::fa_clock_one } , // clock-one
+    { 38126, fa::fa_clock_one_thirty } , // clock-one-thirty
+    { 38143, fa::fa_clock_seven } , // clock-seven
+    { 38155, fa::fa_clock_seven_thirty } , // clock-seven-thirty
+    { 38174, fa::fa_clock_six } , // clock-six
+    { 38184, fa::fa_clock_six_thirty } , // clock-six-thirty
+    { 38201, fa::fa_clock_ten } , // clock-ten
+    { 38211, fa::fa_clock_ten_thirty } , // clock-ten-thirty
+    { 38228, fa::fa_clock_three } , // clock-three
+    { 38240, fa::fa_clock_three_thirty } , // clock-three-thirty
+    { 38259, fa::fa_clock_twelve } , // clock-twelve
+    { 38272, fa::fa_clock_twelve_thirty } , // clock-twelve-thirty
+    { 38292, fa::fa_clock_two } , // clock-two
+    { 38302, fa::fa_clock_two_thirty } , // clock-two-thirty
+    { 38319, fa::fa_closed_captioning_slash } , // closed-captioning-slash
+    { 38343, fa::fa_clothes_hanger } , // clothes-hanger
+    { 38358, fa::fa_cloud_binary } , // cloud-binary
+    { 38371, fa::fa_cloud_bolt_moon } , // cloud-bolt-moon
+    { 38405, fa::fa_cloud_bolt_sun } , // cloud-bolt-sun
+    { 38437, fa::fa_cloud_check } , // cloud-check
+    { 38449, fa::fa_cloud_drizzle } , // cloud-drizzle
+    { 38463, fa::fa_cloud_exclamation } , // cloud-exclamation
+    { 38481, fa::fa_cloud_fog } , // cloud-fog
+    { 38495, fa::fa_cloud_hail } , // cloud-hail
+    { 38506, fa::fa_cloud_hail_mixed } , // cloud-hail-mixed
+    { 38523, fa::fa_cloud_minus } , // cloud-minus
+    { 38535, fa::fa_cloud_music } , // cloud-music
+    { 38547, fa::fa_cloud_plus } , // cloud-plus
+    { 38558, fa::fa_cloud_question } , // cloud-question
+    { 38573, fa::fa_cloud_rainbow } , // cloud-rainbow
+    { 38587, fa::fa_cloud_showers } , // cloud-showers
+    { 38601, fa::fa_cloud_slash } , // cloud-slash
+    { 38613, fa::fa_cloud_sleet } , // cloud-sleet
+    { 38625, fa::fa_cloud_snow } , // cloud-snow
+    { 38636, fa::fa_cloud_word } , // cloud-word
+    { 38647, fa::fa_cloud_xmark } , // cloud-xmark
+    { 38659, fa::fa_clouds } , // clouds
+    { 38666, fa::fa_clouds_moon } , // clouds-moon
+    { 38678, fa::fa_clouds_sun } , // clouds-sun
+    { 38689, fa::fa_club } , // club
+    { 38694, fa::fa_coconut } , // coconut
+    { 38702, fa::fa_code_pull_request_closed } , // code-pull-request-closed
+    { 38727, fa::fa_code_pull_request_draft } , // code-pull-request-draft
+    { 38751, fa::fa_code_simple } , // code-simple
+    { 38763, fa::fa_coffee_bean } , // coffee-bean
+    { 38775, fa::fa_coffee_beans } , // coffee-beans
+    { 38788, fa::fa_coffee_pot } , // coffee-pot
+    { 39758, fa::fa_coffee_togo } , // coffee-togo
+    { 38799, fa::fa_coffin } , // coffin
+    { 38806, fa::fa_coffin_cross } , // coffin-cross
+    { 38819, fa::fa_coin } , // coin
+    { 38824, fa::fa_coin_blank } , // coin-blank
+    { 38835, fa::fa_coin_front } , // coin-front
+    { 38846, fa::fa_coin_vertical } , // coin-vertical
+    { 38860, fa::fa_colon } , // colon
+    { 38866, fa::fa_columns_3 } , // columns-3
+    { 38876, fa::fa_comet } , // comet
+    { 38882, fa::fa_comma } , // comma
+    { 38888, fa::fa_command } , // command
+    { 48667, fa::fa_comment_alt_arrow_down } , // comment-alt-arrow-down
+    { 48707, fa::fa_comment_alt_arrow_up } , // comment-alt-arrow-up
+    { 48780, fa::fa_comment_alt_captions } , // comment-alt-captions
+    { 48815, fa::fa_comment_alt_check } , // comment-alt-check
+    { 48861, fa::fa_comment_alt_dollar } , // comment-alt-dollar
+    { 48893, fa::fa_comment_alt_dots } , // comment-alt-dots
+    { 49230, fa::fa_comment_alt_edit } , // comment-alt-edit
+    { 48940, fa::fa_comment_alt_exclamation } , // comment-alt-exclamation
+    { 48992, fa::fa_comment_alt_image } , // comment-alt-image
+    { 49024, fa::fa_comment_alt_lines } , // comment-alt-lines
+    { 49058, fa::fa_comment_alt_medical } , // comment-alt-medical
+    { 49168, fa::fa_comment_alt_minus } , // comment-alt-minus
+    { 49200, fa::fa_comment_alt_music } , // comment-alt-music
+    { 49273, fa::fa_comment_alt_plus } , // comment-alt-plus
+    { 49321, fa::fa_comment_alt_quote } , // comment-alt-quote
+    { 49353, fa::fa_comment_alt_slash } , // comment-alt-slash
+    { 49385, fa::fa_comment_alt_smile } , // comment-alt-smile
+    { 49428, fa::fa_comment_alt_text } , // comment-alt-text
+    { 49459, fa::fa_comment_alt_times } , // comment-alt-times
+    { 38896, fa::fa_comment_arrow_down } , // comment-arrow-down
+    { 38915, fa::fa_comment_arrow_up } , // comment-arrow-up
+    { 38932, fa::fa_comment_arrow_up_right } , // comment-arrow-up-right
+    { 38955, fa::fa_comment_captions } , // comment-captions
+    { 38972, fa::fa_comment_check } , // comment-check
+    { 38986, fa::fa_comment_code } , // comment-code
+    { 39135, fa::fa_comment_edit } , // comment-edit
+    { 38999, fa::fa_comment_exclamation } , // comment-exclamation
+    { 39019, fa::fa_comment_heart } , // comment-heart
+    { 39033, fa::fa_comment_image } , // comment-image
+    { 39047, fa::fa_comment_lines } , // comment-lines
+    { 39061, fa::fa_comment_middle } , // comment-middle
+    { 49093, fa::fa_comment_middle_alt } , // comment-middle-alt
+    { 39076, fa::fa_comment_middle_top } , // comment-middle-top
+    { 49131, fa::fa_comment_middle_top_alt } , // comment-middle-top-alt
+    { 39095, fa::fa_comment_minus } , // comment-minus
+    { 39109, fa::fa_comment_music } , // comment-music
+    { 39123, fa::fa_comment_pen } , // comment-pen
+    { 39148, fa::fa_comment_plus } , // comment-plus
+    { 39161, fa::fa_comment_question } , // comment-question
+    { 39178, fa::fa_comment_quote } , // comment-quote
+    { 39192, fa::fa_comment_smile } , // comment-smile
+    { 39206, fa::fa_comment_text } , // comment-text
+    { 39233, fa::fa_comment_times } , // comment-times
+    { 39219, fa::fa_comment_xmark } , // comment-xmark
+    { 49500, fa::fa_comments_alt } , // comments-alt
+    { 49529, fa::fa_comments_alt_dollar } , // comments-alt-dollar
+    { 39247, fa::fa_comments_question } , // comments-question
+    { 39265, fa::fa_comments_question_check } , // comments-question-check
+    { 39289, fa::fa_compass_slash } , // compass-slash
+    { 31308, fa::fa_compress_arrows } , // compress-arrows
+    { 39303, fa::fa_compress_wide } , // compress-wide
+    { 39317, fa::fa_computer_classic } , // computer-classic
+    { 39334, fa::fa_computer_mouse_scrollwheel } , // computer-mouse-scrollwheel
+    { 39371, fa::fa_computer_speaker } , // computer-speaker
+    { 59134, fa::fa_construction } , // construction
+    { 39388, fa::fa_container_storage } , // container-storage
+    { 39406, fa::fa_conveyor_belt } , // conveyor-belt
+    { 39458, fa::fa_conveyor_belt_alt } , // conveyor-belt-alt
+    { 39420, fa::fa_conveyor_belt_arm } , // conveyor-belt-arm
+    { 39438, fa::fa_conveyor_belt_boxes } , // conveyor-belt-boxes
+    { 39476, fa::fa_conveyor_belt_empty } , // conveyor-belt-empty
+    { 39496, fa::fa_corn } , // corn
+    { 39501, fa::fa_corner } , // corner
+    { 48344, fa::fa_couch_small } , // couch-small
+    { 39508, fa::fa_court_sport } , // court-sport
+    { 39520, fa::fa_cowbell } , // cowbell
+    { 39528, fa::fa_cowbell_circle_plus } , // cowbell-circle-plus
+    { 39548, fa::fa_cowbell_more } , // cowbell-more
+    { 39561, fa::fa_crab } , // crab
+    { 39566, fa::fa_crate_apple } , // crate-apple
+    { 39590, fa::fa_crate_empty } , // crate-empty
+    { 39602, fa::fa_credit_card_blank } , // credit-card-blank
+    { 39620, fa::fa_credit_card_front } , // credit-card-front
+    { 55038, fa::fa_creemee } , // creemee
+    { 39655, fa::fa_cricket } , // cricket
+    { 39638, fa::fa_cricket_bat_ball } , // cricket-bat-ball
+    { 39663, fa::fa_croissant } , // croissant
+    { 39673, fa::fa_crosshairs_simple } , // crosshairs-simple
+    { 39691, fa::fa_crutches } , // crutches
+    { 39700, fa::fa_crystal_ball } , // crystal-ball
+    { 39713, fa::fa_cucumber } , // cucumber
+    { 39722, fa::fa_cup_straw } , // cup-straw
+    { 39732, fa::fa_cup_straw_swoosh } , // cup-straw-swoosh
+    { 39749, fa::fa_cup_togo } , // cup-togo
+    { 39770, fa::fa_cupcake } , // cupcake
+    { 39792, fa::fa_curling } , // curling
+    { 39778, fa::fa_curling_stone } , // curling-stone
+    { 39800, fa::fa_custard } , // custard
+    { 39808, fa::fa_dagger } , // dagger
+    { 39815, fa::fa_dash } , // dash
+    { 31770, fa::fa_debug } , // debug
+    { 39832, fa::fa_deer } , // deer
+    { 39837, fa::fa_deer_rudolph } , // deer-rudolph
+    { 39850, fa::fa_delete_right } , // delete-right
+    { 39863, fa::fa_desktop_arrow_down } , // desktop-arrow-down
+    { 40332, fa::fa_desktop_code } , // desktop-code
+    { 40361, fa::fa_desktop_medical } , // desktop-medical
+    { 40391, fa::fa_desktop_slash } , // desktop-slash
+    { 40788, fa::fa_dewpoint } , // dewpoint
+    { 39882, fa::fa_diagram_cells } , // diagram-cells
+    { 39896, fa::fa_diagram_lean_canvas } , // diagram-lean-canvas
+    { 39916, fa::fa_diagram_nested } , // diagram-nested
+    { 39931, fa::fa_diagram_previous } , // diagram-previous
+    { 39948, fa::fa_diagram_sankey } , // diagram-sankey
+    { 39963, fa::fa_diagram_subtask } , // diagram-subtask
+    { 39979, fa::fa_diagram_venn } , // diagram-venn
+    { 39992, fa::fa_dial } , // dial
+    { 40011, fa::fa_dial_high } , // dial-high
+    { 40021, fa::fa_dial_low } , // dial-low
+    { 40030, fa::fa_dial_max } , // dial-max
+    { 40039, fa::fa_dial_med } , // dial-med
+    { 39997, fa::fa_dial_med_high } , // dial-med-high
+    { 40048, fa::fa_dial_med_low } , // dial-med-low
+    { 40061, fa::fa_dial_min } , // dial-min
+    { 40070, fa::fa_dial_off } , // dial-off
+    { 40079, fa::fa_diamond_exclamation } , // diamond-exclamation
+    { 40099, fa::fa_diamond_half } , // diamond-half
+    { 40112, fa::fa_diamond_half_stroke } , // diamond-half-stroke
+    { 40132, fa::fa_diamonds_4 } , // diamonds-4
+    { 40143, fa::fa_dice_d10 } , // dice-d10
+    { 40152, fa::fa_dice_d12 } , // dice-d12
+    { 40161, fa::fa_dice_d4 } , // dice-d4
+    { 40169, fa::fa_dice_d8 } , // dice-d8
+    { 40177, fa::fa_dinosaur } , // dinosaur
+    { 40186, fa::fa_diploma } , // diploma
+    { 40208, fa::fa_disc_drive } , // disc-drive
+    { 40219, fa::fa_display_arrow_down } , // display-arrow-down
+    { 40238, fa::fa_display_chart_up } , // display-chart-up
+    { 40255, fa::fa_display_chart_up_circle_currency } , // display-chart-up-circle-currency
+    { 40288, fa::fa_display_chart_up_circle_dollar } , // display-chart-up-circle-dollar
+    { 40319, fa::fa_display_code } , // display-code
+    { 40345, fa::fa_display_medical } , // display-medical
+    { 40377, fa::fa_display_slash } , // display-slash
+    { 40405, fa::fa_distribute_spacing_horizontal } , // distribute-spacing-horizontal
+    { 40435, fa::fa_distribute_spacing_vertical } , // distribute-spacing-vertical
+    { 40463, fa::fa_ditto } , // ditto
+    { 40469, fa::fa_do_not_enter } , // do-not-enter
+    { 40482, fa::fa_dog_leashed } , // dog-leashed
+    { 36716, fa::fa_dollar_circle } , // dollar-circle
+    { 55893, fa::fa_dollar_square } , // dollar-square
+    { 40494, fa::fa_dolly_empty } , // dolly-empty
+    { 35041, fa::fa_dolly_flatbed_alt } , // dolly-flatbed-alt
+    { 35078, fa::fa_dolly_flatbed_empty } , // dolly-flatbed-empty
+    { 40506, fa::fa_dolphin } , // dolphin
+    { 40514, fa::fa_donut } , // donut
+    { 40520, fa::fa_doughnut } , // doughnut
+    { 40529, fa::fa_down } , // down
+    { 40549, fa::fa_down_from_bracket } , // down-from-bracket
+    { 40567, fa::fa_down_from_dotted_line } , // down-from-dotted-line
+    { 40589, fa::fa_down_from_line } , // down-from-line
+    { 40623, fa::fa_down_left } , // down-left
+    { 40633, fa::fa_down_right } , // down-right
+    { 40644, fa::fa_down_to_bracket } , // down-to-bracket
+    { 40660, fa::fa_down_to_dotted_line } , // down-to-dotted-line
+    { 40680, fa::fa_down_to_line } , // down-to-line
+    { 40713, fa::fa_draw_circle } , // draw-circle
+    { 40725, fa::fa_draw_square } , // draw-square
+    { 40737, fa::fa_dreidel } , // dreidel
+    { 40745, fa::fa_drone } , // drone
+    { 40763, fa::fa_drone_alt } , // drone-alt
+    { 40751, fa::fa_drone_front } , // drone-front
+    { 40773, fa::fa_droplet_degree } , // droplet-degree
+    { 40797, fa::fa_droplet_percent } , // droplet-percent
+    { 40822, fa::fa_drumstick } , // drumstick
+    { 40832, fa::fa_dryer } , // dryer
+    { 40849, fa::fa_dryer_alt } , // dryer-alt
+    { 40838, fa::fa_dryer_heat } , // dryer-heat
+    { 40859, fa::fa_duck } , // duck
+    { 40864, fa::fa_ear } , // ear
+    { 40868, fa::fa_ear_muffs } , // ear-muffs
+    { 40878, fa::fa_eclipse } , // eclipse
+    { 49984, fa::fa_eclipse_alt } , // eclipse-alt
+    { 40886, fa::fa_egg_fried } , // egg-fried
+    { 40896, fa::fa_eggplant } , // eggplant
+    { 40905, fa::fa_elephant } , // elephant
+    { 40930, fa::fa_ellipsis_h_alt } , // ellipsis-h-alt
+    { 40914, fa::fa_ellipsis_stroke } , // ellipsis-stroke
+    { 40945, fa::fa_ellipsis_stroke_vertical } , // ellipsis-stroke-vertical
+    { 40970, fa::fa_ellipsis_v_alt } , // ellipsis-v-alt
+    { 40985, fa::fa_empty_set } , // empty-set
+    { 40995, fa::fa_engine } , // engine
+    { 41017, fa::fa_engine_exclamation } , // engine-exclamation
+    { 41002, fa::fa_engine_warning } , // engine-warning
+    { 41049, fa::fa_envelope_badge } , // envelope-badge
+    { 36842, fa::fa_envelope_circle } , // envelope-circle
+    { 41036, fa::fa_envelope_dot } , // envelope-dot
+    { 41064, fa::fa_envelope_open_dollar } , // envelope-open-dollar
+    { 41085, fa::fa_envelopes } , // envelopes
+    { 41095, fa::fa_escalator } , // escalator
+    { 41105, fa::fa_excavator } , // excavator
+    { 56056, fa::fa_exclamation_square } , // exclamation-square
+    { 31278, fa::fa_expand_arrows } , // expand-arrows
+    { 41115, fa::fa_expand_wide } , // expand-wide
+    { 41475, fa::fa_exploding_head } , // exploding-head
+    { 41127, fa::fa_eye_dropper_full } , // eye-dropper-full
+    { 41144, fa::fa_eye_dropper_half } , // eye-dropper-half
+    { 41161, fa::fa_eye_evil } , // eye-evil
+    { 41170, fa::fa_eyes } , // eyes
+    { 41175, fa::fa_face_angry_horns } , // face-angry-horns
+    { 41192, fa::fa_face_anguished } , // face-anguished
+    { 41207, fa::fa_face_anxious_sweat } , // face-anxious-sweat
+    { 41226, fa::fa_face_astonished } , // face-astonished
+    { 41242, fa::fa_face_awesome } , // face-awesome
+    { 41266, fa::fa_face_beam_hand_over_mouth } , // face-beam-hand-over-mouth
+    { 41292, fa::fa_face_clouds } , // face-clouds
+    { 41304, fa::fa_face_confounded } , // face-confounded
+    { 41320, fa::fa_face_confused } , // face-confused
+    { 41334, fa::fa_face_cowboy_hat } , // face-cowboy-hat
+    { 41350, fa::fa_face_diagonal_mouth } , // face-diagonal-mouth
+    { 41370, fa::fa_face_disappointed } , // face-disappointed
+    { 41388, fa::fa_face_disguise } , // face-disguise
+    { 41402, fa::fa_face_dotted } , // face-dotted
+    { 41414, fa::fa_face_downcast_sweat } , // face-downcast-sweat
+    { 41434, fa::fa_face_drooling } , // face-drooling
+    { 41448, fa::fa_face_exhaling } , // face-exhaling
+    { 41462, fa::fa_face_explode } , // face-explode
+    { 41490, fa::fa_face_expressionless } , // face-expressionless
+    { 41510, fa::fa_face_eyes_xmarks } , // face-eyes-xmarks
+    { 41527, fa::fa_face_fearful } , // face-fearful
+    { 41540, fa::fa_face_frown_slight } , // face-frown-slight
+    { 41558, fa::fa_face_glasses } , // face-glasses
+    { 41571, fa::fa_face_hand_over_mouth } , // face-hand-over-mouth
+    { 41592, fa::fa_face_hand_peeking } , // face-hand-peeking
+    { 41610, fa::fa_face_hand_yawn } , // face-hand-yawn
+    { 41625, fa::fa_face_head_bandage } , // face-head-bandage
+    { 41643, fa::fa_face_holding_back_tears } , // face-holding-back-tears
+    { 41667, fa::fa_face_hushed } , // face-hushed
+    { 41679, fa::fa_face_icicles } , // face-icicles
+    { 41692, fa::fa_face_kiss_closed_eyes } , // face-kiss-closed-eyes
+    { 41714, fa::fa_face_lying } , // face-lying
+    { 41725, fa::fa_face_mask } , // face-mask
+    { 41735, fa::fa_face_melting } , // face-melting
+    { 41748, fa::fa_face_monocle } , // face-monocle
+    { 41761, fa::fa_face_nauseated } , // face-nauseated
+    { 41776, fa::fa_face_nose_steam } , // face-nose-steam
+    { 41792, fa::fa_face_party } , // face-party
+    { 41803, fa::fa_face_pensive } , // face-pensive
+    { 41816, fa::fa_face_persevering } , // face-persevering
+    { 41833, fa::fa_face_pleading } , // face-pleading
+    { 41847, fa::fa_face_pouting } , // face-pouting
+    { 41860, fa::fa_face_raised_eyebrow } , // face-raised-eyebrow
+    { 41880, fa::fa_face_relieved } , // face-relieved
+    { 41894, fa::fa_face_sad_sweat } , // face-sad-sweat
+    { 41909, fa::fa_face_saluting } , // face-saluting
+    { 41923, fa::fa_face_scream } , // face-scream
+    { 41935, fa::fa_face_shush } , // face-shush
+    { 41946, fa::fa_face_sleeping } , // face-sleeping
+    { 41960, fa::fa_face_sleepy } , // face-sleepy
+    { 41972, fa::fa_face_smile_halo } , // face-smile-halo
+    { 41988, fa::fa_face_smile_hearts } , // face-smile-hearts
+    { 42006, fa::fa_face_smile_horns } , // face-smile-horns
+    { 42023, fa::fa_face_smile_plus } , // face-smile-plus
+    { 42050, fa::fa_face_smile_relaxed } , // face-smile-relaxed
+    { 42069, fa::fa_face_smile_tear } , // face-smile-tear
+    { 42085, fa::fa_face_smile_tongue } , // face-smile-tongue
+    { 42103, fa::fa_face_smile_upside_down } , // face-smile-upside-down
+    { 42126, fa::fa_face_smiling_hands } , // face-smiling-hands
+    { 42145, fa::fa_face_smirking } , // face-smirking
+    { 42159, fa::fa_face_spiral_eyes } , // face-spiral-eyes
+    { 42176, fa::fa_face_sunglasses } , // face-sunglasses
+    { 42192, fa::fa_face_swear } , // face-swear
+    { 42203, fa::fa_face_thermometer } , // face-thermometer
+    { 42220, fa::fa_face_thinking } , // face-thinking
+    { 42234, fa::fa_face_tissue } , // face-tissue
+    { 42246, fa::fa_face_tongue_money } , // face-tongue-money
+    { 42264, fa::fa_face_tongue_sweat } , // face-tongue-sweat
+    { 42282, fa::fa_face_unamused } , // face-unamused
+    { 42296, fa::fa_face_viewfinder } , // face-viewfinder
+    { 42312, fa::fa_face_vomit } , // face-vomit
+    { 42323, fa::fa_face_weary } , // face-weary
+    { 42334, fa::fa_face_woozy } , // face-woozy
+    { 42345, fa::fa_face_worried } , // face-worried
+    { 42358, fa::fa_face_zany } , // face-zany
+    { 42368, fa::fa_face_zipper } , // face-zipper
+    { 42380, fa::fa_falafel } , // falafel
+    { 42388, fa::fa_family } , // family
+    { 42395, fa::fa_family_dress } , // family-dress
+    { 42408, fa::fa_family_pants } , // family-pants
+    { 42421, fa::fa_fan_table } , // fan-table
+    { 42431, fa::fa_farm } , // farm
+    { 42446, fa::fa_fence } , // fence
+    { 42452, fa::fa_ferris_wheel } , // ferris-wheel
+    { 42489, fa::fa_field_hockey } , // field-hockey
+    { 42465, fa::fa_field_hockey_stick_ball } , // field-hockey-stick-ball
+    { 42540, fa::fa_file_award } , // file-award
+    { 42502, fa::fa_file_binary } , // file-binary
+    { 42514, fa::fa_file_cad } , // file-cad
+    { 50834, fa::fa_file_caret_down } , // file-caret-down
+    { 50864, fa::fa_file_caret_up } , // file-caret-up
+    { 42523, fa::fa_file_certificate } , // file-certificate
+    { 42551, fa::fa_file_chart_column } , // file-chart-column
+    { 42569, fa::fa_file_chart_line } , // file-chart-line
+    { 42585, fa::fa_file_chart_pie } , // file-chart-pie
+    { 42600, fa::fa_file_check } , // file-check
+    { 42611, fa::fa_file_circle_info } , // file-circle-info
+    { 42628, fa::fa_file_dashed_line } , // file-dashed-line
+    { 42656, fa::fa_file_doc } , // file-doc
+    { 42665, fa::fa_file_eps } , // file-eps
+    { 42674, fa::fa_file_exclamation } , // file-exclamation
+    { 42691, fa::fa_file_gif } , // file-gif
+    { 42700, fa::fa_file_heart } , // file-heart
+    { 42711, fa::fa_file_jpg } , // file-jpg
+    { 42720, fa::fa_file_lock } , // file-lock
+    { 42730, fa::fa_file_magnifying_glass } , // file-magnifying-glass
+    { 42764, fa::fa_file_minus } , // file-minus
+    { 42775, fa::fa_file_mov } , // file-mov
+    { 42784, fa::fa_file_mp3 } , // file-mp3
+    { 42793, fa::fa_file_mp4 } , // file-mp4
+    { 42802, fa::fa_file_music } , // file-music
+    { 42813, fa::fa_file_plus } , // file-plus
+    { 42823, fa::fa_file_plus_minus } , // file-plus-minus
+    { 42839, fa::fa_file_png } , // file-png
+    { 42848, fa::fa_file_ppt } , // file-ppt
+    { 42752, fa::fa_file_search } , // file-search
+    { 42857, fa::fa_file_slash } , // file-slash
+    { 42868, fa::fa_file_spreadsheet } , // file-spreadsheet
+    { 42885, fa::fa_file_svg } , // file-svg
+    { 42936, fa::fa_file_times } , // file-times
+    { 42894, fa::fa_file_user } , // file-user
+    { 42904, fa::fa_file_vector } , // file-vector
+    { 42916, fa::fa_file_xls } , // file-xls
+    { 42925, fa::fa_file_xmark } , // file-xmark
+    { 42947, fa::fa_file_xml } , // file-xml
+    { 42956, fa::fa_file_zip } , // file-zip
+    { 42965, fa::fa_files } , // files
+    { 42971, fa::fa_files_medical } , // files-medical
+    { 43026, fa::fa_film_alt } , // film-alt
+    { 42985, fa::fa_film_canister } , // film-canister
+    { 42999, fa::fa_film_cannister } , // film-cannister
+    { 43014, fa::fa_film_simple } , // film-simple
+    { 43035, fa::fa_film_slash } , // film-slash
+    { 43046, fa::fa_films } , // films
+    { 43052, fa::fa_filter_list } , // filter-list
+    { 43064, fa::fa_filter_slash } , // filter-slash
+    { 43077, fa::fa_filters } , // filters
+    { 43085, fa::fa_fire_flame } , // fire-flame
+    { 43102, fa::fa_fire_hydrant } , // fire-hydrant
+    { 43115, fa::fa_fire_smoke } , // fire-smoke
+    { 43126, fa::fa_fireplace } , // fireplace
+    { 32408, fa::fa_firewall } , // firewall
+    { 43136, fa::fa_fish_bones } , // fish-bones
+    { 43147, fa::fa_fish_cooked } , // fish-cooked
+    { 43159, fa::fa_fishing_rod } , // fishing-rod
+    { 43209, fa::fa_flag_alt } , // flag-alt
+    { 43171, fa::fa_flag_pennant } , // flag-pennant
+    { 43192, fa::fa_flag_swallowtail } , // flag-swallowtail
+    { 43096, fa::fa_flame } , // flame
+    { 43218, fa::fa_flashlight } , // flashlight
+    { 43229, fa::fa_flask_gear } , // flask-gear
+    { 43259, fa::fa_flask_poison } , // flask-poison
+    { 43291, fa::fa_flask_potion } , // flask-potion
+    { 43240, fa::fa_flask_round_poison } , // flask-round-poison
+    { 43272, fa::fa_flask_round_potion } , // flask-round-potion
+    { 43304, fa::fa_flatbread } , // flatbread
+    { 43314, fa::fa_flatbread_stuffed } , // flatbread-stuffed
+    { 43332, fa::fa_floppy_disk_circle_arrow_right } , // floppy-disk-circle-arrow-right
+    { 43387, fa::fa_floppy_disk_circle_xmark } , // floppy-disk-circle-xmark
+    { 43459, fa::fa_floppy_disk_pen } , // floppy-disk-pen
+    { 43412, fa::fa_floppy_disk_times } , // floppy-disk-times
+    { 43475, fa::fa_floppy_disks } , // floppy-disks
+    { 43488, fa::fa_flower } , // flower
+    { 43495, fa::fa_flower_daffodil } , // flower-daffodil
+    { 43511, fa::fa_flower_tulip } , // flower-tulip
+    { 43524, fa::fa_flute } , // flute
+    { 43530, fa::fa_flux_capacitor } , // flux-capacitor
+    { 43545, fa::fa_flying_disc } , // flying-disc
+    { 38491, fa::fa_fog } , // fog
+    { 43557, fa::fa_folder_arrow_down } , // folder-arrow-down
+    { 43591, fa::fa_folder_arrow_up } , // folder-arrow-up
+    { 43621, fa::fa_folder_bookmark } , // folder-bookmark
+    { 43637, fa::fa_folder_check } , // folder-check
+    { 43662, fa::fa_folder_cog } , // folder-cog
+    { 43575, fa::fa_folder_download } , // folder-download
+    { 43650, fa::fa_folder_gear } , // folder-gear
+    { 43673, fa::fa_folder_grid } , // folder-grid
+    { 43685, fa::fa_folder_heart } , // folder-heart
+    { 43698, fa::fa_folder_image } , // folder-image
+    { 43711, fa::fa_folder_magnifying_glass } , // folder-magnifying-glass
+    { 43749, fa::fa_folder_medical } , // folder-medical
+    { 43764, fa::fa_folder_music } , // folder-music
+    { 43735, fa::fa_folder_search } , // folder-search
+    { 43802, fa::fa_folder_times } , // folder-times
+    { 43607, fa::fa_folder_upload } , // folder-upload
+    { 43777, fa::fa_folder_user } , // folder-user
+    { 43789, fa::fa_folder_xmark } , // folder-xmark
+    { 43815, fa::fa_folders } , // folders
+    { 43823, fa::fa_fondue_pot } , // fondue-pot
+    { 43834, fa::fa_font_case } , // font-case
+    { 43844, fa::fa_football_helmet } , // football-helmet
+    { 43860, fa::fa_fork } , // fork
+    { 43878, fa::fa_fork_knife } , // fork-knife
+    { 43902, fa::fa_forklift } , // forklift
+    { 43911, fa::fa_fort } , // fort
+    { 61312, fa::fa_fragile } , // fragile
+    { 43916, fa::fa_frame } , // frame
+    { 43922, fa::fa_french_fries } , // french-fries
+    { 55015, fa::fa_frosty_head } , // frosty-head
+    { 43935, fa::fa_function } , // function
+    { 43944, fa::fa_galaxy } , // galaxy
+    { 43951, fa::fa_gallery_thumbnails } , // gallery-thumbnails
+    { 43970, fa::fa_game_board } , // game-board
+    { 43999, fa::fa_game_board_alt } , // game-board-alt
+    { 43981, fa::fa_game_board_simple } , // game-board-simple
+    { 44014, fa::fa_game_console_handheld } , // game-console-handheld
+    { 44036, fa::fa_game_console_handheld_crank } , // game-console-handheld-crank
+    { 44079, fa::fa_gamepad_alt } , // gamepad-alt
+    { 44064, fa::fa_gamepad_modern } , // gamepad-modern
+    { 44091, fa::fa_garage } , // garage
+    { 44098, fa::fa_garage_car } , // garage-car
+    { 44109, fa::fa_garage_open } , // garage-open
+    { 44121, fa::fa_garlic } , // garlic
+    { 44128, fa::fa_gas_pump_slash } , // gas-pump-slash
+    { 44143, fa::fa_gauge_circle_bolt } , // gauge-circle-bolt
+    { 44161, fa::fa_gauge_circle_minus } , // gauge-circle-minus
+    { 44180, fa::fa_gauge_circle_plus } , // gauge-circle-plus
+    { 44198, fa::fa_gauge_low } , // gauge-low
+    { 44228, fa::fa_gauge_max } , // gauge-max
+    { 44261, fa::fa_gauge_min } , // gauge-min
+    { 44294, fa::fa_gauge_simple_low } , // gauge-simple-low
+    { 44327, fa::fa_gauge_simple_max } , // gauge-simple-max
+    { 44363, fa::fa_gauge_simple_min } , // gauge-simple-min
+    { 41255, fa::fa_gave_dandy } , // gave-dandy
+    { 44399, fa::fa_gear_code } , // gear-code
+    { 44409, fa::fa_gear_complex } , // gear-complex
+    { 44422, fa::fa_gear_complex_code } , // gear-complex-code
+    { 44440, fa::fa_gif } , // gif
+    { 44444, fa::fa_gift_card } , // gift-card
+    { 44454, fa::fa_gingerbread_man } , // gingerbread-man
+    { 44470, fa::fa_glass } , // glass
+    { 35250, fa::fa_glass_champagne } , // glass-champagne
+    { 44476, fa::fa_glass_citrus } , // glass-citrus
+    { 44489, fa::fa_glass_empty } , // glass-empty
+    { 44501, fa::fa_glass_half } , // glass-half
+    { 44512, fa::fa_glass_half_empty } , // glass-half-empty
+    { 44529, fa::fa_glass_half_full } , // glass-half-full
+    { 61085, fa::fa_glass_whiskey_rocks } , // glass-whiskey-rocks
+    { 44559, fa::fa_glasses_alt } , // glasses-alt
+    { 44545, fa::fa_glasses_round } , // glasses-round
+    { 44571, fa::fa_globe_pointer } , // globe-pointer
+    { 44585, fa::fa_globe_snow } , // globe-snow
+    { 44596, fa::fa_globe_stand } , // globe-stand
+    { 44608, fa::fa_globe_wifi } , // globe-wifi
+    { 33215, fa::fa_glove_boxing } , // glove-boxing
+    { 44619, fa::fa_goal_net } , // goal-net
+    { 44628, fa::fa_golf_club } , // golf-club
+    { 44638, fa::fa_golf_flag_hole } , // golf-flag-hole
+    { 44653, fa::fa_gramophone } , // gramophone
+    { 44664, fa::fa_grapes } , // grapes
+    { 44671, fa::fa_grate } , // grate
+    { 44677, fa::fa_grate_droplet } , // grate-droplet
+    { 44691, fa::fa_grid } , // grid
+    { 44703, fa::fa_grid_2 } , // grid-2
+    { 44710, fa::fa_grid_2_plus } , // grid-2-plus
+    { 44696, fa::fa_grid_3 } , // grid-3
+    { 44722, fa::fa_grid_4 } , // grid-4
+    { 44729, fa::fa_grid_5 } , // grid-5
+    { 44736, fa::fa_grid_dividers } , // grid-dividers
+    { 44750, fa::fa_grid_horizontal } , // grid-horizontal
+    { 44766, fa::fa_grid_round } , // grid-round
+    { 44777, fa::fa_grid_round_2 } , // grid-round-2
+    { 44790, fa::fa_grid_round_2_plus } , // grid-round-2-plus
+    { 44808, fa::fa_grid_round_4 } , // grid-round-4
+    { 44821, fa::fa_grid_round_5 } , // grid-round-5
+    { 44834, fa::fa_grill } , // grill
+    { 44840, fa::fa_grill_fire } , // grill-fire
+    { 44851, fa::fa_grill_hot } , // grill-hot
+    { 44861, fa::fa_grip_dots } , // grip-dots
+    { 44871, fa::fa_grip_dots_vertical } , // grip-dots-vertical
+    { 44890, fa::fa_guitar_electric } , // guitar-electric
+    { 44906, fa::fa_guitars } , // guitars
+    { 44914, fa::fa_gun_slash } , // gun-slash
+    { 44924, fa::fa_gun_squirt } , // gun-squirt
+    { 44935, fa::fa_h1 } , // h1
+    { 44938, fa::fa_h2 } , // h2
+    { 44941, fa::fa_h3 } , // h3
+    { 44944, fa::fa_h4 } , // h4
+    { 44947, fa::fa_h5 } , // h5
+    { 44950, fa::fa_h6 } , // h6
+    { 44953, fa::fa_hammer_brush } , // hammer-brush
+    { 44966, fa::fa_hammer_crash } , // hammer-crash
+    { 44979, fa::fa_hammer_war } , // hammer-war
+    { 44990, fa::fa_hand_back_point_down } , // hand-back-point-down
+    { 45011, fa::fa_hand_back_point_left } , // hand-back-point-left
+    { 45032, fa::fa_hand_back_point_ribbon } , // hand-back-point-ribbon
+    { 45055, fa::fa_hand_back_point_right } , // hand-back-point-right
+    { 45077, fa::fa_hand_back_point_up } , // hand-back-point-up
+    { 45096, fa::fa_hand_fingers_crossed } , // hand-fingers-crossed
+    { 45117, fa::fa_hand_heart } , // hand-heart
+    { 45128, fa::fa_hand_holding_box } , // hand-holding-box
+    { 45145, fa::fa_hand_holding_circle_dollar } , // hand-holding-circle-dollar
+    { 45172, fa::fa_hand_holding_magic } , // hand-holding-magic
+    { 45191, fa::fa_hand_holding_seedling } , // hand-holding-seedling
+    { 45213, fa::fa_hand_holding_skull } , // hand-holding-skull
+    { 45232, fa::fa_hand_horns } , // hand-horns
+    { 45243, fa::fa_hand_love } , // hand-love
+    { 45253, fa::fa_hand_point_ribbon } , // hand-point-ribbon
+    { 45303, fa::fa_hand_receiving } , // hand-receiving
+    { 45271, fa::fa_hand_wave } , // hand-wave
+    { 45369, fa::fa_hands_heart } , // hands-heart
+    { 45281, fa::fa_hands_holding_diamond } , // hands-holding-diamond
+    { 45318, fa::fa_hands_holding_dollar } , // hands-holding-dollar
+    { 45349, fa::fa_hands_holding_heart } , // hands-holding-heart
+    { 45339, fa::fa_hands_usd } , // hands-usd
+    { 45381, fa::fa_hashtag_lock } , // hashtag-lock
+    { 45394, fa::fa_hat_beach } , // hat-beach
+    { 45404, fa::fa_hat_chef } , // hat-chef
+    { 45413, fa::fa_hat_santa } , // hat-santa
+    { 45423, fa::fa_hat_winter } , // hat-winter
+    { 45434, fa::fa_hat_witch } , // hat-witch
+    { 45444, fa::fa_head_side } , // head-side
+    { 45454, fa::fa_head_side_brain } , // head-side-brain
+    { 45470, fa::fa_head_side_gear } , // head-side-gear
+    { 45485, fa::fa_head_side_goggles } , // head-side-goggles
+    { 45511, fa::fa_head_side_headphones } , // head-side-headphones
+    { 45532, fa::fa_head_side_heart } , // head-side-heart
+    { 45548, fa::fa_head_side_medical } , // head-side-medical
+    { 45503, fa::fa_head_vr } , // head-vr
+    { 36948, fa::fa_heart_circle } , // heart-circle
+    { 45566, fa::fa_heart_half } , // heart-half
+    { 45595, fa::fa_heart_half_alt } , // heart-half-alt
+    { 45577, fa::fa_heart_half_stroke } , // heart-half-stroke
+    { 60935, fa::fa_heart_rate } , // heart-rate
+    { 56157, fa::fa_heart_square } , // heart-square
+    { 45610, fa::fa_heat } , // heat
+    { 45615, fa::fa_helmet_battle } , // helmet-battle
+    { 45629, fa::fa_hexagon } , // hexagon
+    { 45637, fa::fa_hexagon_check } , // hexagon-check
+    { 45651, fa::fa_hexagon_divide } , // hexagon-divide
+    { 45666, fa::fa_hexagon_exclamation } , // hexagon-exclamation
+    { 45686, fa::fa_hexagon_image } , // hexagon-image
+    { 45700, fa::fa_hexagon_minus } , // hexagon-minus
+    { 45728, fa::fa_hexagon_plus } , // hexagon-plus
+    { 45754, fa::fa_hexagon_vertical_nft } , // hexagon-vertical-nft
+    { 45775, fa::fa_hexagon_vertical_nft_slanted } , // hexagon-vertical-nft-slanted
+    { 45804, fa::fa_hexagon_xmark } , // hexagon-xmark
+    { 45846, fa::fa_high_definition } , // high-definition
+    { 45875, fa::fa_highlighter_line } , // highlighter-line
+    { 45892, fa::fa_hockey_mask } , // hockey-mask
+    { 45904, fa::fa_hockey_stick_puck } , // hockey-stick-puck
+    { 45922, fa::fa_hockey_sticks } , // hockey-sticks
+    { 46039, fa::fa_home_blank } , // home-blank
+    { 46127, fa::fa_home_heart } , // home-heart
+    { 45936, fa::fa_honey_pot } , // honey-pot
+    { 45946, fa::fa_hood_cloak } , // hood-cloak
+    { 45957, fa::fa_horizontal_rule } , // horizontal-rule
+    { 45973, fa::fa_horse_saddle } , // horse-saddle
+    { 45986, fa::fa_hose } , // hose
+    { 45991, fa::fa_hose_reel } , // hose-reel
+    { 46001, fa::fa_hospitals } , // hospitals
+    { 46011, fa::fa_hourglass_clock } , // hourglass-clock
+    { 46027, fa::fa_house_blank } , // house-blank
+    { 46050, fa::fa_house_building } , // house-building
+    { 46065, fa::fa_house_chimney_blank } , // house-chimney-blank
+    { 46085, fa::fa_house_chimney_heart } , // house-chimney-heart
+    { 46105, fa::fa_house_day } , // house-day
+    { 46290, fa::fa_house_flood } , // house-flood
+    { 46115, fa::fa_house_heart } , // house-heart
+    { 46169, fa::fa_house_leave } , // house-leave
+    { 46138, fa::fa_house_night } , // house-night
+    { 46221, fa::fa_house_person_arrive } , // house-person-arrive
+    { 46181, fa::fa_house_person_depart } , // house-person-depart
+    { 46150, fa::fa_house_person_leave } , // house-person-leave
+    { 46201, fa::fa_house_person_return } , // house-person-return
+    { 46241, fa::fa_house_return } , // house-return
+    { 46254, fa::fa_house_tree } , // house-tree
+    { 46265, fa::fa_house_turret } , // house-turret
+    { 46278, fa::fa_house_water } , // house-water
+    { 46302, fa::fa_house_window } , // house-window
+    { 40813, fa::fa_humidity } , // humidity
+    { 46315, fa::fa_hundred_points } , // hundred-points
+    { 46334, fa::fa_hydra } , // hydra
+    { 46340, fa::fa_hyphen } , // hyphen
+    { 46347, fa::fa_ice_skate } , // ice-skate
+    { 57421, fa::fa_icons_alt } , // icons-alt
+    { 46357, fa::fa_image_landscape } , // image-landscape
+    { 46383, fa::fa_image_polaroid } , // image-polaroid
+    { 46398, fa::fa_image_polaroid_user } , // image-polaroid-user
+    { 46418, fa::fa_image_slash } , // image-slash
+    { 46430, fa::fa_image_user } , // image-user
+    { 46441, fa::fa_images_user } , // images-user
+    { 46473, fa::fa_inbox_arrow_down } , // inbox-arrow-down
+    { 46500, fa::fa_inbox_arrow_up } , // inbox-arrow-up
+    { 46453, fa::fa_inbox_full } , // inbox-full
+    { 46464, fa::fa_inbox_in } , // inbox-in
+    { 46490, fa::fa_inbox_out } , // inbox-out
+    { 46515, fa::fa_inboxes } , // inboxes
+    { 46540, fa::fa_industry_alt } , // industry-alt
+    { 46523, fa::fa_industry_windows } , // industry-windows
+    { 56191, fa::fa_info_square } , // info-square
+    { 46553, fa::fa_inhaler } , // inhaler
+    { 46561, fa::fa_input_numeric } , // input-numeric
+    { 46575, fa::fa_input_pipe } , // input-pipe
+    { 46586, fa::fa_input_text } , // input-text
+    { 46597, fa::fa_integral } , // integral
+    { 46606, fa::fa_interrobang } , // interrobang
+    { 46618, fa::fa_intersection } , // intersection
+    { 54062, fa::fa_inventory } , // inventory
+    { 46647, fa::fa_island_tree_palm } , // island-tree-palm
+    { 46631, fa::fa_island_tropical } , // island-tropical
+    { 46664, fa::fa_jack_o_lantern } , // jack-o-lantern
+    { 46679, fa::fa_joystick } , // joystick
+    { 46688, fa::fa_jug } , // jug
+    { 46692, fa::fa_jug_bottle } , // jug-bottle
+    { 46703, fa::fa_kazoo } , // kazoo
+    { 46709, fa::fa_kerning } , // kerning
+    { 46717, fa::fa_key_skeleton } , // key-skeleton
+    { 46730, fa::fa_key_skeleton_left_right } , // key-skeleton-left-right
+    { 46754, fa::fa_keyboard_brightness } , // keyboard-brightness
+    { 46774, fa::fa_keyboard_brightness_low } , // keyboard-brightness-low
+    { 46798, fa::fa_keyboard_down } , // keyboard-down
+    { 46812, fa::fa_keyboard_left } , // keyboard-left
+    { 46826, fa::fa_keynote } , // keynote
+    { 46834, fa::fa_kidneys } , // kidneys
+    { 46842, fa::fa_kite } , // kite
+    { 46847, fa::fa_kiwi_fruit } , // kiwi-fruit
+    { 46858, fa::fa_knife } , // knife
+    { 46878, fa::fa_knife_kitchen } , // knife-kitchen
+    { 46892, fa::fa_lacrosse_stick } , // lacrosse-stick
+    { 46907, fa::fa_lacrosse_stick_ball } , // lacrosse-stick-ball
+    { 46927, fa::fa_lambda } , // lambda
+    { 46934, fa::fa_lamp } , // lamp
+    { 46939, fa::fa_lamp_desk } , // lamp-desk
+    { 46949, fa::fa_lamp_floor } , // lamp-floor
+    { 46960, fa::fa_lamp_street } , // lamp-street
+    { 46972, fa::fa_landmark_magnifying_glass } , // landmark-magnifying-glass
+    { 46373, fa::fa_landscape } , // landscape
+    { 46998, fa::fa_laptop_arrow_down } , // laptop-arrow-down
+    { 47016, fa::fa_laptop_binary } , // laptop-binary
+    { 47030, fa::fa_laptop_mobile } , // laptop-mobile
+    { 47057, fa::fa_laptop_slash } , // laptop-slash
+    { 47070, fa::fa_lasso } , // lasso
+    { 47076, fa::fa_lasso_sparkles } , // lasso-sparkles
+    { 47103, fa::fa_layer_group_minus } , // layer-group-minus
+    { 47132, fa::fa_layer_group_plus } , // layer-group-plus
+    { 47091, fa::fa_layer_minus } , // layer-minus
+    { 47121, fa::fa_layer_plus } , // layer-plus
+    { 47149, fa::fa_leaf_heart } , // leaf-heart
+    { 47160, fa::fa_leaf_maple } , // leaf-maple
+    { 47171, fa::fa_leaf_oak } , // leaf-oak
+    { 47180, fa::fa_leafy_green } , // leafy-green
+    { 47192, fa::fa_left } , // left
+    { 47212, fa::fa_left_from_bracket } , // left-from-bracket
+    { 47230, fa::fa_left_from_line } , // left-from-line
+    { 47266, fa::fa_left_long_to_line } , // left-long-to-line
+    { 47284, fa::fa_left_to_bracket } , // left-to-bracket
+    { 47300, fa::fa_left_to_line } , // left-to-line
+    { 47331, fa::fa_light_ceiling } , // light-ceiling
+    { 47345, fa::fa_light_emergency } , // light-emergency
+    { 47361, fa::fa_light_emergency_on } , // light-emergency-on
+    { 47380, fa::fa_light_switch } , // light-switch
+    { 47393, fa::fa_light_switch_off } , // light-switch-off
+    { 47410, fa::fa_light_switch_on } , // light-switch-on
+    { 47426, fa::fa_lightbulb_cfl } , // lightbulb-cfl
+    { 47440, fa::fa_lightbulb_cfl_on } , // lightbulb-cfl-on
+    { 47457, fa::fa_lightbulb_dollar } , // lightbulb-dollar
+    { 47474, fa::fa_lightbulb_exclamation } , // lightbulb-exclamation
+    { 47496, fa::fa_lightbulb_exclamation_on } , // lightbulb-exclamation-on
+    { 47521, fa::fa_lightbulb_gear } , // lightbulb-gear
+    { 47536, fa::fa_lightbulb_message } , // lightbulb-message
+    { 47554, fa::fa_lightbulb_on } , // lightbulb-on
+    { 47567, fa::fa_lightbulb_slash } , // lightbulb-slash
+    { 47583, fa::fa_lighthouse } , // lighthouse
+    { 47594, fa::fa_lights_holiday } , // lights-holiday
+    { 47609, fa::fa_line_columns } , // line-columns
+    { 47622, fa::fa_line_height } , // line-height
+    { 47634, fa::fa_link_horizontal } , // link-horizontal
+    { 47667, fa::fa_link_horizontal_slash } , // link-horizontal-slash
+    { 47712, fa::fa_link_simple } , // link-simple
+    { 47724, fa::fa_link_simple_slash } , // link-simple-slash
+    { 47742, fa::fa_lips } , // lips
+    { 47747, fa::fa_list_dropdown } , // list-dropdown
+    { 47761, fa::fa_list_music } , // list-music
+    { 47772, fa::fa_list_radio } , // list-radio
+    { 47783, fa::fa_list_timeline } , // list-timeline
+    { 47797, fa::fa_list_tree } , // list-tree
+    { 47807, fa::fa_loader } , // loader
+    { 47814, fa::fa_lobster } , // lobster
+    { 47822, fa::fa_location_arrow_up } , // location-arrow-up
+    { 47840, fa::fa_location_check } , // location-check
+    { 37019, fa::fa_location_circle } , // location-circle
+    { 47872, fa::fa_location_crosshairs_slash } , // location-crosshairs-slash
+    { 47913, fa::fa_location_dot_slash } , // location-dot-slash
+    { 47953, fa::fa_location_exclamation } , // location-exclamation
+    { 47997, fa::fa_location_minus } , // location-minus
+    { 48029, fa::fa_location_pen } , // location-pen
+    { 48058, fa::fa_location_pin_slash } , // location-pin-slash
+    { 48094, fa::fa_location_plus } , // location-plus
+    { 48124, fa::fa_location_question } , // location-question
+    { 47898, fa::fa_location_slash } , // location-slash
+    { 48162, fa::fa_location_smile } , // location-smile
+    { 48194, fa::fa_location_xmark } , // location-xmark
+    { 48243, fa::fa_lock_a } , // lock-a
+    { 48276, fa::fa_lock_alt } , // lock-alt
+    { 48250, fa::fa_lock_hashtag } , // lock-hashtag
+    { 48263, fa::fa_lock_keyhole } , // lock-keyhole
+    { 48285, fa::fa_lock_keyhole_open } , // lock-keyhole-open
+    { 48303, fa::fa_lock_open_alt } , // lock-open-alt
+    { 48317, fa::fa_lollipop } , // lollipop
+    { 48326, fa::fa_lollypop } , // lollypop
+    { 48335, fa::fa_loveseat } , // loveseat
+    { 48370, fa::fa_luchador } , // luchador
+    { 48356, fa::fa_luchador_mask } , // luchador-mask
+    { 48393, fa::fa_mace } , // mace
+    { 48398, fa::fa_magnifying_glass_arrows_rotate } , // magnifying-glass-arrows-rotate
+    { 48429, fa::fa_magnifying_glass_music } , // magnifying-glass-music
+    { 48452, fa::fa_magnifying_glass_play } , // magnifying-glass-play
+    { 48474, fa::fa_magnifying_glass_waveform } , // magnifying-glass-waveform
+    { 48500, fa::fa_mailbox } , // mailbox
+    { 48508, fa::fa_mailbox_flag_up } , // mailbox-flag-up
+    { 57322, fa::fa_maki_roll } , // maki-roll
+    { 57332, fa::fa_makizushi } , // makizushi
+    { 48524, fa::fa_mandolin } , // mandolin
+    { 48533, fa::fa_mango } , // mango
+    { 48539, fa::fa_manhole } , // manhole
+    { 47932, fa::fa_map_marker_alt_slash } , // map-marker-alt-slash
+    { 47855, fa::fa_map_marker_check } , // map-marker-check
+    { 48042, fa::fa_map_marker_edit } , // map-marker-edit
+    { 47974, fa::fa_map_marker_exclamation } , // map-marker-exclamation
+    { 48012, fa::fa_map_marker_minus } , // map-marker-minus
+    { 48108, fa::fa_map_marker_plus } , // map-marker-plus
+    { 48142, fa::fa_map_marker_question } , // map-marker-question
+    { 48077, fa::fa_map_marker_slash } , // map-marker-slash
+    { 48177, fa::fa_map_marker_smile } , // map-marker-smile
+    { 48209, fa::fa_map_marker_times } , // map-marker-times
+    { 48226, fa::fa_map_marker_xmark } , // map-marker-xmark
+    { 48379, fa::fa_mask_luchador } , // mask-luchador
+    { 48547, fa::fa_mask_snorkel } , // mask-snorkel
+    { 48560, fa::fa_meat } , // meat
+    { 48565, fa::fa_megaphone } , // megaphone
+    { 48575, fa::fa_melon } , // melon
+    { 48581, fa::fa_melon_slice } , // melon-slice
+    { 48593, fa::fa_memo } , // memo
+    { 48598, fa::fa_memo_circle_check } , // memo-circle-check
+    { 48616, fa::fa_memo_circle_info } , // memo-circle-info
+    { 48633, fa::fa_memo_pad } , // memo-pad
+    { 48642, fa::fa_merge } , // merge
+    { 48648, fa::fa_message_arrow_down } , // message-arrow-down
+    { 48690, fa::fa_message_arrow_up } , // message-arrow-up
+    { 48728, fa::fa_message_arrow_up_right } , // message-arrow-up-right
+    { 48751, fa::fa_message_bot } , // message-bot
+    { 48763, fa::fa_message_captions } , // message-captions
+    { 48801, fa::fa_message_check } , // message-check
+    { 48833, fa::fa_message_code } , // message-code
+    { 48846, fa::fa_message_dollar } , // message-dollar
+    { 48880, fa::fa_message_dots } , // message-dots
+    { 49247, fa::fa_message_edit } , // message-edit
+    { 48920, fa::fa_message_exclamation } , // message-exclamation
+    { 48964, fa::fa_message_heart } , // message-heart
+    { 48978, fa::fa_message_image } , // message-image
+    { 49010, fa::fa_message_lines } , // message-lines
+    { 49042, fa::fa_message_medical } , // message-medical
+    { 49078, fa::fa_message_middle } , // message-middle
+    { 49112, fa::fa_message_middle_top } , // message-middle-top
+    { 49154, fa::fa_message_minus } , // message-minus
+    { 49186, fa::fa_message_music } , // message-music
+    { 49218, fa::fa_message_pen } , // message-pen
+    { 49260, fa::fa_message_plus } , // message-plus
+    { 49290, fa::fa_message_question } , // message-question
+    { 49307, fa::fa_message_quote } , // message-quote
+    { 49339, fa::fa_message_slash } , // message-slash
+    { 49371, fa::fa_message_smile } , // message-smile
+    { 49403, fa::fa_message_sms } , // message-sms
+    { 49415, fa::fa_message_text } , // message-text
+    { 49477, fa::fa_message_times } , // message-times
+    { 49445, fa::fa_message_xmark } , // message-xmark
+    { 49491, fa::fa_messages } , // messages
+    { 49513, fa::fa_messages_dollar } , // messages-dollar
+    { 49549, fa::fa_messages_question } , // messages-question
+    { 48910, fa::fa_messaging } , // messaging
+    { 49567, fa::fa_meter } , // meter
+    { 49573, fa::fa_meter_bolt } , // meter-bolt
+    { 49584, fa::fa_meter_droplet } , // meter-droplet
+    { 49598, fa::fa_meter_fire } , // meter-fire
+    { 49609, fa::fa_microchip_ai } , // microchip-ai
+    { 37062, fa::fa_microphone_circle } , // microphone-circle
+    { 37104, fa::fa_microphone_circle_alt } , // microphone-circle-alt
+    { 49622, fa::fa_microphone_stand } , // microphone-stand
+    { 49639, fa::fa_microwave } , // microwave
+    { 33476, fa::fa_mind_share } , // mind-share
+    { 45714, fa::fa_minus_hexagon } , // minus-hexagon
+    { 39820, fa::fa_minus_large } , // minus-large
+    { 50617, fa::fa_minus_octagon } , // minus-octagon
+    { 49649, fa::fa_mistletoe } , // mistletoe
+    { 49672, fa::fa_mobile_iphone } , // mobile-iphone
+    { 49659, fa::fa_mobile_notch } , // mobile-notch
+    { 49686, fa::fa_mobile_signal } , // mobile-signal
+    { 49700, fa::fa_mobile_signal_out } , // mobile-signal-out
+    { 49718, fa::fa_money_bill_simple } , // money-bill-simple
+    { 49736, fa::fa_money_bill_simple_wave } , // money-bill-simple-wave
+    { 49778, fa::fa_money_bills_alt } , // money-bills-alt
+    { 49759, fa::fa_money_bills_simple } , // money-bills-simple
+    { 49794, fa::fa_money_check_dollar_pen } , // money-check-dollar-pen
+    { 49854, fa::fa_money_check_edit } , // money-check-edit
+    { 49817, fa::fa_money_check_edit_alt } , // money-check-edit-alt
+    { 49838, fa::fa_money_check_pen } , // money-check-pen
+    { 49871, fa::fa_money_from_bracket } , // money-from-bracket
+    { 49890, fa::fa_money_simple_from_bracket } , // money-simple-from-bracket
+    { 49933, fa::fa_monitor_heart_rate } , // monitor-heart-rate
+    { 49916, fa::fa_monitor_waveform } , // monitor-waveform
+    { 49952, fa::fa_monkey } , // monkey
+    { 49959, fa::fa_moon_cloud } , // moon-cloud
+    { 49970, fa::fa_moon_over_sun } , // moon-over-sun
+    { 49996, fa::fa_moon_stars } , // moon-stars
+    { 50007, fa::fa_moped } , // moped
+    { 50013, fa::fa_mountains } , // mountains
+    { 39361, fa::fa_mouse_alt } , // mouse-alt
+    { 50023, fa::fa_mouse_field } , // mouse-field
+    { 50035, fa::fa_mp3_player } , // mp3-player
+    { 50046, fa::fa_mug } , // mug
+    { 50050, fa::fa_mug_marshmallows } , // mug-marshmallows
+    { 50067, fa::fa_mug_tea } , // mug-tea
+    { 50075, fa::fa_mug_tea_saucer } , // mug-tea-saucer
+    { 50090, fa::fa_mushroom } , // mushroom
+    { 50133, fa::fa_music_alt } , // music-alt
+    { 50160, fa::fa_music_alt_slash } , // music-alt-slash
+    { 50099, fa::fa_music_magnifying_glass } , // music-magnifying-glass
+    { 50122, fa::fa_music_note } , // music-note
+    { 50143, fa::fa_music_note_slash } , // music-note-slash
+    { 50176, fa::fa_music_slash } , // music-slash
+    { 50188, fa::fa_mustache } , // mustache
+    { 50197, fa::fa_narwhal } , // narwhal
+    { 50205, fa::fa_nesting_dolls } , // nesting-dolls
+    { 50219, fa::fa_nfc } , // nfc
+    { 50223, fa::fa_nfc_lock } , // nfc-lock
+    { 50232, fa::fa_nfc_magnifying_glass } , // nfc-magnifying-glass
+    { 50253, fa::fa_nfc_pen } , // nfc-pen
+    { 50261, fa::fa_nfc_signal } , // nfc-signal
+    { 50272, fa::fa_nfc_slash } , // nfc-slash
+    { 50282, fa::fa_nfc_trash } , // nfc-trash
+    { 57304, fa::fa_nigiri } , // nigiri
+    { 50292, fa::fa_nose } , // nose
+    { 50297, fa::fa_note } , // note
+    { 50302, fa::fa_note_medical } , // note-medical
+    { 50315, fa::fa_notebook } , // notebook
+    { 50324, fa::fa_notes } , // notes
+    { 50330, fa::fa_object_exclude } , // object-exclude
+    { 50345, fa::fa_object_intersect } , // object-intersect
+    { 50362, fa::fa_object_subtract } , // object-subtract
+    { 50378, fa::fa_object_union } , // object-union
+    { 50391, fa::fa_objects_align_bottom } , // objects-align-bottom
+    { 50412, fa::fa_objects_align_center_horizontal } , // objects-align-center-horizontal
+    { 50444, fa::fa_objects_align_center_vertical } , // objects-align-center-vertical
+    { 50474, fa::fa_objects_align_left } , // objects-align-left
+    { 50493, fa::fa_objects_align_right } , // objects-align-right
+    { 50513, fa::fa_objects_align_top } , // objects-align-top
+    { 50531, fa::fa_objects_column } , // objects-column
+    { 50546, fa::fa_octagon } , // octagon
+    { 50554, fa::fa_octagon_check } , // octagon-check
+    { 50568, fa::fa_octagon_divide } , // octagon-divide
+    { 50583, fa::fa_octagon_exclamation } , // octagon-exclamation
+    { 50603, fa::fa_octagon_minus } , // octagon-minus
+    { 50631, fa::fa_octagon_plus } , // octagon-plus
+    { 50657, fa::fa_octagon_xmark } , // octagon-xmark
+    { 50699, fa::fa_octopus } , // octopus
+    { 50707, fa::fa_oil_can_drip } , // oil-can-drip
+    { 50736, fa::fa_oil_temp } , // oil-temp
+    { 50720, fa::fa_oil_temperature } , // oil-temperature
+    { 50745, fa::fa_olive } , // olive
+    { 50751, fa::fa_olive_branch } , // olive-branch
+    { 50764, fa::fa_omega } , // omega
+    { 50770, fa::fa_onion } , // onion
+    { 50776, fa::fa_option } , // option
+    { 50783, fa::fa_ornament } , // ornament
+    { 50792, fa::fa_outlet } , // outlet
+    { 50799, fa::fa_oven } , // oven
+    { 50804, fa::fa_overline } , // overline
+    { 50813, fa::fa_page } , // page
+    { 42645, fa::fa_page_break } , // page-break
+    { 50818, fa::fa_page_caret_down } , // page-caret-down
+    { 50850, fa::fa_page_caret_up } , // page-caret-up
+    { 50894, fa::fa_paint_brush_alt } , // paint-brush-alt
+    { 50910, fa::fa_paint_brush_fine } , // paint-brush-fine
+    { 50927, fa::fa_paintbrush_alt } , // paintbrush-alt
+    { 50878, fa::fa_paintbrush_fine } , // paintbrush-fine
+    { 50942, fa::fa_paintbrush_pencil } , // paintbrush-pencil
+    { 50984, fa::fa_palette_boxes } , // palette-boxes
+    { 50998, fa::fa_pallet_alt } , // pallet-alt
+    { 50960, fa::fa_pallet_box } , // pallet-box
+    { 50971, fa::fa_pallet_boxes } , // pallet-boxes
+    { 51009, fa::fa_pan_food } , // pan-food
+    { 51018, fa::fa_pan_frying } , // pan-frying
+    { 51029, fa::fa_pancakes } , // pancakes
+    { 51038, fa::fa_panel_ews } , // panel-ews
+    { 51048, fa::fa_panel_fire } , // panel-fire
+    { 51075, fa::fa_paper_plane_alt } , // paper-plane-alt
+    { 51059, fa::fa_paper_plane_top } , // paper-plane-top
+    { 51096, fa::fa_paperclip_vertical } , // paperclip-vertical
+    { 51115, fa::fa_paragraph_left } , // paragraph-left
+    { 51130, fa::fa_paragraph_rtl } , // paragraph-rtl
+    { 33414, fa::fa_parentheses } , // parentheses
+    { 33295, fa::fa_parenthesis } , // parenthesis
+    { 37168, fa::fa_parking_circle } , // parking-circle
+    { 31788, fa::fa_parking_circle_slash } , // parking-circle-slash
+    { 56347, fa::fa_parking_slash } , // parking-slash
+    { 60094, fa::fa_party_back } , // party-back
+    { 51144, fa::fa_party_bell } , // party-bell
+    { 51155, fa::fa_party_horn } , // party-horn
+    { 51187, fa::fa_paw_alt } , // paw-alt
+    { 51166, fa::fa_paw_claws } , // paw-claws
+    { 51176, fa::fa_paw_simple } , // paw-simple
+    { 51195, fa::fa_peach } , // peach
+    { 51201, fa::fa_peanut } , // peanut
+    { 51208, fa::fa_peanuts } , // peanuts
+    { 51216, fa::fa_peapod } , // peapod
+    { 51223, fa::fa_pear } , // pear
+    { 51228, fa::fa_pedestal } , // pedestal
+    { 51237, fa::fa_pegasus } , // pegasus
+    { 51271, fa::fa_pen_alt_slash } , // pen-alt-slash
+    { 51245, fa::fa_pen_circle } , // pen-circle
+    { 51256, fa::fa_pen_clip_slash } , // pen-clip-slash
+    { 51285, fa::fa_pen_fancy_slash } , // pen-fancy-slash
+    { 51301, fa::fa_pen_field } , // pen-field
+    { 51311, fa::fa_pen_line } , // pen-line
+    { 51320, fa::fa_pen_nib_slash } , // pen-nib-slash
+    { 51334, fa::fa_pen_paintbrush } , // pen-paintbrush
+    { 51367, fa::fa_pen_slash } , // pen-slash
+    { 51377, fa::fa_pen_swirl } , // pen-swirl
+    { 51387, fa::fa_pencil_mechanical } , // pencil-mechanical
+    { 51349, fa::fa_pencil_paintbrush } , // pencil-paintbrush
+    { 51405, fa::fa_pencil_slash } , // pencil-slash
+    { 43184, fa::fa_pennant } , // pennant
+    { 51418, fa::fa_people } , // people
+    { 51425, fa::fa_people_dress } , // people-dress
+    { 51438, fa::fa_people_dress_simple } , // people-dress-simple
+    { 51458, fa::fa_people_pants } , // people-pants
+    { 51471, fa::fa_people_pants_simple } , // people-pants-simple
+    { 51491, fa::fa_people_simple } , // people-simple
+    { 51505, fa::fa_pepper } , // pepper
+    { 51512, fa::fa_period } , // period
+    { 51519, fa::fa_person_biking_mountain } , // person-biking-mountain
+    { 51575, fa::fa_person_carry } , // person-carry
+    { 51558, fa::fa_person_carry_box } , // person-carry-box
+    { 51588, fa::fa_person_dolly } , // person-dolly
+    { 51601, fa::fa_person_dolly_empty } , // person-dolly-empty
+    { 51620, fa::fa_person_dress_fairy } , // person-dress-fairy
+    { 51639, fa::fa_person_dress_simple } , // person-dress-simple
+    { 51659, fa::fa_person_fairy } , // person-fairy
+    { 51672, fa::fa_person_from_portal } , // person-from-portal
+    { 51703, fa::fa_person_pinball } , // person-pinball
+    { 51718, fa::fa_person_running_fast } , // person-running-fast
+    { 51738, fa::fa_person_seat } , // person-seat
+    { 51750, fa::fa_person_seat_reclined } , // person-seat-reclined
+    { 51771, fa::fa_person_sign } , // person-sign
+    { 51783, fa::fa_person_simple } , // person-simple
+    { 51797, fa::fa_person_ski_jumping } , // person-ski-jumping
+    { 51825, fa::fa_person_ski_lift } , // person-ski-lift
+    { 51850, fa::fa_person_sledding } , // person-sledding
+    { 51875, fa::fa_person_snowmobiling } , // person-snowmobiling
+    { 51906, fa::fa_person_to_door } , // person-to-door
+    { 51921, fa::fa_person_to_portal } , // person-to-portal
+    { 51973, fa::fa_phone_arrow_down } , // phone-arrow-down
+    { 51951, fa::fa_phone_arrow_down_left } , // phone-arrow-down-left
+    { 52005, fa::fa_phone_arrow_right } , // phone-arrow-right
+    { 52044, fa::fa_phone_arrow_up } , // phone-arrow-up
+    { 52023, fa::fa_phone_arrow_up_right } , // phone-arrow-up-right
+    { 37196, fa::fa_phone_circle } , // phone-circle
+    { 37227, fa::fa_phone_circle_alt } , // phone-circle-alt
+    { 37264, fa::fa_phone_circle_down } , // phone-circle-down
+    { 52074, fa::fa_phone_hangup } , // phone-hangup
+    { 51990, fa::fa_phone_incoming } , // phone-incoming
+    { 52087, fa::fa_phone_intercom } , // phone-intercom
+    { 47044, fa::fa_phone_laptop } , // phone-laptop
+    { 52102, fa::fa_phone_missed } , // phone-missed
+    { 52115, fa::fa_phone_office } , // phone-office
+    { 52059, fa::fa_phone_outgoing } , // phone-outgoing
+    { 52128, fa::fa_phone_plus } , // phone-plus
+    { 52139, fa::fa_phone_rotary } , // phone-rotary
+    { 56381, fa::fa_phone_square_down } , // phone-square-down
+    { 52152, fa::fa_phone_xmark } , // phone-xmark
+    { 52164, fa::fa_photo_film_music } , // photo-film-music
+    { 52181, fa::fa_pi } , // pi
+    { 52184, fa::fa_piano } , // piano
+    { 52190, fa::fa_piano_keyboard } , // piano-keyboard
+    { 52205, fa::fa_pickaxe } , // pickaxe
+    { 52213, fa::fa_pickleball } , // pickleball
+    { 52224, fa::fa_pie } , // pie
+    { 52228, fa::fa_pig } , // pig
+    { 52232, fa::fa_pinata } , // pinata
+    { 52239, fa::fa_pinball } , // pinball
+    { 52247, fa::fa_pineapple } , // pineapple
+    { 52257, fa::fa_pipe } , // pipe
+    { 52262, fa::fa_pipe_circle_check } , // pipe-circle-check
+    { 52280, fa::fa_pipe_collar } , // pipe-collar
+    { 52292, fa::fa_pipe_section } , // pipe-section
+    { 52305, fa::fa_pipe_smoking } , // pipe-smoking
+    { 52318, fa::fa_pipe_valve } , // pipe-valve
+    { 52329, fa::fa_pizza } , // pizza
+    { 52349, fa::fa_plane_alt } , // plane-alt
+    { 52335, fa::fa_plane_engines } , // plane-engines
+    { 52359, fa::fa_plane_prop } , // plane-prop
+    { 52370, fa::fa_plane_tail } , // plane-tail
+    { 52381, fa::fa_plane_up_slash } , // plane-up-slash
+    { 52396, fa::fa_planet_moon } , // planet-moon
+    { 52408, fa::fa_planet_ringed } , // planet-ringed
+    { 52422, fa::fa_plate_utensils } , // plate-utensils
+    { 52437, fa::fa_play_pause } , // play-pause
+    { 45741, fa::fa_plus_hexagon } , // plus-hexagon
+    { 52448, fa::fa_plus_large } , // plus-large
+    { 50644, fa::fa_plus_octagon } , // plus-octagon
+    { 52459, fa::fa_podium } , // podium
+    { 52466, fa::fa_podium_star } , // podium-star
+    { 52478, fa::fa_police_box } , // police-box
+    { 52489, fa::fa_poll_people } , // poll-people
+    { 52501, fa::fa_pompebled } , // pompebled
+    { 52511, fa::fa_pool_8_ball } , // pool-8-ball
+    { 52523, fa::fa_popcorn } , // popcorn
+    { 52531, fa::fa_popsicle } , // popsicle
+    { 51938, fa::fa_portal_enter } , // portal-enter
+    { 51691, fa::fa_portal_exit } , // portal-exit
+    { 52540, fa::fa_pot_food } , // pot-food
+    { 52549, fa::fa_potato } , // potato
+    { 52556, fa::fa_prescription_bottle_pill } , // prescription-bottle-pill
+    { 52601, fa::fa_presentation } , // presentation
+    { 52581, fa::fa_presentation_screen } , // presentation-screen
+    { 52614, fa::fa_pretzel } , // pretzel
+    { 52622, fa::fa_print_magnifying_glass } , // print-magnifying-glass
+    { 52645, fa::fa_print_search } , // print-search
+    { 52658, fa::fa_print_slash } , // print-slash
+    { 53023, fa::fa_pro } , // pro
+    { 52670, fa::fa_projector } , // projector
+    { 37837, fa::fa_pronoun } , // pronoun
+    { 52680, fa::fa_pump } , // pump
+    { 52685, fa::fa_pumpkin } , // pumpkin
+    { 52693, fa::fa_puzzle } , // puzzle
+    { 52720, fa::fa_puzzle_piece_alt } , // puzzle-piece-alt
+    { 52700, fa::fa_puzzle_piece_simple } , // puzzle-piece-simple
+    { 56440, fa::fa_question_square } , // question-square
+    { 52737, fa::fa_quotes } , // quotes
+    { 52744, fa::fa_rabbit } , // rabbit
+    { 52766, fa::fa_rabbit_fast } , // rabbit-fast
+    { 52751, fa::fa_rabbit_running } , // rabbit-running
+    { 52778, fa::fa_raccoon } , // raccoon
+    { 52786, fa::fa_racquet } , // racquet
+    { 52794, fa::fa_radar } , // radar
+    { 52812, fa::fa_radio_alt } , // radio-alt
+    { 52800, fa::fa_radio_tuner } , // radio-tuner
+    { 52822, fa::fa_raindrops } , // raindrops
+    { 52832, fa::fa_ram } , // ram
+    { 52836, fa::fa_ramp_loading } , // ramp-loading
+    { 52849, fa::fa_raygun } , // raygun
+    { 52856, fa::fa_rectangle } , // rectangle
+    { 52886, fa::fa_rectangle_barcode } , // rectangle-barcode
+    { 52916, fa::fa_rectangle_code } , // rectangle-code
+    { 45862, fa::fa_rectangle_hd } , // rectangle-hd
+    { 52931, fa::fa_rectangle_history } , // rectangle-history
+    { 52949, fa::fa_rectangle_history_circle_plus } , // rectangle-history-circle-plus
+    { 52979, fa::fa_rectangle_history_circle_user } , // rectangle-history-circle-user
+    { 52866, fa::fa_rectangle_landscape } , // rectangle-landscape
+    { 53065, fa::fa_rectangle_portrait } , // rectangle-portrait
+    { 53009, fa::fa_rectangle_pro } , // rectangle-pro
+    { 56848, fa::fa_rectangle_sd } , // rectangle-sd
+    { 53027, fa::fa_rectangle_terminal } , // rectangle-terminal
+    { 53046, fa::fa_rectangle_vertical } , // rectangle-vertical
+    { 53084, fa::fa_rectangle_vertical_history } , // rectangle-vertical-history
+    { 53111, fa::fa_rectangle_wide } , // rectangle-wide
+    { 53126, fa::fa_rectangles_mixed } , // rectangles-mixed
+    { 53143, fa::fa_reel } , // reel
+    { 53148, fa::fa_reflect_both } , // reflect-both
+    { 53161, fa::fa_reflect_horizontal } , // reflect-horizontal
+    { 53180, fa::fa_reflect_vertical } , // reflect-vertical
+    { 53197, fa::fa_refrigerator } , // refrigerator
+    { 53210, fa::fa_repeat_1 } , // repeat-1
+    { 31365, fa::fa_repeat_1_alt } , // repeat-1-alt
+    { 31338, fa::fa_repeat_alt } , // repeat-alt
+    { 53219, fa::fa_reply_clock } , // reply-clock
+    { 53231, fa::fa_reply_time } , // reply-time
+    { 53242, fa::fa_restroom_simple } , // restroom-simple
+    { 31393, fa::fa_retweet_alt } , // retweet-alt
+    { 53258, fa::fa_rhombus } , // rhombus
+    { 53266, fa::fa_right } , // right
+    { 53288, fa::fa_right_from_line } , // right-from-line
+    { 53324, fa::fa_right_left_large } , // right-left-large
+    { 53341, fa::fa_right_long_to_line } , // right-long-to-line
+    { 53360, fa::fa_right_to_line } , // right-to-line
+    { 53393, fa::fa_ring_diamond } , // ring-diamond
+    { 53406, fa::fa_rings_wedding } , // rings-wedding
+    { 53420, fa::fa_robot_astromech } , // robot-astromech
+    { 53436, fa::fa_rocket_launch } , // rocket-launch
+    { 53450, fa::fa_roller_coaster } , // roller-coaster
+    { 53465, fa::fa_rotate_exclamation } , // rotate-exclamation
+    { 53484, fa::fa_rotate_reverse } , // rotate-reverse
+    { 53499, fa::fa_route_highway } , // route-highway
+    { 53513, fa::fa_route_interstate } , // route-interstate
+    { 53530, fa::fa_router } , // router
+    { 57548, fa::fa_rows } , // rows
+    { 53537, fa::fa_rugby_ball } , // rugby-ball
+    { 53548, fa::fa_ruler_triangle } , // ruler-triangle
+    { 53563, fa::fa_rv } , // rv
+    { 53566, fa::fa_sack } , // sack
+    { 53571, fa::fa_salad } , // salad
+    { 53588, fa::fa_salt_shaker } , // salt-shaker
+    { 53600, fa::fa_sandwich } , // sandwich
+    { 53609, fa::fa_sausage } , // sausage
+    { 43363, fa::fa_save_circle_arrow_right } , // save-circle-arrow-right
+    { 43430, fa::fa_save_circle_xmark } , // save-circle-xmark
+    { 43448, fa::fa_save_times } , // save-times
+    { 53642, fa::fa_sax_hot } , // sax-hot
+    { 53617, fa::fa_saxophone } , // saxophone
+    { 53627, fa::fa_saxophone_fire } , // saxophone-fire
+    { 53650, fa::fa_scalpel } , // scalpel
+    { 53658, fa::fa_scalpel_line_dashed } , // scalpel-line-dashed
+    { 53678, fa::fa_scalpel_path } , // scalpel-path
+    { 53703, fa::fa_scanner } , // scanner
+    { 53691, fa::fa_scanner_gun } , // scanner-gun
+    { 53711, fa::fa_scanner_image } , // scanner-image
+    { 53725, fa::fa_scanner_keyboard } , // scanner-keyboard
+    { 53742, fa::fa_scanner_touchscreen } , // scanner-touchscreen
+    { 53762, fa::fa_scarecrow } , // scarecrow
+    { 53772, fa::fa_scarf } , // scarf
+    { 53778, fa::fa_screen_users } , // screen-users
+    { 53803, fa::fa_screencast } , // screencast
+    { 34500, fa::fa_screenshot } , // screenshot
+    { 53814, fa::fa_scribble } , // scribble
+    { 53823, fa::fa_scroll_old } , // scroll-old
+    { 40194, fa::fa_scroll_ribbon } , // scroll-ribbon
+    { 53834, fa::fa_scrubber } , // scrubber
+    { 53843, fa::fa_scythe } , // scythe
+    { 53850, fa::fa_sd_cards } , // sd-cards
+    { 53859, fa::fa_seal } , // seal
+    { 53864, fa::fa_seal_exclamation } , // seal-exclamation
+    { 53881, fa::fa_seal_question } , // seal-question
+    { 53895, fa::fa_seat_airline } , // seat-airline
+    { 53908, fa::fa_semicolon } , // semicolon
+    { 51091, fa::fa_send } , // send
+    { 53918, fa::fa_send_back } , // send-back
+    { 53928, fa::fa_send_backward } , // send-backward
+    { 53942, fa::fa_sensor } , // sensor
+    { 54025, fa::fa_sensor_alert } , // sensor-alert
+    { 53949, fa::fa_sensor_cloud } , // sensor-cloud
+    { 53975, fa::fa_sensor_fire } , // sensor-fire
+    { 53987, fa::fa_sensor_on } , // sensor-on
+    { 53962, fa::fa_sensor_smoke } , // sensor-smoke
+    { 53997, fa::fa_sensor_triangle_exclamation } , // sensor-triangle-exclamation
+    { 54038, fa::fa_share_all } , // share-all
+    { 54048, fa::fa_sheep } , // sheep
+    { 54054, fa::fa_shelves } , // shelves
+    { 54072, fa::fa_shelves_empty } , // shelves-empty
+    { 54086, fa::fa_shield_check } , // shield-check
+    { 54099, fa::fa_shield_cross } , // shield-cross
+    { 54112, fa::fa_shield_exclamation } , // shield-exclamation
+    { 54131, fa::fa_shield_keyhole } , // shield-keyhole
+    { 54146, fa::fa_shield_minus } , // shield-minus
+    { 54159, fa::fa_shield_plus } , // shield-plus
+    { 54171, fa::fa_shield_quartered } , // shield-quartered
+    { 54188, fa::fa_shield_slash } , // shield-slash
+    { 54214, fa::fa_shield_times } , // shield-times
+    { 54201, fa::fa_shield_xmark } , // shield-xmark
+    { 59226, fa::fa_shipping_timed } , // shipping-timed
+    { 54227, fa::fa_shirt_long_sleeve } , // shirt-long-sleeve
+    { 54245, fa::fa_shirt_running } , // shirt-running
+    { 54259, fa::fa_shirt_tank_top } , // shirt-tank-top
+    { 54274, fa::fa_shish_kebab } , // shish-kebab
+    { 31936, fa::fa_shopping_basket_alt } , // shopping-basket-alt
+    { 33954, fa::fa_shortcake } , // shortcake
+    { 54286, fa::fa_shovel } , // shovel
+    { 54293, fa::fa_shovel_snow } , // shovel-snow
+    { 54317, fa::fa_shower_alt } , // shower-alt
+    { 54305, fa::fa_shower_down } , // shower-down
+    { 54328, fa::fa_shredder } , // shredder
+    { 54337, fa::fa_shutters } , // shutters
+    { 54346, fa::fa_shuttlecock } , // shuttlecock
+    { 54358, fa::fa_sickle } , // sickle
+    { 54365, fa::fa_sidebar } , // sidebar
+    { 54373, fa::fa_sidebar_flip } , // sidebar-flip
+    { 54386, fa::fa_sigma } , // sigma
+    { 54392, fa::fa_sign_post } , // sign-post
+    { 54402, fa::fa_sign_posts } , // sign-posts
+    { 54413, fa::fa_sign_posts_wrench } , // sign-posts-wrench
+    { 54735, fa::fa_signal_1 } , // signal-1
+    { 54623, fa::fa_signal_2 } , // signal-2
+    { 54644, fa::fa_signal_3 } , // signal-3
+    { 54714, fa::fa_signal_4 } , // signal-4
+    { 54443, fa::fa_signal_alt } , // signal-alt
+    { 54598, fa::fa_signal_alt_1 } , // signal-alt-1
+    { 54503, fa::fa_signal_alt_2 } , // signal-alt-2
+    { 54533, fa::fa_signal_alt_3 } , // signal-alt-3
+    { 54454, fa::fa_signal_alt_4 } , // signal-alt-4
+    { 54564, fa::fa_signal_alt_slash } , // signal-alt-slash
+    { 54431, fa::fa_signal_bars } , // signal-bars
+    { 54486, fa::fa_signal_bars_fair } , // signal-bars-fair
+    { 54516, fa::fa_signal_bars_good } , // signal-bars-good
+    { 54546, fa::fa_signal_bars_slash } , // signal-bars-slash
+    { 54467, fa::fa_signal_bars_strong } , // signal-bars-strong
+    { 54581, fa::fa_signal_bars_weak } , // signal-bars-weak
+    { 54611, fa::fa_signal_fair } , // signal-fair
+    { 54632, fa::fa_signal_good } , // signal-good
+    { 54653, fa::fa_signal_slash } , // signal-slash
+    { 54666, fa::fa_signal_stream } , // signal-stream
+    { 54680, fa::fa_signal_stream_slash } , // signal-stream-slash
+    { 54700, fa::fa_signal_strong } , // signal-strong
+    { 54723, fa::fa_signal_weak } , // signal-weak
+    { 54744, fa::fa_signature_lock } , // signature-lock
+    { 54759, fa::fa_signature_slash } , // signature-slash
+    { 54775, fa::fa_sim_cards } , // sim-cards
+    { 54785, fa::fa_siren } , // siren
+    { 54791, fa::fa_siren_on } , // siren-on
+    { 54800, fa::fa_skeleton } , // skeleton
+    { 54809, fa::fa_skeleton_ribs } , // skeleton-ribs
+    { 54823, fa::fa_ski_boot } , // ski-boot
+    { 54832, fa::fa_ski_boot_ski } , // ski-boot-ski
+    { 51816, fa::fa_ski_jump } , // ski-jump
+    { 51841, fa::fa_ski_lift } , // ski-lift
+    { 54845, fa::fa_skull_cow } , // skull-cow
+    { 54855, fa::fa_slash_back } , // slash-back
+    { 54866, fa::fa_slash_forward } , // slash-forward
+    { 51866, fa::fa_sledding } , // sledding
+    { 54880, fa::fa_slider } , // slider
+    { 56562, fa::fa_sliders_h_square } , // sliders-h-square
+    { 54887, fa::fa_sliders_simple } , // sliders-simple
+    { 54902, fa::fa_sliders_up } , // sliders-up
+    { 54913, fa::fa_sliders_v } , // sliders-v
+    { 56603, fa::fa_sliders_v_square } , // sliders-v-square
+    { 54923, fa::fa_slot_machine } , // slot-machine
+    { 42039, fa::fa_smile_plus } , // smile-plus
+    { 54936, fa::fa_smoke } , // smoke
+    { 54942, fa::fa_snake } , // snake
+    { 54948, fa::fa_snooze } , // snooze
+    { 54959, fa::fa_snow_blowing } , // snow-blowing
+    { 54972, fa::fa_snowflake_droplets } , // snowflake-droplets
+    { 54991, fa::fa_snowflakes } , // snowflakes
+    { 55002, fa::fa_snowman_head } , // snowman-head
+    { 51895, fa::fa_snowmobile } , // snowmobile
+    { 55027, fa::fa_soft_serve } , // soft-serve
+    { 55046, fa::fa_solar_system } , // solar-system
+    { 29796, fa::fa_sort_alt } , // sort-alt
+    { 37387, fa::fa_sort_circle } , // sort-circle
+    { 37416, fa::fa_sort_circle_down } , // sort-circle-down
+    { 37448, fa::fa_sort_circle_up } , // sort-circle-up
+    { 30264, fa::fa_sort_shapes_down } , // sort-shapes-down
+    { 30094, fa::fa_sort_shapes_down_alt } , // sort-shapes-down-alt
+    { 31193, fa::fa_sort_shapes_up } , // sort-shapes-up
+    { 31059, fa::fa_sort_shapes_up_alt } , // sort-shapes-up-alt
+    { 29826, fa::fa_sort_size_down } , // sort-size-down
+    { 30048, fa::fa_sort_size_down_alt } , // sort-size-down-alt
+    { 30781, fa::fa_sort_size_up } , // sort-size-up
+    { 31017, fa::fa_sort_size_up_alt } , // sort-size-up-alt
+    { 30749, fa::fa_sort_up_down } , // sort-up-down
+    { 32993, fa::fa_soup } , // soup
+    { 55059, fa::fa_space_station_moon } , // space-station-moon
+    { 55110, fa::fa_space_station_moon_alt } , // space-station-moon-alt
+    { 55078, fa::fa_space_station_moon_construction } , // space-station-moon-construction
+    { 55133, fa::fa_spade } , // spade
+    { 55139, fa::fa_sparkle } , // sparkle
+    { 55147, fa::fa_sparkles } , // sparkles
+    { 55156, fa::fa_speaker } , // speaker
+    { 55164, fa::fa_speakers } , // speakers
+    { 55173, fa::fa_spider_black_widow } , // spider-black-widow
+    { 55192, fa::fa_spider_web } , // spider-web
+    { 55203, fa::fa_spinner_scale } , // spinner-scale
+    { 55217, fa::fa_spinner_third } , // spinner-third
+    { 55231, fa::fa_split } , // split
+    { 55237, fa::fa_sportsball } , // sportsball
+    { 55248, fa::fa_sprinkler } , // sprinkler
+    { 55258, fa::fa_sprinkler_ceiling } , // sprinkler-ceiling
+    { 55276, fa::fa_square_0 } , // square-0
+    { 55285, fa::fa_square_1 } , // square-1
+    { 55294, fa::fa_square_2 } , // square-2
+    { 55303, fa::fa_square_3 } , // square-3
+    { 55312, fa::fa_square_4 } , // square-4
+    { 55321, fa::fa_square_5 } , // square-5
+    { 55330, fa::fa_square_6 } , // square-6
+    { 55339, fa::fa_square_7 } , // square-7
+    { 55348, fa::fa_square_8 } , // square-8
+    { 55357, fa::fa_square_9 } , // square-9
+    { 55366, fa::fa_square_a } , // square-a
+    { 55375, fa::fa_square_a_lock } , // square-a-lock
+    { 55389, fa::fa_square_ampersand } , // square-ampersand
+    { 55406, fa::fa_square_arrow_down } , // square-arrow-down
+    { 55442, fa::fa_square_arrow_down_left } , // square-arrow-down-left
+    { 55465, fa::fa_square_arrow_down_right } , // square-arrow-down-right
+    { 55489, fa::fa_square_arrow_left } , // square-arrow-left
+    { 55525, fa::fa_square_arrow_right } , // square-arrow-right
+    { 55563, fa::fa_square_arrow_up } , // square-arrow-up
+    { 55595, fa::fa_square_arrow_up_left } , // square-arrow-up-left
+    { 55616, fa::fa_square_b } , // square-b
+    { 55625, fa::fa_square_bolt } , // square-bolt
+    { 55637, fa::fa_square_c } , // square-c
+    { 55646, fa::fa_square_chevron_down } , // square-chevron-down
+    { 55686, fa::fa_square_chevron_left } , // square-chevron-left
+    { 55726, fa::fa_square_chevron_right } , // square-chevron-right
+    { 55768, fa::fa_square_chevron_up } , // square-chevron-up
+    { 55804, fa::fa_square_code } , // square-code
+    { 55816, fa::fa_square_d } , // square-d
+    { 55825, fa::fa_square_dashed } , // square-dashed
+    { 55839, fa::fa_square_dashed_circle_plus } , // square-dashed-circle-plus
+    { 55865, fa::fa_square_divide } , // square-divide
+    { 55879, fa::fa_square_dollar } , // square-dollar
+    { 55918, fa::fa_square_down } , // square-down
+    { 55952, fa::fa_square_down_left } , // square-down-left
+    { 55969, fa::fa_square_down_right } , // square-down-right
+    { 55987, fa::fa_square_e } , // square-e
+    { 55996, fa::fa_square_ellipsis } , // square-ellipsis
+    { 56012, fa::fa_square_ellipsis_vertical } , // square-ellipsis-vertical
+    { 56037, fa::fa_square_exclamation } , // square-exclamation
+    { 56075, fa::fa_square_f } , // square-f
+    { 56084, fa::fa_square_fragile } , // square-fragile
+    { 56135, fa::fa_square_g } , // square-g
+    { 56144, fa::fa_square_heart } , // square-heart
+    { 56170, fa::fa_square_i } , // square-i
+    { 56179, fa::fa_square_info } , // square-info
+    { 56203, fa::fa_square_j } , // square-j
+    { 56212, fa::fa_square_k } , // square-k
+    { 56221, fa::fa_square_kanban } , // square-kanban
+    { 56235, fa::fa_square_l } , // square-l
+    { 56244, fa::fa_square_left } , // square-left
+    { 56278, fa::fa_square_list } , // square-list
+    { 56290, fa::fa_square_m } , // square-m
+    { 56299, fa::fa_square_n } , // square-n
+    { 56308, fa::fa_square_o } , // square-o
+    { 56317, fa::fa_square_p } , // square-p
+    { 56326, fa::fa_square_parking_slash } , // square-parking-slash
+    { 56361, fa::fa_square_phone_hangup } , // square-phone-hangup
+    { 56399, fa::fa_square_q } , // square-q
+    { 56408, fa::fa_square_quarters } , // square-quarters
+    { 56424, fa::fa_square_question } , // square-question
+    { 56456, fa::fa_square_quote } , // square-quote
+    { 56469, fa::fa_square_r } , // square-r
+    { 56478, fa::fa_square_right } , // square-right
+    { 56514, fa::fa_square_ring } , // square-ring
+    { 56526, fa::fa_square_root } , // square-root
+    { 56538, fa::fa_square_s } , // square-s
+    { 56547, fa::fa_square_sliders } , // square-sliders
+    { 56579, fa::fa_square_sliders_vertical } , // square-sliders-vertical
+    { 56620, fa::fa_square_small } , // square-small
+    { 56633, fa::fa_square_star } , // square-star
+    { 56645, fa::fa_square_t } , // square-t
+    { 56654, fa::fa_square_terminal } , // square-terminal
+    { 56670, fa::fa_square_this_way_up } , // square-this-way-up
+    { 56696, fa::fa_square_u } , // square-u
+    { 56705, fa::fa_square_up } , // square-up
+    { 56735, fa::fa_square_up_left } , // square-up-left
+    { 56750, fa::fa_square_user } , // square-user
+    { 56762, fa::fa_square_v } , // square-v
+    { 56771, fa::fa_square_w } , // square-w
+    { 56111, fa::fa_square_wine_glass_crack } , // square-wine-glass-crack
+    { 56780, fa::fa_square_x } , // square-x
+    { 56789, fa::fa_square_y } , // square-y
+    { 56798, fa::fa_square_z } , // square-z
+    { 56807, fa::fa_squid } , // squid
+    { 56813, fa::fa_squirrel } , // squirrel
+    { 56822, fa::fa_staff } , // staff
+    { 56828, fa::fa_standard_definition } , // standard-definition
+    { 56861, fa::fa_star_christmas } , // star-christmas
+    { 37475, fa::fa_star_circle } , // star-circle
+    { 56876, fa::fa_star_exclamation } , // star-exclamation
+    { 56893, fa::fa_star_sharp } , // star-sharp
+    { 56904, fa::fa_star_sharp_half } , // star-sharp-half
+    { 56943, fa::fa_star_sharp_half_alt } , // star-sharp-half-alt
+    { 56920, fa::fa_star_sharp_half_stroke } , // star-sharp-half-stroke
+    { 56963, fa::fa_star_shooting } , // star-shooting
+    { 56977, fa::fa_starfighter } , // starfighter
+    { 57017, fa::fa_starfighter_alt } , // starfighter-alt
+    { 57070, fa::fa_starfighter_alt_advanced } , // starfighter-alt-advanced
+    { 56989, fa::fa_starfighter_twin_ion_engine } , // starfighter-twin-ion-engine
+    { 57033, fa::fa_starfighter_twin_ion_engine_advanced } , // starfighter-twin-ion-engine-advanced
+    { 57095, fa::fa_stars } , // stars
+    { 57101, fa::fa_starship } , // starship
+    { 57110, fa::fa_starship_freighter } , // starship-freighter
+    { 57129, fa::fa_steak } , // steak
+    { 57135, fa::fa_steering_wheel } , // steering-wheel
+    { 57150, fa::fa_stocking } , // stocking
+    { 57159, fa::fa_stomach } , // stomach
+    { 57167, fa::fa_store_lock } , // store-lock
+    { 57178, fa::fa_strawberry } , // strawberry
+    { 57189, fa::fa_stretcher } , // stretcher
+    { 57199, fa::fa_subtitles } , // subtitles
+    { 57209, fa::fa_subtitles_slash } , // subtitles-slash
+    { 58517, fa::fa_subway_tunnel } , // subway-tunnel
+    { 57236, fa::fa_sun_alt } , // sun-alt
+    { 57225, fa::fa_sun_bright } , // sun-bright
+    { 57244, fa::fa_sun_cloud } , // sun-cloud
+    { 57254, fa::fa_sun_dust } , // sun-dust
+    { 57263, fa::fa_sun_haze } , // sun-haze
+    { 57272, fa::fa_sunglasses } , // sunglasses
+    { 57283, fa::fa_sunrise } , // sunrise
+    { 57291, fa::fa_sunset } , // sunset
+    { 57298, fa::fa_sushi } , // sushi
+    { 57311, fa::fa_sushi_roll } , // sushi-roll
+    { 57342, fa::fa_swap } , // swap
+    { 57347, fa::fa_swap_arrows } , // swap-arrows
+    { 57359, fa::fa_sword } , // sword
+    { 57365, fa::fa_sword_laser } , // sword-laser
+    { 57377, fa::fa_sword_laser_alt } , // sword-laser-alt
+    { 57393, fa::fa_swords } , // swords
+    { 57400, fa::fa_swords_laser } , // swords-laser
+    { 57413, fa::fa_symbols } , // symbols
+    { 57431, fa::fa_t_rex } , // t-rex
+    { 57437, fa::fa_table_cells_column_unlock } , // table-cells-column-unlock
+    { 57463, fa::fa_table_cells_lock } , // table-cells-lock
+    { 57480, fa::fa_table_cells_unlock } , // table-cells-unlock
+    { 57499, fa::fa_table_layout } , // table-layout
+    { 57512, fa::fa_table_picnic } , // table-picnic
+    { 57525, fa::fa_table_pivot } , // table-pivot
+    { 57537, fa::fa_table_rows } , // table-rows
+    { 57553, fa::fa_table_tree } , // table-tree
+    { 57592, fa::fa_tablet_android_alt } , // tablet-android-alt
+    { 57564, fa::fa_tablet_rugged } , // tablet-rugged
+    { 57578, fa::fa_tablet_screen } , // tablet-screen
+    { 44238, fa::fa_tachometer_alt_fastest } , // tachometer-alt-fastest
+    { 44208, fa::fa_tachometer_alt_slow } , // tachometer-alt-slow
+    { 44271, fa::fa_tachometer_alt_slowest } , // tachometer-alt-slowest
+    { 44344, fa::fa_tachometer_fastest } , // tachometer-fastest
+    { 44311, fa::fa_tachometer_slow } , // tachometer-slow
+    { 44380, fa::fa_tachometer_slowest } , // tachometer-slowest
+    { 57611, fa::fa_taco } , // taco
+    { 57616, fa::fa_tally } , // tally
+    { 57630, fa::fa_tally_1 } , // tally-1
+    { 57638, fa::fa_tally_2 } , // tally-2
+    { 57646, fa::fa_tally_3 } , // tally-3
+    { 57654, fa::fa_tally_4 } , // tally-4
+    { 57622, fa::fa_tally_5 } , // tally-5
+    { 57662, fa::fa_tamale } , // tamale
+    { 57669, fa::fa_tank_water } , // tank-water
+    { 57680, fa::fa_taxi_bus } , // taxi-bus
+    { 57689, fa::fa_teddy_bear } , // teddy-bear
+    { 57700, fa::fa_telescope } , // telescope
+    { 59412, fa::fa_teletype_answer } , // teletype-answer
+    { 57744, fa::fa_temperature_frigid } , // temperature-frigid
+    { 57779, fa::fa_temperature_hot } , // temperature-hot
+    { 57710, fa::fa_temperature_list } , // temperature-list
+    { 57727, fa::fa_temperature_snow } , // temperature-snow
+    { 57763, fa::fa_temperature_sun } , // temperature-sun
+    { 57795, fa::fa_tennis_ball } , // tennis-ball
+    { 57807, fa::fa_tent_double_peak } , // tent-double-peak
+    { 57824, fa::fa_text } , // text
+    { 57829, fa::fa_text_size } , // text-size
+    { 57839, fa::fa_theta } , // theta
+    { 57845, fa::fa_thought_bubble } , // thought-bubble
+    { 38387, fa::fa_thunderstorm_moon } , // thunderstorm-moon
+    { 38420, fa::fa_thunderstorm_sun } , // thunderstorm-sun
+    { 57860, fa::fa_tick } , // tick
+    { 57865, fa::fa_ticket_airline } , // ticket-airline
+    { 57917, fa::fa_ticket_perforated } , // ticket-perforated
+    { 57880, fa::fa_ticket_perforated_plane } , // ticket-perforated-plane
+    { 57904, fa::fa_ticket_plane } , // ticket-plane
+    { 57935, fa::fa_tickets } , // tickets
+    { 57943, fa::fa_tickets_airline } , // tickets-airline
+    { 57998, fa::fa_tickets_perforated } , // tickets-perforated
+    { 57959, fa::fa_tickets_perforated_plane } , // tickets-perforated-plane
+    { 57984, fa::fa_tickets_plane } , // tickets-plane
+    { 58017, fa::fa_tickets_simple } , // tickets-simple
+    { 58032, fa::fa_tilde } , // tilde
+    { 58038, fa::fa_timeline_arrow } , // timeline-arrow
+    { 58053, fa::fa_timer } , // timer
+    { 45818, fa::fa_times_hexagon } , // times-hexagon
+    { 50671, fa::fa_times_octagon } , // times-octagon
+    { 61381, fa::fa_times_to_slot } , // times-to-slot
+    { 58059, fa::fa_tire } , // tire
+    { 58064, fa::fa_tire_flat } , // tire-flat
+    { 58074, fa::fa_tire_pressure_warning } , // tire-pressure-warning
+    { 58096, fa::fa_tire_rugged } , // tire-rugged
+    { 58108, fa::fa_toggle_large_off } , // toggle-large-off
+    { 58125, fa::fa_toggle_large_on } , // toggle-large-on
+    { 58160, fa::fa_toilet_paper_alt } , // toilet-paper-alt
+    { 58141, fa::fa_toilet_paper_blank } , // toilet-paper-blank
+    { 58177, fa::fa_toilet_paper_blank_under } , // toilet-paper-blank-under
+    { 58227, fa::fa_toilet_paper_check } , // toilet-paper-check
+    { 58265, fa::fa_toilet_paper_reverse } , // toilet-paper-reverse
+    { 58202, fa::fa_toilet_paper_reverse_alt } , // toilet-paper-reverse-alt
+    { 58311, fa::fa_toilet_paper_reverse_slash } , // toilet-paper-reverse-slash
+    { 58246, fa::fa_toilet_paper_under } , // toilet-paper-under
+    { 58286, fa::fa_toilet_paper_under_slash } , // toilet-paper-under-slash
+    { 58338, fa::fa_toilet_paper_xmark } , // toilet-paper-xmark
+    { 58357, fa::fa_tomato } , // tomato
+    { 58364, fa::fa_tombstone } , // tombstone
+    { 58390, fa::fa_tombstone_alt } , // tombstone-alt
+    { 58374, fa::fa_tombstone_blank } , // tombstone-blank
+    { 58404, fa::fa_toothbrush } , // toothbrush
+    { 58415, fa::fa_tower_control } , // tower-control
+    { 58429, fa::fa_traffic_cone } , // traffic-cone
+    { 58442, fa::fa_traffic_light_go } , // traffic-light-go
+    { 58459, fa::fa_traffic_light_slow } , // traffic-light-slow
+    { 58478, fa::fa_traffic_light_stop } , // traffic-light-stop
+    { 58497, fa::fa_train_subway_tunnel } , // train-subway-tunnel
+    { 58531, fa::fa_train_track } , // train-track
+    { 58543, fa::fa_train_tunnel } , // train-tunnel
+    { 58556, fa::fa_transformer_bolt } , // transformer-bolt
+    { 58573, fa::fa_transporter } , // transporter
+    { 58585, fa::fa_transporter_1 } , // transporter-1
+    { 58599, fa::fa_transporter_2 } , // transporter-2
+    { 58613, fa::fa_transporter_3 } , // transporter-3
+    { 58627, fa::fa_transporter_4 } , // transporter-4
+    { 58641, fa::fa_transporter_5 } , // transporter-5
+    { 58655, fa::fa_transporter_6 } , // transporter-6
+    { 58669, fa::fa_transporter_7 } , // transporter-7
+    { 58683, fa::fa_transporter_empty } , // transporter-empty
+    { 58779, fa::fa_trash_alt_slash } , // trash-alt-slash
+    { 58936, fa::fa_trash_arrow_turn_left } , // trash-arrow-turn-left
+    { 58810, fa::fa_trash_can_arrow_turn_left } , // trash-can-arrow-turn-left
+    { 58701, fa::fa_trash_can_check } , // trash-can-check
+    { 58717, fa::fa_trash_can_clock } , // trash-can-clock
+    { 58733, fa::fa_trash_can_list } , // trash-can-list
+    { 58748, fa::fa_trash_can_plus } , // trash-can-plus
+    { 58763, fa::fa_trash_can_slash } , // trash-can-slash
+    { 58795, fa::fa_trash_can_undo } , // trash-can-undo
+    { 58851, fa::fa_trash_can_xmark } , // trash-can-xmark
+    { 58867, fa::fa_trash_check } , // trash-check
+    { 37576, fa::fa_trash_circle } , // trash-circle
+    { 58879, fa::fa_trash_clock } , // trash-clock
+    { 58891, fa::fa_trash_list } , // trash-list
+    { 58902, fa::fa_trash_plus } , // trash-plus
+    { 58913, fa::fa_trash_slash } , // trash-slash
+    { 58925, fa::fa_trash_undo } , // trash-undo
+    { 58836, fa::fa_trash_undo_alt } , // trash-undo-alt
+    { 58958, fa::fa_trash_xmark } , // trash-xmark
+    { 58970, fa::fa_treasure_chest } , // treasure-chest
+    { 59015, fa::fa_tree_alt } , // tree-alt
+    { 58985, fa::fa_tree_christmas } , // tree-christmas
+    { 59000, fa::fa_tree_deciduous } , // tree-deciduous
+    { 59024, fa::fa_tree_decorated } , // tree-decorated
+    { 59039, fa::fa_tree_large } , // tree-large
+    { 59050, fa::fa_tree_palm } , // tree-palm
+    { 59060, fa::fa_trees } , // trees
+    { 60105, fa::fa_trian_balbot } , // trian-balbot
+    { 59066, fa::fa_triangle } , // triangle
+    { 59075, fa::fa_triangle_instrument } , // triangle-instrument
+    { 59095, fa::fa_triangle_music } , // triangle-music
+    { 59110, fa::fa_triangle_person_digging } , // triangle-person-digging
+    { 59147, fa::fa_tricycle } , // tricycle
+    { 59156, fa::fa_tricycle_adult } , // tricycle-adult
+    { 59171, fa::fa_trillium } , // trillium
+    { 59192, fa::fa_trophy_alt } , // trophy-alt
+    { 59180, fa::fa_trophy_star } , // trophy-star
+    { 59203, fa::fa_truck_bolt } , // truck-bolt
+    { 59214, fa::fa_truck_clock } , // truck-clock
+    { 59241, fa::fa_truck_container } , // truck-container
+    { 59257, fa::fa_truck_container_empty } , // truck-container-empty
+    { 59356, fa::fa_truck_couch } , // truck-couch
+    { 59279, fa::fa_truck_fire } , // truck-fire
+    { 59290, fa::fa_truck_flatbed } , // truck-flatbed
+    { 59304, fa::fa_truck_ladder } , // truck-ladder
+    { 59317, fa::fa_truck_plow } , // truck-plow
+    { 59328, fa::fa_truck_ramp } , // truck-ramp
+    { 59339, fa::fa_truck_ramp_couch } , // truck-ramp-couch
+    { 59368, fa::fa_truck_tow } , // truck-tow
+    { 59378, fa::fa_truck_utensils } , // truck-utensils
+    { 59393, fa::fa_trumpet } , // trumpet
+    { 59401, fa::fa_tty_answer } , // tty-answer
+    { 59428, fa::fa_tugrik_sign } , // tugrik-sign
+    { 59440, fa::fa_turkey } , // turkey
+    { 59447, fa::fa_turn_down_left } , // turn-down-left
+    { 59462, fa::fa_turn_down_right } , // turn-down-right
+    { 59478, fa::fa_turn_left } , // turn-left
+    { 59488, fa::fa_turn_left_down } , // turn-left-down
+    { 59503, fa::fa_turn_left_up } , // turn-left-up
+    { 59516, fa::fa_turn_right } , // turn-right
+    { 59527, fa::fa_turntable } , // turntable
+    { 59537, fa::fa_turtle } , // turtle
+    { 59544, fa::fa_tv_music } , // tv-music
+    { 59553, fa::fa_tv_retro } , // tv-retro
+    { 59562, fa::fa_typewriter } , // typewriter
+    { 59573, fa::fa_ufo } , // ufo
+    { 59577, fa::fa_ufo_beam } , // ufo-beam
+    { 59602, fa::fa_umbrella_alt } , // umbrella-alt
+    { 59586, fa::fa_umbrella_simple } , // umbrella-simple
+    { 59615, fa::fa_unicorn } , // unicorn
+    { 59623, fa::fa_uniform_martial_arts } , // uniform-martial-arts
+    { 59644, fa::fa_union } , // union
+    { 59650, fa::fa_up } , // up
+    { 59666, fa::fa_up_from_bracket } , // up-from-bracket
+    { 59682, fa::fa_up_from_dotted_line } , // up-from-dotted-line
+    { 59702, fa::fa_up_from_line } , // up-from-line
+    { 59737, fa::fa_up_left } , // up-left
+    { 59745, fa::fa_up_right } , // up-right
+    { 59754, fa::fa_up_to_bracket } , // up-to-bracket
+    { 59768, fa::fa_up_to_dotted_line } , // up-to-dotted-line
+    { 59786, fa::fa_up_to_line } , // up-to-line
+    { 59814, fa::fa_usb_drive } , // usb-drive
+    { 36730, fa::fa_usd_circle } , // usd-circle
+    { 55907, fa::fa_usd_square } , // usd-square
+    { 59824, fa::fa_user_alien } , // user-alien
+    { 59835, fa::fa_user_beard_bolt } , // user-beard-bolt
+    { 59851, fa::fa_user_bounty_hunter } , // user-bounty-hunter
+    { 35699, fa::fa_user_chart } , // user-chart
+    { 59870, fa::fa_user_chef } , // user-chef
+    { 60150, fa::fa_user_construction } , // user-construction
+    { 59880, fa::fa_user_cowboy } , // user-cowboy
+    { 59892, fa::fa_user_crown } , // user-crown
+    { 59903, fa::fa_user_doctor_hair } , // user-doctor-hair
+    { 59920, fa::fa_user_doctor_hair_long } , // user-doctor-hair-long
+    { 59942, fa::fa_user_doctor_message } , // user-doctor-message
+    { 59975, fa::fa_user_group_crown } , // user-group-crown
+    { 60004, fa::fa_user_group_simple } , // user-group-simple
+    { 60022, fa::fa_user_hair } , // user-hair
+    { 60032, fa::fa_user_hair_buns } , // user-hair-buns
+    { 60047, fa::fa_user_hair_long } , // user-hair-long
+    { 60062, fa::fa_user_hair_mullet } , // user-hair-mullet
+    { 60168, fa::fa_user_hard_hat } , // user-hard-hat
+    { 60118, fa::fa_user_headset } , // user-headset
+    { 60131, fa::fa_user_helmet_safety } , // user-helmet-safety
+    { 60182, fa::fa_user_hoodie } , // user-hoodie
+    { 60194, fa::fa_user_magnifying_glass } , // user-magnifying-glass
+    { 59962, fa::fa_user_md_chat } , // user-md-chat
+    { 60216, fa::fa_user_music } , // user-music
+    { 60227, fa::fa_user_nurse_hair } , // user-nurse-hair
+    { 60243, fa::fa_user_nurse_hair_long } , // user-nurse-hair-long
+    { 60264, fa::fa_user_pilot } , // user-pilot
+    { 60275, fa::fa_user_pilot_tie } , // user-pilot-tie
+    { 60290, fa::fa_user_police } , // user-police
+    { 60302, fa::fa_user_police_tie } , // user-police-tie
+    { 60318, fa::fa_user_robot } , // user-robot
+    { 60329, fa::fa_user_robot_xmarks } , // user-robot-xmarks
+    { 60347, fa::fa_user_shakespeare } , // user-shakespeare
+    { 60364, fa::fa_user_tie_hair } , // user-tie-hair
+    { 60378, fa::fa_user_tie_hair_long } , // user-tie-hair-long
+    { 60397, fa::fa_user_unlock } , // user-unlock
+    { 60409, fa::fa_user_visor } , // user-visor
+    { 60420, fa::fa_user_vneck } , // user-vneck
+    { 60431, fa::fa_user_vneck_hair } , // user-vneck-hair
+    { 60447, fa::fa_user_vneck_hair_long } , // user-vneck-hair-long
+    { 53791, fa::fa_users_class } , // users-class
+    { 59992, fa::fa_users_crown } , // users-crown
+    { 60468, fa::fa_users_medical } , // users-medical
+    { 43865, fa::fa_utensil_fork } , // utensil-fork
+    { 46864, fa::fa_utensil_knife } , // utensil-knife
+    { 43889, fa::fa_utensils_alt } , // utensils-alt
+    { 60482, fa::fa_utensils_slash } , // utensils-slash
+    { 60497, fa::fa_utility_pole } , // utility-pole
+    { 60510, fa::fa_utility_pole_double } , // utility-pole-double
+    { 60530, fa::fa_vacuum } , // vacuum
+    { 60537, fa::fa_vacuum_robot } , // vacuum-robot
+    { 60550, fa::fa_value_absolute } , // value-absolute
+    { 60565, fa::fa_vector_circle } , // vector-circle
+    { 60579, fa::fa_vector_polygon } , // vector-polygon
+    { 60594, fa::fa_vent_damper } , // vent-damper
+    { 35191, fa::fa_vhs } , // vhs
+    { 60606, fa::fa_video_arrow_down_left } , // video-arrow-down-left
+    { 60628, fa::fa_video_arrow_up_right } , // video-arrow-up-right
+    { 37651, fa::fa_video_circle } , // video-circle
+    { 34380, fa::fa_video_handheld } , // video-handheld
+    { 60649, fa::fa_video_plus } , // video-plus
+    { 60660, fa::fa_violin } , // violin
+    { 60667, fa::fa_volume } , // volume
+    { 60674, fa::fa_volume_medium } , // volume-medium
+    { 60688, fa::fa_volume_slash } , // volume-slash
+    { 61395, fa::fa_vote_nay } , // vote-nay
+    { 60701, fa::fa_waffle } , // waffle
+    { 60708, fa::fa_wagon_covered } , // wagon-covered
+    { 60722, fa::fa_walker } , // walker
+    { 32380, fa::fa_wall_brick } , // wall-brick
+    { 60729, fa::fa_wand } , // wand
+    { 60749, fa::fa_warehouse_alt } , // warehouse-alt
+    { 60734, fa::fa_warehouse_full } , // warehouse-full
+    { 60779, fa::fa_washer } , // washer
+    { 60763, fa::fa_washing_machine } , // washing-machine
+    { 60786, fa::fa_watch } , // watch
+    { 60792, fa::fa_watch_apple } , // watch-apple
+    { 60804, fa::fa_watch_calculator } , // watch-calculator
+    { 60821, fa::fa_watch_fitness } , // watch-fitness
+    { 60835, fa::fa_watch_smart } , // watch-smart
+    { 60847, fa::fa_water_arrow_down } , // water-arrow-down
+    { 60876, fa::fa_water_arrow_up } , // water-arrow-up
+    { 60864, fa::fa_water_lower } , // water-lower
+    { 60891, fa::fa_water_rise } , // water-rise
+    { 60902, fa::fa_watermelon_slice } , // watermelon-slice
+    { 60919, fa::fa_wave } , // wave
+    { 60924, fa::fa_wave_pulse } , // wave-pulse
+    { 60946, fa::fa_wave_sine } , // wave-sine
+    { 60956, fa::fa_wave_triangle } , // wave-triangle
+    { 60970, fa::fa_waveform } , // waveform
+    { 37695, fa::fa_waveform_circle } , // waveform-circle
+    { 60979, fa::fa_waveform_lines } , // waveform-lines
+    { 60994, fa::fa_waveform_path } , // waveform-path
+    { 61008, fa::fa_waves_sine } , // waves-sine
+    { 34522, fa::fa_webcam } , // webcam
+    { 34546, fa::fa_webcam_slash } , // webcam-slash
+    { 61019, fa::fa_webhook } , // webhook
+    { 61027, fa::fa_whale } , // whale
+    { 61033, fa::fa_wheat } , // wheat
+    { 61039, fa::fa_wheat_awn_slash } , // wheat-awn-slash
+    { 61055, fa::fa_wheat_slash } , // wheat-slash
+    { 61067, fa::fa_whiskey_glass_ice } , // whiskey-glass-ice
+    { 61105, fa::fa_whistle } , // whistle
+    { 61168, fa::fa_wifi_1 } , // wifi-1
+    { 61140, fa::fa_wifi_2 } , // wifi-2
+    { 61113, fa::fa_wifi_exclamation } , // wifi-exclamation
+    { 61130, fa::fa_wifi_fair } , // wifi-fair
+    { 61147, fa::fa_wifi_slash } , // wifi-slash
+    { 61158, fa::fa_wifi_weak } , // wifi-weak
+    { 61201, fa::fa_wind_circle_exclamation } , // wind-circle-exclamation
+    { 61175, fa::fa_wind_turbine } , // wind-turbine
+    { 61188, fa::fa_wind_warning } , // wind-warning
+    { 61225, fa::fa_window } , // window
+    { 61244, fa::fa_window_alt } , // window-alt
+    { 61232, fa::fa_window_flip } , // window-flip
+    { 61255, fa::fa_window_frame } , // window-frame
+    { 61268, fa::fa_window_frame_open } , // window-frame-open
+    { 61286, fa::fa_windsock } , // windsock
+    { 61295, fa::fa_wine_glass_crack } , // wine-glass-crack
+    { 61320, fa::fa_wreath } , // wreath
+    { 61327, fa::fa_wreath_laurel } , // wreath-laurel
+    { 61341, fa::fa_wrench_simple } , // wrench-simple
+    { 45832, fa::fa_xmark_hexagon } , // xmark-hexagon
+    { 61355, fa::fa_xmark_large } , // xmark-large
+    { 50685, fa::fa_xmark_octagon } , // xmark-octagon
+    { 61367, fa::fa_xmark_to_slot } , // xmark-to-slot
+    { 54955, fa::fa_zzz }  // zzz
 };
+static constexpr int faProIconCount = 2345;
 #else
 
-static const fa::QtAwesomeNamedIcon faRegularFreeIconArray[] = {
-    { "address-book", fa::fa_address_book } ,
-    { "contact-book", fa::fa_contact_book } ,
-    { "address-card", fa::fa_address_card } ,
-    { "contact-card", fa::fa_contact_card } ,
-    { "vcard", fa::fa_vcard } ,
-    { "bell", fa::fa_bell } ,
-    { "bell-slash", fa::fa_bell_slash } ,
-    { "bookmark", fa::fa_bookmark } ,
-    { "building", fa::fa_building } ,
-    { "calendar", fa::fa_calendar } ,
-    { "calendar-check", fa::fa_calendar_check } ,
-    { "calendar-days", fa::fa_calendar_days } ,
-    { "calendar-alt", fa::fa_calendar_alt } ,
-    { "calendar-minus", fa::fa_calendar_minus } ,
-    { "calendar-plus", fa::fa_calendar_plus } ,
-    { "calendar-xmark", fa::fa_calendar_xmark } ,
-    { "calendar-times", fa::fa_calendar_times } ,
-    { "chart-bar", fa::fa_chart_bar } ,
-    { "bar-chart", fa::fa_bar_chart } ,
-    { "chess-bishop", fa::fa_chess_bishop } ,
-    { "chess-king", fa::fa_chess_king } ,
-    { "chess-knight", fa::fa_chess_knight } ,
-    { "chess-pawn", fa::fa_chess_pawn } ,
-    { "chess-queen", fa::fa_chess_queen } ,
-    { "chess-rook", fa::fa_chess_rook } ,
-    { "circle", fa::fa_circle } ,
-    { "circle-check", fa::fa_circle_check } ,
-    { "check-circle", fa::fa_check_circle } ,
-    { "circle-dot", fa::fa_circle_dot } ,
-    { "dot-circle", fa::fa_dot_circle } ,
-    { "circle-down", fa::fa_circle_down } ,
-    { "arrow-alt-circle-down", fa::fa_arrow_alt_circle_down } ,
-    { "circle-left", fa::fa_circle_left } ,
-    { "arrow-alt-circle-left", fa::fa_arrow_alt_circle_left } ,
-    { "circle-pause", fa::fa_circle_pause } ,
-    { "pause-circle", fa::fa_pause_circle } ,
-    { "circle-play", fa::fa_circle_play } ,
-    { "play-circle", fa::fa_play_circle } ,
-    { "circle-question", fa::fa_circle_question } ,
-    { "question-circle", fa::fa_question_circle } ,
-    { "circle-right", fa::fa_circle_right } ,
-    { "arrow-alt-circle-right", fa::fa_arrow_alt_circle_right } ,
-    { "circle-stop", fa::fa_circle_stop } ,
-    { "stop-circle", fa::fa_stop_circle } ,
-    { "circle-up", fa::fa_circle_up } ,
-    { "arrow-alt-circle-up", fa::fa_arrow_alt_circle_up } ,
-    { "circle-user", fa::fa_circle_user } ,
-    { "user-circle", fa::fa_user_circle } ,
-    { "circle-xmark", fa::fa_circle_xmark } ,
-    { "times-circle", fa::fa_times_circle } ,
-    { "xmark-circle", fa::fa_xmark_circle } ,
-    { "clipboard", fa::fa_clipboard } ,
-    { "clock", fa::fa_clock } ,
-    { "clock-four", fa::fa_clock_four } ,
-    { "clone", fa::fa_clone } ,
-    { "closed-captioning", fa::fa_closed_captioning } ,
-    { "comment", fa::fa_comment } ,
-    { "comment-dots", fa::fa_comment_dots } ,
-    { "commenting", fa::fa_commenting } ,
-    { "comments", fa::fa_comments } ,
-    { "compass", fa::fa_compass } ,
-    { "copy", fa::fa_copy } ,
-    { "copyright", fa::fa_copyright } ,
-    { "credit-card", fa::fa_credit_card } ,
-    { "credit-card-alt", fa::fa_credit_card_alt } ,
-    { "envelope", fa::fa_envelope } ,
-    { "envelope-open", fa::fa_envelope_open } ,
-    { "eye", fa::fa_eye } ,
-    { "eye-slash", fa::fa_eye_slash } ,
-    { "face-angry", fa::fa_face_angry } ,
-    { "angry", fa::fa_angry } ,
-    { "face-dizzy", fa::fa_face_dizzy } ,
-    { "dizzy", fa::fa_dizzy } ,
-    { "face-flushed", fa::fa_face_flushed } ,
-    { "flushed", fa::fa_flushed } ,
-    { "face-frown", fa::fa_face_frown } ,
-    { "frown", fa::fa_frown } ,
-    { "face-frown-open", fa::fa_face_frown_open } ,
-    { "frown-open", fa::fa_frown_open } ,
-    { "face-grimace", fa::fa_face_grimace } ,
-    { "grimace", fa::fa_grimace } ,
-    { "face-grin", fa::fa_face_grin } ,
-    { "grin", fa::fa_grin } ,
-    { "face-grin-beam", fa::fa_face_grin_beam } ,
-    { "grin-beam", fa::fa_grin_beam } ,
-    { "face-grin-beam-sweat", fa::fa_face_grin_beam_sweat } ,
-    { "grin-beam-sweat", fa::fa_grin_beam_sweat } ,
-    { "face-grin-hearts", fa::fa_face_grin_hearts } ,
-    { "grin-hearts", fa::fa_grin_hearts } ,
-    { "face-grin-squint", fa::fa_face_grin_squint } ,
-    { "grin-squint", fa::fa_grin_squint } ,
-    { "face-grin-squint-tears", fa::fa_face_grin_squint_tears } ,
-    { "grin-squint-tears", fa::fa_grin_squint_tears } ,
-    { "face-grin-stars", fa::fa_face_grin_stars } ,
-    { "grin-stars", fa::fa_grin_stars } ,
-    { "face-grin-tears", fa::fa_face_grin_tears } ,
-    { "grin-tears", fa::fa_grin_tears } ,
-    { "face-grin-tongue", fa::fa_face_grin_tongue } ,
-    { "grin-tongue", fa::fa_grin_tongue } ,
-    { "face-grin-tongue-squint", fa::fa_face_grin_tongue_squint } ,
-    { "grin-tongue-squint", fa::fa_grin_tongue_squint } ,
-    { "face-grin-tongue-wink", fa::fa_face_grin_tongue_wink } ,
-    { "grin-tongue-wink", fa::fa_grin_tongue_wink } ,
-    { "face-grin-wide", fa::fa_face_grin_wide } ,
-    { "grin-alt", fa::fa_grin_alt } ,
-    { "face-grin-wink", fa::fa_face_grin_wink } ,
-    { "grin-wink", fa::fa_grin_wink } ,
-    { "face-kiss", fa::fa_face_kiss } ,
-    { "kiss", fa::fa_kiss } ,
-    { "face-kiss-beam", fa::fa_face_kiss_beam } ,
-    { "kiss-beam", fa::fa_kiss_beam } ,
-    { "face-kiss-wink-heart", fa::fa_face_kiss_wink_heart } ,
-    { "kiss-wink-heart", fa::fa_kiss_wink_heart } ,
-    { "face-laugh", fa::fa_face_laugh } ,
-    { "laugh", fa::fa_laugh } ,
-    { "face-laugh-beam", fa::fa_face_laugh_beam } ,
-    { "laugh-beam", fa::fa_laugh_beam } ,
-    { "face-laugh-squint", fa::fa_face_laugh_squint } ,
-    { "laugh-squint", fa::fa_laugh_squint } ,
-    { "face-laugh-wink", fa::fa_face_laugh_wink } ,
-    { "laugh-wink", fa::fa_laugh_wink } ,
-    { "face-meh", fa::fa_face_meh } ,
-    { "meh", fa::fa_meh } ,
-    { "face-meh-blank", fa::fa_face_meh_blank } ,
-    { "meh-blank", fa::fa_meh_blank } ,
-    { "face-rolling-eyes", fa::fa_face_rolling_eyes } ,
-    { "meh-rolling-eyes", fa::fa_meh_rolling_eyes } ,
-    { "face-sad-cry", fa::fa_face_sad_cry } ,
-    { "sad-cry", fa::fa_sad_cry } ,
-    { "face-sad-tear", fa::fa_face_sad_tear } ,
-    { "sad-tear", fa::fa_sad_tear } ,
-    { "face-smile", fa::fa_face_smile } ,
-    { "smile", fa::fa_smile } ,
-    { "face-smile-beam", fa::fa_face_smile_beam } ,
-    { "smile-beam", fa::fa_smile_beam } ,
-    { "face-smile-wink", fa::fa_face_smile_wink } ,
-    { "smile-wink", fa::fa_smile_wink } ,
-    { "face-surprise", fa::fa_face_surprise } ,
-    { "surprise", fa::fa_surprise } ,
-    { "face-tired", fa::fa_face_tired } ,
-    { "tired", fa::fa_tired } ,
-    { "file", fa::fa_file } ,
-    { "file-audio", fa::fa_file_audio } ,
-    { "file-code", fa::fa_file_code } ,
-    { "file-excel", fa::fa_file_excel } ,
-    { "file-image", fa::fa_file_image } ,
-    { "file-lines", fa::fa_file_lines } ,
-    { "file-alt", fa::fa_file_alt } ,
-    { "file-text", fa::fa_file_text } ,
-    { "file-pdf", fa::fa_file_pdf } ,
-    { "file-powerpoint", fa::fa_file_powerpoint } ,
-    { "file-video", fa::fa_file_video } ,
-    { "file-word", fa::fa_file_word } ,
-    { "file-zipper", fa::fa_file_zipper } ,
-    { "file-archive", fa::fa_file_archive } ,
-    { "flag", fa::fa_flag } ,
-    { "floppy-disk", fa::fa_floppy_disk } ,
-    { "save", fa::fa_save } ,
-    { "folder", fa::fa_folder } ,
-    { "folder-blank", fa::fa_folder_blank } ,
-    { "folder-closed", fa::fa_folder_closed } ,
-    { "folder-open", fa::fa_folder_open } ,
-    { "futbol", fa::fa_futbol } ,
-    { "futbol-ball", fa::fa_futbol_ball } ,
-    { "soccer-ball", fa::fa_soccer_ball } ,
-    { "gem", fa::fa_gem } ,
-    { "hand", fa::fa_hand } ,
-    { "hand-paper", fa::fa_hand_paper } ,
-    { "hand-back-fist", fa::fa_hand_back_fist } ,
-    { "hand-rock", fa::fa_hand_rock } ,
-    { "hand-lizard", fa::fa_hand_lizard } ,
-    { "hand-peace", fa::fa_hand_peace } ,
-    { "hand-point-down", fa::fa_hand_point_down } ,
-    { "hand-point-left", fa::fa_hand_point_left } ,
-    { "hand-point-right", fa::fa_hand_point_right } ,
-    { "hand-point-up", fa::fa_hand_point_up } ,
-    { "hand-pointer", fa::fa_hand_pointer } ,
-    { "hand-scissors", fa::fa_hand_scissors } ,
-    { "hand-spock", fa::fa_hand_spock } ,
-    { "handshake", fa::fa_handshake } ,
-    { "hard-drive", fa::fa_hard_drive } ,
-    { "hdd", fa::fa_hdd } ,
-    { "heart", fa::fa_heart } ,
-    { "hospital", fa::fa_hospital } ,
-    { "hospital-alt", fa::fa_hospital_alt } ,
-    { "hospital-wide", fa::fa_hospital_wide } ,
-    { "hourglass", fa::fa_hourglass } ,
-    { "hourglass-empty", fa::fa_hourglass_empty } ,
-    { "hourglass-half", fa::fa_hourglass_half } ,
-    { "hourglass-2", fa::fa_hourglass_2 } ,
-    { "id-badge", fa::fa_id_badge } ,
-    { "id-card", fa::fa_id_card } ,
-    { "drivers-license", fa::fa_drivers_license } ,
-    { "image", fa::fa_image } ,
-    { "images", fa::fa_images } ,
-    { "keyboard", fa::fa_keyboard } ,
-    { "lemon", fa::fa_lemon } ,
-    { "life-ring", fa::fa_life_ring } ,
-    { "lightbulb", fa::fa_lightbulb } ,
-    { "map", fa::fa_map } ,
-    { "message", fa::fa_message } ,
-    { "comment-alt", fa::fa_comment_alt } ,
-    { "money-bill-1", fa::fa_money_bill_1 } ,
-    { "money-bill-alt", fa::fa_money_bill_alt } ,
-    { "moon", fa::fa_moon } ,
-    { "newspaper", fa::fa_newspaper } ,
-    { "note-sticky", fa::fa_note_sticky } ,
-    { "sticky-note", fa::fa_sticky_note } ,
-    { "object-group", fa::fa_object_group } ,
-    { "object-ungroup", fa::fa_object_ungroup } ,
-    { "paper-plane", fa::fa_paper_plane } ,
-    { "paste", fa::fa_paste } ,
-    { "file-clipboard", fa::fa_file_clipboard } ,
-    { "pen-to-square", fa::fa_pen_to_square } ,
-    { "edit", fa::fa_edit } ,
-    { "rectangle-list", fa::fa_rectangle_list } ,
-    { "list-alt", fa::fa_list_alt } ,
-    { "rectangle-xmark", fa::fa_rectangle_xmark } ,
-    { "rectangle-times", fa::fa_rectangle_times } ,
-    { "times-rectangle", fa::fa_times_rectangle } ,
-    { "window-close", fa::fa_window_close } ,
-    { "registered", fa::fa_registered } ,
-    { "share-from-square", fa::fa_share_from_square } ,
-    { "share-square", fa::fa_share_square } ,
-    { "snowflake", fa::fa_snowflake } ,
-    { "square", fa::fa_square } ,
-    { "square-caret-down", fa::fa_square_caret_down } ,
-    { "caret-square-down", fa::fa_caret_square_down } ,
-    { "square-caret-left", fa::fa_square_caret_left } ,
-    { "caret-square-left", fa::fa_caret_square_left } ,
-    { "square-caret-right", fa::fa_square_caret_right } ,
-    { "caret-square-right", fa::fa_caret_square_right } ,
-    { "square-caret-up", fa::fa_square_caret_up } ,
-    { "caret-square-up", fa::fa_caret_square_up } ,
-    { "square-check", fa::fa_square_check } ,
-    { "check-square", fa::fa_check_square } ,
-    { "square-full", fa::fa_square_full } ,
-    { "square-minus", fa::fa_square_minus } ,
-    { "minus-square", fa::fa_minus_square } ,
-    { "square-plus", fa::fa_square_plus } ,
-    { "plus-square", fa::fa_plus_square } ,
-    { "star", fa::fa_star } ,
-    { "star-half", fa::fa_star_half } ,
-    { "star-half-stroke", fa::fa_star_half_stroke } ,
-    { "star-half-alt", fa::fa_star_half_alt } ,
-    { "sun", fa::fa_sun } ,
-    { "thumbs-down", fa::fa_thumbs_down } ,
-    { "thumbs-up", fa::fa_thumbs_up } ,
-    { "trash-can", fa::fa_trash_can } ,
-    { "trash-alt", fa::fa_trash_alt } ,
-    { "user", fa::fa_user } ,
-    { "window-maximize", fa::fa_window_maximize } ,
-    { "window-minimize", fa::fa_window_minimize } ,
-    { "window-restore", fa::fa_window_restore } ,
-
+static constexpr fa::QtAwesomeNamedIcon faRegularFreeIconArray[] = {
+    { 22, fa::fa_address_book } , // address-book
+    { 48, fa::fa_address_card } , // address-card
+    { 7916, fa::fa_angry } , // angry
+    { 5344, fa::fa_arrow_alt_circle_down } , // arrow-alt-circle-down
+    { 5491, fa::fa_arrow_alt_circle_left } , // arrow-alt-circle-left
+    { 5715, fa::fa_arrow_alt_circle_right } , // arrow-alt-circle-right
+    { 5772, fa::fa_arrow_alt_circle_up } , // arrow-alt-circle-up
+    { 4578, fa::fa_bar_chart } , // bar-chart
+    { 2632, fa::fa_bell } , // bell
+    { 2667, fa::fa_bell_slash } , // bell-slash
+    { 3001, fa::fa_bookmark } , // bookmark
+    { 3473, fa::fa_building } , // building
+    { 3886, fa::fa_calendar } , // calendar
+    { 3937, fa::fa_calendar_alt } , // calendar-alt
+    { 3895, fa::fa_calendar_check } , // calendar-check
+    { 3923, fa::fa_calendar_days } , // calendar-days
+    { 3950, fa::fa_calendar_minus } , // calendar-minus
+    { 3965, fa::fa_calendar_plus } , // calendar-plus
+    { 4008, fa::fa_calendar_times } , // calendar-times
+    { 3993, fa::fa_calendar_xmark } , // calendar-xmark
+    { 19273, fa::fa_caret_square_down } , // caret-square-down
+    { 19309, fa::fa_caret_square_left } , // caret-square-left
+    { 19346, fa::fa_caret_square_right } , // caret-square-right
+    { 19381, fa::fa_caret_square_up } , // caret-square-up
+    { 4568, fa::fa_chart_bar } , // chart-bar
+    { 5110, fa::fa_check_circle } , // check-circle
+    { 19410, fa::fa_check_square } , // check-square
+    { 4737, fa::fa_chess_bishop } , // chess-bishop
+    { 4762, fa::fa_chess_king } , // chess-king
+    { 4773, fa::fa_chess_knight } , // chess-knight
+    { 4786, fa::fa_chess_pawn } , // chess-pawn
+    { 4797, fa::fa_chess_queen } , // chess-queen
+    { 4809, fa::fa_chess_rook } , // chess-rook
+    { 4948, fa::fa_circle } , // circle
+    { 5097, fa::fa_circle_check } , // circle-check
+    { 5310, fa::fa_circle_dot } , // circle-dot
+    { 5332, fa::fa_circle_down } , // circle-down
+    { 5479, fa::fa_circle_left } , // circle-left
+    { 5565, fa::fa_circle_pause } , // circle-pause
+    { 5591, fa::fa_circle_play } , // circle-play
+    { 5639, fa::fa_circle_question } , // circle-question
+    { 5702, fa::fa_circle_right } , // circle-right
+    { 5738, fa::fa_circle_stop } , // circle-stop
+    { 5762, fa::fa_circle_up } , // circle-up
+    { 5792, fa::fa_circle_user } , // circle-user
+    { 5816, fa::fa_circle_xmark } , // circle-xmark
+    { 5873, fa::fa_clipboard } , // clipboard
+    { 5948, fa::fa_clock } , // clock
+    { 5954, fa::fa_clock_four } , // clock-four
+    { 5991, fa::fa_clone } , // clone
+    { 5997, fa::fa_closed_captioning } , // closed-captioning
+    { 6364, fa::fa_comment } , // comment
+    { 14282, fa::fa_comment_alt } , // comment-alt
+    { 6387, fa::fa_comment_dots } , // comment-dots
+    { 6400, fa::fa_commenting } , // commenting
+    { 6471, fa::fa_comments } , // comments
+    { 6509, fa::fa_compass } , // compass
+    { 35, fa::fa_contact_book } , // contact-book
+    { 61, fa::fa_contact_card } , // contact-card
+    { 6609, fa::fa_copy } , // copy
+    { 6614, fa::fa_copyright } , // copyright
+    { 6634, fa::fa_credit_card } , // credit-card
+    { 6646, fa::fa_credit_card_alt } , // credit-card-alt
+    { 7933, fa::fa_dizzy } , // dizzy
+    { 5321, fa::fa_dot_circle } , // dot-circle
+    { 12695, fa::fa_drivers_license } , // drivers-license
+    { 15371, fa::fa_edit } , // edit
+    { 7662, fa::fa_envelope } , // envelope
+    { 7693, fa::fa_envelope_open } , // envelope-open
+    { 7822, fa::fa_eye } , // eye
+    { 7893, fa::fa_eye_slash } , // eye-slash
+    { 7905, fa::fa_face_angry } , // face-angry
+    { 7922, fa::fa_face_dizzy } , // face-dizzy
+    { 7939, fa::fa_face_flushed } , // face-flushed
+    { 7960, fa::fa_face_frown } , // face-frown
+    { 7977, fa::fa_face_frown_open } , // face-frown-open
+    { 8004, fa::fa_face_grimace } , // face-grimace
+    { 8025, fa::fa_face_grin } , // face-grin
+    { 8040, fa::fa_face_grin_beam } , // face-grin-beam
+    { 8065, fa::fa_face_grin_beam_sweat } , // face-grin-beam-sweat
+    { 8102, fa::fa_face_grin_hearts } , // face-grin-hearts
+    { 8131, fa::fa_face_grin_squint } , // face-grin-squint
+    { 8160, fa::fa_face_grin_squint_tears } , // face-grin-squint-tears
+    { 8201, fa::fa_face_grin_stars } , // face-grin-stars
+    { 8228, fa::fa_face_grin_tears } , // face-grin-tears
+    { 8255, fa::fa_face_grin_tongue } , // face-grin-tongue
+    { 8284, fa::fa_face_grin_tongue_squint } , // face-grin-tongue-squint
+    { 8327, fa::fa_face_grin_tongue_wink } , // face-grin-tongue-wink
+    { 8366, fa::fa_face_grin_wide } , // face-grin-wide
+    { 8390, fa::fa_face_grin_wink } , // face-grin-wink
+    { 8415, fa::fa_face_kiss } , // face-kiss
+    { 8430, fa::fa_face_kiss_beam } , // face-kiss-beam
+    { 8455, fa::fa_face_kiss_wink_heart } , // face-kiss-wink-heart
+    { 8492, fa::fa_face_laugh } , // face-laugh
+    { 8509, fa::fa_face_laugh_beam } , // face-laugh-beam
+    { 8536, fa::fa_face_laugh_squint } , // face-laugh-squint
+    { 8567, fa::fa_face_laugh_wink } , // face-laugh-wink
+    { 8594, fa::fa_face_meh } , // face-meh
+    { 8607, fa::fa_face_meh_blank } , // face-meh-blank
+    { 8632, fa::fa_face_rolling_eyes } , // face-rolling-eyes
+    { 8667, fa::fa_face_sad_cry } , // face-sad-cry
+    { 8688, fa::fa_face_sad_tear } , // face-sad-tear
+    { 8711, fa::fa_face_smile } , // face-smile
+    { 8728, fa::fa_face_smile_beam } , // face-smile-beam
+    { 8755, fa::fa_face_smile_wink } , // face-smile-wink
+    { 8782, fa::fa_face_surprise } , // face-surprise
+    { 8805, fa::fa_face_tired } , // face-tired
+    { 8891, fa::fa_file } , // file
+    { 9275, fa::fa_file_alt } , // file-alt
+    { 9460, fa::fa_file_archive } , // file-archive
+    { 8952, fa::fa_file_audio } , // file-audio
+    { 15264, fa::fa_file_clipboard } , // file-clipboard
+    { 9079, fa::fa_file_code } , // file-code
+    { 9112, fa::fa_file_excel } , // file-excel
+    { 9188, fa::fa_file_image } , // file-image
+    { 9264, fa::fa_file_lines } , // file-lines
+    { 9307, fa::fa_file_pdf } , // file-pdf
+    { 9335, fa::fa_file_powerpoint } , // file-powerpoint
+    { 9284, fa::fa_file_text } , // file-text
+    { 9396, fa::fa_file_video } , // file-video
+    { 9438, fa::fa_file_word } , // file-word
+    { 9448, fa::fa_file_zipper } , // file-zipper
+    { 9667, fa::fa_flag } , // flag
+    { 9713, fa::fa_floppy_disk } , // floppy-disk
+    { 7952, fa::fa_flushed } , // flushed
+    { 9742, fa::fa_folder } , // folder
+    { 9749, fa::fa_folder_blank } , // folder-blank
+    { 9762, fa::fa_folder_closed } , // folder-closed
+    { 9789, fa::fa_folder_open } , // folder-open
+    { 7971, fa::fa_frown } , // frown
+    { 7993, fa::fa_frown_open } , // frown-open
+    { 9929, fa::fa_futbol } , // futbol
+    { 9936, fa::fa_futbol_ball } , // futbol-ball
+    { 10200, fa::fa_gem } , // gem
+    { 8017, fa::fa_grimace } , // grimace
+    { 8035, fa::fa_grin } , // grin
+    { 8381, fa::fa_grin_alt } , // grin-alt
+    { 8055, fa::fa_grin_beam } , // grin-beam
+    { 8086, fa::fa_grin_beam_sweat } , // grin-beam-sweat
+    { 8119, fa::fa_grin_hearts } , // grin-hearts
+    { 8148, fa::fa_grin_squint } , // grin-squint
+    { 8183, fa::fa_grin_squint_tears } , // grin-squint-tears
+    { 8217, fa::fa_grin_stars } , // grin-stars
+    { 8244, fa::fa_grin_tears } , // grin-tears
+    { 8272, fa::fa_grin_tongue } , // grin-tongue
+    { 8308, fa::fa_grin_tongue_squint } , // grin-tongue-squint
+    { 8349, fa::fa_grin_tongue_wink } , // grin-tongue-wink
+    { 8405, fa::fa_grin_wink } , // grin-wink
+    { 10495, fa::fa_hand } , // hand
+    { 10511, fa::fa_hand_back_fist } , // hand-back-fist
+    { 10726, fa::fa_hand_lizard } , // hand-lizard
+    { 10500, fa::fa_hand_paper } , // hand-paper
+    { 10757, fa::fa_hand_peace } , // hand-peace
+    { 10768, fa::fa_hand_point_down } , // hand-point-down
+    { 10784, fa::fa_hand_point_left } , // hand-point-left
+    { 10800, fa::fa_hand_point_right } , // hand-point-right
+    { 10817, fa::fa_hand_point_up } , // hand-point-up
+    { 10831, fa::fa_hand_pointer } , // hand-pointer
+    { 10526, fa::fa_hand_rock } , // hand-rock
+    { 10844, fa::fa_hand_scissors } , // hand-scissors
+    { 10872, fa::fa_hand_spock } , // hand-spock
+    { 11174, fa::fa_handshake } , // handshake
+    { 11313, fa::fa_hard_drive } , // hard-drive
+    { 11324, fa::fa_hdd } , // hdd
+    { 11510, fa::fa_heart } , // heart
+    { 11874, fa::fa_hospital } , // hospital
+    { 11883, fa::fa_hospital_alt } , // hospital-alt
+    { 11896, fa::fa_hospital_wide } , // hospital-wide
+    { 11960, fa::fa_hourglass } , // hourglass
+    { 12027, fa::fa_hourglass_2 } , // hourglass-2
+    { 11970, fa::fa_hourglass_empty } , // hourglass-empty
+    { 12012, fa::fa_hourglass_half } , // hourglass-half
+    { 12678, fa::fa_id_badge } , // id-badge
+    { 12687, fa::fa_id_card } , // id-card
+    { 12742, fa::fa_image } , // image
+    { 12772, fa::fa_images } , // images
+    { 12949, fa::fa_keyboard } , // keyboard
+    { 8425, fa::fa_kiss } , // kiss
+    { 8445, fa::fa_kiss_beam } , // kiss-beam
+    { 8476, fa::fa_kiss_wink_heart } , // kiss-wink-heart
+    { 8503, fa::fa_laugh } , // laugh
+    { 8525, fa::fa_laugh_beam } , // laugh-beam
+    { 8554, fa::fa_laugh_squint } , // laugh-squint
+    { 8583, fa::fa_laugh_wink } , // laugh-wink
+    { 13219, fa::fa_lemon } , // lemon
+    { 13251, fa::fa_life_ring } , // life-ring
+    { 13261, fa::fa_lightbulb } , // lightbulb
+    { 17352, fa::fa_list_alt } , // list-alt
+    { 13846, fa::fa_map } , // map
+    { 8603, fa::fa_meh } , // meh
+    { 8622, fa::fa_meh_blank } , // meh-blank
+    { 8650, fa::fa_meh_rolling_eyes } , // meh-rolling-eyes
+    { 14274, fa::fa_message } , // message
+    { 19498, fa::fa_minus_square } , // minus-square
+    { 14625, fa::fa_money_bill_1 } , // money-bill-1
+    { 14638, fa::fa_money_bill_alt } , // money-bill-alt
+    { 14832, fa::fa_moon } , // moon
+    { 14999, fa::fa_newspaper } , // newspaper
+    { 15026, fa::fa_note_sticky } , // note-sticky
+    { 15066, fa::fa_object_group } , // object-group
+    { 15079, fa::fa_object_ungroup } , // object-ungroup
+    { 15203, fa::fa_paper_plane } , // paper-plane
+    { 15258, fa::fa_paste } , // paste
+    { 5578, fa::fa_pause_circle } , // pause-circle
+    { 15357, fa::fa_pen_to_square } , // pen-to-square
+    { 5603, fa::fa_play_circle } , // play-circle
+    { 19677, fa::fa_plus_square } , // plus-square
+    { 5655, fa::fa_question_circle } , // question-circle
+    { 17337, fa::fa_rectangle_list } , // rectangle-list
+    { 17377, fa::fa_rectangle_times } , // rectangle-times
+    { 17361, fa::fa_rectangle_xmark } , // rectangle-xmark
+    { 17430, fa::fa_registered } , // registered
+    { 8680, fa::fa_sad_cry } , // sad-cry
+    { 8702, fa::fa_sad_tear } , // sad-tear
+    { 9725, fa::fa_save } , // save
+    { 18430, fa::fa_share_from_square } , // share-from-square
+    { 18448, fa::fa_share_square } , // share-square
+    { 8722, fa::fa_smile } , // smile
+    { 8744, fa::fa_smile_beam } , // smile-beam
+    { 8771, fa::fa_smile_wink } , // smile-wink
+    { 18948, fa::fa_snowflake } , // snowflake
+    { 9948, fa::fa_soccer_ball } , // soccer-ball
+    { 19191, fa::fa_square } , // square
+    { 19255, fa::fa_square_caret_down } , // square-caret-down
+    { 19291, fa::fa_square_caret_left } , // square-caret-left
+    { 19327, fa::fa_square_caret_right } , // square-caret-right
+    { 19365, fa::fa_square_caret_up } , // square-caret-up
+    { 19397, fa::fa_square_check } , // square-check
+    { 19455, fa::fa_square_full } , // square-full
+    { 19485, fa::fa_square_minus } , // square-minus
+    { 19665, fa::fa_square_plus } , // square-plus
+    { 20008, fa::fa_star } , // star
+    { 20031, fa::fa_star_half } , // star-half
+    { 20058, fa::fa_star_half_alt } , // star-half-alt
+    { 20041, fa::fa_star_half_stroke } , // star-half-stroke
+    { 15038, fa::fa_sticky_note } , // sticky-note
+    { 5750, fa::fa_stop_circle } , // stop-circle
+    { 20284, fa::fa_sun } , // sun
+    { 8796, fa::fa_surprise } , // surprise
+    { 21363, fa::fa_thumbs_down } , // thumbs-down
+    { 21375, fa::fa_thumbs_up } , // thumbs-up
+    { 5829, fa::fa_times_circle } , // times-circle
+    { 17393, fa::fa_times_rectangle } , // times-rectangle
+    { 8816, fa::fa_tired } , // tired
+    { 21817, fa::fa_trash_alt } , // trash-alt
+    { 21807, fa::fa_trash_can } , // trash-can
+    { 22534, fa::fa_user } , // user
+    { 5804, fa::fa_user_circle } , // user-circle
+    { 74, fa::fa_vcard } , // vcard
+    { 17409, fa::fa_window_close } , // window-close
+    { 23721, fa::fa_window_maximize } , // window-maximize
+    { 23737, fa::fa_window_minimize } , // window-minimize
+    { 23753, fa::fa_window_restore } , // window-restore
+    { 5842, fa::fa_xmark_circle }  // xmark-circle
 };
+static constexpr int faRegularFreeIconCount = 254;
 #endif
+
+} // namespace fa
+
+#endif // QTAWESOMESTRINGGENERATED_H
@@ -0,0 +1,91 @@
+#include "QtAwesomeTextObject.h"
+#include "QtAwesome.h"
+
+#include <QAbstractTextDocumentLayout>
+#include <QFontInfo>
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QTextCursor>
+#include <QTextDocument>
+
+namespace fa {
+
+static IconId iconIdFromFormat(const QTextFormat& format)
+{
+    return IconId::fromValue(format.property(QtAwesomeTextObject::IconIdProperty).toUInt());
+}
+
+QtAwesomeTextObject::QtAwesomeTextObject(QtAwesome* awesome, QObject* parent)
+    : QObject(parent)
+    , awesomeRef_(awesome)
+{
+}
+
+/// Registers a text object for the icons in the document, the text object is owned by the document
+QtAwesomeTextObject* QtAwesomeTextObject::install(QTextDocument* document, QtAwesome* awesome)
+{
+    QtAwesomeTextObject* textObject = new QtAwesomeTextObject(awesome, document);
+    document->documentLayout()->registerHandler(IconFormat, textObject);
+    return textObject;
+}
+
+/// Returns the character format for an icon
+/// @param format the format of the surrounding text, the icon uses its font size and color
+QTextCharFormat QtAwesomeTextObject::iconFormat(IconId id, const QTextCharFormat& format)
+{
+    QTextCharFormat result = format;
+    result.setObjectType(IconFormat);
+    result.setProperty(IconIdProperty, id.value());
+    return result;
+}
+
+/// Inserts the icon at the cursor position, with the font size and color of the cursor format
+void QtAwesomeTextObject::insertIcon(QTextCursor& cursor, IconId id)
+{
+    cursor.insertText(QString(QChar::ObjectReplacementCharacter), iconFormat(id, cursor.charFormat()));
+}
+
+/// The icon font, with the pixel size of the text font
+/// The format only contains the font properties set on the text, the others come from the document default font.
+QFont QtAwesomeTextObject::iconFont(QTextDocument* document, const QTextFormat& format) const
+{
+    QFont textFont = format.toCharFormat().font().resolve(document->defaultFont());
+
+    int pixelSize = textFont.pixelSize();
+    if (pixelSize <= 0) {
+        QPaintDevice* device = document->documentLayout()->paintDevice();
+        pixelSize = device ? qRound(textFont.pointSizeF() * device->logicalDpiY() / 72.0) : QFontInfo(textFont).pixelSize();
+    }
+
+    return awesomeRef_->font(iconIdFromFormat(format).style(), pixelSize);
+}
+
+/// The size of the glyph, the icon is placed on the baseline of the text
+QSizeF QtAwesomeTextObject::intrinsicSize(QTextDocument* document, int posInDocument, const QTextFormat& format)
+{
+    Q_UNUSED(posInDocument)
+
+    QFontMetricsF metrics(iconFont(document, format));
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    qreal width = metrics.horizontalAdvance(codePointToString(iconIdFromFormat(format).codePoint()));
+#else
+    qreal width = metrics.width(codePointToString(iconIdFromFormat(format).codePoint()));
+#endif
+    return QSizeF(width, metrics.ascent());
+}
+
+void QtAwesomeTextObject::drawObject(QPainter* painter, const QRectF& rect, QTextDocument* document, int posInDocument,
+                                     const QTextFormat& format)
+{
+    Q_UNUSED(posInDocument)
+
+    painter->save();
+    painter->setFont(iconFont(document, format));
+    if (format.hasProperty(QTextFormat::ForegroundBrush)) {
+        painter->setPen(format.foreground().color());
+    }
+    painter->drawText(QPointF(rect.left(), rect.bottom()), codePointToString(iconIdFromFormat(format).codePoint()));
+    painter->restore();
+}
+
+} // namespace fa
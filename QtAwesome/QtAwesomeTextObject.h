@@ -0,0 +1,56 @@
+#ifndef QTAWESOMETEXTOBJECT_H
+#define QTAWESOMETEXTOBJECT_H
+
+#include <QObject>
+#include <QTextFormat>
+#include <QTextObjectInterface>
+
+#include "QtAwesomeIconId.h"
+
+class QTextCursor;
+
+namespace fa {
+
+class QtAwesome;
+
+///
+/// A text object that draws icons inline in a QTextDocument
+///
+///     fa::QtAwesomeTextObject::install(document, awesome);
+///     fa::QtAwesomeTextObject::insertIcon(cursor, fa::IconId(fa::fa_solid, fa::fa_circle_info));
+///
+/// The icons are drawn as glyphs with the font size of the surrounding text. No QIcon or pixmap is created
+/// per icon, the glyphs are drawn from the glyph cache of the font, like the text.
+///
+class QtAwesomeTextObject : public QObject, public QTextObjectInterface
+{
+Q_OBJECT
+    Q_INTERFACES(QTextObjectInterface)
+
+public:
+    /// The object type of the icon characters
+    static const int IconFormat = QTextFormat::UserObject + 0xfa;
+
+    /// The format property with the IconId value
+    static const int IconIdProperty = QTextFormat::UserProperty + 0xfa;
+
+    explicit QtAwesomeTextObject(QtAwesome* awesome, QObject* parent = nullptr);
+
+    static QtAwesomeTextObject* install(QTextDocument* document, QtAwesome* awesome);
+
+    static QTextCharFormat iconFormat(IconId id, const QTextCharFormat& format = QTextCharFormat());
+    static void insertIcon(QTextCursor& cursor, IconId id);
+
+    virtual QSizeF intrinsicSize(QTextDocument* document, int posInDocument, const QTextFormat& format) override;
+    virtual void drawObject(QPainter* painter, const QRectF& rect, QTextDocument* document, int posInDocument,
+                            const QTextFormat& format) override;
+
+private:
+    QFont iconFont(QTextDocument* document, const QTextFormat& format) const;
+
+    QtAwesome* awesomeRef_;   ///< a reference to the QtAwesome instance
+};
+
+} // namespace fa
+
+#endif // QTAWESOMETEXTOBJECT_H
@@ -1,6 +1,7 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include "QtAwesome.h"
+#include "QtAwesomeItemDelegate.h"
 #include <QStandardItemModel>
 #include <QMap>
 #include <QDebug>
@@ -65,6 +66,7 @@ MainWindow::MainWindow(QWidget *parent) :
 
     QStandardItemModel* model = new QStandardItemModel(this);
     ui->listView->setModel(model);
+    ui->listView->setItemDelegate(new fa::QtAwesomeItemDelegate(awesome, ui->listView));
 
     connect(ui->comboBox, SIGNAL(activated(int)), this, SLOT(styleChanged(int)));
     styleChanged(fa::fa_solid);
@@ -81,15 +83,13 @@ void MainWindow::styleChanged(int index)
     QVariant styleValue = ui->comboBox->currentData();
     int style = styleValue.toInt();
 
-    QHash<QString, int> iconset = awesome->namedCodePoints(style);
-
     QStandardItemModel *model = dynamic_cast<QStandardItemModel*>(ui->listView->model());
     model->clear();
 
-    for (QHash<QString, int>::iterator i=iconset.begin(); i != iconset.end(); ++i) {
-        QString name = i.key();
-        int ic = i.value();
-        model->appendRow(new QStandardItem(awesome->icon(style, ic), name));
+    for (const fa::QtAwesomeNamedCodePoint& namedCodePoint : awesome->namedCodePointsView(style, true)) {
+        // the delegate paints the icon, only the visible rows are rendered
+        QStandardItem* item = new QStandardItem(namedCodePoint.name);
+        item->setData(QVariant::fromValue(fa::IconId(style, namedCodePoint.codePoint)), Qt::DecorationRole);
+        model->appendRow(item);
     }
-    model->sort(0);
 }
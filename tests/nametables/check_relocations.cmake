@@ -0,0 +1,29 @@
+# Checks that the generated name tables don't need dynamic relocations (ELF only)
+#
+#     cmake -DREADELF=readelf -DLIBRARY=libqtawesome_nametables.so -P check_relocations.cmake
+#
+# Before the single string table each name was a const char*, one R_*_RELATIVE relocation per name (4840 in the pro build)
+# and the tables ended up in .data.rel.ro. The remaining relocations come from the compiler runtime (a handful).
+set(QTAWESOME_MAX_RELATIVE_RELOCATIONS 16)
+
+execute_process(COMMAND ${READELF} --wide --relocs ${LIBRARY} OUTPUT_VARIABLE relocs RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "readelf failed on ${LIBRARY}")
+endif()
+string(REGEX MATCHALL "R_[A-Z0-9_]*_RELATIVE" relative "${relocs}")
+list(LENGTH relative count)
+
+execute_process(COMMAND ${READELF} --wide --section-headers ${LIBRARY} OUTPUT_VARIABLE sections)
+string(REGEX MATCH "\\.data\\.rel\\.ro +[A-Z]+ +[0-9a-f]+ +[0-9a-f]+ +([0-9a-f]+)" dataRelRo "${sections}")
+set(dataRelRoSize 0)
+if(dataRelRo)
+	math(EXPR dataRelRoSize "0x${CMAKE_MATCH_1}")
+endif()
+
+message(STATUS "relative relocations: ${count}, .data.rel.ro: ${dataRelRoSize} bytes")
+if(count GREATER QTAWESOME_MAX_RELATIVE_RELOCATIONS)
+	message(FATAL_ERROR "The name tables need ${count} relative relocations (at most ${QTAWESOME_MAX_RELATIVE_RELOCATIONS} expected)")
+endif()
+if(dataRelRoSize GREATER 1024)
+	message(FATAL_ERROR "The name tables are in .data.rel.ro (${dataRelRoSize} bytes), they should be in .rodata")
+endif()
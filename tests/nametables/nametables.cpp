@@ -0,0 +1,16 @@
+// The generated name tables in a shared library of their own (see check_relocations.cmake and tst_bench_nametables)
+#include "QtAwesome.h"
+#include "QtAwesomeStringGenerated.h"
+
+extern "C" Q_DECL_EXPORT const fa::QtAwesomeNamedIcon* qtawesome_nametables(const char** names, int* count)
+{
+    *names = fa::faIconNames;
+    *count = fa::faCommonIconCount;
+    return fa::faCommonIconArray;
+}
+
+extern "C" Q_DECL_EXPORT const fa::QtAwesomeNamedIcon* qtawesome_nametables_brands(int* count)
+{
+    *count = fa::faBrandsIconCount;
+    return fa::faBrandsIconArray;
+}
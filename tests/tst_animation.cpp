@@ -0,0 +1,147 @@
+// Checks the animation frames at fixed times, with a manually advanced timeline clock
+#include "QtAwesomeAnim.h"
+
+#include <QImage>
+#include <QPainter>
+#include <QWidget>
+#include <QtMath>
+#include <QtTest>
+
+#include <cmath>
+
+/// The rotation of the painter in degrees (0..360)
+static qreal painterRotation(const QPainter& painter)
+{
+    QTransform transform = painter.transform();
+    qreal angle = qRadiansToDegrees(std::atan2(transform.m12(), transform.m11()));
+    return angle < -0.0001 ? angle + 360 : angle;
+}
+
+/// Compares angles in degrees, 0 and 360 are the same angle
+static bool sameAngle(qreal a, qreal b)
+{
+    qreal difference = std::fmod(qAbs(a - b), 360.0);
+    return qMin(difference, 360 - difference) < 0.01;
+}
+
+#define COMPARE_ANGLE(actual, expected) \
+    do { \
+        qreal actualAngle = (actual); \
+        QVERIFY2(sameAngle(actualAngle, (expected)), qPrintable(QString("%1 != %2").arg(actualAngle).arg(expected))); \
+    } while (false)
+
+/// The rotation of the frame of the animation at the given time
+static qreal frameRotation(const fa::QtAwesomeAnimation& animation, qint64 time)
+{
+    QImage image(32, 32, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    animation.apply(painter, QRectF(0, 0, 32, 32), time);
+    return painterRotation(painter);
+}
+
+class TestAnimation : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init()
+    {
+        now_ = 0;
+        fa::QtAwesomeAnimationTimeline::instance()->setClock([this]() { return now_; });
+    }
+
+    void cleanup()
+    {
+        fa::QtAwesomeAnimationTimeline::instance()->setClock(fa::QtAwesomeAnimationTimeline::Clock());
+    }
+
+    void spinFrames_data()
+    {
+        QTest::addColumn<qint64>("time");
+        QTest::addColumn<qreal>("rotation");
+        QTest::newRow("start") << qint64(0) << 0.0;
+        QTest::newRow("quarter") << qint64(500) << 90.0;
+        QTest::newRow("half") << qint64(1000) << 180.0;
+        QTest::newRow("next cycle") << qint64(2500) << 90.0;
+    }
+
+    void spinFrames()
+    {
+        QFETCH(qint64, time);
+        QFETCH(qreal, rotation);
+
+        QWidget widget;
+        fa::QtAwesomeAnimation animation(&widget, fa::QtAwesomeAnimation::Spin);   // 2s per turn
+        QCOMPARE(animation.duration(), 2000);
+        COMPARE_ANGLE(frameRotation(animation, time), rotation);
+    }
+
+    /// The angle only depends on the clock, not on how often the timeline ticks
+    void spinSpeedIndependentOfTicks_data()
+    {
+        QTest::addColumn<int>("tickInterval");
+        QTest::newRow("100 Hz") << 10;
+        QTest::newRow("60 Hz") << 16;
+        QTest::newRow("busy event loop") << 250;
+    }
+
+    void spinSpeedIndependentOfTicks()
+    {
+        QFETCH(int, tickInterval);
+
+        QWidget widget;
+        fa::QtAwesomeAnimation animation(&widget, fa::QtAwesomeAnimation::Spin);
+        fa::QtAwesomeAnimationTimeline* timeline = fa::QtAwesomeAnimationTimeline::instance();
+
+        QImage image(32, 32, QImage::Format_ARGB32_Premultiplied);
+        qreal rotation = 0;
+        for (now_ = 0; now_ <= 1000; now_ += tickInterval) {
+            QPainter painter(&image);
+            animation.setup(painter, QRect(0, 0, 32, 32));
+            rotation = painterRotation(painter);
+            QMetaObject::invokeMethod(timeline, "tick");
+        }
+
+        // 0.18 degrees per millisecond at every tick rate
+        qint64 lastTime = now_ - tickInterval;
+        COMPARE_ANGLE(rotation, std::fmod(lastTime * 0.18, 360.0));
+    }
+
+    void legacySpin()
+    {
+        QWidget widget;
+        fa::QtAwesomeAnimation clockwise(&widget, 10, 1);   // 1 degree per 10 ms
+        QCOMPARE(clockwise.duration(), 3600);
+        COMPARE_ANGLE(frameRotation(clockwise, 900), 90.0);
+
+        fa::QtAwesomeAnimation counterClockwise(&widget, 10, -1);
+        QCOMPARE(counterClockwise.direction(), fa::QtAwesomeAnimation::Reverse);
+        COMPARE_ANGLE(frameRotation(counterClockwise, 900), 270.0);
+    }
+
+    void pulseSteps()
+    {
+        QWidget widget;
+        fa::QtAwesomeAnimation animation(&widget, fa::QtAwesomeAnimation::Pulse);   // 8 steps per second
+        COMPARE_ANGLE(frameRotation(animation, 100), 0.0);
+        COMPARE_ANGLE(frameRotation(animation, 130), 45.0);
+        COMPARE_ANGLE(frameRotation(animation, 999), 315.0);
+    }
+
+    void fadeOpacity()
+    {
+        QWidget widget;
+        fa::QtAwesomeAnimation animation(&widget, fa::QtAwesomeAnimation::Fade);
+
+        QImage image(32, 32, QImage::Format_ARGB32_Premultiplied);
+        QPainter painter(&image);
+        animation.apply(painter, QRectF(0, 0, 32, 32), 500);
+        QVERIFY(qAbs(painter.opacity() - 0.4) < 0.001);
+    }
+
+private:
+    qint64 now_;   ///< the time of the fake clock
+};
+
+QTEST_MAIN(TestAnimation)
+#include "tst_animation.moc"
@@ -0,0 +1,77 @@
+// Checks that animated icons don't leak animations or keep the timeline running, and don't use deleted animations
+#include "QtAwesome.h"
+
+#include <QImage>
+#include <QPainter>
+#include <QWidget>
+#include <QtTest>
+
+class TestAnimationLifetime : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase()
+    {
+        QVERIFY(awesome_.initFontAwesome());
+    }
+
+    /// Creates, paints and destroys 100k icons with shared animations, every animation is deleted with its icon
+    void sharedAnimationsAreDeleted()
+    {
+        const int count = 100000;
+        QWidget widget;
+        QImage image(16, 16, QImage::Format_ARGB32_Premultiplied);
+        fa::QtAwesomeAnimationTimeline* timeline = fa::QtAwesomeAnimationTimeline::instance();
+
+        int destroyed = 0;
+        for (int i = 0; i < count; ++i) {
+            QSharedPointer<fa::QtAwesomeAnimation> animation = fa::QtAwesomeAnimation::create(&widget);
+            connect(animation.data(), &QObject::destroyed, this, [&destroyed]() { ++destroyed; });
+
+            QVariantMap options;
+            options.insert("anim", QVariant::fromValue(animation));
+            animation.reset();   // the icon owns the animation
+
+            QIcon icon = awesome_.icon(fa::fa_solid, fa::fa_spinner, options);
+            QPainter painter(&image);
+            icon.paint(&painter, QRect(0, 0, 16, 16));
+            QCOMPARE(timeline->animationCount(), 1);   // painting starts the animation
+        }
+
+        QCOMPARE(destroyed, count);
+        QCOMPARE(timeline->animationCount(), 0);
+        QCOMPARE(widget.children().size(), 0);
+    }
+
+    /// An animation created with new is owned by its widget, the icon may outlive it
+    void iconOutlivesWidgetAnimation()
+    {
+        QWidget* widget = new QWidget();
+        QVariantMap options;
+        options.insert("anim", QVariant::fromValue(new fa::QtAwesomeAnimation(widget, fa::QtAwesomeAnimation::Spin)));
+        QIcon icon = awesome_.icon(fa::fa_solid, fa::fa_spinner, options);
+
+        QImage image(16, 16, QImage::Format_ARGB32_Premultiplied);
+        {
+            QPainter painter(&image);
+            icon.paint(&painter, QRect(0, 0, 16, 16));
+        }
+        delete widget;   // deletes the animation
+
+        // painted without the animation, instead of with the deleted one
+        image.fill(Qt::transparent);
+        {
+            QPainter painter(&image);
+            icon.paint(&painter, QRect(0, 0, 16, 16));
+        }
+        QVERIFY(!image.isNull());
+        QCOMPARE(fa::QtAwesomeAnimationTimeline::instance()->animationCount(), 0);
+    }
+
+private:
+    fa::QtAwesome awesome_;
+};
+
+QTEST_MAIN(TestAnimationLifetime)
+#include "tst_animationlifetime.moc"
@@ -0,0 +1,113 @@
+// Benchmarks resolving icon names, the allocation-free parser against the previous QString based implementation
+#include "QtAwesome.h"
+
+#include <QtTest>
+
+/// The style lookup before the hash switch, a chain of QString comparisons
+static int oldStringToStyleEnum(const QString& style)
+{
+    if (style == "fa-solid") return fa::fa_solid;
+    else if (style == "fa-regular") return fa::fa_regular;
+    else if (style == "fa-brands") return fa::fa_brands;
+#ifdef FONT_AWESOME_PRO
+    else if (style == "fa-light") return fa::fa_light;
+    else if (style == "fa-thin") return fa::fa_thin;
+    else if (style == "fa-duotone") return fa::fa_duotone;
+    else if (style == "fa-duotone-solid") return fa::fa_duotone_solid;
+    else if (style == "fa-duotone-regular") return fa::fa_duotone_regular;
+    else if (style == "fa-duotone-light") return fa::fa_duotone_light;
+    else if (style == "fa-duotone-thin") return fa::fa_duotone_thin;
+    else if (style == "fa-sharp-solid") return fa::fa_sharp_solid;
+    else if (style == "fa-sharp-regular") return fa::fa_sharp_regular;
+    else if (style == "fa-sharp-light") return fa::fa_sharp_light;
+    else if (style == "fa-sharp-thin") return fa::fa_sharp_thin;
+    else if (style == "fa-sharp-duotone-solid") return fa::fa_sharp_duotone_solid;
+    else if (style == "fa-sharp-duotone-regular") return fa::fa_sharp_duotone_regular;
+    else if (style == "fa-sharp-duotone-light") return fa::fa_sharp_duotone_light;
+    else if (style == "fa-sharp-duotone-thin") return fa::fa_sharp_duotone_thin;
+#endif
+    return fa::fa_solid;
+}
+
+/// The name parsing of icon(const QString&) before the allocation-free parser
+static fa::IconId oldIconId(const fa::QtAwesome& awesome, const QString& name)
+{
+    int spaceIndex = name.indexOf(' ');
+    int style = fa::fa_solid;
+    QString iconName;
+
+    if (spaceIndex > 0) {
+        QString styleName = name.left(spaceIndex);
+        style = oldStringToStyleEnum(styleName.startsWith("fa-") ? styleName : "fa-" + styleName);
+        iconName = name.mid(spaceIndex + 1);
+    } else {
+        iconName = name;
+    }
+
+    if (iconName.startsWith("fa-")) {
+        iconName = iconName.mid(3);
+    }
+
+    int codePoint = awesome.namedCodePoint(style, iconName);
+    return codePoint >= 0 ? fa::IconId(style, codePoint) : fa::IconId();
+}
+
+class BenchIconName : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase()
+    {
+        QVERIFY(awesome_.initFontAwesome());
+    }
+
+    void names_data()
+    {
+        QTest::addColumn<QString>("name");
+        QTest::newRow("name") << QStringLiteral("house");
+        QTest::newRow("fa-name") << QStringLiteral("fa-house");
+        QTest::newRow("style name") << QStringLiteral("regular bell");
+        QTest::newRow("fa-style fa-name") << QStringLiteral("fa-brands fa-github");
+    }
+
+    void oldParser_data() { names_data(); }
+    void oldParser()
+    {
+        QFETCH(QString, name);
+        fa::IconId id;
+        QBENCHMARK {
+            id = oldIconId(awesome_, name);
+        }
+        QCOMPARE(id, awesome_.iconId(QStringView(name)));
+    }
+
+    void stringView_data() { names_data(); }
+    void stringView()
+    {
+        QFETCH(QString, name);
+        fa::IconId id;
+        QBENCHMARK {
+            id = awesome_.iconId(QStringView(name));
+        }
+        QVERIFY(id.isValid());
+    }
+
+    void latin1_data() { names_data(); }
+    void latin1()
+    {
+        QFETCH(QString, name);
+        QByteArray latin1 = name.toLatin1();
+        fa::IconId id;
+        QBENCHMARK {
+            id = awesome_.iconId(QLatin1String(latin1));
+        }
+        QVERIFY(id.isValid());
+    }
+
+private:
+    fa::QtAwesome awesome_;
+};
+
+QTEST_MAIN(BenchIconName)
+#include "tst_bench_iconname.moc"
@@ -0,0 +1,23 @@
+// Benchmarks loading the generated name tables as shared library (the dlopen time includes the relocations)
+#include <QLibrary>
+#include <QtTest>
+
+class BenchNameTables : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void load()
+    {
+        QLibrary library(QStringLiteral(QTAWESOME_NAMETABLES_LIBRARY));
+        library.setLoadHints(QLibrary::ResolveAllSymbolsHint);   // RTLD_NOW, all relocations are processed while loading
+
+        QBENCHMARK {
+            QVERIFY2(library.load(), qPrintable(library.errorString()));
+            library.unload();
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(BenchNameTables)
+#include "tst_bench_nametables.moc"
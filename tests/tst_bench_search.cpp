@@ -0,0 +1,61 @@
+// Benchmarks QtAwesome::search against a substring scan over namedCodePoints() (what an icon picker did before)
+#include "QtAwesome.h"
+
+#include <QtTest>
+
+class BenchSearch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase()
+    {
+        QVERIFY(awesome_.initFontAwesome());
+        awesome_.search(fa::fa_solid, QStringLiteral("warm-up"));   // builds the trigram index
+    }
+
+    void search_data()
+    {
+        QTest::addColumn<QString>("query");
+        QTest::newRow("1 char") << QStringLiteral("a");
+        QTest::newRow("2 chars") << QStringLiteral("ar");
+        QTest::newRow("5 chars") << QStringLiteral("arrow");
+    }
+
+    void search()
+    {
+        QFETCH(QString, query);
+        QVector<fa::QtAwesomeNamedCodePoint> result;
+        QBENCHMARK {
+            result = awesome_.search(fa::fa_solid, query);
+        }
+        QVERIFY(!result.isEmpty());
+    }
+
+    void substringScan_data()
+    {
+        search_data();
+    }
+
+    void substringScan()
+    {
+        QFETCH(QString, query);
+        QStringList result;
+        // built once, the old namedCodePoints() returned an implicitly shared hash without allocating
+        const QHash<QString, int> namedCodePoints = awesome_.namedCodePoints(fa::fa_solid);
+        QBENCHMARK {
+            result.clear();
+            for (QHash<QString, int>::const_iterator itr = namedCodePoints.constBegin(); itr != namedCodePoints.constEnd(); ++itr) {
+                if (itr.key().contains(query)) result.append(itr.key());
+            }
+            result.sort();
+        }
+        QVERIFY(!result.isEmpty());
+    }
+
+private:
+    fa::QtAwesome awesome_;
+};
+
+QTEST_MAIN(BenchSearch)
+#include "tst_bench_search.moc"
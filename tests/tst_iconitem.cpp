@@ -0,0 +1,77 @@
+// Renders FaIcon items headless, with the software scene graph backend (QT_QUICK_BACKEND=software)
+#include "QtAwesome.h"
+#include "QtAwesomeIconItem.h"
+
+#include <QQuickWindow>
+#include <QtTest>
+
+class TestIconItem : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase()
+    {
+        QVERIFY(awesome_.initFontAwesome());
+        fa::QtAwesomeIconItem::registerType(&awesome_);
+    }
+
+    void render()
+    {
+        QQuickWindow window;
+        window.resize(64, 64);
+        window.setColor(Qt::white);
+
+        fa::QtAwesomeIconItem* item = new fa::QtAwesomeIconItem(window.contentItem());
+        item->setName(QStringLiteral("fa-solid fa-square"));
+        item->setColor(Qt::red);
+        item->setSize(QSizeF(64, 64));
+        QVERIFY(item->iconId().isValid());
+
+        window.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+        // the square glyph covers the center of the item
+        QImage image = window.grabWindow();
+        QColor center = image.pixelColor(image.width() / 2, image.height() / 2);
+        QVERIFY2(center.red() > 200 && center.green() < 60 && center.blue() < 60, qPrintable(center.name()));
+
+        item->setColor(Qt::blue);
+        image = window.grabWindow();
+        center = image.pixelColor(image.width() / 2, image.height() / 2);
+        QVERIFY2(center.blue() > 200 && center.red() < 60 && center.green() < 60, qPrintable(center.name()));
+    }
+
+    /// Animating the color creates a texture per frame, the unused textures may not pile up
+    void animatedColorKeepsTextureCacheBounded()
+    {
+        QQuickWindow window;
+        window.resize(32, 32);
+
+        fa::QtAwesomeIconItem* item = new fa::QtAwesomeIconItem(window.contentItem());
+        item->setName(QStringLiteral("fa-solid fa-house"));
+        item->setSize(QSizeF(32, 32));
+
+        window.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+        for (int frame = 0; frame < 500; ++frame) {
+            item->setColor(QColor::fromHsv(frame % 360, 255, 255, 255 - frame % 128));
+            window.grabWindow();
+        }
+        QVERIFY(fa::QtAwesomeIconItem::cachedTextureCount(&window) > 0);
+        QVERIFY(fa::QtAwesomeIconItem::cachedTextureCount(&window) <= 65);   // the texture in use and 64 unused
+
+        // going back to a recent color reuses its texture
+        int count = fa::QtAwesomeIconItem::cachedTextureCount(&window);
+        item->setColor(QColor::fromHsv(498 % 360, 255, 255, 255 - 498 % 128));
+        window.grabWindow();
+        QCOMPARE(fa::QtAwesomeIconItem::cachedTextureCount(&window), count);
+    }
+
+private:
+    fa::QtAwesome awesome_;
+};
+
+QTEST_MAIN(TestIconItem)
+#include "tst_iconitem.moc"
@@ -9,8 +9,13 @@
 # - QtAwesomeGenerated.h
 #
 # To use it make sure the fontawesome icons.json is place in the the QtAwesome/fonts/pro/metadata folder
+# When no icons.json is available, the icon information is read from the current generated headers.
+#
+# With the --subset option only the given icon names are included in the name tables.
+# (Used by the QTAWESOME_ICON_SUBSET CMake option, the enum header is never trimmed)
 require 'erb'
 require 'json'
+require 'optparse'
 
 class Icons
   attr_reader :icons_common,
@@ -18,12 +23,24 @@ class Icons
               :icons_pro,
               :icons_regular_free
 
-  def initialize(icon_file)
+  def initialize
     @icons_common = {}
     @icons_brands = {}
     @icons_pro = {}
     @icons_regular_free = {}
-    build_maps(JSON.parse(File.read(icon_file)))
+  end
+
+  def self.from_json(icon_file)
+    icons = new
+    icons.build_maps(JSON.parse(File.read(icon_file)))
+    icons
+  end
+
+  # Reads the icons from the previously generated headers in the given directory
+  def self.from_headers(path)
+    icons = new
+    icons.read_headers(path)
+    icons
   end
 
   def id_name(str)
@@ -39,6 +56,41 @@ class Icons
     "\"#{name}\""
   end
 
+  # The icons sorted by name (bytewise, the same order as strcmp)
+  def sorted(hash)
+    hash.sort_by { |name, _unicode| name.b }
+  end
+
+  # The names of the free icons, in string table order (every name is stored once)
+  def name_table_free
+    build_name_table unless @name_table_free
+    @name_table_free
+  end
+
+  # The names that are only used by the pro icons, these are placed after the free names
+  def name_table_pro
+    build_name_table unless @name_table_pro
+    @name_table_pro
+  end
+
+  # The offset of the name in the string table
+  def name_offset(name)
+    build_name_table unless @name_offsets
+    @name_offsets.fetch(name)
+  end
+
+  def build_name_table
+    @name_offsets = {}
+    offset = 0
+    tables = [[@icons_common, @icons_brands, @icons_regular_free], [@icons_pro]].map do |hashes|
+      hashes.flat_map(&:keys).reject { |name| @name_offsets.key?(name) }.uniq.each do |name|
+        @name_offsets[name] = offset
+        offset += name.bytesize + 1
+      end
+    end
+    @name_table_free, @name_table_pro = tables
+  end
+
   def build_maps(icons)
     icons.each do |key, data|
       if data['free'].length > 0
@@ -76,23 +128,89 @@ class Icons
     end
   end
 
+  def read_headers(path)
+    enum_header = File.read("#{path}/QtAwesomeEnumGenerated.h")
+    read_enum(enum_header, 'fa_common_icons', @icons_common)
+    read_enum(enum_header, 'fa_brand_icons', @icons_brands)
+    read_enum(enum_header, 'fa_pro_icons', @icons_pro)
+
+    # the regular free icons are only available in the name tables
+    string_header = File.read("#{path}/QtAwesomeStringGenerated.h")
+    block = string_header[/faRegularFreeIconArray\[\] = \{(.*?)\n\};/m, 1] || ''
+    block.scan(/fa::fa_([a-z0-9_]+)/).each do |(id)|
+      name = id.tr('_', '-')
+      @icons_regular_free[name] = @icons_common.fetch(name)
+    end
+  end
+
+  def read_enum(header, enum_name, hash)
+    block = header[/enum #{enum_name} : uint16_t \{(.*?)\n\};/m, 1] || ''
+    block.scan(/fa_([a-z0-9_]+) = 0x([0-9a-f]+)/).each do |id, unicode|
+      hash[id.tr('_', '-')] = unicode
+    end
+  end
+
+  # Only keep the given icon names in the name tables
+  def subset!(names)
+    [@icons_common, @icons_brands, @icons_pro, @icons_regular_free].each do |hash|
+      hash.select! { |name, _unicode| names.include?(name) }
+    end
+  end
+
+  # All codepoints of the included icons, including the secondary duotone glyphs
+  def unicodes
+    codepoints = [@icons_common, @icons_brands, @icons_pro].flat_map(&:values).map { |unicode| unicode.to_i(16) }.uniq.sort
+    codepoints + codepoints.map { |codepoint| codepoint | 0x100000 }
+  end
+
   def generate(template)
     ERB.new(template, trim_mode: '-').result(binding)
   end
 end
 
-icon_file = ARGV[1] || "#{__dir__}/../QtAwesome/fonts/pro/metadata/icons.json"
-output_path = "#{__dir__}/../QtAwesome"
+# Reads a list of icon names, one per line. A style prefix and the fa- prefix are optional.
+# (e.g. "fa-solid fa-house", "solid house" and "house" are all the same icon)
+def read_icon_names(file)
+  File.readlines(file).map { |line| line.sub(/#.*/, '').strip }.reject(&:empty?).map do |line|
+    line.split(/\s+/).last.sub(/\Afa-/, '')
+  end
+end
+
+options = {
+  output: "#{__dir__}/../QtAwesome",
+  subset: nil,
+  unicodes: nil
+}
+
+OptionParser.new do |opts|
+  opts.banner = "Usage: build_headers.rb [options] [icons.json]"
+  opts.on('--output DIR', 'Directory to write the generated headers to') { |dir| options[:output] = dir }
+  opts.on('--subset FILE', 'Only include the icon names listed in FILE in the name tables') { |file| options[:subset] = file }
+  opts.on('--unicodes FILE', 'Write the codepoints of the included icons to FILE (pyftsubset --unicodes-file)') { |file| options[:unicodes] = file }
+end.parse!
+
+icon_file = ARGV.last || "#{__dir__}/../QtAwesome/fonts/pro/metadata/icons.json"
+header_path = "#{__dir__}/../QtAwesome"
 
 source_names = [
   'QtAwesomeEnumGenerated.h',
   'QtAwesomeStringGenerated.h'
 ]
 
-icons = Icons.new(icon_file)
+icons = File.exist?(icon_file) ? Icons.from_json(icon_file) : Icons.from_headers(header_path)
+
+if options[:subset]
+  names = read_icon_names(options[:subset])
+  icons.subset!(names)
+  source_names = ['QtAwesomeStringGenerated.h']
+end
+
+if options[:unicodes]
+  File.write(options[:unicodes], icons.unicodes.map { |codepoint| format("U+%04X\n", codepoint) }.join)
+end
 
 # generate the templates
 source_names.each do |source_name|
   result = icons.generate(File.read("#{__dir__}/#{source_name}.erb"))
-  File.write("#{output_path}/#{source_name}", result)
+  File.write("#{options[:output]}/#{source_name}", result)
 end
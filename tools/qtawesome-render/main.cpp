@@ -0,0 +1,616 @@
+/**
+ * qtawesome-render - renders font awesome icons to a PNG sprite sheet, with a JSON and CSS index, an icon bundle
+ * or animated PNGs
+ *
+ * MIT Licensed
+ *
+ * Copyright 2013-2024 - Reliable Bits Software by Blommers IT. All Rights Reserved.
+ * Author Rick Blommers
+ */
+
+#include "QtAwesome.h"
+
+#include <QApplication>
+#include <QBuffer>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QImageWriter>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPainter>
+#include <QRunnable>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QtEndian>
+
+#include <algorithm>
+#include <cmath>
+
+/// A rendered icon in the sprite sheet
+struct Sprite
+{
+    QString style;       ///< the style name, e.g. solid
+    QString name;        ///< the icon name (without the fa- prefix)
+    fa::IconId id;       ///< the resolved icon
+    int size;            ///< the size in css pixels
+    QColor color;        ///< the icon color
+    qreal dpr;           ///< the device pixel ratio, the image is size * dpr pixels
+    QImage image;        ///< the rendered icon
+    QPoint position;     ///< the position in the sheet
+};
+
+/// Renders a sprite, the sprites are rendered in parallel (QtAwesome::image is thread-safe)
+class SpriteRenderer : public QRunnable
+{
+public:
+    SpriteRenderer(fa::QtAwesome* awesome, Sprite* sprite)
+        : awesomeRef_(awesome)
+        , spriteRef_(sprite)
+    {
+    }
+
+    virtual void run() override
+    {
+        QVariantMap options;
+        options.insert("color", spriteRef_->color);
+
+        int pixelSize = qRound(spriteRef_->size * spriteRef_->dpr);
+        spriteRef_->image = awesomeRef_->image(spriteRef_->id, QSize(pixelSize, pixelSize), options);
+    }
+
+private:
+    fa::QtAwesome* awesomeRef_;   ///< a reference to the QtAwesome instance
+    Sprite* spriteRef_;           ///< the sprite to render
+};
+
+/// A frame of an animation
+struct Frame
+{
+    qint64 time;         ///< the time in the animation in milliseconds
+    QImage image;        ///< the rendered frame
+    QByteArray png;      ///< the frame as PNG file
+};
+
+/// Renders and encodes an animation frame, the frames are rendered in parallel
+/// Every frame uses its own animation: the easing curve is initialized lazily when it's first used,
+/// so a shared curve isn't thread-safe. The settings are copied in the gui thread.
+class FrameRenderer : public QRunnable
+{
+public:
+    FrameRenderer(const fa::QtAwesomeAnimation& animation, const QImage& glyph, const QSize& size, Frame* frame)
+        : type_(animation.type())
+        , duration_(animation.duration())
+        , easingCurve_(animation.easingCurve())
+        , direction_(animation.direction())
+        , glyph_(glyph)
+        , size_(size)
+        , frameRef_(frame)
+    {
+    }
+
+    virtual void run() override
+    {
+        fa::QtAwesomeAnimation animation(nullptr, type_, duration_);
+        animation.setEasingCurve(easingCurve_);
+        animation.setDirection(direction_);
+
+        QImage image(size_, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::transparent);
+        {
+            QPainter painter(&image);
+            painter.setRenderHint(QPainter::Antialiasing);
+            painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+            QRectF rect(QPointF(0, 0), QSizeF(size_));
+            animation.apply(painter, rect, frameRef_->time);
+            painter.drawImage(rect, glyph_);
+        }
+
+        // all frames have the same PNG format (8-bit RGBA), required to combine them in an APNG
+        frameRef_->image = image.convertToFormat(QImage::Format_ARGB32);
+        QBuffer buffer(&frameRef_->png);
+        buffer.open(QIODevice::WriteOnly);
+        QImageWriter writer(&buffer, "png");
+        writer.write(frameRef_->image);
+    }
+
+private:
+    fa::QtAwesomeAnimation::Type type_;             ///< the animation type
+    int duration_;                                  ///< the duration of one cycle in milliseconds
+    QEasingCurve easingCurve_;                      ///< a copy of the easing curve, only used by this frame
+    fa::QtAwesomeAnimation::Direction direction_;   ///< the direction the keyframes are played
+    QImage glyph_;                                  ///< the glyph, rendered at twice the frame size
+    QSize size_;                                    ///< the frame size in pixels
+    Frame* frameRef_;                               ///< the frame to render
+};
+
+static QTextStream& err()
+{
+    static QTextStream stream(stderr);
+    return stream;
+}
+
+/// The values of a list option, values can be given multiple times and/or comma separated
+static QStringList listOption(const QCommandLineParser& parser, const QString& name)
+{
+    QStringList result;
+    for (const QString& value : parser.values(name)) {
+        for (const QString& item : value.split(',')) {
+            if (!item.trimmed().isEmpty()) result.append(item.trimmed());
+        }
+    }
+    return result;
+}
+
+/// The styles a name without style is looked up in, in order of preference
+static QStringList iconStyles()
+{
+    QStringList styles;
+    styles << "solid" << "regular" << "brands";
+#ifdef FONT_AWESOME_PRO
+    styles << "light" << "thin"
+           << "duotone-solid" << "duotone-regular" << "duotone-light" << "duotone-thin"
+           << "sharp-solid" << "sharp-regular" << "sharp-light" << "sharp-thin"
+           << "sharp-duotone-solid" << "sharp-duotone-regular" << "sharp-duotone-light" << "sharp-duotone-thin";
+#endif
+    return styles;
+}
+
+/// Reads the icon names from a file, one name per line. Lines starting with # are ignored.
+/// (The same format as the QTAWESOME_ICON_SUBSET file, a name without style matches the icon in every style)
+static bool readIconNames(const QString& fileName, QStringList& names)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) return false;
+
+    while (!file.atEnd()) {
+        QString line = QString::fromUtf8(file.readLine());
+        int commentIndex = line.indexOf('#');
+        if (commentIndex >= 0) line.truncate(commentIndex);
+        line = line.trimmed();
+        if (!line.isEmpty()) names.append(line);
+    }
+    return true;
+}
+
+static QString withoutFaPrefix(const QString& name)
+{
+    return name.startsWith("fa-") || name.startsWith("fa_") ? name.mid(3) : name;
+}
+
+/// Packs the sprites in shelves, the highest sprites first
+/// @return the size of the sheet
+static QSize packSprites(QVector<Sprite>& sprites, int padding)
+{
+    QVector<Sprite*> order;
+    qint64 area = 0;
+    int maxWidth = 0;
+    for (Sprite& sprite : sprites) {
+        order.append(&sprite);
+        area += static_cast<qint64>(sprite.image.width() + padding) * (sprite.image.height() + padding);
+        maxWidth = qMax(maxWidth, sprite.image.width() + padding);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const Sprite* a, const Sprite* b) {
+        return a->image.height() > b->image.height();
+    });
+
+    // aim for a square sheet
+    int sheetWidth = qMax(maxWidth, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(area)))));
+
+    int x = 0;
+    int y = 0;
+    int shelfHeight = 0;
+    int usedWidth = 0;
+    for (Sprite* sprite : order) {
+        int width = sprite->image.width() + padding;
+        int height = sprite->image.height() + padding;
+        if (x + width > sheetWidth) {
+            y += shelfHeight;
+            x = 0;
+            shelfHeight = 0;
+        }
+        sprite->position = QPoint(x, y);
+        x += width;
+        shelfHeight = qMax(shelfHeight, height);
+        usedWidth = qMax(usedWidth, x);
+    }
+    return QSize(usedWidth, y + shelfHeight);
+}
+
+/// The css class of the sprite, e.g. fa-solid-house-32, fa-solid-house-32-ff0000-2x
+static QString cssClass(const QString& prefix, const Sprite& sprite, bool withColor)
+{
+    QString result = QString("%1-%2-%3-%4").arg(prefix, sprite.style, sprite.name).arg(sprite.size);
+    if (withColor) result += "-" + sprite.color.name().mid(1);
+    if (!qFuzzyCompare(sprite.dpr, 1.0)) result += "-" + QString::number(sprite.dpr).replace('.', '_') + "x";
+    return result;
+}
+
+static bool writeFile(const QString& fileName, const QByteArray& data)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+    return file.write(data) == data.size();
+}
+
+/// The animation types by name
+static bool animationType(const QString& name, fa::QtAwesomeAnimation::Type* type)
+{
+    static const char* const names[] = { "spin", "pulse", "beat", "fade", "bounce", "shake", "flip" };
+    for (int i = 0; i < static_cast<int>(sizeof(names) / sizeof(names[0])); ++i) {
+        if (name == QLatin1String(names[i])) {
+            *type = static_cast<fa::QtAwesomeAnimation::Type>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/// The CRC-32 of the PNG chunks
+static quint32 crc32(const QByteArray& data)
+{
+    static quint32 table[256];
+    static bool initialized = false;
+    if (!initialized) {
+        for (quint32 n = 0; n < 256; ++n) {
+            quint32 c = n;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        initialized = true;
+    }
+
+    quint32 crc = 0xffffffffu;
+    for (char byte : data) {
+        crc = table[(crc ^ static_cast<quint8>(byte)) & 0xff] ^ (crc >> 8);
+    }
+    return crc ^ 0xffffffffu;
+}
+
+static QByteArray bigEndian32(quint32 value)
+{
+    uchar buffer[4];
+    qToBigEndian<quint32>(value, buffer);
+    return QByteArray(reinterpret_cast<const char*>(buffer), 4);
+}
+
+static QByteArray bigEndian16(quint16 value)
+{
+    uchar buffer[2];
+    qToBigEndian<quint16>(value, buffer);
+    return QByteArray(reinterpret_cast<const char*>(buffer), 2);
+}
+
+/// A chunk of a PNG file
+struct PngChunk
+{
+    QByteArray type;     ///< the chunk type, e.g. IDAT
+    QByteArray data;     ///< the chunk data
+};
+
+/// Splits a PNG file in its chunks
+static QVector<PngChunk> pngChunks(const QByteArray& png)
+{
+    QVector<PngChunk> result;
+    int offset = 8;   // the signature
+    while (offset + 12 <= png.size()) {
+        quint32 length = qFromBigEndian<quint32>(reinterpret_cast<const uchar*>(png.constData() + offset));
+        if (length > static_cast<quint32>(png.size() - offset - 12)) break;
+
+        PngChunk chunk;
+        chunk.type = png.mid(offset + 4, 4);
+        chunk.data = png.mid(offset + 8, static_cast<int>(length));
+        result.append(chunk);
+        offset += 12 + static_cast<int>(length);
+    }
+    return result;
+}
+
+static void appendChunk(QByteArray& png, const QByteArray& type, const QByteArray& data)
+{
+    png += bigEndian32(static_cast<quint32>(data.size()));
+    png += type;
+    png += data;
+    png += bigEndian32(crc32(type + data));
+}
+
+static quint64 greatestCommonDivisor(quint64 a, quint64 b)
+{
+    while (b != 0) {
+        quint64 remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+/// Combines the PNG frames in an animated PNG, the first frame is the default image
+/// Every frame replaces the whole canvas (no disposal, source blending), the animation loops forever.
+/// The frame delay is the fraction duration / frame count of a second, so the animation plays exactly its duration.
+/// When the reduced fraction doesn't fit in 16 bits, the delays are whole milliseconds up to the next frame time,
+/// the rounding is carried over to the next frame.
+/// @param duration the duration of the animation in milliseconds
+static QByteArray assembleApng(const QVector<Frame>& frames, int duration)
+{
+    quint64 delayNumerator = static_cast<quint64>(qMax(1, duration));
+    quint64 delayDenominator = 1000ull * static_cast<quint64>(frames.size());
+    quint64 divisor = greatestCommonDivisor(delayNumerator, delayDenominator);
+    delayNumerator /= divisor;
+    delayDenominator /= divisor;
+    bool exactDelay = delayNumerator <= 0xffff && delayDenominator <= 0xffff;
+
+    QByteArray result("\x89PNG\r\n\x1a\n", 8);
+    quint32 sequenceNumber = 0;
+    for (int i = 0; i < frames.size(); ++i) {
+        bool frameControlWritten = false;
+        for (const PngChunk& chunk : pngChunks(frames.at(i).png)) {
+            if (chunk.type == "IDAT") {
+                if (!frameControlWritten) {
+                    quint16 delayNum = static_cast<quint16>(delayNumerator);
+                    quint16 delayDen = static_cast<quint16>(delayDenominator);
+                    if (!exactDelay) {
+                        qint64 next = i + 1 < frames.size() ? frames.at(i + 1).time : duration;
+                        delayNum = static_cast<quint16>(qBound<qint64>(0, next - frames.at(i).time, 0xffff));
+                        delayDen = 1000;
+                    }
+                    QByteArray frameControl = bigEndian32(sequenceNumber++)
+                                              + bigEndian32(static_cast<quint32>(frames.at(i).image.width()))
+                                              + bigEndian32(static_cast<quint32>(frames.at(i).image.height()))
+                                              + bigEndian32(0) + bigEndian32(0)
+                                              + bigEndian16(delayNum) + bigEndian16(delayDen)
+                                              + QByteArray(2, '\0');   // APNG_DISPOSE_OP_NONE, APNG_BLEND_OP_SOURCE
+                    appendChunk(result, "fcTL", frameControl);
+                    frameControlWritten = true;
+                }
+                if (i == 0) {
+                    appendChunk(result, "IDAT", chunk.data);
+                } else {
+                    appendChunk(result, "fdAT", bigEndian32(sequenceNumber++) + chunk.data);
+                }
+            } else if (i == 0 && chunk.type != "IEND") {
+                // the header and ancillary chunks of the first frame, the animation control follows the header
+                appendChunk(result, chunk.type, chunk.data);
+                if (chunk.type == "IHDR") {
+                    appendChunk(result, "acTL", bigEndian32(static_cast<quint32>(frames.size())) + bigEndian32(0));
+                }
+            }
+        }
+    }
+    appendChunk(result, "IEND", QByteArray());
+    return result;
+}
+
+/// Renders the animation of every sprite, as APNG or PNG sequence
+static int writeAnimations(fa::QtAwesome* awesome, const QVector<Sprite>& sprites, const QCommandLineParser& parser,
+                           bool withColor)
+{
+    fa::QtAwesomeAnimation::Type type;
+    if (!animationType(parser.value("animate"), &type)) {
+        err() << "Unknown animation: " << parser.value("animate") << "\n";
+        return 1;
+    }
+
+    fa::QtAwesomeAnimation animation(nullptr, type, parser.isSet("duration") ? parser.value("duration").toInt() : -1);
+    int fps = qBound(1, parser.value("fps").toInt(), 100);
+    int frameCount = qMax(1, qRound(animation.duration() * fps / 1000.0));
+
+    QString base = parser.value("output");
+    QString prefix = parser.value("prefix");
+    for (const Sprite& sprite : sprites) {
+        QVariantMap options;
+        options.insert("color", sprite.color);
+
+        // the glyph is rendered once, at twice the size so scaled frames stay sharp
+        int pixelSize = qRound(sprite.size * sprite.dpr);
+        QImage glyph = awesome->image(sprite.id, QSize(pixelSize * 2, pixelSize * 2), options);
+
+        QVector<Frame> frames(frameCount);
+        for (int i = 0; i < frameCount; ++i) {
+            frames[i].time = static_cast<qint64>(i) * animation.duration() / frameCount;
+            QThreadPool::globalInstance()->start(new FrameRenderer(animation, glyph, QSize(pixelSize, pixelSize), &frames[i]));
+        }
+        QThreadPool::globalInstance()->waitForDone();
+
+        QString name = base + "-" + cssClass(prefix, sprite, withColor);
+        if (parser.isSet("sequence")) {
+            for (int i = 0; i < frameCount; ++i) {
+                QString fileName = QString("%1-%2.png").arg(name).arg(i, 3, 10, QChar('0'));
+                if (!writeFile(fileName, frames.at(i).png)) {
+                    err() << "Can't write " << fileName << "\n";
+                    return 1;
+                }
+            }
+        } else if (!writeFile(name + ".png", assembleApng(frames, animation.duration()))) {
+            err() << "Can't write " << name << ".png\n";
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    // render without a display
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("qtawesome-render");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Renders font awesome icons to a PNG sprite sheet, with a JSON and CSS index");
+    parser.addHelpOption();
+    parser.addPositionalArgument("icons", "The icon names, e.g. \"fa-solid fa-house\" or brands/github", "[icons...]");
+    parser.addOption(QCommandLineOption("icons", "Read the icon names from <file>, one name per line", "file"));
+    parser.addOption(QCommandLineOption("size", "The icon sizes in css pixels (default 32)", "sizes"));
+    parser.addOption(QCommandLineOption("color", "The icon colors (default #000000)", "colors"));
+    parser.addOption(QCommandLineOption("dpr", "The device pixel ratios (default 1)", "ratios"));
+    parser.addOption(QCommandLineOption("padding", "The space between the sprites in pixels (default 1)", "pixels", "1"));
+    parser.addOption(QCommandLineOption("output", "Writes <base>.png, <base>.json and <base>.css (default sprites)", "base", "sprites"));
+    parser.addOption(QCommandLineOption("prefix", "The css class prefix (default fa)", "prefix", "fa"));
+    parser.addOption(QCommandLineOption("font-dir", "Load the fonts from <directory> instead of the embedded fonts", "directory"));
+    parser.addOption(QCommandLineOption("threads", "The number of render threads (default the number of cores)", "count"));
+    parser.addOption(QCommandLineOption("bundle", "Write the icon outlines to the icon bundle <file> instead of a sprite sheet", "file"));
+    parser.addOption(QCommandLineOption("animate", "Write an animated PNG per icon instead of a sprite sheet, <type> is "
+                                        "spin, pulse, beat, fade, bounce, shake or flip", "type"));
+    parser.addOption(QCommandLineOption("duration", "The duration of the animation in milliseconds (default the Font Awesome duration)", "ms"));
+    parser.addOption(QCommandLineOption("fps", "The frames per second of the animation (default 30)", "fps", "30"));
+    parser.addOption(QCommandLineOption("sequence", "Write the animation frames as PNG sequence (<base>-<class>-000.png) instead of an APNG"));
+    parser.process(app);
+
+    QStringList names = parser.positionalArguments();
+    if (parser.isSet("icons") && !readIconNames(parser.value("icons"), names)) {
+        err() << "Can't read " << parser.value("icons") << "\n";
+        return 1;
+    }
+    if (names.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    QStringList sizes = listOption(parser, "size");
+    QStringList colors = listOption(parser, "color");
+    QStringList ratios = listOption(parser, "dpr");
+    if (sizes.isEmpty()) sizes.append("32");
+    if (colors.isEmpty()) colors.append("#000000");
+    if (ratios.isEmpty()) ratios.append("1");
+
+    if (parser.isSet("threads")) {
+        QThreadPool::globalInstance()->setMaxThreadCount(qMax(1, parser.value("threads").toInt()));
+    }
+
+    fa::QtAwesome* awesome = new fa::QtAwesome(&app);
+    if (parser.isSet("font-dir")) {
+        awesome->setFontDirectory(parser.value("font-dir"));
+    }
+    if (!awesome->initFontAwesome()) {
+        err() << "Can't load the font awesome fonts\n";
+        return 1;
+    }
+
+    // a sprite for every icon, size, color and device pixel ratio
+    QVector<Sprite> sprites;
+    QVector<fa::IconId> bundleIcons;
+    for (const QString& fullName : names) {
+        QStringList parts = QString(fullName).replace('/', ' ').simplified().split(' ');
+        Sprite sprite;
+        sprite.name = withoutFaPrefix(parts.last());
+
+        // a name without style is looked up in every style, the sprite uses the first match
+        QStringList styles = parts.size() > 1 ? QStringList(withoutFaPrefix(parts.first())) : iconStyles();
+        for (const QString& style : styles) {
+            fa::IconId id = awesome->iconId(style + " " + sprite.name);
+            if (!id.isValid()) continue;
+
+            if (!sprite.id.isValid()) {
+                sprite.style = style;
+                sprite.id = id;
+            }
+            if (parser.isSet("bundle")) bundleIcons.append(id);   // every style, like the icon subset
+        }
+        if (!sprite.id.isValid()) {
+            err() << "Unknown icon: " << fullName << "\n";
+            return 1;
+        }
+        if (parser.isSet("bundle")) continue;
+
+        for (const QString& size : sizes) {
+            for (const QString& color : colors) {
+                for (const QString& ratio : ratios) {
+                    sprite.size = size.toInt();
+                    sprite.color = QColor(color);
+                    sprite.dpr = ratio.toDouble();
+                    if (sprite.size <= 0 || !sprite.color.isValid() || sprite.dpr <= 0) {
+                        err() << "Invalid size, color or dpr: " << size << " " << color << " " << ratio << "\n";
+                        return 1;
+                    }
+                    sprites.append(sprite);
+                }
+            }
+        }
+    }
+
+    if (parser.isSet("bundle")) {
+        if (!awesome->writeBundle(parser.value("bundle"), bundleIcons)) {
+            err() << "Can't write the icon bundle " << parser.value("bundle") << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (parser.isSet("animate")) {
+        return writeAnimations(awesome, sprites, parser, colors.size() > 1);
+    }
+
+    // render the sprites in parallel, the vector isn't resized while rendering
+    for (Sprite& sprite : sprites) {
+        QThreadPool::globalInstance()->start(new SpriteRenderer(awesome, &sprite));
+    }
+    QThreadPool::globalInstance()->waitForDone();
+
+    int padding = qMax(0, parser.value("padding").toInt());
+    QSize sheetSize = packSprites(sprites, padding);
+
+    QImage sheet(sheetSize, QImage::Format_ARGB32_Premultiplied);
+    sheet.fill(Qt::transparent);
+    {
+        QPainter painter(&sheet);
+        for (const Sprite& sprite : sprites) {
+            painter.drawImage(sprite.position, sprite.image);
+        }
+    }
+
+    QString base = parser.value("output");
+    QString imageName = QFileInfo(base + ".png").fileName();
+    if (!sheet.save(base + ".png", "PNG")) {
+        err() << "Can't write " << base << ".png\n";
+        return 1;
+    }
+
+    // the index
+    QString prefix = parser.value("prefix");
+    bool withColor = colors.size() > 1;
+
+    QJsonArray spriteArray;
+    QString css;
+    QTextStream cssStream(&css);
+    for (const Sprite& sprite : sprites) {
+        QJsonObject object;
+        object.insert("name", QString("fa-%1 fa-%2").arg(sprite.style, sprite.name));
+        object.insert("class", cssClass(prefix, sprite, withColor));
+        object.insert("size", sprite.size);
+        object.insert("color", sprite.color.name(QColor::HexArgb));
+        object.insert("dpr", sprite.dpr);
+        object.insert("x", sprite.position.x());
+        object.insert("y", sprite.position.y());
+        object.insert("width", sprite.image.width());
+        object.insert("height", sprite.image.height());
+        spriteArray.append(object);
+
+        // css pixels, the sheet is scaled down for high dpr sprites
+        cssStream << "." << cssClass(prefix, sprite, withColor) << " {"
+                  << " width: " << sprite.size << "px;"
+                  << " height: " << sprite.size << "px;"
+                  << " background-image: url(" << imageName << ");"
+                  << " background-position: " << -sprite.position.x() / sprite.dpr << "px " << -sprite.position.y() / sprite.dpr << "px;"
+                  << " background-size: " << sheetSize.width() / sprite.dpr << "px " << sheetSize.height() / sprite.dpr << "px;"
+                  << " background-repeat: no-repeat; }\n";
+    }
+    cssStream.flush();
+
+    QJsonObject index;
+    index.insert("image", imageName);
+    index.insert("width", sheetSize.width());
+    index.insert("height", sheetSize.height());
+    index.insert("sprites", spriteArray);
+
+    if (!writeFile(base + ".json", QJsonDocument(index).toJson()) || !writeFile(base + ".css", css.toUtf8())) {
+        err() << "Can't write the index files " << base << ".json/.css\n";
+        return 1;
+    }
+
+    return 0;
+}
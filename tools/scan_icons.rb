@@ -0,0 +1,73 @@
+#!/usr/bin/env ruby
+
+# This script scans source files for the icons that are used, and writes the icon manifest
+# that is consumed by build_headers.rb --subset (QTAWESOME_ICON_SUBSET).
+#
+# It detects:
+# - enum references, e.g.  fa::fa_house
+# - string names passed to QtAwesome::icon, e.g.  awesome->icon("fa-solid fa-house")
+# - compile-time icon literals, e.g.  "fa-solid fa-house"_fa  and  fa::named<"house">()
+#
+# Usage: scan_icons.rb --output icons.txt <source dirs or files>...
+#
+# The output file is only written when its content changes, so a rebuild is only triggered when
+# the set of used icons changes.
+require 'optparse'
+
+SOURCE_EXTENSIONS = %w[.c .cc .cpp .cxx .h .hh .hpp .hxx .ui .qml .js].freeze
+
+STYLE_NAMES = %w[
+  solid regular brands light thin duotone
+  duotone-solid duotone-regular duotone-light duotone-thin
+  sharp-solid sharp-regular sharp-light sharp-thin
+  sharp-duotone-solid sharp-duotone-regular sharp-duotone-light sharp-duotone-thin
+].freeze
+
+# fa:: identifiers that aren't icons
+NON_ICON_IDS = (STYLE_NAMES.map { |style| "fa_#{style.tr('-', '_')}" } +
+                %w[fa_styles fa_common_icons fa_brand_icons fa_pro_icons]).freeze
+
+ENUM_PATTERN = /\bfa::(fa_[a-z0-9_]+)\b/.freeze
+ICON_CALL_PATTERN = /\bicon\s*\(\s*(?:QStringLiteral\s*\(\s*|QLatin1String\s*\(\s*)?"([^"\\]+)"/.freeze
+LITERAL_PATTERN = /"([^"\\]+)"_fa\b|\bnamed\s*<\s*"([^"\\]+)"/.freeze
+STYLED_NAME_PATTERN = /"(?:fa[-_])?(?:#{STYLE_NAMES.join('|')})\s+(?:fa-)?([a-z0-9-]+)"/.freeze
+
+def source_files(paths)
+  paths.flat_map do |path|
+    if File.directory?(path)
+      Dir.glob("#{path}/**/*").select { |file| File.file?(file) && SOURCE_EXTENSIONS.include?(File.extname(file)) }
+                               .reject { |file| File.basename(file).match?(/\AQtAwesome\w*Generated\.h\z/) }
+    else
+      [path]
+    end
+  end
+end
+
+def icon_name(name)
+  name.split(/\s+/).last.sub(/\Afa-/, '')
+end
+
+def scan(file)
+  content = File.read(file, encoding: 'UTF-8', invalid: :replace, undef: :replace)
+  names = []
+  content.scan(ENUM_PATTERN).each do |(id)|
+    names << id.sub(/\Afa_/, '').tr('_', '-') unless NON_ICON_IDS.include?(id)
+  end
+  content.scan(ICON_CALL_PATTERN).each { |(name)| names << icon_name(name) }
+  content.scan(LITERAL_PATTERN).each { |literal, named| names << icon_name(literal || named) }
+  content.scan(STYLED_NAME_PATTERN).each { |(name)| names << name }
+  names
+end
+
+output = nil
+OptionParser.new do |opts|
+  opts.banner = "Usage: scan_icons.rb --output FILE <source dirs or files>..."
+  opts.on('--output FILE', 'The icon manifest to write') { |file| output = file }
+end.parse!
+
+abort("scan_icons.rb: --output is required") unless output
+
+names = source_files(ARGV).flat_map { |file| scan(file) }.uniq.sort
+manifest = "# generated by scan_icons.rb, do not edit\n" + names.map { |name| "#{name}\n" }.join
+
+File.write(output, manifest) unless File.exist?(output) && File.read(output) == manifest